@@ -2,6 +2,8 @@
  drake::geometry::optimization namespace. They can be found in the
  pydrake.geometry.optimization module. */
 
+#include "pybind11/functional.h"
+
 #include "drake/bindings/pydrake/common/default_scalars_pybind.h"
 #include "drake/bindings/pydrake/common/deprecation_pybind.h"
 #include "drake/bindings/pydrake/common/identifier_pybind.h"
@@ -121,6 +123,8 @@ void DefineGeometryOptimization(py::module m) {
             py::arg("reference_frame") = std::nullopt, cls_doc.ctor.doc_3args)
         .def("A", &HPolyhedron::A, cls_doc.A.doc)
         .def("b", &HPolyhedron::b, cls_doc.b.doc)
+        .def("PointsInSet", &HPolyhedron::PointsInSet, py::arg("x"),
+            py::arg("tol") = 0, cls_doc.PointsInSet.doc)
         .def("ContainedIn", &HPolyhedron::ContainedIn, py::arg("other"),
             py::arg("tol") = 1E-9, cls_doc.ContainedIn.doc)
         .def("Intersection", &HPolyhedron::Intersection, py::arg("other"),
@@ -303,6 +307,8 @@ void DefineGeometryOptimization(py::module m) {
           doc.IrisOptions.num_additional_constraint_infeasible_samples.doc)
       .def_readwrite("random_seed", &IrisOptions::random_seed,
           doc.IrisOptions.random_seed.doc)
+      .def_readwrite("num_threads", &IrisOptions::num_threads,
+          doc.IrisOptions.num_threads.doc)
       .def("__repr__", [](const IrisOptions& self) {
         return py::str(
             "IrisOptions("
@@ -314,7 +320,8 @@ void DefineGeometryOptimization(py::module m) {
             "num_collision_infeasible_samples={}, "
             "prog_with_additional_constraints {}, "
             "num_additional_constraint_infeasible_samples={}, "
-            "random_seed={}"
+            "random_seed={}, "
+            "num_threads={}"
             ")")
             .format(self.require_sample_point_is_contained,
                 self.iteration_limit, self.termination_threshold,
@@ -323,7 +330,7 @@ void DefineGeometryOptimization(py::module m) {
                 self.num_collision_infeasible_samples,
                 self.prog_with_additional_constraints ? "is set" : "is not set",
                 self.num_additional_constraint_infeasible_samples,
-                self.random_seed);
+                self.random_seed, self.num_threads);
       });
 
   m.def("Iris", &Iris, py::arg("obstacles"), py::arg("sample"),
@@ -337,7 +344,21 @@ void DefineGeometryOptimization(py::module m) {
           const systems::Context<double>&, const IrisOptions&>(
           &IrisInConfigurationSpace),
       py::arg("plant"), py::arg("context"), py::arg("options") = IrisOptions(),
-      doc.IrisInConfigurationSpace.doc);
+      doc.IrisInConfigurationSpace.doc_3args);
+
+  m.def("IrisInConfigurationSpace",
+      py::overload_cast<const multibody::MultibodyPlant<double>&,
+          const systems::Context<double>&, const std::vector<Eigen::VectorXd>&,
+          const IrisOptions&,
+          const std::function<void(int, int, const HPolyhedron&)>&>(
+          &IrisInConfigurationSpace),
+      py::arg("plant"), py::arg("root_context"), py::arg("seeds"),
+      py::arg("options") = IrisOptions(),
+      py::arg("progress_callback") = nullptr,
+      // Releasing the GIL lets the progress callback be called from the
+      // worker threads.
+      py::call_guard<py::gil_scoped_release>(),
+      doc.IrisInConfigurationSpace.doc_5args);
 
   // GraphOfConvexSetsOptions
   {
@@ -361,6 +382,9 @@ void DefineGeometryOptimization(py::module m) {
             cls_doc.flow_tolerance.doc)
         .def_readwrite("rounding_seed",
             &GraphOfConvexSetsOptions::rounding_seed, cls_doc.rounding_seed.doc)
+        .def_readwrite("max_rounding_threads",
+            &GraphOfConvexSetsOptions::max_rounding_threads,
+            cls_doc.max_rounding_threads.doc)
         .def("__repr__", [](const GraphOfConvexSetsOptions& self) {
           return py::str(
               "GraphOfConvexSetsOptions("
@@ -370,13 +394,14 @@ void DefineGeometryOptimization(py::module m) {
               "max_rounding_trials={}, "
               "flow_tolerance={}, "
               "rounding_seed={}, "
+              "max_rounding_threads={}, "
               "solver={}, "
               "solver_options={}, "
               ")")
               .format(self.convex_relaxation, self.preprocessing,
                   self.max_rounded_paths, self.max_rounding_trials,
-                  self.flow_tolerance, self.rounding_seed, self.solver,
-                  self.solver_options);
+                  self.flow_tolerance, self.rounding_seed,
+                  self.max_rounding_threads, self.solver, self.solver_options);
         });
 
     DefReadWriteKeepAlive(&gcs_options, "solver",
@@ -385,6 +410,28 @@ void DefineGeometryOptimization(py::module m) {
         &GraphOfConvexSetsOptions::solver_options, cls_doc.solver_options.doc);
   }
 
+  // GraphOfConvexSetsStatistics
+  {
+    const auto& cls_doc = doc.GraphOfConvexSetsStatistics;
+    py::class_<GraphOfConvexSetsStatistics>(
+        m, "GraphOfConvexSetsStatistics", cls_doc.doc)
+        .def(py::init<>())
+        .def_readwrite("setup_time", &GraphOfConvexSetsStatistics::setup_time,
+            cls_doc.setup_time.doc)
+        .def_readwrite("relaxation_time",
+            &GraphOfConvexSetsStatistics::relaxation_time,
+            cls_doc.relaxation_time.doc)
+        .def_readwrite("rounding_time",
+            &GraphOfConvexSetsStatistics::rounding_time,
+            cls_doc.rounding_time.doc)
+        .def_readwrite("num_rounded_paths",
+            &GraphOfConvexSetsStatistics::num_rounded_paths,
+            cls_doc.num_rounded_paths.doc)
+        .def_readwrite("postprocessing_time",
+            &GraphOfConvexSetsStatistics::postprocessing_time,
+            cls_doc.postprocessing_time.doc);
+  }
+
   // GraphOfConvexSets
   {
     const auto& cls_doc = doc.GraphOfConvexSets;
@@ -460,19 +507,23 @@ void DefineGeometryOptimization(py::module m) {
             .def("SolveShortestPath",
                 overload_cast_explicit<solvers::MathematicalProgramResult,
                     GraphOfConvexSets::VertexId, GraphOfConvexSets::VertexId,
-                    const GraphOfConvexSetsOptions&>(
+                    const GraphOfConvexSetsOptions&,
+                    GraphOfConvexSetsStatistics*>(
                     &GraphOfConvexSets::SolveShortestPath),
                 py::arg("source_id"), py::arg("target_id"),
                 py::arg("options") = GraphOfConvexSetsOptions(),
+                py::arg("statistics") = nullptr,
                 cls_doc.SolveShortestPath.doc_by_id)
             .def("SolveShortestPath",
                 overload_cast_explicit<solvers::MathematicalProgramResult,
                     const GraphOfConvexSets::Vertex&,
                     const GraphOfConvexSets::Vertex&,
-                    const GraphOfConvexSetsOptions&>(
+                    const GraphOfConvexSetsOptions&,
+                    GraphOfConvexSetsStatistics*>(
                     &GraphOfConvexSets::SolveShortestPath),
                 py::arg("source"), py::arg("target"),
                 py::arg("options") = GraphOfConvexSetsOptions(),
+                py::arg("statistics") = nullptr,
                 cls_doc.SolveShortestPath.doc_by_reference);
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
@@ -252,6 +252,8 @@ void DoScalarIndependentDefinitions(py::module m) {
             py::overload_cast<std::string_view,
                 const Eigen::Ref<const Eigen::Matrix4d>&>(&Class::SetTransform),
             py::arg("path"), py::arg("matrix"), cls_doc.SetTransform.doc_matrix)
+        .def("SetTransforms", &Class::SetTransforms, py::arg("paths"),
+            py::arg("X_ParentPaths"), cls_doc.SetTransforms.doc)
         .def("Delete", &Class::Delete, py::arg("path") = "", cls_doc.Delete.doc)
         .def("SetRealtimeRate", &Class::SetRealtimeRate, py::arg("rate"),
             cls_doc.SetRealtimeRate.doc)
@@ -333,6 +335,8 @@ void DoScalarIndependentDefinitions(py::module m) {
         .def("repetitions", &Class::repetitions, cls_doc.repetitions.doc)
         .def("clamp_when_finished", &Class::clamp_when_finished,
             cls_doc.clamp_when_finished.doc)
+        .def("decimation_tolerance", &Class::decimation_tolerance,
+            cls_doc.decimation_tolerance.doc)
         .def("set_autoplay", &Class::set_autoplay, py::arg("play"),
             cls_doc.set_autoplay.doc)
         .def("set_loop_mode", &Class::set_loop_mode, py::arg("mode"),
@@ -341,6 +345,8 @@ void DoScalarIndependentDefinitions(py::module m) {
             cls_doc.set_repetitions.doc)
         .def("set_clamp_when_finished", &Class::set_clamp_when_finished,
             py::arg("clamp"), cls_doc.set_clamp_when_finished.doc)
+        .def("set_decimation_tolerance", &Class::set_decimation_tolerance,
+            py::arg("tolerance"), cls_doc.set_decimation_tolerance.doc)
         .def("SetTransform", &Class::SetTransform, py::arg("frame"),
             py::arg("path"), py::arg("X_ParentPath"), cls_doc.SetTransform.doc)
         .def("SetProperty",
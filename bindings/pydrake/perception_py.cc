@@ -1,12 +1,17 @@
+#include <limits>
+#include <vector>
+
 #include "pybind11/eigen.h"
 #include "pybind11/operators.h"
 #include "pybind11/pybind11.h"
+#include "pybind11/stl.h"
 
 #include "drake/bindings/pydrake/common/cpp_param_pybind.h"
 #include "drake/bindings/pydrake/common/value_pybind.h"
 #include "drake/bindings/pydrake/documentation_pybind.h"
 #include "drake/bindings/pydrake/pydrake_pybind.h"
 #include "drake/perception/depth_image_to_point_cloud.h"
+#include "drake/perception/depth_images_to_fused_point_cloud.h"
 #include "drake/perception/point_cloud.h"
 #include "drake/perception/point_cloud_to_lcm.h"
 
@@ -123,10 +128,29 @@ void init_perception(py::module m) {
             cls_doc.Crop.doc)
         .def("FlipNormalsTowardPoint", &Class::FlipNormalsTowardPoint,
             py::arg("p_CP"), cls_doc.FlipNormalsTowardPoint.doc)
-        .def("VoxelizedDownSample", &Class::VoxelizedDownSample,
-            py::arg("voxel_size"), cls_doc.VoxelizedDownSample.doc)
+        .def("VoxelizedDownSample",
+            py::overload_cast<double, int>(
+                &Class::VoxelizedDownSample, py::const_),
+            py::arg("voxel_size"), py::arg("num_threads") = 1,
+            cls_doc.VoxelizedDownSample.doc_2args)
         .def("EstimateNormals", &Class::EstimateNormals, py::arg("radius"),
-            py::arg("num_closest"), cls_doc.EstimateNormals.doc);
+            py::arg("num_closest"), py::arg("num_threads") = 1,
+            cls_doc.EstimateNormals.doc)
+        .def(
+            "FindNearestNeighbors",
+            [](const Class& self,
+                const Eigen::Ref<const Matrix3X<float>>& queries,
+                int num_closest, int num_threads) {
+              MatrixX<float> squared_distances;
+              Eigen::MatrixXi indices = self.FindNearestNeighbors(
+                  queries, num_closest, num_threads, &squared_distances);
+              return std::make_pair(indices, squared_distances);
+            },
+            py::arg("queries"), py::arg("num_closest"),
+            py::arg("num_threads") = 1, cls_doc.FindNearestNeighbors.doc)
+        .def("FindNeighborsWithinRadius", &Class::FindNeighborsWithinRadius,
+            py::arg("queries"), py::arg("radius"), py::arg("num_threads") = 1,
+            cls_doc.FindNeighborsWithinRadius.doc);
   }
 
   AddValueInstantiation<PointCloud>(m);
@@ -139,11 +163,12 @@ void init_perception(py::module m) {
     py::class_<Class, LeafSystem<double>>(
         m, "DepthImageToPointCloud", cls_doc.doc)
         .def(py::init<const CameraInfo&, PixelType, float,
-                 pc_flags::BaseFieldT>(),
+                 pc_flags::BaseFieldT, bool, int>(),
             py::arg("camera_info"),
             py::arg("pixel_type") = PixelType::kDepth32F,
             py::arg("scale") = 1.0, py::arg("fields") = pc_flags::kXYZs,
-            cls_doc.ctor.doc)
+            py::arg("drop_invalid_points") = false,
+            py::arg("pixel_stride") = 1, cls_doc.ctor.doc)
         .def("depth_image_input_port", &Class::depth_image_input_port,
             py_rvp::reference_internal, cls_doc.depth_image_input_port.doc)
         .def("color_image_input_port", &Class::color_image_input_port,
@@ -154,6 +179,36 @@ void init_perception(py::module m) {
             py_rvp::reference_internal, cls_doc.point_cloud_output_port.doc);
   }
 
+  {
+    using Class = DepthImagesToFusedPointCloud;
+    constexpr auto& cls_doc = doc.DepthImagesToFusedPointCloud;
+    constexpr double kInf = std::numeric_limits<double>::infinity();
+    py::class_<Class, LeafSystem<double>>(
+        m, "DepthImagesToFusedPointCloud", cls_doc.doc)
+        .def(py::init<std::vector<CameraInfo>, PixelType, float,
+                 pc_flags::BaseFieldT, const Eigen::Vector3d&,
+                 const Eigen::Vector3d&, double, int>(),
+            py::arg("camera_infos"),
+            py::arg("pixel_type") = PixelType::kDepth32F,
+            py::arg("scale") = 1.0, py::arg("fields") = pc_flags::kXYZs,
+            py::arg("lower_xyz") = Eigen::Vector3d::Constant(-kInf),
+            py::arg("upper_xyz") = Eigen::Vector3d::Constant(kInf),
+            py::arg("voxel_size") = 0.0, py::arg("num_threads") = 1,
+            cls_doc.ctor.doc)
+        .def("num_cameras", &Class::num_cameras, cls_doc.num_cameras.doc)
+        .def("depth_image_input_port", &Class::depth_image_input_port,
+            py::arg("i"), py_rvp::reference_internal,
+            cls_doc.depth_image_input_port.doc)
+        .def("color_image_input_port", &Class::color_image_input_port,
+            py::arg("i"), py_rvp::reference_internal,
+            cls_doc.color_image_input_port.doc)
+        .def("camera_pose_input_port", &Class::camera_pose_input_port,
+            py::arg("i"), py_rvp::reference_internal,
+            cls_doc.camera_pose_input_port.doc)
+        .def("point_cloud_output_port", &Class::point_cloud_output_port,
+            py_rvp::reference_internal, cls_doc.point_cloud_output_port.doc);
+  }
+
   {
     using Class = PointCloudToLcm;
     constexpr auto& cls_doc = doc.PointCloudToLcm;
@@ -867,6 +867,19 @@ class TestMathematicalProgram(unittest.TestCase):
         prog.AddLinearEqualityConstraint(
             2 * x[:2] + np.array([0, 1]), np.array([3, 2]))
 
+        A_sparse = scipy.sparse.csc_matrix(np.array([[1., 2.], [0., 1.]]))
+        binding = prog.AddLinearConstraint(
+            A=A_sparse, lb=np.zeros(2), ub=np.ones(2), vars=x)
+        self.assertEqual(binding.evaluator().get_sparse_A().nnz, 3)
+        binding = prog.AddLinearConstraint(
+            A=A_sparse, lb=np.zeros(2), ub=np.ones(2), var_indices=[1, 0])
+        self.assertEqual(binding.variables()[0].get_id(), x[1].get_id())
+        prog.AddLinearEqualityConstraint(
+            Aeq=A_sparse, beq=np.zeros(2), vars=x)
+        binding = prog.AddLinearEqualityConstraint(
+            Aeq=A_sparse, beq=np.zeros(2), var_indices=[0, 1])
+        self.assertEqual(binding.evaluator().get_sparse_A().nnz, 3)
+
     def test_constraint_set_bounds(self):
         prog = mp.MathematicalProgram()
         x = prog.NewContinuousVariables(2, "x")
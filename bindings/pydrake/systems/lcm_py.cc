@@ -205,6 +205,29 @@ PYBIND11_MODULE(lcm, m) {
             py::keep_alive<1, 4>(), cls_doc.ctor.doc_4args);
   }
 
+  {
+    using Class = LcmSubscriberStatistics;
+    constexpr auto& cls_doc = doc.LcmSubscriberStatistics;
+    py::class_<Class>(m, "LcmSubscriberStatistics", cls_doc.doc)
+        .def(py::init<>())
+        .def_readwrite(
+            "num_received", &Class::num_received, cls_doc.num_received.doc)
+        .def_readwrite(
+            "num_processed", &Class::num_processed, cls_doc.num_processed.doc)
+        .def_readwrite(
+            "num_dropped", &Class::num_dropped, cls_doc.num_dropped.doc)
+        .def_readwrite(
+            "num_pending", &Class::num_pending, cls_doc.num_pending.doc)
+        .def_readwrite(
+            "max_pending", &Class::max_pending, cls_doc.max_pending.doc)
+        .def_readwrite(
+            "last_latency", &Class::last_latency, cls_doc.last_latency.doc)
+        .def_readwrite(
+            "mean_latency", &Class::mean_latency, cls_doc.mean_latency.doc)
+        .def_readwrite(
+            "max_latency", &Class::max_latency, cls_doc.max_latency.doc);
+  }
+
   {
     using Class = LcmSubscriberSystem;
     constexpr auto& cls_doc = doc.LcmSubscriberSystem;
@@ -225,7 +248,9 @@ PYBIND11_MODULE(lcm, m) {
             py::keep_alive<1, 4>(), doc.LcmSubscriberSystem.ctor.doc)
         .def("WaitForMessage", &Class::WaitForMessage,
             py::arg("old_message_count"), py::arg("message") = nullptr,
-            py::arg("timeout") = -1, cls_doc.WaitForMessage.doc);
+            py::arg("timeout") = -1, cls_doc.WaitForMessage.doc)
+        .def("GetReceiveStatistics", &Class::GetReceiveStatistics,
+            cls_doc.GetReceiveStatistics.doc);
   }
 
   {
@@ -312,6 +312,24 @@ PYBIND11_MODULE(sensors, m) {
             }));
   }
 
+  {
+    using Class = ImageCompressionParams;
+    constexpr auto& cls_doc = doc.ImageCompressionParams;
+    py::class_<Class> cls(m, "ImageCompressionParams", cls_doc.doc);
+    py::enum_<Class::Method>(cls, "Method", cls_doc.Method.doc)
+        .value("kNone", Class::Method::kNone, cls_doc.Method.kNone.doc)
+        .value("kZlib", Class::Method::kZlib, cls_doc.Method.kZlib.doc)
+        .value("kPng", Class::Method::kPng, cls_doc.Method.kPng.doc);
+    cls  // BR
+        .def(py::init<>())
+        .def_readwrite("method", &Class::method, cls_doc.method.doc)
+        .def_readwrite("level", &Class::level, cls_doc.level.doc)
+        .def_readwrite("run_length_only", &Class::run_length_only,
+            cls_doc.run_length_only.doc)
+        .def_readwrite(
+            "num_threads", &Class::num_threads, cls_doc.num_threads.doc);
+  }
+
   {
     using Class = ImageToLcmImageArrayT;
     constexpr auto& cls_doc = doc.ImageToLcmImageArrayT;
@@ -321,9 +339,18 @@ PYBIND11_MODULE(sensors, m) {
         .def(py::init<const string&, const string&, const string&, bool>(),
             py::arg("color_frame_name"), py::arg("depth_frame_name"),
             py::arg("label_frame_name"), py::arg("do_compress") = false,
-            cls_doc.ctor.doc_4args)
+            cls_doc.ctor
+                .doc_4args_color_frame_name_depth_frame_name_label_frame_name_do_compress)
+        .def(py::init<const string&, const string&, const string&,
+                 const ImageCompressionParams&>(),
+            py::arg("color_frame_name"), py::arg("depth_frame_name"),
+            py::arg("label_frame_name"), py::arg("compression"),
+            cls_doc.ctor
+                .doc_4args_color_frame_name_depth_frame_name_label_frame_name_compression)
         .def(py::init<bool>(), py::arg("do_compress") = false,
-            cls_doc.ctor.doc_1args)
+            cls_doc.ctor.doc_1args_do_compress)
+        .def(py::init<const ImageCompressionParams&>(),
+            py::arg("compression"), cls_doc.ctor.doc_1args_compression)
         .def("color_image_input_port", &Class::color_image_input_port,
             py_rvp::reference_internal, cls_doc.color_image_input_port.doc)
         .def("depth_image_input_port", &Class::depth_image_input_port,
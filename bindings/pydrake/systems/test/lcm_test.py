@@ -195,6 +195,27 @@ class TestSystemsLcm(unittest.TestCase):
                 lcm.HandleSubscriptions(0)
             self.assertEqual(value.get_value().utime, old_message_count + 1)
 
+    def test_subscriber_statistics(self):
+        lcm = DrakeLcm()
+        dut = mut.LcmSubscriberSystem.Make(
+            channel="TEST_CHANNEL", lcm_type=lcmt_quaternion, lcm=lcm)
+        stats = dut.GetReceiveStatistics()
+        self.assertIsInstance(stats, mut.LcmSubscriberStatistics)
+        self.assertEqual(stats.num_received, 0)
+        self.assertTrue(np.isnan(stats.mean_latency))
+        lcm.Publish(channel="TEST_CHANNEL",
+                    buffer=self._model_message().encode())
+        lcm.HandleSubscriptions(0)
+        self._process_event(dut)
+        stats = dut.GetReceiveStatistics()
+        self.assertEqual(stats.num_received, 1)
+        self.assertEqual(stats.num_processed, 1)
+        self.assertEqual(stats.num_dropped, 0)
+        self.assertEqual(stats.num_pending, 0)
+        self.assertEqual(stats.max_pending, 1)
+        self.assertGreaterEqual(stats.last_latency, 0)
+        self.assertGreaterEqual(stats.max_latency, stats.mean_latency)
+
     def _fix_and_publish(self, dut, value):
         context = dut.CreateDefaultContext()
         dut.get_input_port(0).FixValue(context, value)
@@ -259,6 +259,19 @@ class TestSensors(unittest.TestCase):
             self._check_input(port)
         self._check_output(dut.image_array_t_msg_output_port())
 
+        # Test the constructors that take compression parameters.
+        compression = mut.ImageCompressionParams()
+        compression.method = mut.ImageCompressionParams.Method.kPng
+        compression.level = 2
+        compression.run_length_only = True
+        compression.num_threads = 2
+        self.assertEqual(compression.level, 2)
+        dut = mut.ImageToLcmImageArrayT(
+            color_frame_name="color", depth_frame_name="depth",
+            label_frame_name="label", compression=compression)
+        self._check_output(dut.image_array_t_msg_output_port())
+        mut.ImageToLcmImageArrayT(compression=compression)
+
         # Test custom constructor, test functionality (up to getting abstract
         # value).
         dut = mut.ImageToLcmImageArrayT(do_compress=False)
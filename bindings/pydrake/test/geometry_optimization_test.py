@@ -58,6 +58,9 @@ class TestGeometryOptimization(unittest.TestCase):
         np.testing.assert_array_equal(hpoly.A(), self.A)
         np.testing.assert_array_equal(hpoly.b(), self.b)
         self.assertTrue(hpoly.PointInSet(x=[0, 0, 0], tol=0.0))
+        np.testing.assert_array_equal(
+            hpoly.PointsInSet(x=np.array([[0, 0, 0], [10, 0, 0]]).T, tol=0.0),
+            [True, False])
         self.assertFalse(hpoly.IsBounded())
         hpoly.AddPointInSetConstraints(self.prog, self.x)
         constraints = hpoly.AddPointInNonnegativeScalingConstraints(
@@ -411,6 +414,18 @@ class TestGeometryOptimization(unittest.TestCase):
         self.assertTrue(region.PointInSet([1.0]))
         self.assertFalse(region.PointInSet([3.0]))
 
+        options.num_threads = 2
+        progress = []
+        regions = mut.IrisInConfigurationSpace(
+            plant=plant, root_context=context, seeds=[[0], [1]],
+            options=options,
+            progress_callback=lambda index, iteration, region:
+                progress.append(index))
+        self.assertEqual(len(regions), 2)
+        self.assertIsInstance(regions[1], mut.HPolyhedron)
+        self.assertTrue(regions[1].PointInSet([1.0]))
+        self.assertIn(1, progress)
+
     def test_graph_of_convex_sets(self):
         options = mut.GraphOfConvexSetsOptions()
         options.convex_relaxation = True
@@ -419,6 +434,7 @@ class TestGeometryOptimization(unittest.TestCase):
         options.max_rounding_trials = 5
         options.flow_tolerance = 1e-6
         options.rounding_seed = 1
+        options.max_rounding_threads = 2
         options.solver = ClpSolver()
         options.solver_options = SolverOptions()
         self.assertIn("convex_relaxation", repr(options))
@@ -442,6 +458,12 @@ class TestGeometryOptimization(unittest.TestCase):
         self.assertIsInstance(spp.SolveShortestPath(
             source=source, target=target, options=options),
             MathematicalProgramResult)
+        statistics = mut.GraphOfConvexSetsStatistics()
+        self.assertIsInstance(spp.SolveShortestPath(
+            source=source, target=target, options=options,
+            statistics=statistics), MathematicalProgramResult)
+        self.assertGreaterEqual(statistics.relaxation_time, 0)
+        self.assertGreaterEqual(statistics.num_rounded_paths, 1)
 
         with catch_drake_warnings(expected_count=6):
             self.assertIsInstance(spp.SolveShortestPath(
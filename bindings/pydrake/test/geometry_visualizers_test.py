@@ -106,6 +106,8 @@ class TestGeometryVisualizers(unittest.TestCase):
                           rgba=mut.Rgba(.5, .5, .5))
         meshcat.SetTransform(path="/test/box", X_ParentPath=RigidTransform())
         meshcat.SetTransform(path="/test/box", matrix=np.eye(4))
+        meshcat.SetTransforms(paths=["/test/box"],
+                              X_ParentPaths=[RigidTransform()])
         self.assertTrue(meshcat.HasPath("/test/box"))
         cloud = PointCloud(4)
         cloud.mutable_xyzs()[:] = np.zeros((3, 4))
@@ -210,6 +212,9 @@ class TestGeometryVisualizers(unittest.TestCase):
         self.assertEqual(animation.repetitions(), 20)
         animation.set_clamp_when_finished(clamp=False)
         self.assertEqual(animation.clamp_when_finished(), False)
+        self.assertIsNone(animation.decimation_tolerance())
+        animation.set_decimation_tolerance(tolerance=1e-3)
+        self.assertEqual(animation.decimation_tolerance(), 1e-3)
         animation.SetTransform(frame=0, path="test",
                                X_ParentPath=RigidTransform())
         animation.SetProperty(frame=0, path="test", property="bool",
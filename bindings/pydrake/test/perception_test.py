@@ -94,10 +94,22 @@ class TestPerception(unittest.TestCase):
 
         pc_downsampled = pc_merged.VoxelizedDownSample(voxel_size=2.0)
         self.assertIsInstance(pc_downsampled, mut.PointCloud)
+        pc_downsampled = pc_merged.VoxelizedDownSample(
+            voxel_size=2.0, num_threads=2)
+        self.assertIsInstance(pc_downsampled, mut.PointCloud)
 
         self.assertFalse(pc_merged.has_normals())
         pc_merged.EstimateNormals(radius=1, num_closest=50)
         self.assertTrue(pc_merged.has_normals())
+        pc_merged.EstimateNormals(radius=1, num_closest=50, num_threads=2)
+
+        indices, squared_distances = pc.FindNearestNeighbors(
+            queries=np.array(test_xyzs).T, num_closest=1, num_threads=2)
+        np.testing.assert_array_equal(indices, [[0, 1]])
+        np.testing.assert_array_equal(squared_distances, [[0., 0.]])
+        neighbors = pc.FindNeighborsWithinRadius(
+            queries=[[1.], [2.], [3.]], radius=0.5)
+        self.assertEqual(neighbors, [[0]])
 
     def test_depth_image_to_point_cloud_api(self):
         camera_info = CameraInfo(width=640, height=480, fov_y=np.pi / 4)
@@ -110,7 +122,28 @@ class TestPerception(unittest.TestCase):
             camera_info=camera_info,
             pixel_type=PixelType.kDepth16U,
             scale=0.001,
-            fields=mut.BaseField.kXYZs | mut.BaseField.kRGBs)
+            fields=mut.BaseField.kXYZs | mut.BaseField.kRGBs,
+            drop_invalid_points=True,
+            pixel_stride=2)
+
+    def test_depth_images_to_fused_point_cloud_api(self):
+        camera_info = CameraInfo(width=640, height=480, fov_y=np.pi / 4)
+        dut = mut.DepthImagesToFusedPointCloud(
+            camera_infos=[camera_info, camera_info])
+        self.assertEqual(dut.num_cameras(), 2)
+        self.assertIsInstance(dut.depth_image_input_port(i=1), InputPort)
+        self.assertIsInstance(dut.color_image_input_port(i=1), InputPort)
+        self.assertIsInstance(dut.camera_pose_input_port(i=1), InputPort)
+        self.assertIsInstance(dut.point_cloud_output_port(), OutputPort)
+        dut = mut.DepthImagesToFusedPointCloud(
+            camera_infos=[camera_info],
+            pixel_type=PixelType.kDepth16U,
+            scale=0.001,
+            fields=mut.BaseField.kXYZs | mut.BaseField.kRGBs,
+            lower_xyz=[-1, -1, 0],
+            upper_xyz=[1, 1, 2],
+            voxel_size=0.01,
+            num_threads=2)
 
     def test_point_cloud_to_lcm(self):
         dut = mut.PointCloudToLcm(frame_name="world")
@@ -66,8 +66,10 @@ class AutoDiff {
   Do not presume any specific C++ type for the the return value. It will act
   like an Eigen column-vector expression (e.g., Eigen::Block<const VectorXd>),
   but we reserve the right to change the return type for efficiency down the
-  road. */
-  const Eigen::VectorXd& derivatives() const {
+  road. (At the moment, it is an Eigen::Ref that refers to the derivatives in
+  place when they are stored densely, and to a dense copy made by this call
+  when they are stored sparsely.) */
+  internal::Partials::ConstXpr derivatives() const {
     return partials_.make_const_xpr();
   }
 
@@ -80,7 +82,8 @@ class AutoDiff {
   Do not presume any specific C++ type for the the return value. It will act
   like a mutable Eigen column-vector expression (e.g., Eigen::Block<VectorXd>)
   that also allows for assignment and resizing, but we reserve the right to
-  change the return type for efficiency down the road. */
+  change the return type for efficiency down the road. Calling this function
+  converts any sparsely-stored derivatives to dense storage. */
   Eigen::VectorXd& derivatives() {
     return partials_.get_raw_storage_mutable();
   }
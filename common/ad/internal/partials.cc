@@ -1,10 +1,13 @@
 #include "drake/common/ad/internal/partials.h"
 
+#include <cmath>
 #include <stdexcept>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include "drake/common/drake_assert.h"
+
 namespace drake {
 namespace ad {
 namespace internal {
@@ -29,29 +32,65 @@ int IndexToInt(Eigen::Index index) {
 }  // namespace
 
 Partials::Partials(Eigen::Index size, Eigen::Index offset, double coeff)
-    : derivatives_{Eigen::VectorXd::Zero(IndexToInt(size))} {
+    : size_{IndexToInt(size)} {
   if (IndexToInt(offset) >= size) {
     throw std::out_of_range(fmt::format(
         "AutoDiff offset {} must be strictly less than size {}",
         offset, size));
   }
-  derivatives_[offset] = coeff;
+  num_entries_ = 1;
+  offsets_[0] = static_cast<int>(offset);
+  coeffs_[0] = coeff;
 }
 
 Partials::Partials(const Eigen::Ref<const Eigen::VectorXd>& value)
-    : derivatives_{value} {}
+    : is_dense_{true}, derivatives_{value} {}
 
 void Partials::MatchSizeOf(const Partials& other) {
   if (other.size() == 0) {
     return;
   }
   if (size() == 0) {
-    derivatives_ = Eigen::VectorXd::Zero(other.size());
+    // An all-zero vector needs no storage in the sparse representation.
+    is_dense_ = false;
+    derivatives_.resize(0);
+    size_ = other.size();
+    num_entries_ = 0;
     return;
   }
   ThrowIfDifferentSize(other);
 }
 
+void Partials::Mul(double factor) {
+  // Multiplying the implicit zeros by a non-finite factor produces NaN, so in
+  // that case we need every element to be explicit.
+  if (!is_dense_ && !std::isfinite(factor)) {
+    MakeDense();
+  }
+  if (is_dense_) {
+    derivatives_ *= factor;
+    return;
+  }
+  for (int i = 0; i < num_entries_; ++i) {
+    coeffs_[i] *= factor;
+  }
+}
+
+void Partials::Div(double factor) {
+  // Dividing the implicit zeros by zero or NaN produces NaN, so in that case
+  // we need every element to be explicit.
+  if (!is_dense_ && (factor == 0.0 || std::isnan(factor))) {
+    MakeDense();
+  }
+  if (is_dense_) {
+    derivatives_ /= factor;
+    return;
+  }
+  for (int i = 0; i < num_entries_; ++i) {
+    coeffs_[i] /= factor;
+  }
+}
+
 void Partials::Add(const Partials& other) {
   AddScaled(1.0, other);
 }
@@ -61,11 +100,78 @@ void Partials::AddScaled(double scale, const Partials& other) {
     return;
   }
   if (size() == 0) {
-    derivatives_ = scale * other.derivatives_;
-    return;
+    MatchSizeOf(other);
   }
   ThrowIfDifferentSize(other);
-  derivatives_ += scale * other.derivatives_;
+
+  // Sparse plus sparse stays sparse, when it fits. Scaling the implicit zeros
+  // of `other` by a non-finite factor produces NaN, so that case goes dense.
+  if (!is_dense_ && !other.is_dense_ && std::isfinite(scale) &&
+      TryAddScaledSparse(scale, other)) {
+    return;
+  }
+
+  MakeDense();
+  if (other.is_dense_) {
+    derivatives_ += scale * other.derivatives_;
+  } else if (std::isfinite(scale)) {
+    for (int i = 0; i < other.num_entries_; ++i) {
+      derivatives_[other.offsets_[i]] += scale * other.coeffs_[i];
+    }
+  } else {
+    derivatives_ += scale * other.make_const_xpr();
+  }
+}
+
+void Partials::MakeDense() {
+  if (is_dense_) {
+    return;
+  }
+  derivatives_.setZero(size_);
+  for (int i = 0; i < num_entries_; ++i) {
+    derivatives_[offsets_[i]] = coeffs_[i];
+  }
+  is_dense_ = true;
+  size_ = 0;
+  num_entries_ = 0;
+}
+
+bool Partials::TryAddScaledSparse(double scale, const Partials& other) {
+  DRAKE_ASSERT(!is_dense_ && !other.is_dense_);
+  DRAKE_ASSERT(size_ == other.size_);
+
+  // Merge the two sorted lists of offsets into temporaries (which also keeps
+  // us safe when `other` is `this`), bailing out if there are too many.
+  std::array<int, kMaxSparseEntries> offsets;
+  std::array<double, kMaxSparseEntries> coeffs;
+  int count = 0;
+  int i = 0;
+  int j = 0;
+  while (i < num_entries_ || j < other.num_entries_) {
+    if (count == kMaxSparseEntries) {
+      return false;
+    }
+    if (j == other.num_entries_ ||
+        (i < num_entries_ && offsets_[i] < other.offsets_[j])) {
+      offsets[count] = offsets_[i];
+      coeffs[count] = coeffs_[i];
+      ++i;
+    } else if (i == num_entries_ || other.offsets_[j] < offsets_[i]) {
+      offsets[count] = other.offsets_[j];
+      coeffs[count] = scale * other.coeffs_[j];
+      ++j;
+    } else {
+      offsets[count] = offsets_[i];
+      coeffs[count] = coeffs_[i] + scale * other.coeffs_[j];
+      ++i;
+      ++j;
+    }
+    ++count;
+  }
+  offsets_ = offsets;
+  coeffs_ = coeffs;
+  num_entries_ = count;
+  return true;
 }
 
 void Partials::ThrowIfDifferentSize(const Partials& other) {
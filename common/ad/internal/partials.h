@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
 
@@ -23,11 +25,26 @@ never returns back to being zero-sized (unless the Partials is moved-from).
 In particular, note that the result of a binary operation takes on the size from
 either operand, e.g., foo.Add(bar) with foo.size() == 0 and bar.size() == 4 will
 will result in foo.size() == 4 after the addition, and that's true even if bar's
-vector was all zeros. */
+vector was all zeros.
+
+To avoid heap allocation for the common case of derivatives that have only a
+few non-zero entries (e.g., the gradient of an intermediate quantity that
+depends on only one joint's position in a large multibody system), the partials
+are stored sparsely as up to kMaxSparseEntries (offset, coeff) pairs inline in
+this object. Once an operation would need more entries than that (or a dense
+vector is provided or requested), the storage is promoted to a dense
+Eigen::VectorXd and stays dense from then on. The representation is an
+implementation detail; all member functions behave identically for both. */
 class Partials {
  public:
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(Partials);
 
+  /* The type returned by make_const_xpr(). */
+  using ConstXpr = Eigen::Ref<const Eigen::VectorXd>;
+
+  /* The number of non-zero partials that can be stored without allocating. */
+  static constexpr int kMaxSparseEntries = 4;
+
   /* Constructs an empty vector. */
   Partials() = default;
 
@@ -43,9 +60,13 @@ class Partials {
 
   /* Returns the size of this vector. */
   int size() const {
-    return derivatives_.size();
+    return is_dense_ ? derivatives_.size() : size_;
   }
 
+  /* Returns true iff the partials are currently stored as a dense vector. This
+  is only intended for testing and performance diagnostics. */
+  bool is_dense() const { return is_dense_; }
+
   /* Updates `this` to be the same size as `other`.
   If `this` and `other` are already the same size then does nothing.
   Otherwise, if `other` has size 0 then does nothing.
@@ -56,18 +77,18 @@ class Partials {
 
   /* Set this to zero. */
   void SetZero() {
-    derivatives_.setZero();
+    if (is_dense_) {
+      derivatives_.setZero();
+    } else {
+      num_entries_ = 0;
+    }
   }
 
   /* Scales this vector by the given amount. */
-  void Mul(double factor) {
-    derivatives_ *= factor;
-  }
+  void Mul(double factor);
 
   /* Scales this vector by the reciprocal of the given amount. */
-  void Div(double factor) {
-    derivatives_ /= factor;
-  }
+  void Div(double factor);
 
   /* Adds `other` into `this`. */
   void Add(const Partials& other);
@@ -75,23 +96,64 @@ class Partials {
   /* Adds `scale * other` into `this`. */
   void AddScaled(double scale, const Partials& other);
 
-  /* Returns the underlying storage vector (readonly).
-  TODO(jwnimmer-tri) Use a more Xpr-like return type. By "Xpr", we mean what
-  Eigen calls an XprType, e.g., something like Eigen::CwiseBinaryOp. */
-  const Eigen::VectorXd& make_const_xpr() const {
-    return derivatives_;
+  /* Returns the derivatives as a read-only Eigen column vector. When the
+  storage is dense, this refers to the storage of `this` in place (so it does
+  not copy the derivatives, and it reflects later changes to `this`); when the
+  storage is sparse, it owns a dense copy that is built by this call. Either
+  way it must not outlive `this`, and (as with any Eigen::Ref<const T>) copies
+  of it must not outlive it. */
+  ConstXpr make_const_xpr() const {
+    if (is_dense_) {
+      return derivatives_;
+    }
+    // The nullary expression has no direct access, so the Ref evaluates it
+    // into its own storage.
+    return Eigen::VectorXd::NullaryExpr(
+        size_, [this](Eigen::Index i) { return coeff(i); });
+  }
+
+  /* Returns the derivative at index `i`.
+  @pre 0 <= i < size() */
+  double coeff(Eigen::Index i) const {
+    if (is_dense_) {
+      return derivatives_[i];
+    }
+    for (int k = 0; k < num_entries_; ++k) {
+      if (offsets_[k] == i) {
+        return coeffs_[k];
+      }
+    }
+    return 0.0;
   }
 
-  /* Returns the underlying storage vector (mutable). */
+  /* Returns the underlying storage vector (mutable). This promotes the storage
+  to be dense. */
   Eigen::VectorXd& get_raw_storage_mutable() {
+    MakeDense();
     return derivatives_;
   }
 
  private:
   void ThrowIfDifferentSize(const Partials& other);
 
-  // TODO(jwnimmer-tri) Replace this implementation with a more efficient
-  // representation.
+  // Converts the sparse representation (if in use) to the dense one.
+  void MakeDense();
+
+  // Adds `scale * other` into `this`, where both use the sparse representation
+  // and have the same size. Returns false (leaving `this` unchanged) when the
+  // result would need more than kMaxSparseEntries entries.
+  bool TryAddScaledSparse(double scale, const Partials& other);
+
+  // When is_dense_ is false, the partials are a vector of size size_ whose only
+  // non-zeros are coeffs_[i] at offsets_[i] for i < num_entries_, with offsets
+  // strictly increasing; derivatives_ is unused (and empty). When is_dense_ is
+  // true, the partials are exactly derivatives_ and the other fields are
+  // unused.
+  bool is_dense_{false};
+  int size_{0};
+  int num_entries_{0};
+  std::array<int, kMaxSparseEntries> offsets_{};
+  std::array<double, kMaxSparseEntries> coeffs_{};
   Eigen::VectorXd derivatives_;
 };
 
@@ -345,7 +345,7 @@ retains the derivatives of `a` (by returning `a`) unless `a` has empty
 derivatives, in which case `b` is returned. */
 inline const AutoDiff& max(const AutoDiff& a, const AutoDiff& b) {
   if (a.value() == b.value()) {
-    return a.derivatives().size() > 0 ? a : b;
+    return a.partials().size() > 0 ? a : b;
   }
   return a.value() < b.value() ? b : a;
 }
@@ -376,7 +376,7 @@ retains the derivatives of `a` (by returning `a`) unless `a` has empty
 derivatives, in which case `b` is returned. */
 inline const AutoDiff& min(const AutoDiff& a, const AutoDiff& b) {
   if (a.value() == b.value()) {
-    return a.derivatives().size() > 0 ? a : b;
+    return a.partials().size() > 0 ? a : b;
   }
   return b.value() < a.value() ? b : a;
 }
@@ -223,6 +223,108 @@ TEST_F(PartialsTest, DefaultCtorMutableGetter) {
   EXPECT_EQ(dut.get_raw_storage_mutable().size(), 4);
 }
 
+// The tests below check the sparse vs dense storage choices. The values are
+// already checked by the tests above.
+
+TEST_F(PartialsTest, SparseStorage) {
+  EXPECT_FALSE(Partials{}.is_dense());
+  EXPECT_FALSE(Partials(4, 2).is_dense());
+  EXPECT_TRUE(Partials{Vector4d::Zero()}.is_dense());
+
+  // Matching the size of a dense vector still doesn't need dense storage.
+  Partials dut;
+  dut.MatchSizeOf(Partials{Vector4d::Zero()});
+  EXPECT_FALSE(dut.is_dense());
+  EXPECT_EQ(dut.size(), 4);
+}
+
+TEST_F(PartialsTest, SparseAddStaysSparseUntilFull) {
+  const int size = 100;
+  Partials dut{size, 50};
+  VectorXd expected = VectorXd::Unit(size, 50);
+  for (int i = 1; i < Partials::kMaxSparseEntries; ++i) {
+    // Alternate adding before and after the existing entries.
+    const int offset = (i % 2 == 0) ? 50 + i : 50 - i;
+    dut.AddScaled(i, Partials(size, offset));
+    expected[offset] += i;
+    EXPECT_FALSE(dut.is_dense());
+    EXPECT_TRUE(CompareMatrices(dut.make_const_xpr(), expected));
+  }
+
+  // Adding to an existing entry doesn't need more storage.
+  dut.Add(Partials(size, 50));
+  expected[50] += 1;
+  EXPECT_FALSE(dut.is_dense());
+  EXPECT_TRUE(CompareMatrices(dut.make_const_xpr(), expected));
+
+  // Adding a vector with itself doesn't need more storage.
+  dut.Add(dut);
+  expected *= 2;
+  EXPECT_FALSE(dut.is_dense());
+  EXPECT_TRUE(CompareMatrices(dut.make_const_xpr(), expected));
+
+  // One more entry overflows to dense storage.
+  dut.Add(Partials(size, 0));
+  expected[0] += 1;
+  EXPECT_TRUE(dut.is_dense());
+  EXPECT_TRUE(CompareMatrices(dut.make_const_xpr(), expected));
+}
+
+TEST_F(PartialsTest, SparseAddDense) {
+  Partials dut{4, 2};
+  dut.AddScaled(2.0, Partials{Vector4d::Ones()});
+  EXPECT_TRUE(dut.is_dense());
+  EXPECT_TRUE(CompareMatrices(dut.make_const_xpr(), Vector4d(2, 2, 3, 2)));
+}
+
+// The dense storage is read in place, rather than copied; the sparse storage
+// is copied into a dense vector.
+TEST_F(PartialsTest, ConstXprDenseIsNotACopy) {
+  Partials dense{Vector4d::LinSpaced(1.0, 4.0)};
+  const auto dense_xpr = dense.make_const_xpr();
+  EXPECT_EQ(dense_xpr.data(), dense.get_raw_storage_mutable().data());
+  dense.get_raw_storage_mutable()[0] = 10.0;
+  EXPECT_TRUE(CompareMatrices(dense_xpr, Vector4d(10, 2, 3, 4)));
+
+  Partials sparse{4, 2};
+  const auto sparse_xpr = sparse.make_const_xpr();
+  EXPECT_FALSE(sparse.is_dense());
+  EXPECT_TRUE(CompareMatrices(sparse_xpr, Vector4d::Unit(2)));
+}
+
+TEST_F(PartialsTest, SparseNonFinite) {
+  const double kInf = std::numeric_limits<double>::infinity();
+  const double kNaN = std::numeric_limits<double>::quiet_NaN();
+
+  // The implicit zeros must become NaN, just like with dense storage.
+  Partials dut{4, 2};
+  dut.Mul(kInf);
+  EXPECT_TRUE(CompareMatrices(dut.make_const_xpr(),
+                              Vector4d(kNaN, kNaN, kInf, kNaN)));
+
+  dut = Partials{4, 2};
+  dut.Div(kNaN);
+  EXPECT_TRUE(CompareMatrices(dut.make_const_xpr(), Vector4d::Constant(kNaN)));
+
+  dut = Partials{4, 2};
+  dut.AddScaled(kInf, Partials(4, 1));
+  EXPECT_TRUE(CompareMatrices(dut.make_const_xpr(),
+                              Vector4d(kNaN, kInf, kNaN, kNaN)));
+
+  // Dividing by infinity is still zero, so can stay sparse.
+  dut = Partials{4, 2};
+  dut.Div(kInf);
+  EXPECT_FALSE(dut.is_dense());
+  EXPECT_TRUE(CompareMatrices(dut.make_const_xpr(), Vector4d::Zero()));
+}
+
+TEST_F(PartialsTest, SparseMutableGetter) {
+  Partials dut{4, 2};
+  dut.get_raw_storage_mutable()[0] = 3.0;
+  EXPECT_TRUE(dut.is_dense());
+  EXPECT_TRUE(CompareMatrices(dut.make_const_xpr(), Vector4d(3, 0, 1, 0)));
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace ad
@@ -0,0 +1,112 @@
+#include <vector>
+
+#include "drake/common/ad/auto_diff.h"
+#include "drake/common/autodiff.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace {
+
+// Evaluates a chain of "local" terms, each of which depends on only two of the
+// `q` variables. This mimics the structure of many multibody kinematics
+// quantities (e.g., a joint's transform depends only on that joint's
+// positions) and thus yields gradients with very few non-zero partials.
+template <typename T>
+T CalcLocalTermsSum(const std::vector<T>& q) {
+  using std::cos;
+  using std::sin;
+  T sum = 0;
+  for (int i = 1; i < static_cast<int>(q.size()); ++i) {
+    const T s = sin(q[i]);
+    const T c = cos(q[i - 1]);
+    const T term = s * c + q[i] * q[i] - 2.0 * s;
+    // Use each term in a product before accumulating it, so that most of the
+    // operations are on sparse intermediate values.
+    sum += term * term;
+  }
+  return sum;
+}
+
+// Evaluates terms that each depend on all of the `q` variables, so that the
+// gradients are dense, and reads each term's gradient back out. This measures
+// the dense storage, including the cost of AutoDiff::derivatives().
+template <typename T>
+double CalcDenseTermsGradientNorm(const std::vector<T>& q) {
+  using std::cos;
+  using std::sin;
+  T total = 0;
+  for (const T& q_i : q) {
+    total += q_i;
+  }
+  double norm = 0;
+  for (const T& q_i : q) {
+    const T term = sin(total) * q_i + cos(q_i) * total;
+    norm += term.derivatives().squaredNorm();
+  }
+  return norm;
+}
+
+template <typename T>
+std::vector<T> MakeIndependentVariables(int num_variables) {
+  std::vector<T> q;
+  q.reserve(num_variables);
+  for (int i = 0; i < num_variables; ++i) {
+    q.emplace_back(0.1 * i, num_variables, i);
+  }
+  return q;
+}
+
+// Times Eigen's AutoDiffScalar (i.e., drake::AutoDiffXd), which always stores
+// derivatives as a dense heap-allocated vector.
+void EigenAutoDiffXdLocalTerms(benchmark::State& state) {  // NOLINT
+  const std::vector<AutoDiffXd> q =
+      MakeIndependentVariables<AutoDiffXd>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(CalcLocalTermsSum(q));
+  }
+}
+
+// Times Drake's AutoDiff, which stores derivatives with only a few non-zero
+// partials inline (without heap allocation).
+void DrakeAutoDiffLocalTerms(benchmark::State& state) {  // NOLINT
+  const std::vector<ad::AutoDiff> q =
+      MakeIndependentVariables<ad::AutoDiff>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(CalcLocalTermsSum(q));
+  }
+}
+
+// Times Eigen's AutoDiffScalar when the derivatives are dense.
+void EigenAutoDiffXdDenseTerms(benchmark::State& state) {  // NOLINT
+  const std::vector<AutoDiffXd> q =
+      MakeIndependentVariables<AutoDiffXd>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(CalcDenseTermsGradientNorm(q));
+  }
+}
+
+// Times Drake's AutoDiff when the derivatives are dense, i.e., when it has
+// promoted its storage to a heap-allocated vector.
+void DrakeAutoDiffDenseTerms(benchmark::State& state) {  // NOLINT
+  const std::vector<ad::AutoDiff> q =
+      MakeIndependentVariables<ad::AutoDiff>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(CalcDenseTermsGradientNorm(q));
+  }
+}
+
+BENCHMARK(EigenAutoDiffXdLocalTerms)
+    ->Unit(benchmark::kMicrosecond)
+    ->Arg(6)->Arg(60);
+BENCHMARK(DrakeAutoDiffLocalTerms)
+    ->Unit(benchmark::kMicrosecond)
+    ->Arg(6)->Arg(60);
+BENCHMARK(EigenAutoDiffXdDenseTerms)
+    ->Unit(benchmark::kMicrosecond)
+    ->Arg(6)->Arg(60);
+BENCHMARK(DrakeAutoDiffDenseTerms)
+    ->Unit(benchmark::kMicrosecond)
+    ->Arg(6)->Arg(60);
+
+}  // namespace
+}  // namespace drake
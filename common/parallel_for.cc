@@ -0,0 +1,68 @@
+#include "drake/common/parallel_for.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <future>
+#include <vector>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace internal {
+
+void ParallelFor(int num_tasks, int num_threads,
+                 const std::function<void(int)>& task) {
+  DRAKE_THROW_UNLESS(num_tasks >= 0);
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  const int num_workers = std::min(num_threads, num_tasks);
+  if (num_workers <= 1) {
+    for (int i = 0; i < num_tasks; ++i) {
+      task(i);
+    }
+    return;
+  }
+
+  // Each task is handed out to exactly one worker.
+  std::atomic<int> next_task{0};
+  std::atomic<bool> failed{false};
+  auto work = [&task, &next_task, &failed, num_tasks]() {
+    for (int i = next_task.fetch_add(1); i < num_tasks && !failed;
+         i = next_task.fetch_add(1)) {
+      try {
+        task(i);
+      } catch (...) {
+        failed = true;
+        throw;
+      }
+    }
+  };
+  std::vector<std::future<void>> workers;
+  workers.reserve(num_workers - 1);
+  for (int w = 1; w < num_workers; ++w) {
+    workers.push_back(std::async(std::launch::async, work));
+  }
+  std::exception_ptr error;
+  try {
+    work();
+  } catch (...) {
+    error = std::current_exception();
+  }
+  // Wait for every worker before propagating an exception, since the tasks
+  // may refer to the local variables of the caller.
+  for (auto& worker : workers) {
+    try {
+      worker.get();
+    } catch (...) {
+      if (!error) {
+        error = std::current_exception();
+      }
+    }
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+}  // namespace internal
+}  // namespace drake
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <functional>
+
+namespace drake {
+namespace internal {
+
+/* Calls task(i) once for each i in [0, num_tasks), using up to `num_threads`
+threads, one of which is the calling thread. The tasks are handed out one at a
+time as the threads become free, so tasks of uneven cost still keep every
+thread busy. When `num_threads` or `num_tasks` is at most one, the tasks run
+in order on the calling thread, without starting any thread.
+
+This returns only once no thread is running a task anymore, so `task` may
+safely refer to the caller's local variables. If a task throws, the tasks that
+have not started yet are skipped, and one of the exceptions is rethrown.
+
+The caller is responsible for `task` being safe to run concurrently with
+itself (for distinct indices).
+
+@throws std::exception if num_tasks < 0 or num_threads < 1. */
+void ParallelFor(int num_tasks, int num_threads,
+                 const std::function<void(int)>& task);
+
+}  // namespace internal
+}  // namespace drake
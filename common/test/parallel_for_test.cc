@@ -0,0 +1,76 @@
+#include "drake/common/parallel_for.h"
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace internal {
+namespace {
+
+GTEST_TEST(ParallelForTest, CallsEachTaskOnce) {
+  for (int num_threads : {1, 2, 4, 16}) {
+    for (int num_tasks : {0, 1, 3, 100}) {
+      std::vector<std::atomic<int>> counts(num_tasks);
+      std::mutex mutex;
+      std::set<std::thread::id> thread_ids;
+      ParallelFor(num_tasks, num_threads, [&](int i) {
+        ++counts.at(i);
+        std::lock_guard<std::mutex> lock(mutex);
+        thread_ids.insert(std::this_thread::get_id());
+      });
+      for (int i = 0; i < num_tasks; ++i) {
+        EXPECT_EQ(counts[i], 1);
+      }
+      EXPECT_LE(static_cast<int>(thread_ids.size()), num_threads);
+      if (num_tasks > 0 && (num_threads == 1 || num_tasks == 1)) {
+        // No thread is started.
+        EXPECT_EQ(thread_ids, std::set<std::thread::id>{
+                                  std::this_thread::get_id()});
+      }
+    }
+  }
+}
+
+GTEST_TEST(ParallelForTest, SerialOrder) {
+  std::vector<int> order;
+  ParallelFor(5, 1, [&](int i) {
+    order.push_back(i);
+  });
+  EXPECT_EQ(order, std::vector<int>({0, 1, 2, 3, 4}));
+}
+
+GTEST_TEST(ParallelForTest, Exception) {
+  for (int num_threads : {1, 4}) {
+    // Every task that starts finishes before the exception is rethrown.
+    std::atomic<int> num_running{0};
+    DRAKE_EXPECT_THROWS_MESSAGE(ParallelFor(100, num_threads,
+                                            [&](int i) {
+                                              ++num_running;
+                                              std::this_thread::yield();
+                                              --num_running;
+                                              if (i == 3) {
+                                                throw std::runtime_error(
+                                                    "task 3 failed");
+                                              }
+                                            }),
+                                "task 3 failed");
+    EXPECT_EQ(num_running, 0);
+  }
+}
+
+GTEST_TEST(ParallelForTest, BadArguments) {
+  EXPECT_THROW(ParallelFor(-1, 1, [](int) {}), std::exception);
+  EXPECT_THROW(ParallelFor(1, 0, [](int) {}), std::exception);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace drake
@@ -0,0 +1,99 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "drake/geometry/meshcat.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace geometry {
+namespace {
+
+using math::RigidTransformd;
+
+// We use this alias to silence cpplint barking at mutable references.
+using BenchmarkStateRef = benchmark::State&;
+
+// Times the updates of the poses of a scene of state.range(0) frames, as
+// MeshcatVisualizer does after each simulation step. Every iteration waits for
+// the websocket thread to process the updates (with Flush()), so that the time
+// of the serialization done there is counted, too.
+class MeshcatBenchmark : public benchmark::Fixture {
+ public:
+  MeshcatBenchmark() { tools::performance::AddMinMaxStatistics(this); }
+
+  using benchmark::Fixture::SetUp;
+  void SetUp(BenchmarkStateRef state) override {
+    const int num_frames = state.range(0);
+    paths_.clear();
+    for (int i = 0; i < num_frames; ++i) {
+      paths_.push_back(fmt::format("robot/link_{}", i));
+    }
+    meshcat_ = std::make_unique<Meshcat>();
+  }
+
+  void TearDown(BenchmarkStateRef) override { meshcat_.reset(); }
+
+ protected:
+  // Returns a pose of every frame, which differs for every `step`.
+  std::vector<RigidTransformd> MakePoses(int step) const {
+    std::vector<RigidTransformd> X_ParentPaths;
+    for (int i = 0; i < static_cast<int>(paths_.size()); ++i) {
+      X_ParentPaths.emplace_back(Eigen::Vector3d(i, step, 0.0));
+    }
+    return X_ParentPaths;
+  }
+
+  std::vector<std::string> paths_;
+  std::unique_ptr<Meshcat> meshcat_;
+};
+
+// Calls SetTransform() once per frame.
+BENCHMARK_DEFINE_F(MeshcatBenchmark, SetTransform)
+(BenchmarkStateRef state) {
+  int step = 0;
+  for (auto _ : state) {
+    const std::vector<RigidTransformd> X_ParentPaths = MakePoses(++step);
+    for (int i = 0; i < static_cast<int>(paths_.size()); ++i) {
+      meshcat_->SetTransform(paths_[i], X_ParentPaths[i]);
+    }
+    meshcat_->Flush();
+  }
+}
+BENCHMARK_REGISTER_F(MeshcatBenchmark, SetTransform)
+    ->Unit(benchmark::kMicrosecond)
+    ->Arg(10)->Arg(100)->Arg(500)->Arg(1000);
+
+// Calls SetTransforms() once for all of the frames, which all moved.
+BENCHMARK_DEFINE_F(MeshcatBenchmark, SetTransforms)
+(BenchmarkStateRef state) {
+  int step = 0;
+  for (auto _ : state) {
+    meshcat_->SetTransforms(paths_, MakePoses(++step));
+    meshcat_->Flush();
+  }
+}
+BENCHMARK_REGISTER_F(MeshcatBenchmark, SetTransforms)
+    ->Unit(benchmark::kMicrosecond)
+    ->Arg(10)->Arg(100)->Arg(500)->Arg(1000);
+
+// Calls SetTransforms() once for all of the frames, none of which moved.
+BENCHMARK_DEFINE_F(MeshcatBenchmark, SetTransformsUnchanged)
+(BenchmarkStateRef state) {
+  const std::vector<RigidTransformd> X_ParentPaths = MakePoses(0);
+  meshcat_->SetTransforms(paths_, X_ParentPaths);
+  for (auto _ : state) {
+    meshcat_->SetTransforms(paths_, X_ParentPaths);
+    meshcat_->Flush();
+  }
+}
+BENCHMARK_REGISTER_F(MeshcatBenchmark, SetTransformsUnchanged)
+    ->Unit(benchmark::kMicrosecond)
+    ->Arg(10)->Arg(100)->Arg(500)->Arg(1000);
+
+}  // namespace
+}  // namespace geometry
+}  // namespace drake
@@ -1,9 +1,11 @@
 #include "drake/geometry/geometry_state.h"
 
 #include <algorithm>
+#include <array>
 #include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include <fmt/format.h>
@@ -19,6 +21,7 @@
 #include "drake/geometry/proximity_properties.h"
 #include "drake/geometry/render/render_engine.h"
 #include "drake/geometry/utilities.h"
+#include "drake/math/fast_pose_composition_functions.h"
 
 namespace drake {
 namespace geometry {
@@ -726,11 +729,15 @@ GeometryId GeometryState<T>::RegisterDeformableGeometry(
   const InternalFrame& frame = frames_[frame_id];
   const RigidTransform<T> X_WG =
       kinematics_data_.X_WFs[frame.index()] * geometry->pose().cast<T>();
-  VectorX<T> q_WG(reference_mesh->num_vertices() * 3);
-  for (int v = 0; v < reference_mesh->num_vertices(); ++v) {
-    q_WG.template segment<3>(3 * v) =
-        X_WG * Vector3<T>(reference_mesh->vertex(v));
-  }
+  const int num_vertices = reference_mesh->num_vertices();
+  Matrix3X<T> p_GVs(3, num_vertices);
+  for (int v = 0; v < num_vertices; ++v) {
+    p_GVs.col(v) = reference_mesh->vertex(v).template cast<T>();
+  }
+  // Transform all of the vertices at once; for T = double this uses the
+  // batched (and possibly SIMD) transform kernel.
+  VectorX<T> q_WG(num_vertices * 3);
+  Eigen::Map<Matrix3X<T>>(q_WG.data(), 3, num_vertices) = X_WG * p_GVs;
   kinematics_data_.q_WGs[geometry_id] = std::move(q_WG);
   geometries_.emplace(geometry_id, std::move(internal_geometry));
 
@@ -1354,12 +1361,36 @@ void GeometryState<T>::UpdatePosesRecursively(
   RigidTransform<T> X_WF = X_WP * X_PF;
   kinematics_data->X_WFs[frame.index()] = X_WF;
   // Update the geometry which belong to *this* frame.
-  for (auto child_id : frame.child_geometries()) {
-    const auto& child_geometry = geometries_.at(child_id);
-    // X_FG() is always RigidTransform<double>, to account for
-    // GeometryState<AutoDiff>, we need to cast it to the common type T.
-    RigidTransform<double> X_FG(child_geometry.X_FG());
-    kinematics_data->X_WGs[child_id] = X_WF * X_FG.cast<T>();
+  if constexpr (std::is_same_v<T, double>) {
+    // Compose the poses in fixed-size chunks so that the batched kernel can
+    // keep X_WF in registers across all of the frame's geometries.
+    constexpr int kBatchSize = 16;
+    std::array<const RigidTransform<double>*, kBatchSize> X_WF_batch;
+    X_WF_batch.fill(&X_WF);
+    std::array<const RigidTransform<double>*, kBatchSize> X_FG_batch;
+    std::array<RigidTransform<double>*, kBatchSize> X_WG_batch;
+    int count = 0;
+    for (auto child_id : frame.child_geometries()) {
+      X_FG_batch[count] = &geometries_.at(child_id).X_FG();
+      X_WG_batch[count] = &kinematics_data->X_WGs[child_id];
+      if (++count == kBatchSize) {
+        math::internal::ComposeXXBatch(X_WF_batch.data(), X_FG_batch.data(),
+                                       count, X_WG_batch.data());
+        count = 0;
+      }
+    }
+    if (count > 0) {
+      math::internal::ComposeXXBatch(X_WF_batch.data(), X_FG_batch.data(),
+                                     count, X_WG_batch.data());
+    }
+  } else {
+    for (auto child_id : frame.child_geometries()) {
+      const auto& child_geometry = geometries_.at(child_id);
+      // X_FG() is always RigidTransform<double>, to account for
+      // GeometryState<AutoDiff>, we need to cast it to the common type T.
+      RigidTransform<double> X_FG(child_geometry.X_FG());
+      kinematics_data->X_WGs[child_id] = X_WF * X_FG.cast<T>();
+    }
   }
 
   // Update each child frame.
@@ -1,6 +1,7 @@
 #include "drake/geometry/meshcat.h"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cctype>
 #include <exception>
@@ -16,6 +17,7 @@
 #include <thread>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include <App.h>
 #include <common_robotics_utilities/base64_helpers.hpp>
@@ -104,6 +106,62 @@ struct PerSocketData {
 using WebSocket = uWS::WebSocket<kSsl, kIsServer, PerSocketData>;
 using MsgPackMap = std::map<std::string, msgpack::object>;
 
+// A homogeneous transform, as a column-major 4x4 matrix.
+using TransformMatrix = std::array<double, 16>;
+
+TransformMatrix ToTransformMatrix(const Eigen::Ref<const Eigen::Matrix4d>& X) {
+  TransformMatrix matrix;
+  Eigen::Map<Eigen::Matrix4d>(matrix.data()) = X;
+  return matrix;
+}
+
+// Returns the msgpack'd set_transform command for the given path.
+std::string PackTransform(std::string path, const TransformMatrix& matrix) {
+  internal::SetTransformData data;
+  data.path = std::move(path);
+  std::copy(matrix.begin(), matrix.end(), data.matrix);
+  std::stringstream message_stream;
+  msgpack::pack(message_stream, data);
+  return message_stream.str();
+}
+
+// Returns the msgpack'd set_transforms command for the given transforms,
+// keyed by path.
+template <typename Iterator>
+std::string PackTransforms(Iterator begin, Iterator end) {
+  internal::SetTransformsData data;
+  for (Iterator iter = begin; iter != end; ++iter) {
+    const auto& [path, matrix] = *iter;
+    data.paths.push_back(path);
+    const char* const bytes = reinterpret_cast<const char*>(matrix.data());
+    data.matrices.insert(data.matrices.end(), bytes,
+                         bytes + sizeof(TransformMatrix));
+  }
+  std::stringstream message_stream;
+  msgpack::pack(message_stream, data);
+  return message_stream.str();
+}
+
+// Returns true iff `path` is `prefix` or one of its descendants.
+bool IsPathOrDescendant(std::string_view path, std::string_view prefix) {
+  return path.substr(0, prefix.size()) == prefix &&
+         (path.size() == prefix.size() || path[prefix.size()] == '/');
+}
+
+// Erases the entries of `map` whose key satisfies IsPathOrDescendant(prefix).
+template <typename Map>
+void EraseDescendants(std::string_view prefix, Map* map) {
+  auto iter = map->lower_bound(prefix);
+  while (iter != map->end() &&
+         std::string_view(iter->first).substr(0, prefix.size()) == prefix) {
+    if (IsPathOrDescendant(iter->first, prefix)) {
+      iter = map->erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+}
+
 // Encode the meshcat command into a Javascript fetch() command.  The particular
 // syntax using `fetch()` was replicated from the corresponding functionality in
 // meshcat-python.
@@ -123,8 +181,8 @@ class SceneTreeElement {
   // effectively public).
   const std::optional<std::string>& object() const { return object_; }
   std::optional<std::string>& object() { return object_; }
-  const std::optional<std::string>& transform() const { return transform_; }
-  std::optional<std::string>& transform() { return transform_; }
+  const std::optional<TransformMatrix>& transform() const { return transform_; }
+  std::optional<TransformMatrix>& transform() { return transform_; }
   const std::map<std::string, std::string>& properties() const {
     return properties_;
   }
@@ -141,12 +199,14 @@ class SceneTreeElement {
       return *this;
     }
     auto loc = path.find_first_of("/");
-    std::string name(path.substr(0, loc));
+    const std::string_view name = path.substr(0, loc);
     auto child = children_.find(name);
     // Create the child if it doesn't exist.
     if (child == children_.end()) {
-      child =
-          children_.emplace(name, std::make_unique<SceneTreeElement>()).first;
+      child = children_
+                  .emplace(std::string(name),
+                           std::make_unique<SceneTreeElement>())
+                  .first;
     }
     if (loc == std::string_view::npos) {
       return *child->second;
@@ -165,8 +225,7 @@ class SceneTreeElement {
       return this;
     }
     auto loc = path.find_first_of("/");
-    std::string name(path.substr(0, loc));
-    auto child = children_.find(name);
+    auto child = children_.find(path.substr(0, loc));
     if (child == children_.end()) {
       return nullptr;
     }
@@ -188,7 +247,7 @@ class SceneTreeElement {
     }
 
     auto loc = path.find_first_of("/");
-    auto child = children_.find(std::string(path.substr(0, loc)));
+    auto child = children_.find(path.substr(0, loc));
     if (child == children_.end()) {
       return;
     }
@@ -199,13 +258,13 @@ class SceneTreeElement {
     child->second->Delete(path.substr(loc + 1));
   }
 
-  // Sends the entire tree on `ws`.
-  void Send(WebSocket* ws) {
+  // Sends the entire tree on `ws`, where `path` is the path of this element.
+  void Send(WebSocket* ws, const std::string& path = "") {
     if (object_) {
       ws->send(*object_);
     }
     if (transform_) {
-      ws->send(*transform_);
+      ws->send(PackTransform(path, *transform_));
     }
     for (const auto& [property, msg] : properties_) {
       unused(property);
@@ -213,20 +272,20 @@ class SceneTreeElement {
     }
 
     for (const auto& [name, child] : children_) {
-      unused(name);
-      child->Send(ws);
+      child->Send(ws, path + "/" + name);
     }
   }
 
   // Returns a string which implements the entire tree directly in javascript.
   // This is intended for use in generating a "static html" of the scene.
-  std::string CreateCommands() {
+  // The `path` is the path of this element.
+  std::string CreateCommands(const std::string& path = "") {
     std::string html;
     if (object_) {
       html += CreateCommand(*object_);
     }
     if (transform_) {
-      html += CreateCommand(*transform_);
+      html += CreateCommand(PackTransform(path, *transform_));
     }
     for (const auto& [property, msg] : properties_) {
       unused(property);
@@ -234,8 +293,7 @@ class SceneTreeElement {
     }
 
     for (const auto& [name, child] : children_) {
-      unused(name);
-      html += child->CreateCommands();
+      html += child->CreateCommands(path + "/" + name);
     }
     return html;
   }
@@ -246,12 +304,14 @@ class SceneTreeElement {
 
   // The msgpack'd set_object command.
   std::optional<std::string> object_{std::nullopt};
-  // The msgpack'd set_transform command.
-  std::optional<std::string> transform_{std::nullopt};
+  // The transform, which is packed into a set_transform command on demand
+  // (since transforms are updated much more often than they are sent).
+  std::optional<TransformMatrix> transform_{std::nullopt};
   // The msgpack'd set_property command(s).
   std::map<std::string, std::string> properties_{};
   // Children, with the key value denoting their (relative) path name.
-  std::map<std::string, std::unique_ptr<SceneTreeElement>> children_{};
+  std::map<std::string, std::unique_ptr<SceneTreeElement>, std::less<>>
+      children_{};
 };
 
 class MeshcatShapeReifier : public ShapeReifier {
@@ -684,7 +744,10 @@ class Meshcat::Impl {
         DRAKE_DEMAND(IsThread(websocket_thread_id_));
         int websocket_backpressure = 0;
         for (WebSocket* ws : websockets_) {
+          SendPendingTransforms(ws);
           websocket_backpressure += ws->getBufferedAmount();
+          // Transforms that are still pending count as backpressure, too.
+          websocket_backpressure += pending_transforms_.count(ws);
         }
         p.set_value(websocket_backpressure);
       });
@@ -1023,19 +1086,75 @@ class Meshcat::Impl {
                     const Eigen::Ref<const Eigen::Matrix4d>& matrix) {
     DRAKE_DEMAND(IsThread(main_thread_id_));
 
-    internal::SetTransformData data;
-    data.path = FullPath(path);
-    Eigen::Map<Eigen::Matrix4d>(data.matrix) = matrix;
+    std::string full_path = FullPath(path);
+    const TransformMatrix transform = ToTransformMatrix(matrix);
+    transforms_.insert_or_assign(full_path, transform);
 
-    Defer([this, data = std::move(data)]() {
+    Defer([this, path = std::move(full_path), transform]() {
       DRAKE_DEMAND(IsThread(websocket_thread_id_));
       DRAKE_DEMAND(app_ != nullptr);
-      std::stringstream message_stream;
-      msgpack::pack(message_stream, data);
-      std::string message = message_stream.str();
-      app_->publish("all", message, uWS::OpCode::BINARY, false);
-      SceneTreeElement& e = scene_tree_root_[data.path];
-      e.transform() = std::move(message);
+      app_->publish("all", PackTransform(path, transform),
+                    uWS::OpCode::BINARY, false);
+      scene_tree_root_[path].transform() = transform;
+      // This transform supersedes any older one that is still pending.
+      for (auto& [ws, pending] : pending_transforms_) {
+        unused(ws);
+        pending.erase(path);
+      }
+    });
+  }
+
+  // This function is public via the PIMPL.
+  void SetTransforms(const std::vector<std::string>& paths,
+                     const std::vector<RigidTransformd>& X_ParentPaths) {
+    DRAKE_DEMAND(IsThread(main_thread_id_));
+    DRAKE_THROW_UNLESS(paths.size() == X_ParentPaths.size());
+
+    // Only the transforms that changed are sent.
+    std::vector<std::pair<std::string, TransformMatrix>> changed;
+    for (size_t i = 0; i < paths.size(); ++i) {
+      std::string full_path = FullPath(paths[i]);
+      const TransformMatrix transform =
+          ToTransformMatrix(X_ParentPaths[i].GetAsMatrix4());
+      auto [iter, inserted] = transforms_.try_emplace(full_path, transform);
+      if (!inserted) {
+        if (iter->second == transform) {
+          continue;
+        }
+        iter->second = transform;
+      }
+      changed.emplace_back(std::move(full_path), transform);
+    }
+    if (changed.empty()) {
+      return;
+    }
+
+    Defer([this, changed = std::move(changed)]() {
+      DRAKE_DEMAND(IsThread(websocket_thread_id_));
+      for (const auto& [path, transform] : changed) {
+        scene_tree_root_[path].transform() = transform;
+      }
+      // The message is sent right away to the sockets that have kept up with
+      // the previous ones. For the others, the transforms are merged with the
+      // ones they are still waiting for, and sent once they have drained.
+      std::string message;
+      for (WebSocket* ws : websockets_) {
+        auto pending = pending_transforms_.find(ws);
+        if (pending == pending_transforms_.end() && !HasBackpressure(ws)) {
+          if (message.empty()) {
+            message = PackTransforms(changed.begin(), changed.end());
+          }
+          ws->send(message, uWS::OpCode::BINARY);
+          continue;
+        }
+        if (pending == pending_transforms_.end()) {
+          pending = pending_transforms_.try_emplace(ws).first;
+        }
+        for (const auto& [path, transform] : changed) {
+          pending->second.insert_or_assign(path, transform);
+        }
+        SendPendingTransforms(ws);
+      }
     });
   }
 
@@ -1045,6 +1164,9 @@ class Meshcat::Impl {
 
     internal::DeleteData data;
     data.path = FullPath(path);
+    // The transforms of the deleted paths must be sent again if they are set
+    // again, even to the same value.
+    EraseDescendants(data.path, &transforms_);
 
     Defer([this, data = std::move(data)]() {
       DRAKE_DEMAND(IsThread(websocket_thread_id_));
@@ -1053,6 +1175,10 @@ class Meshcat::Impl {
       msgpack::pack(message_stream, data);
       app_->publish("all", message_stream.str(), uWS::OpCode::BINARY, false);
       scene_tree_root_.Delete(data.path);
+      for (auto& [ws, pending] : pending_transforms_) {
+        unused(ws);
+        EraseDescendants(data.path, &pending);
+      }
     });
   }
 
@@ -1084,85 +1210,116 @@ class Meshcat::Impl {
   void SetAnimation(const MeshcatAnimation& animation) {
     DRAKE_DEMAND(IsThread(main_thread_id_));
 
-    std::stringstream message_stream;
-    // We pack this message in-place (rather than using structs to organize
-    // the packing) for a few reasons:
-    //  1) we want to avoid copying the big data nested structure,
-    //  2) this message type would require a nasty hairball of structs, and
-    //  3) the nested structures have paths inside that must be modified with
-    //     FullPath().
-    msgpack::packer o(message_stream);
-    // The details of this message have been extracted primarily from
-    // meshcat/test/animation.html and
-    // meshcat-python/src/meshcat/animation.py.
-    o.pack_map(3);
-    o.pack("type");
-    o.pack("set_animation");
-    o.pack("animations");
-    {
-      o.pack_array(animation.path_tracks_.size());
-      for (const auto& path_track : animation.path_tracks_) {
-        o.pack_map(2);
-        o.pack("path");
-        // TODO(russt): Handle the case where the FullPaths are not unique.
-        o.pack(FullPath(path_track.first));
-        o.pack("clip");
-        {
-          o.pack_map(3);
-          o.pack("fps");
-          o.pack(animation.frames_per_second());
-          o.pack("name");
-          o.pack("default");
-          o.pack("tracks");
+    // The keyframes are only copied here (which is cheap, since they are
+    // stored as contiguous arrays); they are decimated and packed in the
+    // websocket thread, so that sending a long recording does not stall the
+    // caller.
+    std::vector<std::pair<std::string, MeshcatAnimation::PropertyTracks>>
+        path_tracks;
+    path_tracks.reserve(animation.path_tracks_.size());
+    for (const auto& [path, property_tracks] : animation.path_tracks_) {
+      // TODO(russt): Handle the case where the FullPaths are not unique.
+      path_tracks.emplace_back(FullPath(path), property_tracks);
+    }
+
+    Defer([this, path_tracks = std::move(path_tracks),
+           frames_per_second = animation.frames_per_second(),
+           tolerance = animation.decimation_tolerance(),
+           play = animation.autoplay(), loop_mode = animation.loop_mode(),
+           repetitions = animation.repetitions(),
+           clamp_when_finished = animation.clamp_when_finished()]() {
+      DRAKE_DEMAND(IsThread(websocket_thread_id_));
+      DRAKE_DEMAND(app_ != nullptr);
+
+      std::stringstream message_stream;
+      // We pack this message in-place (rather than using structs to organize
+      // the packing) for a few reasons:
+      //  1) we want to avoid copying the big data nested structure, and
+      //  2) this message type would require a nasty hairball of structs.
+      msgpack::packer o(message_stream);
+      // The details of this message have been extracted primarily from
+      // meshcat/test/animation.html and
+      // meshcat-python/src/meshcat/animation.py.
+      o.pack_map(3);
+      o.pack("type");
+      o.pack("set_animation");
+      o.pack("animations");
+      {
+        o.pack_array(path_tracks.size());
+        for (const auto& [path, property_tracks] : path_tracks) {
+          o.pack_map(2);
+          o.pack("path");
+          o.pack(path);
+          o.pack("clip");
           {
-            o.pack_array(path_track.second.size());
-            for (const auto& property_track : path_track.second) {
-              o.pack_map(3);
-              o.pack("name");
-              o.pack("." + property_track.first);
-              o.pack("type");
-              o.pack(property_track.second.js_type);
-              o.pack("keys");
-              std::visit(
-                  [&o](const auto& track) {
-                    using T = std::decay_t<decltype(track)>;
-                    if constexpr (!std::is_same_v<T, std::monostate>) {
-                      o.pack_array(track.size());
-                      for (const auto& key : track) {
-                        o.pack_map(2);
-                        o.pack("time");
-                        o.pack(key.first);
-                        o.pack("value");
-                        o.pack(key.second);
+            o.pack_map(3);
+            o.pack("fps");
+            o.pack(frames_per_second);
+            o.pack("name");
+            o.pack("default");
+            o.pack("tracks");
+            {
+              o.pack_array(property_tracks.size());
+              for (const auto& [property, typed_track] : property_tracks) {
+                const std::vector<int> kept =
+                    MeshcatAnimation::DecimateKeyFrames(typed_track,
+                                                        tolerance);
+                o.pack_map(4);
+                o.pack("name");
+                o.pack("." + property);
+                o.pack("type");
+                o.pack(typed_track.js_type);
+                // The keyframes are packed as the "times" and (flattened)
+                // "values" arrays that three.js's KeyframeTrack uses, which
+                // are much more compact than an array of {time, value} keys.
+                std::visit(
+                    [&o, &kept](const auto& track) {
+                      using T = std::decay_t<decltype(track)>;
+                      if constexpr (std::is_same_v<T, std::monostate>) {
+                        o.pack("times");
+                        o.pack_array(0);
+                        o.pack("values");
+                        o.pack_array(0);
+                      } else {
+                        o.pack("times");
+                        o.pack_array(kept.size());
+                        for (int i : kept) {
+                          o.pack(track.frames[i]);
+                        }
+                        o.pack("values");
+                        o.pack_array(kept.size() * track.size);
+                        for (int i : kept) {
+                          for (int k = 0; k < track.size; ++k) {
+                            const typename T::Element value =
+                                track.values[i * track.size + k];
+                            o.pack(value);
+                          }
+                        }
                       }
-                    }
-                  },
-                  property_track.second.track);
+                    },
+                    typed_track.track);
+              }
             }
           }
         }
       }
-    }
-    o.pack("options");
-    {
-      o.pack_map(4);
-      o.pack("play");
-      o.pack(animation.autoplay());
-      o.pack("loopMode");
-      o.pack(animation.loop_mode());
-      o.pack("repetitions");
-      o.pack(animation.repetitions());
-      o.pack("clampWhenFinished");
-      o.pack(animation.clamp_when_finished());
-    }
-
-    Defer(
-        [this, message = message_stream.str()]() {
-          DRAKE_DEMAND(IsThread(websocket_thread_id_));
-          DRAKE_DEMAND(app_ != nullptr);
-          app_->publish("all", message, uWS::OpCode::BINARY, false);
-          animation_ = std::move(message);
-        });
+      o.pack("options");
+      {
+        o.pack_map(4);
+        o.pack("play");
+        o.pack(play);
+        o.pack("loopMode");
+        o.pack(loop_mode);
+        o.pack("repetitions");
+        o.pack(repetitions);
+        o.pack("clampWhenFinished");
+        o.pack(clamp_when_finished);
+      }
+
+      std::string message = message_stream.str();
+      app_->publish("all", message, uWS::OpCode::BINARY, false);
+      animation_ = std::move(message);
+    });
   }
 
   // This function is public via the PIMPL.
@@ -1517,7 +1674,7 @@ class Meshcat::Impl {
       if (!e || !e->transform()) {
         p.set_value("");
       } else {
-        p.set_value(*e->transform());
+        p.set_value(PackTransform(path, *e->transform()));
       }
     });
     return f.get();
@@ -1583,6 +1740,17 @@ class Meshcat::Impl {
     DRAKE_UNREACHABLE();
   }
 
+  void InjectTransformsBackpressure(bool hold) {
+    DRAKE_DEMAND(IsThread(main_thread_id_));
+    Defer([this, hold]() {
+      DRAKE_DEMAND(IsThread(websocket_thread_id_));
+      inject_transforms_backpressure_ = hold;
+      for (WebSocket* ws : websockets_) {
+        SendPendingTransforms(ws);
+      }
+    });
+  }
+
  private:
   bool IsThread(std::thread::id thread_id) const {
     return (std::this_thread::get_id() == thread_id);
@@ -1663,6 +1831,10 @@ class Meshcat::Impl {
       unused(op_code);
       HandleMessage(ws, message);
     };
+    behavior.drain = [this](WebSocket* ws) {
+      DRAKE_DEMAND(IsThread(websocket_thread_id_));
+      SendPendingTransforms(ws);
+    };
 
     uWS::App app =
         uWS::App()
@@ -1763,6 +1935,7 @@ class Meshcat::Impl {
         "Meshcat connection closed from {}",
         ws->getRemoteAddressAsText());
     websockets_.erase(ws);
+    pending_transforms_.erase(ws);
     const int new_count = --num_websockets_;
     DRAKE_DEMAND(new_count >= 0);
     DRAKE_DEMAND(new_count == static_cast<int>(websockets_.size()));
@@ -1814,6 +1987,34 @@ class Meshcat::Impl {
     }
   }
 
+  // This function is a private utility for use within this class. It sends
+  // the transforms that `ws` is waiting for, as a single set_transforms
+  // command, once `ws` has no backpressure.
+  //
+  // N.B. uWS drains the messages published to a socket before anything is
+  // sent to it directly, so the command is ordered correctly with respect to
+  // the published ones.
+  void SendPendingTransforms(WebSocket* ws) {
+    DRAKE_DEMAND(IsThread(websocket_thread_id_));
+    auto pending = pending_transforms_.find(ws);
+    if (pending == pending_transforms_.end() || HasBackpressure(ws)) {
+      return;
+    }
+    if (!pending->second.empty()) {
+      ws->send(PackTransforms(pending->second.begin(), pending->second.end()),
+               uWS::OpCode::BINARY);
+    }
+    pending_transforms_.erase(pending);
+  }
+
+  // This function is a private utility for use within this class. It returns
+  // true iff `ws` still has buffered messages to send (or backpressure was
+  // injected by a unit test).
+  bool HasBackpressure(WebSocket* ws) const {
+    DRAKE_DEMAND(IsThread(websocket_thread_id_));
+    return inject_transforms_backpressure_ || ws->getBufferedAmount() > 0;
+  }
+
   // A functor object that we can post from the main thread into the websocket
   // thread.
   using Callback = uWS::MoveOnlyFunction<void()>;
@@ -1886,6 +2087,9 @@ class Meshcat::Impl {
   const MeshcatParams params_;
   int port_{};
   std::mt19937 generator_{};
+  // The transforms most recently set, keyed by full path, so that SetTransforms
+  // can skip the ones that did not change.
+  std::map<std::string, TransformMatrix, std::less<>> transforms_{};
 
   // These variables should only be accessed in the websocket thread.
   std::thread::id websocket_thread_id_{};
@@ -1894,6 +2098,11 @@ class Meshcat::Impl {
   uWS::App* app_{nullptr};
   us_listen_socket_t* listen_socket_{nullptr};
   std::set<WebSocket*> websockets_{};
+  // The transforms, keyed by full path, that were set while a socket had
+  // backpressure, and that the socket is still waiting for.
+  std::map<WebSocket*, std::map<std::string, TransformMatrix, std::less<>>>
+      pending_transforms_{};
+  bool inject_transforms_backpressure_{false};
 
   // This variable may be accessed from any thread, but should only be modified
   // in the websocket thread.
@@ -2102,6 +2311,11 @@ void Meshcat::SetTransform(std::string_view path,
   impl().SetTransform(path, matrix);
 }
 
+void Meshcat::SetTransforms(const std::vector<std::string>& paths,
+                            const std::vector<RigidTransformd>& X_ParentPaths) {
+  impl().SetTransforms(paths, X_ParentPaths);
+}
+
 void Meshcat::Delete(std::string_view path) {
   impl().Delete(path);
 }
@@ -2198,5 +2412,9 @@ void Meshcat::InjectWebsocketThreadFault(int fault_number) {
   impl().InjectWebsocketThreadFault(fault_number);
 }
 
+void Meshcat::InjectTransformsBackpressure(bool hold) {
+  impl().InjectTransformsBackpressure(hold);
+}
+
 }  // namespace geometry
 }  // namespace drake
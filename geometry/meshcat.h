@@ -412,6 +412,25 @@ class Meshcat {
   void SetTransform(std::string_view path,
                     const Eigen::Ref<const Eigen::Matrix4d>& matrix);
 
+  /** Sets the transforms of many paths at once, e.g., to update all of the
+  poses of a scene after a simulation step. This is equivalent to calling
+  SetTransform() for each of the paths, but much cheaper for large scenes:
+  - the transforms that are unchanged since they were last set (by either
+    function) are skipped;
+  - the changed ones are sent to each browser in a single message, which
+    packs their matrices into one binary blob;
+  - a browser that has not yet received the previous messages (i.e., whose
+    connection has backpressure) is not sent more messages; instead, the
+    latest transform of each path is sent to it, again in a single message,
+    once it has caught up.
+  @param paths "/"-delimited strings indicating the paths in the scene tree.
+               See @ref meshcat_path "Meshcat paths" for the semantics.
+  @param X_ParentPaths the relative transforms from each path to its
+                       immediate parent.
+  @throws std::exception if `paths` and `X_ParentPaths` differ in size. */
+  void SetTransforms(const std::vector<std::string>& paths,
+                     const std::vector<math::RigidTransformd>& X_ParentPaths);
+
   /** Deletes the object at the given `path` as well as all of its children.
   See @ref meshcat_path for the detailed semantics of deletion. */
   void Delete(std::string_view path = "");
@@ -478,7 +497,12 @@ class Meshcat {
   // TODO(russt): Support multiple animations, by name.  Currently "default" is
   // hard-coded in the meshcat javascript.
   /** Sets the MeshcatAnimation, which creates a slider interface element to
-  play/pause/rewind through a series of animation frames in the visualizer. */
+  play/pause/rewind through a series of animation frames in the visualizer.
+
+  The keyframes of the `animation` are copied, and then decimated (see
+  MeshcatAnimation::set_decimation_tolerance()) and serialized in the
+  background, so later changes to the `animation` do not affect the one that
+  is sent, and this call returns quickly even for long animations. */
   void SetAnimation(const MeshcatAnimation& animation);
 
   /** @name Meshcat Controls
@@ -611,6 +635,12 @@ class Meshcat {
   /* (Internal use for unit testing only) The max value (inclusive) for
   fault_number, above. */
   static constexpr int kMaxFaultNumber = 3;
+
+  /* (Internal use for unit testing only) While `hold` is true, SetTransforms()
+  treats every websocket connection as having backpressure, so that its
+  transforms are coalesced per path instead of being sent. Setting `hold` back
+  to false sends them, as if the connections had drained. */
+  void InjectTransformsBackpressure(bool hold);
 #endif
 
  private:
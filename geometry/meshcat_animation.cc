@@ -1,21 +1,94 @@
 #include "drake/geometry/meshcat_animation.h"
 
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+
 namespace drake {
 namespace geometry {
+namespace {
+
+constexpr double kInfinity = std::numeric_limits<double>::infinity();
+
+// Returns the (increasing) indices of the keyframes to keep among the
+// `num_keys` keyframes of a track, such that interpolating between the kept
+// keyframes reproduces each of the others to within `tolerance`. The functor
+// error(i, a, b) returns the error at keyframe i of the interpolation between
+// keyframes a and b, where a < i < b.
+//
+// This is the Ramer-Douglas-Peucker algorithm: the keyframe with the largest
+// error is kept, and both sides of it are decimated in turn. A track that does
+// not change is thus decimated in a single pass.
+template <typename ErrorFunction>
+std::vector<int> Decimate(int num_keys, double tolerance,
+                          const ErrorFunction& error) {
+  std::vector<bool> keep(num_keys, false);
+  if (num_keys > 0) {
+    keep.front() = true;
+    keep.back() = true;
+  }
+  // The spans (a, b) of keyframes still to be decimated. They are stored
+  // explicitly (rather than recursing) since they can be nested as deep as the
+  // number of keyframes.
+  std::vector<std::pair<int, int>> spans;
+  if (num_keys > 2) {
+    spans.emplace_back(0, num_keys - 1);
+  }
+  while (!spans.empty()) {
+    const auto [a, b] = spans.back();
+    spans.pop_back();
+    int worst = -1;
+    double worst_error = tolerance;
+    for (int i = a + 1; i < b; ++i) {
+      const double error_i = error(i, a, b);
+      if (error_i > worst_error) {
+        worst = i;
+        worst_error = error_i;
+      }
+    }
+    if (worst >= 0) {
+      keep[worst] = true;
+      spans.emplace_back(a, worst);
+      spans.emplace_back(worst, b);
+    }
+  }
+  std::vector<int> kept;
+  for (int i = 0; i < num_keys; ++i) {
+    if (keep[i]) {
+      kept.push_back(i);
+    }
+  }
+  return kept;
+}
+
+}  // namespace
 
 MeshcatAnimation::MeshcatAnimation(double frames_per_second)
     : frames_per_second_(frames_per_second) {}
 
 MeshcatAnimation::~MeshcatAnimation() = default;
 
+void MeshcatAnimation::set_decimation_tolerance(
+    std::optional<double> tolerance) {
+  DRAKE_THROW_UNLESS(!tolerance || *tolerance >= 0);
+  decimation_tolerance_ = tolerance;
+}
+
 void MeshcatAnimation::SetTransform(int frame, const std::string& path,
                                     const math::RigidTransformd& X_ParentPath) {
-  std::vector<double> position(3);
-  Eigen::Vector3d::Map(&position[0]) = X_ParentPath.translation();
-  const auto q = X_ParentPath.rotation().ToQuaternion();
-  std::vector<double> quaternion{q.x(), q.y(), q.z(), q.w()};
-  SetProperty(frame, path, "position", "vector3", position);
-  SetProperty(frame, path, "quaternion", "quaternion", quaternion);
+  const Eigen::Quaterniond q = X_ParentPath.rotation().ToQuaternion();
+  const double quaternion[4] = {q.x(), q.y(), q.z(), q.w()};
+  PropertyTracks& tracks = path_tracks_[path];
+  SetKeyFrame<std::vector<double>>(frame, path, "position", "vector3",
+                                   X_ParentPath.translation().data(), 3,
+                                   &tracks);
+  SetKeyFrame<std::vector<double>>(frame, path, "quaternion", "quaternion",
+                                   quaternion, 4, &tracks);
 }
 
 void MeshcatAnimation::SetProperty(int frame, const std::string& path,
@@ -47,9 +120,26 @@ template <typename T>
 void MeshcatAnimation::SetProperty(int frame, const std::string& path,
                                    const std::string& property,
                                    const std::string& js_type, const T& value) {
-  TypedTrack& tt = path_tracks_[path][property];
+  if constexpr (std::is_same_v<T, std::vector<double>>) {
+    SetKeyFrame<T>(frame, path, property, js_type, value.data(),
+                   static_cast<int>(value.size()), &path_tracks_[path]);
+  } else {
+    SetKeyFrame<T>(frame, path, property, js_type, &value, 1,
+                   &path_tracks_[path]);
+  }
+}
+
+template <typename T>
+void MeshcatAnimation::SetKeyFrame(int frame, const std::string& path,
+                                   const std::string& property,
+                                   const std::string& js_type,
+                                   const typename Track<T>::Element* value,
+                                   int size, PropertyTracks* tracks) {
+  TypedTrack& tt = (*tracks)[property];
   if (std::holds_alternative<std::monostate>(tt.track)) {
-    tt.track = Track<T>();
+    Track<T> track;
+    track.size = size;
+    tt.track = std::move(track);
     tt.js_type = js_type;
   } else if (tt.js_type != js_type) {
     throw std::runtime_error(fmt::format(
@@ -57,7 +147,86 @@ void MeshcatAnimation::SetProperty(int frame, const std::string& path,
         path, property, tt.js_type, js_type));
   }
   // get<T> will also throw bad_variant_access if the types don't match.
-  std::get<Track<T>>(tt.track)[frame] = value;
+  Track<T>& track = std::get<Track<T>>(tt.track);
+  if (size != track.size) {
+    throw std::runtime_error(fmt::format(
+        "{} property {} already has a track with values of size {} != {}",
+        path, property, track.size, size));
+  }
+
+  // Recording appends the frames in order, so look at the end first.
+  auto iter = track.frames.end();
+  if (!track.frames.empty() && track.frames.back() >= frame) {
+    iter = std::lower_bound(track.frames.begin(), track.frames.end(), frame);
+  }
+  const int begin = (iter - track.frames.begin()) * size;
+  if (iter != track.frames.end() && *iter == frame) {
+    std::copy(value, value + size, track.values.begin() + begin);
+  } else {
+    track.frames.insert(iter, frame);
+    track.values.insert(track.values.begin() + begin, value, value + size);
+  }
+}
+
+std::vector<int> MeshcatAnimation::DecimateKeyFrames(
+    const TypedTrack& typed_track, std::optional<double> tolerance) {
+  return std::visit(
+      [&typed_track, &tolerance](const auto& track) -> std::vector<int> {
+        using TrackType = std::decay_t<decltype(track)>;
+        if constexpr (std::is_same_v<TrackType, std::monostate>) {
+          return {};
+        } else if (!tolerance) {
+          std::vector<int> kept(track.frames.size());
+          std::iota(kept.begin(), kept.end(), 0);
+          return kept;
+        } else if constexpr (std::is_same_v<TrackType, Track<bool>>) {
+          // Boolean tracks use a discrete interpolation; the value of a
+          // keyframe holds until the next one.
+          return Decimate(track.frames.size(), *tolerance,
+                          [&track](int i, int a, int) {
+                            return track.values[i] == track.values[a]
+                                       ? 0.0
+                                       : kInfinity;
+                          });
+        } else {
+          // The interpolation parameter of keyframe i between a and b.
+          const int* const frames = track.frames.data();
+          auto param = [frames](int i, int a, int b) {
+            return static_cast<double>(frames[i] - frames[a]) /
+                   (frames[b] - frames[a]);
+          };
+          const int size = track.size;
+          const double* const values = track.values.data();
+          if (typed_track.js_type == "quaternion") {
+            // Quaternion tracks use a spherical linear interpolation.
+            DRAKE_DEMAND(size == 4);
+            auto key = [values](int i) {
+              const double* q = values + 4 * i;
+              return Eigen::Quaterniond(q[3], q[0], q[1], q[2]);
+            };
+            return Decimate(track.frames.size(), *tolerance,
+                            [&key, &param](int i, int a, int b) {
+                              return key(i).angularDistance(
+                                  key(a).slerp(param(i, a, b), key(b)));
+                            });
+          }
+          // The other tracks use a linear interpolation.
+          return Decimate(
+              track.frames.size(), *tolerance,
+              [values, size, &param](int i, int a, int b) {
+                const double t = param(i, a, b);
+                double squared_error = 0;
+                for (int k = 0; k < size; ++k) {
+                  const double error =
+                      values[i * size + k] - (1 - t) * values[a * size + k] -
+                      t * values[b * size + k];
+                  squared_error += error * error;
+                }
+                return std::sqrt(squared_error);
+              });
+        }
+      },
+      typed_track.track);
 }
 
 }  // namespace geometry
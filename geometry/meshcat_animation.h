@@ -1,8 +1,10 @@
 #pragma once
 
+#include <algorithm>
 #include <map>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <variant>
 #include <vector>
 
@@ -71,6 +73,12 @@ class MeshcatAnimation {
   int repetitions() const { return repetitions_; }
   bool clamp_when_finished() const { return clamp_when_finished_; }
 
+  /** Returns the tolerance of the keyframe decimation, or std::nullopt if the
+  keyframes are not decimated. See set_decimation_tolerance(). */
+  std::optional<double> decimation_tolerance() const {
+    return decimation_tolerance_;
+  }
+
   /** Set the start time of the animation.  This is only for convenience; it is
   used in the frame() method to allow callers to look up the frame number based
   on the current time, the start time, and the frame rate.  It is not passed to
@@ -102,6 +110,20 @@ class MeshcatAnimation {
   only an effect if its last loop has really finished). */
   void set_clamp_when_finished(bool clamp) { clamp_when_finished_ = clamp; }
 
+  /** Sets the tolerance used to drop redundant keyframes when the animation
+  is sent to Meshcat (the keyframes stored in this object are unaffected).
+  A keyframe is redundant if the visualizer's interpolation between the
+  keyframes that are kept reproduces its value to within `tolerance`: the
+  Euclidean distance for number and vector properties (e.g., meters for the
+  position of a transform), and the rotation angle, in radians, for
+  quaternions. Boolean properties are not interpolated, so only their
+  repeated values are dropped. The first and last keyframes of each track are
+  always kept. A tolerance of zero drops only the keyframes that are exactly
+  redundant, e.g., those of the objects that do not move. When std::nullopt,
+  every keyframe is sent. The default is std::nullopt.
+  @throws std::exception if `tolerance` is negative. */
+  void set_decimation_tolerance(std::optional<double> tolerance);
+
   /** Set the RigidTransform at `frame` in the animation for a given `path` in
   the the scene tree.  @see Meshcat::SetTransform.
   @param frame a non-negative integer indicating the frame at which this
@@ -158,7 +180,8 @@ class MeshcatAnimation {
   @param property the string name of the property to set
   @param value the new value.
   @throws std::exception if this path/property has already been set with a
-                         different type.
+                         different type, or with a vector of a different
+                         size.
 
   @pydrake_mkdoc_identifier{vector_double}
   */
@@ -192,10 +215,17 @@ class MeshcatAnimation {
       return std::nullopt;
     }
     const Track<T>& t = std::get<Track<T>>(tt.track);
-    if (t.find(frame) == t.end()) {
+    const auto iter = std::lower_bound(t.frames.begin(), t.frames.end(), frame);
+    if (iter == t.frames.end() || *iter != frame) {
       return std::nullopt;
     }
-    return t.at(frame);
+    const int begin = (iter - t.frames.begin()) * t.size;
+    if constexpr (std::is_same_v<T, std::vector<double>>) {
+      return std::vector<double>(t.values.begin() + begin,
+                                 t.values.begin() + begin + t.size);
+    } else {
+      return t.values[begin];
+    }
   }
 
   /** Returns the javascript type for a particular path/property, or the empty
@@ -212,9 +242,18 @@ class MeshcatAnimation {
                    const std::string& property, const std::string& js_type,
                    const T& value);
 
-  // A map of frame => value.
+  // The keyframes of a track, stored as columns in increasing order of frame
+  // (so that recording, which mostly appends, is cheap). Each keyframe has
+  // `size` consecutive elements in `values`: one for the bool and double
+  // tracks, and the size of the vectors for the std::vector<double> tracks.
   template <typename T>
-  using Track = std::map<int, T>;
+  struct Track {
+    using Element =
+        std::conditional_t<std::is_same_v<T, std::vector<double>>, double, T>;
+    std::vector<int> frames;
+    std::vector<Element> values;
+    int size{1};
+  };
 
   // All property values in a track must be the same type.
   struct TypedTrack {
@@ -230,6 +269,20 @@ class MeshcatAnimation {
   // A map of path => property tracks.
   using PathTracks = std::map<std::string, PropertyTracks>;
 
+  // Sets the keyframe at `frame` of the path/property track in `tracks` to
+  // the `size` elements of `value`, creating the track if needed.
+  template <typename T>
+  void SetKeyFrame(int frame, const std::string& path,
+                   const std::string& property, const std::string& js_type,
+                   const typename Track<T>::Element* value, int size,
+                   PropertyTracks* tracks);
+
+  // Returns the indices of the keyframes of `track` that are sent to Meshcat
+  // when the decimation tolerance is `tolerance`; see
+  // set_decimation_tolerance().
+  static std::vector<int> DecimateKeyFrames(const TypedTrack& track,
+                                            std::optional<double> tolerance);
+
   // TODO(russt): Narrow this access to restore encapsulation.
   friend class Meshcat;
 
@@ -242,6 +295,7 @@ class MeshcatAnimation {
   LoopMode loop_mode_{kLoopRepeat};
   int repetitions_{1};
   bool clamp_when_finished_{true};
+  std::optional<double> decimation_tolerance_{};
 };
 
 }  // namespace geometry
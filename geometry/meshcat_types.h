@@ -367,6 +367,19 @@ struct SetTransformData {
   MSGPACK_DEFINE_MAP(type, path, matrix);
 };
 
+// Note that this struct is unique to Drake's integration of meshcat; it is not
+// part of upstream meshcat.js. We unpack it within meshcat.html, into one
+// set_transform command per path for meshcat.js.
+struct SetTransformsData {
+  std::string type{"set_transforms"};
+  std::vector<std::string> paths;
+  // The column-major 4x4 matrices of the `paths`, as 16 doubles per path in
+  // the host's byte order (which is little-endian on all supported platforms,
+  // like the browsers'), packed as a single msgpack bin.
+  std::vector<char> matrices;
+  MSGPACK_DEFINE_MAP(type, paths, matrices);
+};
+
 // Note that this struct is unique to Drake's integration of meshcat; it is not
 // part of upstream meshcat.js. We handle it directly within meshcat.html,
 // without ever feeding it into meshcat.js.
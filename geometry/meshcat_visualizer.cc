@@ -170,11 +170,19 @@ template <typename T>
 void MeshcatVisualizer<T>::SetTransforms(
     const systems::Context<T>& context,
     const QueryObject<T>& query_object) const {
+  const bool set_transforms = !recording_ || set_transforms_while_recording_;
+  std::vector<std::string> paths;
+  std::vector<math::RigidTransformd> X_WFs;
+  if (set_transforms) {
+    paths.reserve(dynamic_frames_.size());
+    X_WFs.reserve(dynamic_frames_.size());
+  }
   for (const auto& [frame_id, path] : dynamic_frames_) {
     const math::RigidTransformd X_WF =
         internal::convert_to_double(query_object.GetPoseInWorld(frame_id));
-    if (!recording_ || set_transforms_while_recording_) {
-      meshcat_->SetTransform(path, X_WF);
+    if (set_transforms) {
+      paths.push_back(path);
+      X_WFs.push_back(X_WF);
     }
     if (recording_) {
       animation_->SetTransform(
@@ -182,6 +190,10 @@ void MeshcatVisualizer<T>::SetTransforms(
           X_WF);
     }
   }
+  // All of the poses are sent at once, which skips the unchanged ones.
+  if (set_transforms) {
+    meshcat_->SetTransforms(paths, X_WFs);
+  }
 }
 
 template <typename T>
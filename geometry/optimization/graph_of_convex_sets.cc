@@ -1,5 +1,6 @@
 #include "drake/geometry/optimization/graph_of_convex_sets.h"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <string>
@@ -8,6 +9,8 @@
 
 #include <fmt/format.h>
 
+#include "drake/common/parallel_for.h"
+#include "drake/common/timer.h"
 #include "drake/math/quadratic_form.h"
 #include "drake/solvers/create_cost.h"
 #include "drake/solvers/solve.h"
@@ -21,12 +24,14 @@ using EdgeId = GraphOfConvexSets::EdgeId;
 using Vertex = GraphOfConvexSets::Vertex;
 using VertexId = GraphOfConvexSets::VertexId;
 
+using drake::internal::ParallelFor;
 using Eigen::MatrixXd;
 using Eigen::Ref;
 using Eigen::RowVector2d;
 using Eigen::RowVectorXd;
 using Eigen::VectorXd;
 using solvers::Binding;
+using solvers::BoundingBoxConstraint;
 using solvers::Constraint;
 using solvers::Cost;
 using solvers::L1NormCost;
@@ -616,23 +621,29 @@ void GraphOfConvexSets::AddPerspectiveConstraint(
 }
 
 namespace {
-MathematicalProgramResult Solve(const MathematicalProgram& prog,
-                                const GraphOfConvexSetsOptions& options) {
+MathematicalProgramResult Solve(
+    const MathematicalProgram& prog, const GraphOfConvexSetsOptions& options,
+    const std::optional<Eigen::VectorXd>& initial_guess = std::nullopt) {
   MathematicalProgramResult result;
   if (options.solver) {
-    options.solver->Solve(prog, {}, options.solver_options, &result);
+    options.solver->Solve(prog, initial_guess, options.solver_options,
+                          &result);
   } else {
-    result = solvers::Solve(prog, {}, options.solver_options);
+    result = solvers::Solve(prog, initial_guess, options.solver_options);
   }
   return result;
 }
+
 }  // namespace
 
 MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
     VertexId source_id, VertexId target_id,
-    const GraphOfConvexSetsOptions& options) const {
+    const GraphOfConvexSetsOptions& options,
+    GraphOfConvexSetsStatistics* statistics) const {
   DRAKE_DEMAND(vertices_.find(source_id) != vertices_.end());
   DRAKE_DEMAND(vertices_.find(target_id) != vertices_.end());
+  GraphOfConvexSetsStatistics stats;
+  SteadyTimer timer;
 
   std::set<EdgeId> unusable_edges;
   if (options.preprocessing) {
@@ -880,7 +891,11 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
     }
   }
 
+  stats.setup_time = timer.Tick();
+  timer.Start();
   MathematicalProgramResult result = Solve(prog, options);
+  stats.relaxation_time = timer.Tick();
+  timer.Start();
 
   // Implements the rounding scheme put forth in Section 4.2 of
   // "Motion Planning around Obstacles with Convex Optimization":
@@ -900,7 +915,6 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
       }
     }
     int num_trials = 0;
-    MathematicalProgramResult best_rounded_result;
     while (static_cast<int>(paths.size()) < options.max_rounded_paths &&
            num_trials < options.max_rounding_trials) {
       ++num_trials;
@@ -946,42 +960,66 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
         continue;
       }
       paths.push_back(new_path);
+    }
 
-      // Optimize path
-      std::vector<Binding<Constraint>> added_constraints;
-      for (const auto& [edge_id, e] : edges_) {
-        if (e->phi_value_.has_value() || unusable_edges.count(edge_id)) {
-          continue;
-        }
-        if (std::find(new_path.begin(), new_path.end(), e.get()) !=
-            new_path.end()) {
-          added_constraints.push_back(
-              prog.AddBoundingBoxConstraint(1, 1, relaxed_phi.at(edge_id)));
+    // The restriction of the relaxation to a path fixes ϕ = 1 on the edges of
+    // the path, and ϕ = 0, y = 0, z = 0, ℓ = 0 on the other edges. These
+    // constraints are made once per edge, and shared by the programs of all
+    // the paths.
+    std::map<EdgeId, Binding<BoundingBoxConstraint>> on_path_constraints;
+    std::map<EdgeId, Binding<BoundingBoxConstraint>> off_path_constraints;
+    for (const auto& [edge_id, e] : edges_) {
+      if (e->phi_value_.has_value() || unusable_edges.count(edge_id)) {
+        continue;
+      }
+      const Variable& phi = relaxed_phi.at(edge_id);
+      on_path_constraints.emplace(
+          edge_id, Binding<BoundingBoxConstraint>(
+                       std::make_shared<BoundingBoxConstraint>(
+                           Vector1d::Ones(), Vector1d::Ones()),
+                       Vector1<Variable>(phi)));
+      VectorXDecisionVariable off_path_vars(1 + e->y_.size() + e->z_.size() +
+                                            e->ell_.size());
+      off_path_vars << phi, e->y_, e->z_, e->ell_;
+      off_path_constraints.emplace(
+          edge_id, Binding<BoundingBoxConstraint>(
+                       std::make_shared<BoundingBoxConstraint>(
+                           VectorXd::Zero(off_path_vars.size()),
+                           VectorXd::Zero(off_path_vars.size())),
+                       off_path_vars));
+    }
+
+    // Optimize the paths. Each path restricts its own copy of the relaxation,
+    // and the solvers that accept an initial guess start from the relaxed
+    // solution.
+    const int num_paths = static_cast<int>(paths.size());
+    std::vector<MathematicalProgramResult> rounded_results(num_paths);
+    ParallelFor(num_paths, options.max_rounding_threads, [&](int i) {
+      std::unique_ptr<MathematicalProgram> path_prog = prog.Clone();
+      std::set<EdgeId> path_edge_ids;
+      for (const Edge* e : paths[i]) {
+        path_edge_ids.insert(e->id());
+      }
+      for (const auto& [edge_id, binding] : off_path_constraints) {
+        if (path_edge_ids.count(edge_id)) {
+          path_prog->AddConstraint(on_path_constraints.at(edge_id));
         } else {
-          added_constraints.push_back(
-              prog.AddBoundingBoxConstraint(0, 0, relaxed_phi.at(edge_id)));
-          added_constraints.push_back(prog.AddLinearEqualityConstraint(
-              e->y_.cast<Expression>(), VectorXd::Zero(e->y_.size())));
-          added_constraints.push_back(prog.AddLinearEqualityConstraint(
-              e->z_.cast<Expression>(), VectorXd::Zero(e->z_.size())));
-          added_constraints.push_back(prog.AddLinearEqualityConstraint(
-              e->ell_.cast<Expression>(), VectorXd::Zero(e->ell_.size())));
+          path_prog->AddConstraint(binding);
         }
       }
+      rounded_results[i] = Solve(*path_prog, options, result.get_x_val());
+    });
+    stats.num_rounded_paths = num_paths;
 
-      MathematicalProgramResult rounded_result = Solve(prog, options);
-
-      // Check path quality.
+    // Check path quality.
+    MathematicalProgramResult best_rounded_result;
+    for (const MathematicalProgramResult& rounded_result : rounded_results) {
       if (rounded_result.is_success() &&
           (!best_rounded_result.is_success() ||
            rounded_result.get_optimal_cost() <
                best_rounded_result.get_optimal_cost())) {
         best_rounded_result = rounded_result;
       }
-
-      for (Binding<Constraint>& con : added_constraints) {
-        prog.RemoveConstraint(con);
-      }
     }
     if (best_rounded_result.is_success()) {
       result = best_rounded_result;
@@ -989,6 +1027,8 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
       result.set_solution_result(SolutionResult::kIterationLimit);
     }
   }
+  stats.rounding_time = timer.Tick();
+  timer.Start();
 
   // Push the placeholder variables and excluded edge variables into the result,
   // so that they can be accessed as if they were variables included in the
@@ -1075,14 +1115,19 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
   }
   result.set_decision_variable_index(decision_variable_index);
   result.set_x_val(x_val);
+  stats.postprocessing_time = timer.Tick();
+  if (statistics != nullptr) {
+    *statistics = stats;
+  }
 
   return result;
 }
 
 MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
     const Vertex& source, const Vertex& target,
-    const GraphOfConvexSetsOptions& options) const {
-  return SolveShortestPath(source.id(), target.id(), options);
+    const GraphOfConvexSetsOptions& options,
+    GraphOfConvexSetsStatistics* statistics) const {
+  return SolveShortestPath(source.id(), target.id(), options, statistics);
 }
 
 MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
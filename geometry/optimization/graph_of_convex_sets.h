@@ -57,6 +57,14 @@ struct GraphOfConvexSetsOptions {
   max_rounded_paths is less than or equal to zero, this option is ignored. */
   int rounding_seed{0};
 
+  /** Maximum number of threads used to solve the programs restricted to the
+  rounded paths concurrently. The paths are sampled in a single thread, so the
+  result does not depend on this number. If convex_relaxation is false or
+  max_rounded_paths is less than or equal to zero, this option is ignored.
+  When it is greater than one, the solver must support being called from
+  several threads at once. */
+  int max_rounding_threads{1};
+
   /** Optimizer to be used to solve the shortest path optimization problem. If
   not set, the best solver for the given problem is selected. Note that if the
   solver cannot handle the type of optimization problem generated, the calling
@@ -67,6 +75,29 @@ struct GraphOfConvexSetsOptions {
   solvers::SolverOptions solver_options;
 };
 
+/** The wall clock time spent in each phase of
+GraphOfConvexSets::SolveShortestPath(), in seconds. */
+struct GraphOfConvexSetsStatistics {
+  /** Time spent preprocessing the graph and building the optimization
+  program. */
+  double setup_time{};
+
+  /** Time spent solving the convex relaxation, or the mixed-integer program if
+  convex_relaxation is false. */
+  double relaxation_time{};
+
+  /** Time spent sampling the rounded paths and solving the programs restricted
+  to them. */
+  double rounding_time{};
+
+  /** Number of distinct rounded paths whose restricted program was solved. */
+  int num_rounded_paths{};
+
+  /** Time spent writing the solution of the placeholder variables into the
+  returned result. */
+  double postprocessing_time{};
+};
+
 /**
 GraphOfConvexSets implements the design pattern and optimization problems first
 introduced in the paper "Shortest Paths in Graphs of Convex Sets".
@@ -473,6 +504,8 @@ class GraphOfConvexSets {
   that set.
   @param options include all settings for solving the shortest path problem. See
   `GraphOfConvexSetsOptions` for further details.
+  @param statistics if not nullptr, is set to the time spent in each phase of
+  the solve.
 
   @throws std::exception if any of the costs or constraints in the graph are
   incompatible with the shortest path formulation or otherwise unsupported.
@@ -482,8 +515,8 @@ class GraphOfConvexSets {
   */
   solvers::MathematicalProgramResult SolveShortestPath(
       VertexId source_id, VertexId target_id,
-      const GraphOfConvexSetsOptions& options =
-          GraphOfConvexSetsOptions()) const;
+      const GraphOfConvexSetsOptions& options = GraphOfConvexSetsOptions(),
+      GraphOfConvexSetsStatistics* statistics = nullptr) const;
 
   /** Convenience overload that takes const reference arguments for source and
   target.
@@ -491,8 +524,8 @@ class GraphOfConvexSets {
   */
   solvers::MathematicalProgramResult SolveShortestPath(
       const Vertex& source, const Vertex& target,
-      const GraphOfConvexSetsOptions& options =
-          GraphOfConvexSetsOptions()) const;
+      const GraphOfConvexSetsOptions& options = GraphOfConvexSetsOptions(),
+      GraphOfConvexSetsStatistics* statistics = nullptr) const;
 
   /** Formulates and solves the mixed-integer convex formulation of the
   shortest path problem on the graph, as discussed in detail in
@@ -1,9 +1,13 @@
 #include "drake/geometry/optimization/hpolyhedron.h"
 
 #include <algorithm>
+#include <atomic>
 #include <bitset>
+#include <cmath>
+#include <deque>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <stdexcept>
 #include <string>
@@ -104,38 +108,35 @@ bool IsRedundant(const Eigen::Ref<const MatrixXd>& c, double d,
   return !(polyhedron_is_empty || -result.get_optimal_cost() > d + tol);
 }
 
-}  // namespace
-
-HPolyhedron::HPolyhedron() : ConvexSet(&ConvexSetCloner<HPolyhedron>, 0) {}
-
-HPolyhedron::HPolyhedron(const Eigen::Ref<const MatrixXd>& A,
-                         const Eigen::Ref<const VectorXd>& b)
-    : ConvexSet(&ConvexSetCloner<HPolyhedron>, A.cols()), A_{A}, b_{b} {
-  CheckInvariants();
-}
-
-HPolyhedron::HPolyhedron(const QueryObject<double>& query_object,
-                         GeometryId geometry_id,
-                         std::optional<FrameId> reference_frame)
-    : ConvexSet(&ConvexSetCloner<HPolyhedron>, 3) {
-  std::pair<MatrixXd, VectorXd> Ab_G;
-  query_object.inspector().GetShape(geometry_id).Reify(this, &Ab_G);
-
-  const RigidTransformd X_WE =
-      reference_frame ? query_object.GetPoseInWorld(*reference_frame)
-                      : RigidTransformd::Identity();
-  const RigidTransformd& X_WG = query_object.GetPoseInWorld(geometry_id);
-  const RigidTransformd X_GE = X_WG.InvertAndCompose(X_WE);
-  // A_G*(p_GE + R_GE*p_EE_var) ≤ b_G
-  A_ = Ab_G.first * X_GE.rotation().matrix();
-  b_ = Ab_G.second - Ab_G.first * X_GE.translation();
+bool CalcIsBounded(const MatrixXd& A) {
+  if (A.rows() < A.cols()) {
+    return false;
+  }
+  Eigen::ColPivHouseholderQR<MatrixXd> qr(A);
+  if (qr.dimensionOfKernel() > 0) {
+    return false;
+  }
+  // Stiemke's theorem of alternatives says that, given A with ker(A) = {0}, we
+  // either have existence of x ≠ 0 such that Ax ≥ 0 or we have existence of y
+  // > 0 such that y^T A = 0.  Since any y that verifies the second condition
+  // can be arbitrarily scaled, and would still pass the second condition,
+  // instead of asking y > 0, we can equivalently ask y ≥ 1.  So boundedness
+  // corresponds to the following LP being feasible: find y s.t. y ≥ 1, y^T A =
+  // 0.
+  MathematicalProgram prog;
+  auto y = prog.NewContinuousVariables(A.rows(), "y");
+  prog.AddBoundingBoxConstraint(1.0, std::numeric_limits<double>::infinity(),
+                                y);
+  prog.AddLinearEqualityConstraint(A.transpose(), VectorXd::Zero(A.cols()),
+                                   y);
+  auto result = solvers::Solve(prog);
+  return result.is_success();
 }
 
-HPolyhedron::~HPolyhedron() = default;
-
-Hyperellipsoid HPolyhedron::MaximumVolumeInscribedEllipsoid() const {
+Hyperellipsoid CalcMaximumVolumeInscribedEllipsoid(const MatrixXd& A,
+                                                  const VectorXd& b) {
   MathematicalProgram prog;
-  const int N = this->ambient_dimension();
+  const int N = A.cols();
   MatrixXDecisionVariable C = prog.NewSymmetricContinuousVariables(N, "C");
   VectorXDecisionVariable d = prog.NewContinuousVariables(N, "d");
 
@@ -145,11 +146,11 @@ Hyperellipsoid HPolyhedron::MaximumVolumeInscribedEllipsoid() const {
   // TODO(russt): We could potentially avoid Expression parsing here by using
   // AddLorentzConeConstraint(A,b,vars), but it's nontrivial because of the
   // duplicate entries in the symmetric matrix C.  E.g. the Lorentz cone A would
-  // not be simply block_diagonal(-A_.row(i), A_.row(i), ..., A_.row(i)).
+  // not be simply block_diagonal(-A.row(i), A.row(i), ..., A.row(i)).
   VectorX<Expression> z(N + 1);
-  for (int i = 0; i < b_.size(); ++i) {
-    z[0] = b_(i) - A_.row(i).dot(d);
-    z.tail(N) = C * A_.row(i).transpose();
+  for (int i = 0; i < b.size(); ++i) {
+    z[0] = b(i) - A.row(i).dot(d);
+    z.tail(N) = C * A.row(i).transpose();
     prog.AddLorentzConeConstraint(z);
   }
   auto result = solvers::Solve(prog);
@@ -163,9 +164,9 @@ Hyperellipsoid HPolyhedron::MaximumVolumeInscribedEllipsoid() const {
   return Hyperellipsoid(result.GetSolution(C).inverse(), result.GetSolution(d));
 }
 
-VectorXd HPolyhedron::ChebyshevCenter() const {
+VectorXd CalcChebyshevCenter(const MatrixXd& A, const VectorXd& b) {
   MathematicalProgram prog;
-  VectorXDecisionVariable x = prog.NewContinuousVariables(ambient_dimension());
+  VectorXDecisionVariable x = prog.NewContinuousVariables(A.cols());
   VectorXDecisionVariable r = prog.NewContinuousVariables<1>("r");
 
   const double inf = std::numeric_limits<double>::infinity();
@@ -176,11 +177,11 @@ VectorXd HPolyhedron::ChebyshevCenter() const {
   prog.AddBoundingBoxConstraint(0, inf, r);
 
   // aᵢᵀ x + |aᵢ| r ≤ bᵢ.
-  RowVectorXd a(A_.cols() + 1);
-  for (int i = 0; i < A_.rows(); ++i) {
-    a[0] = A_.row(i).norm();
-    a.tail(A_.cols()) = A_.row(i);
-    prog.AddLinearConstraint(a, -inf, b_[i], {r, x});
+  RowVectorXd a(A.cols() + 1);
+  for (int i = 0; i < A.rows(); ++i) {
+    a[0] = A.row(i).norm();
+    a.tail(A.cols()) = A.row(i);
+    prog.AddLinearConstraint(a, -inf, b[i], {r, x});
   }
 
   auto result = solvers::Solve(prog);
@@ -194,6 +195,341 @@ VectorXd HPolyhedron::ChebyshevCenter() const {
   return result.GetSolution(x);
 }
 
+/* Returns the indices, in increasing order, of the rows of A x ≤ b that define
+the facets of a one-dimensional polyhedron, or nullopt if the set is empty. Of
+several rows that define the same facet, only the last one is kept. */
+std::optional<std::vector<int>> FindFacets1d(const MatrixXd& A,
+                                             const VectorXd& b) {
+  DRAKE_DEMAND(A.cols() == 1);
+  int upper = -1;
+  int lower = -1;
+  double upper_bound = kInf;
+  double lower_bound = -kInf;
+  for (int i = 0; i < A.rows(); ++i) {
+    const double a = A(i, 0);
+    if (a == 0) {
+      if (b[i] < 0) {
+        return std::nullopt;
+      }
+      continue;
+    }
+    const double bound = b[i] / a;
+    if (a > 0 && bound <= upper_bound) {
+      upper_bound = bound;
+      upper = i;
+    } else if (a < 0 && bound >= lower_bound) {
+      lower_bound = bound;
+      lower = i;
+    }
+  }
+  if (lower_bound > upper_bound) {
+    return std::nullopt;
+  }
+  std::vector<int> facets;
+  for (const int i : {std::min(lower, upper), std::max(lower, upper)}) {
+    if (i >= 0) {
+      facets.push_back(i);
+    }
+  }
+  return facets;
+}
+
+/* Returns the indices, in increasing order, of the rows of A x ≤ b that define
+the edges of a bounded two-dimensional polyhedron with a non-empty interior.
+This is the half-plane intersection algorithm: the boundary lines are sorted by
+the angle of their normal, and a deque keeps the lines of the boundary of the
+intersection of the lines processed so far, in O(m log m) for m rows. The
+result is certified by checking every row at every vertex; when the set is
+unbounded, empty, or too thin for that check, returns nullopt. */
+std::optional<std::vector<int>> FindFacets2d(const MatrixXd& A,
+                                             const VectorXd& b) {
+  DRAKE_DEMAND(A.cols() == 2);
+  struct Line {
+    Eigen::Vector2d normal;
+    double offset{};
+    double angle{};
+    int index{};
+  };
+  std::vector<Line> lines;
+  lines.reserve(A.rows());
+  for (int i = 0; i < A.rows(); ++i) {
+    const double norm = A.row(i).norm();
+    if (norm == 0) {
+      if (b[i] < 0) {
+        return std::nullopt;
+      }
+      continue;
+    }
+    const Eigen::Vector2d normal = A.row(i).transpose() / norm;
+    lines.push_back(
+        Line{normal, b[i] / norm, std::atan2(normal.y(), normal.x()), i});
+  }
+  if (lines.size() < 3) {
+    return std::nullopt;
+  }
+  // Tolerances on the rows normalized to unit normals.
+  const double kAngleTol = 1E-12;
+  double max_offset = 0;
+  for (const Line& line : lines) {
+    max_offset = std::max(max_offset, std::abs(line.offset));
+  }
+  const double kDistanceTol = 1E-10 * (1 + max_offset);
+  // Of the lines with the same normal, keep the tightest one (the last row
+  // among exact duplicates, as the linear programs would).
+  std::sort(lines.begin(), lines.end(), [](const Line& l1, const Line& l2) {
+    return std::tie(l1.angle, l1.offset, l2.index) <
+           std::tie(l2.angle, l2.offset, l1.index);
+  });
+  std::vector<Line> unique_lines;
+  for (const Line& line : lines) {
+    if (unique_lines.empty() ||
+        line.angle - unique_lines.back().angle > kAngleTol) {
+      unique_lines.push_back(line);
+    }
+  }
+  // The set is bounded iff the normals leave no gap of π or more.
+  const int num_lines = unique_lines.size();
+  if (num_lines < 3) {
+    return std::nullopt;
+  }
+  for (int k = 0; k < num_lines; ++k) {
+    const double gap =
+        k + 1 < num_lines
+            ? unique_lines[k + 1].angle - unique_lines[k].angle
+            : unique_lines[0].angle + 2 * M_PI - unique_lines[k].angle;
+    if (gap >= M_PI - kAngleTol) {
+      return std::nullopt;
+    }
+  }
+
+  // Returns the intersection of two lines whose normals make an angle in
+  // (0, π), or nullopt otherwise.
+  auto intersect = [&](const Line& l1,
+                       const Line& l2) -> std::optional<Eigen::Vector2d> {
+    const double det =
+        l1.normal.x() * l2.normal.y() - l1.normal.y() * l2.normal.x();
+    if (det <= kAngleTol) {
+      return std::nullopt;
+    }
+    return Eigen::Vector2d(
+        (l1.offset * l2.normal.y() - l2.offset * l1.normal.y()) / det,
+        (l2.offset * l1.normal.x() - l1.offset * l2.normal.x()) / det);
+  };
+  auto outside = [&](const Line& line, const Eigen::Vector2d& point) {
+    return line.normal.dot(point) > line.offset + kDistanceTol;
+  };
+  std::deque<const Line*> boundary;
+  for (const Line& line : unique_lines) {
+    while (boundary.size() >= 2) {
+      const auto vertex =
+          intersect(*boundary[boundary.size() - 2], *boundary.back());
+      if (!vertex) {
+        return std::nullopt;
+      }
+      if (!outside(line, *vertex)) {
+        break;
+      }
+      boundary.pop_back();
+    }
+    while (boundary.size() >= 2) {
+      const auto vertex = intersect(*boundary[0], *boundary[1]);
+      if (!vertex) {
+        return std::nullopt;
+      }
+      if (!outside(line, *vertex)) {
+        break;
+      }
+      boundary.pop_front();
+    }
+    boundary.push_back(&line);
+  }
+  while (boundary.size() >= 3) {
+    const auto vertex =
+        intersect(*boundary[boundary.size() - 2], *boundary.back());
+    if (!vertex) {
+      return std::nullopt;
+    }
+    if (!outside(*boundary.front(), *vertex)) {
+      break;
+    }
+    boundary.pop_back();
+  }
+  while (boundary.size() >= 3) {
+    const auto vertex = intersect(*boundary[0], *boundary[1]);
+    if (!vertex) {
+      return std::nullopt;
+    }
+    if (!outside(*boundary.back(), *vertex)) {
+      break;
+    }
+    boundary.pop_front();
+  }
+  const int num_boundary = boundary.size();
+  if (num_boundary < 3) {
+    return std::nullopt;
+  }
+
+  // The k-th vertex is the end of the edge along the k-th boundary line.
+  std::vector<Eigen::Vector2d> vertices;
+  vertices.reserve(num_boundary);
+  for (int k = 0; k < num_boundary; ++k) {
+    const auto vertex =
+        intersect(*boundary[k], *boundary[(k + 1) % num_boundary]);
+    if (!vertex) {
+      return std::nullopt;
+    }
+    for (const Line& line : lines) {
+      if (outside(line, *vertex)) {
+        return std::nullopt;
+      }
+    }
+    vertices.push_back(*vertex);
+  }
+  std::vector<int> facets;
+  for (int k = 0; k < num_boundary; ++k) {
+    const Eigen::Vector2d& normal = boundary[k]->normal;
+    const Eigen::Vector2d edge =
+        vertices[k] - vertices[(k + num_boundary - 1) % num_boundary];
+    const double length = normal.x() * edge.y() - normal.y() * edge.x();
+    if (length < -kDistanceTol) {
+      return std::nullopt;
+    }
+    if (length > kDistanceTol) {
+      facets.push_back(boundary[k]->index);
+    }
+  }
+  if (facets.size() < 3) {
+    return std::nullopt;
+  }
+  std::sort(facets.begin(), facets.end());
+  return facets;
+}
+
+/* Given the indices `facets` (as returned by FindFacets2d) of the rows of
+A x ≤ b that define the edges of a bounded two-dimensional polyhedron, returns
+them without the rows that the other edges imply to within `tol`, as the linear
+programs in ReduceInequalities() would. The edges are checked in increasing
+order of index. Removing an edge replaces it by the intersection of its two
+neighboring edges; when their normals make an angle of π or more, the set would
+become unbounded, so the edge is kept. */
+std::vector<int> RemoveNearlyRedundantEdges2d(const MatrixXd& A,
+                                              const VectorXd& b, double tol,
+                                              const std::vector<int>& facets) {
+  DRAKE_DEMAND(A.cols() == 2);
+  const int num_facets = facets.size();
+  // The positions in `facets` of the edges, in counterclockwise order.
+  std::vector<int> order(num_facets);
+  std::vector<double> angles(num_facets);
+  for (int k = 0; k < num_facets; ++k) {
+    order[k] = k;
+    angles[k] = std::atan2(A(facets[k], 1), A(facets[k], 0));
+  }
+  std::sort(order.begin(), order.end(), [&angles](int k1, int k2) {
+    return angles[k1] < angles[k2];
+  });
+  // The neighbors of each remaining edge, as positions in `facets`.
+  std::vector<int> previous(num_facets);
+  std::vector<int> next(num_facets);
+  for (int j = 0; j < num_facets; ++j) {
+    previous[order[j]] = order[(j + num_facets - 1) % num_facets];
+    next[order[j]] = order[(j + 1) % num_facets];
+  }
+  std::vector<bool> removed(num_facets, false);
+  int num_remaining = num_facets;
+  for (int k = 0; k < num_facets && num_remaining > 3; ++k) {
+    const int i = facets[k];
+    const int p = facets[previous[k]];
+    const int n = facets[next[k]];
+    const double det = A(p, 0) * A(n, 1) - A(p, 1) * A(n, 0);
+    if (det <= 1E-12 * A.row(p).norm() * A.row(n).norm()) {
+      continue;
+    }
+    const Eigen::Vector2d vertex((b[p] * A(n, 1) - b[n] * A(p, 1)) / det,
+                                 (b[n] * A(p, 0) - b[p] * A(n, 0)) / det);
+    if (A.row(i).dot(vertex) <= b[i] + tol) {
+      next[previous[k]] = next[k];
+      previous[next[k]] = previous[k];
+      removed[k] = true;
+      --num_remaining;
+    }
+  }
+  std::vector<int> kept;
+  for (int k = 0; k < num_facets; ++k) {
+    if (!removed[k]) {
+      kept.push_back(facets[k]);
+    }
+  }
+  return kept;
+}
+
+}  // namespace
+
+// Each quantity is computed by the first call that needs it; std::call_once
+// makes concurrent callers wait for it, and retries if the computation throws.
+struct HPolyhedron::DerivedQuantities {
+  std::once_flag is_bounded_flag;
+  bool is_bounded{};
+  std::once_flag chebyshev_center_flag;
+  VectorXd chebyshev_center;
+  std::once_flag maximum_volume_inscribed_ellipsoid_flag;
+  std::optional<Hyperellipsoid> maximum_volume_inscribed_ellipsoid;
+  std::atomic<int> num_computed{0};
+};
+
+HPolyhedron::HPolyhedron() : ConvexSet(&ConvexSetCloner<HPolyhedron>, 0) {
+  ResetDerivedQuantities();
+}
+
+HPolyhedron::HPolyhedron(const Eigen::Ref<const MatrixXd>& A,
+                         const Eigen::Ref<const VectorXd>& b)
+    : ConvexSet(&ConvexSetCloner<HPolyhedron>, A.cols()), A_{A}, b_{b} {
+  CheckInvariants();
+  ResetDerivedQuantities();
+}
+
+HPolyhedron::HPolyhedron(const QueryObject<double>& query_object,
+                         GeometryId geometry_id,
+                         std::optional<FrameId> reference_frame)
+    : ConvexSet(&ConvexSetCloner<HPolyhedron>, 3) {
+  std::pair<MatrixXd, VectorXd> Ab_G;
+  query_object.inspector().GetShape(geometry_id).Reify(this, &Ab_G);
+
+  const RigidTransformd X_WE =
+      reference_frame ? query_object.GetPoseInWorld(*reference_frame)
+                      : RigidTransformd::Identity();
+  const RigidTransformd& X_WG = query_object.GetPoseInWorld(geometry_id);
+  const RigidTransformd X_GE = X_WG.InvertAndCompose(X_WE);
+  // A_G*(p_GE + R_GE*p_EE_var) ≤ b_G
+  A_ = Ab_G.first * X_GE.rotation().matrix();
+  b_ = Ab_G.second - Ab_G.first * X_GE.translation();
+  ResetDerivedQuantities();
+}
+
+HPolyhedron::~HPolyhedron() = default;
+
+Hyperellipsoid HPolyhedron::MaximumVolumeInscribedEllipsoid() const {
+  if (derived_ == nullptr) {
+    return CalcMaximumVolumeInscribedEllipsoid(A_, b_);
+  }
+  std::call_once(derived_->maximum_volume_inscribed_ellipsoid_flag, [this]() {
+    derived_->maximum_volume_inscribed_ellipsoid =
+        CalcMaximumVolumeInscribedEllipsoid(A_, b_);
+    ++derived_->num_computed;
+  });
+  return *derived_->maximum_volume_inscribed_ellipsoid;
+}
+
+VectorXd HPolyhedron::ChebyshevCenter() const {
+  if (derived_ == nullptr) {
+    return CalcChebyshevCenter(A_, b_);
+  }
+  std::call_once(derived_->chebyshev_center_flag, [this]() {
+    derived_->chebyshev_center = CalcChebyshevCenter(A_, b_);
+    ++derived_->num_computed;
+  });
+  return derived_->chebyshev_center;
+}
+
 HPolyhedron HPolyhedron::CartesianProduct(const HPolyhedron& other) const {
   MatrixXd A_product = MatrixXd::Zero(A_.rows() + other.A().rows(),
                                       A_.cols() + other.A().cols());
@@ -300,28 +636,14 @@ HPolyhedron HPolyhedron::MakeL1Ball(const int dim) {
 }
 
 bool HPolyhedron::DoIsBounded() const {
-  if (A_.rows() < A_.cols()) {
-    return false;
-  }
-  Eigen::ColPivHouseholderQR<MatrixXd> qr(A_);
-  if (qr.dimensionOfKernel() > 0) {
-    return false;
+  if (derived_ == nullptr) {
+    return CalcIsBounded(A_);
   }
-  // Stiemke's theorem of alternatives says that, given A with ker(A) = {0}, we
-  // either have existence of x ≠ 0 such that Ax ≥ 0 or we have existence of y
-  // > 0 such that y^T A = 0.  Since any y that verifies the second condition
-  // can be arbitrarily scaled, and would still pass the second condition,
-  // instead of asking y > 0, we can equivalently ask y ≥ 1.  So boundedness
-  // corresponds to the following LP being feasible: find y s.t. y ≥ 1, y^T A =
-  // 0.
-  MathematicalProgram prog;
-  auto y = prog.NewContinuousVariables(A_.rows(), "y");
-  prog.AddBoundingBoxConstraint(1.0, std::numeric_limits<double>::infinity(),
-                                y);
-  prog.AddLinearEqualityConstraint(A_.transpose(), VectorXd::Zero(A_.cols()),
-                                   y);
-  auto result = solvers::Solve(prog);
-  return result.is_success();
+  std::call_once(derived_->is_bounded_flag, [this]() {
+    derived_->is_bounded = CalcIsBounded(A_);
+    ++derived_->num_computed;
+  });
+  return derived_->is_bounded;
 }
 
 bool HPolyhedron::ContainedIn(const HPolyhedron& other, double tol) const {
@@ -415,6 +737,28 @@ HPolyhedron HPolyhedron::ReduceInequalities(double tol) const {
   const int num_inequalities = A_.rows();
   const int num_vars = A_.cols();
 
+  // In one or two dimensions, the facets can be found directly. Removing every
+  // other inequality leaves the set unchanged, so each removed inequality is
+  // redundant for any non-negative tol. A facet can only be redundant to
+  // within tol in two dimensions; in one dimension, the set would become
+  // unbounded without it.
+  if (tol >= 0 && (num_vars == 1 || num_vars == 2)) {
+    std::optional<std::vector<int>> facets =
+        num_vars == 1 ? FindFacets1d(A_, b_) : FindFacets2d(A_, b_);
+    if (facets.has_value()) {
+      if (num_vars == 2) {
+        facets = RemoveNearlyRedundantEdges2d(A_, b_, tol, *facets);
+      }
+      MatrixXd A_new(facets->size(), num_vars);
+      VectorXd b_new(facets->size());
+      for (int i = 0; i < static_cast<int>(facets->size()); ++i) {
+        A_new.row(i) = A_.row((*facets)[i]);
+        b_new[i] = b_[(*facets)[i]];
+      }
+      return {A_new, b_new};
+    }
+  }
+
   std::set<int> kept_indices;
   for (int i = 0; i < num_inequalities; ++i) {
     kept_indices.emplace(i);
@@ -473,6 +817,30 @@ bool HPolyhedron::DoPointInSet(const Eigen::Ref<const VectorXd>& x,
   return ((A_ * x).array() <= b_.array() + tol).all();
 }
 
+VectorX<bool> HPolyhedron::PointsInSet(const Eigen::Ref<const MatrixXd>& x,
+                                       double tol) const {
+  DRAKE_THROW_UNLESS(x.rows() == ambient_dimension());
+  const int num_points = x.cols();
+  VectorX<bool> in_set = VectorX<bool>::Constant(num_points, true);
+  if (A_.rows() == 0) {
+    return in_set;
+  }
+  // Evaluate A x over blocks of points, so that the temporary stays small while
+  // each product is still large enough for Eigen's vectorized matrix kernels.
+  constexpr int kBlockSize = 256;
+  MatrixXd Ax(A_.rows(), std::min(kBlockSize, num_points));
+  const VectorXd b_tol = b_.array() + tol;
+  for (int start = 0; start < num_points; start += kBlockSize) {
+    const int size = std::min(kBlockSize, num_points - start);
+    auto Ax_block = Ax.leftCols(size);
+    Ax_block.noalias() = A_ * x.middleCols(start, size);
+    in_set.segment(start, size) =
+        ((Ax_block.colwise() - b_tol).colwise().maxCoeff().array() <= 0)
+            .transpose();
+  }
+  return in_set;
+}
+
 void HPolyhedron::DoAddPointInSetConstraints(
     MathematicalProgram* prog,
     const Eigen::Ref<const VectorXDecisionVariable>& vars) const {
@@ -593,6 +961,14 @@ HPolyhedron HPolyhedron::PontryaginDifference(const HPolyhedron& other) const {
   return {A_, b_diff};
 }
 
+void HPolyhedron::ResetDerivedQuantities() {
+  derived_ = std::make_shared<DerivedQuantities>();
+}
+
+int HPolyhedron::num_derived_quantities_computed() const {
+  return derived_ == nullptr ? 0 : derived_->num_computed.load();
+}
+
 void HPolyhedron::CheckInvariants() const {
   DRAKE_DEMAND(this->ambient_dimension() == A_.cols());
   DRAKE_DEMAND(A_.rows() == b_.size());
@@ -15,6 +15,14 @@ namespace optimization {
 
 /** Implements a polyhedral convex set using the half-space representation:
 `{x| A x ≤ b}`.  Note: This set may be unbounded.
+
+@anchor hpolyhedron_caching
+<b>Caching</b>: A and b never change after construction, so the quantities that
+require solving an optimization program (IsBounded(),
+ChebyshevCenter() and MaximumVolumeInscribedEllipsoid()) are computed on the
+first call and cached. Copies of an HPolyhedron share the cache, which is safe
+to use from several threads at once. Failures are not cached.
+
 @ingroup geometry_optimization
 */
 class HPolyhedron final : public ConvexSet {
@@ -53,9 +61,19 @@ class HPolyhedron final : public ConvexSet {
   finite lower and upper bound for the set.  For HPolyhedron, while there are
   some fast checks to confirm a set is unbounded, confirming boundedness
   requires solving a linear program (based on Stiemke’s theorem of
-  alternatives). */
+  alternatives). The result is cached, see @ref hpolyhedron_caching
+  "caching". */
   using ConvexSet::IsBounded;
 
+  /** Batched version of PointInSet(), where each column of @p x is a point.
+  Returns a vector whose i-th element is true iff `x.col(i)` satisfies
+  `A x ≤ b + tol`. The products A x are evaluated for blocks of points at once
+  with a matrix-matrix product, which is much faster than calling PointInSet()
+  on each point.
+  @pre x.rows() == ambient_dimension(). */
+  VectorX<bool> PointsInSet(const Eigen::Ref<const Eigen::MatrixXd>& x,
+                            double tol = 0) const;
+
   /** Returns true iff this HPolyhedron is entirely contained in the HPolyhedron
   other. This is done by checking whether every inequality in @p other is
   redundant when added to this.
@@ -82,6 +100,12 @@ class HPolyhedron final : public ConvexSet {
   HPolyhedron.  This is not guaranteed to give the minimal representation of
   the polyhedron but is a relatively fast way to reduce the number of
   inequalities.
+
+  In one or two dimensions and for a non-negative @p tol, the inequalities are
+  reduced without solving any linear program when the set is non-empty (and,
+  in two dimensions, bounded with a non-empty interior): the result then keeps
+  the inequalities that define a facet of the set, except for those that the
+  other facets imply to within @p tol.
   @param tol For a constraint c'x<=d, if the halfspace c'x<=d + tol contains the
   hpolyhedron generated by the rest of the constraints, then we remove this
   inequality. A positive tol means it is more likely to remove a constraint, a
@@ -98,6 +122,8 @@ class HPolyhedron final : public ConvexSet {
   where aᵢ and bᵢ denote the ith row.  This defines the ellipsoid
   E = { Cx + d | |x|₂ ≤ 1}.
 
+  The result is cached, see @ref hpolyhedron_caching "caching".
+
   @pre the HPolyhedron is bounded.
   @throws std::exception if the solver fails to solve the problem.
   */
@@ -124,6 +150,8 @@ class HPolyhedron final : public ConvexSet {
   MaximumVolumeInscribedEllipsoid() method, and then taking the center of the
   returned Hyperellipsoid.
 
+  The result is cached, see @ref hpolyhedron_caching "caching".
+
   @throws std::exception if the solver fails to solve the problem.
   */
   Eigen::VectorXd ChebyshevCenter() const;
@@ -185,9 +213,23 @@ class HPolyhedron final : public ConvexSet {
     a->Visit(DRAKE_NVP(A_));
     a->Visit(DRAKE_NVP(b_));
     CheckInvariants();
+    ResetDerivedQuantities();
   }
 
  private:
+  // The lazily computed quantities, shared by the copies of this set. It is
+  // only null for a moved-from set, which then computes them without caching.
+  struct DerivedQuantities;
+
+  // Starts a new, empty cache for the current A and b.
+  void ResetDerivedQuantities();
+
+  // Returns the number of quantities computed so far for the cache shared by
+  // this set (or zero if it has none), for unit testing.
+  int num_derived_quantities_computed() const;
+
+  friend class HPolyhedronTester;
+
   [[nodiscard]] HPolyhedron DoIntersectionNoChecks(
       const HPolyhedron& other) const;
 
@@ -243,6 +285,7 @@ class HPolyhedron final : public ConvexSet {
 
   Eigen::MatrixXd A_{};
   Eigen::VectorXd b_{};
+  std::shared_ptr<DerivedQuantities> derived_;
 };
 
 }  // namespace optimization
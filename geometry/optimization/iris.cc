@@ -1,7 +1,9 @@
 #include "drake/geometry/optimization/iris.h"
 
 #include <algorithm>
+#include <functional>
 #include <limits>
+#include <mutex>
 #include <optional>
 #include <tuple>
 #include <unordered_map>
@@ -9,6 +11,7 @@
 #include <utility>
 #include <vector>
 
+#include "drake/common/parallel_for.h"
 #include "drake/common/symbolic/expression.h"
 #include "drake/geometry/optimization/cartesian_product.h"
 #include "drake/geometry/optimization/convex_set.h"
@@ -23,6 +26,7 @@ namespace drake {
 namespace geometry {
 namespace optimization {
 
+using drake::internal::ParallelFor;
 using Eigen::MatrixXd;
 using Eigen::Ref;
 using Eigen::Vector3d;
@@ -598,25 +602,121 @@ struct GeometryPairWithDistance {
   }
 };
 
-}  // namespace
+// The convex sets of the geometries with a proximity role (in their geometry
+// frames), the frames they are attached to, and the geometry pairs that are
+// collision candidates. None of these depend on the configuration of the
+// plant, so they are shared by all the regions grown in one plant.
+struct IrisCollisionGeometries {
+  std::unordered_map<GeometryId, copyable_unique_ptr<ConvexSet>> sets;
+  std::unordered_map<GeometryId, const multibody::Frame<double>*> frames;
+  std::vector<std::pair<GeometryId, GeometryId>> pairs;
+};
 
-HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
-                                     const Context<double>& context,
-                                     const IrisOptions& options) {
-  // Check the inputs.
-  plant.ValidateContext(context);
-  const int nq = plant.num_positions();
-  const Eigen::VectorXd sample = plant.GetPositions(context);
-  // Note: We require finite joint limits to define the bounding box for the
-  // IRIS algorithm.
-  DRAKE_DEMAND(plant.GetPositionLowerLimits().array().isFinite().all());
-  DRAKE_DEMAND(plant.GetPositionUpperLimits().array().isFinite().all());
-  DRAKE_DEMAND(options.num_collision_infeasible_samples >= 0);
+IrisCollisionGeometries MakeIrisCollisionGeometries(
+    const MultibodyPlant<double>& plant,
+    const QueryObject<double>& query_object) {
+  const SceneGraphInspector<double>& inspector = query_object.inspector();
+  IrisConvexSetMaker maker(query_object, inspector.world_frame_id());
+  IrisCollisionGeometries geometries;
+  const std::unordered_set<GeometryId> geom_ids = inspector.GetGeometryIds(
+      GeometrySet(inspector.GetAllGeometryIds()), Role::kProximity);
+  copyable_unique_ptr<ConvexSet> temp_set;
+  for (GeometryId geom_id : geom_ids) {
+    // Make all sets in the local geometry frame.
+    FrameId frame_id = inspector.GetFrameId(geom_id);
+    maker.set_reference_frame(frame_id);
+    maker.set_geometry_id(geom_id);
+    inspector.GetShape(geom_id).Reify(&maker, &temp_set);
+    geometries.sets.emplace(geom_id, std::move(temp_set));
+    geometries.frames.emplace(
+        geom_id, &plant.GetBodyFromFrameId(frame_id)->body_frame());
+  }
+  const auto pairs = inspector.GetCollisionCandidates();
+  geometries.pairs.assign(pairs.begin(), pairs.end());
+  return geometries;
+}
 
-  if (options.prog_with_additional_constraints) {
-    DRAKE_DEMAND(options.prog_with_additional_constraints->num_vars() == nq);
-    DRAKE_DEMAND(options.num_additional_constraint_infeasible_samples >= 0);
+using RowMajorMatrixXd =
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+// The polytope {q | A q ≤ b} given by the first `num_constraints` rows of A and
+// b, as it is grown by the counter-example searches of one IRIS iteration.
+struct IrisPolytope {
+  RowMajorMatrixXd A;
+  VectorXd b;
+  int num_constraints{};
+};
+
+// Searches for configurations in `polytope` where the geometries of `pair`
+// collide, starting from random samples, and adds the tangent to the
+// ellipsoid E at each one found to `polytope`. Returns false iff
+// options.require_sample_point_is_contained is violated by a new tangent.
+bool SeparateCollisionPair(const GeometryPairWithDistance& pair,
+                           const IrisCollisionGeometries& geometries,
+                           std::shared_ptr<SamePointConstraint>
+                               same_point_constraint,
+                           const Hyperellipsoid& E,
+                           const Eigen::Ref<const VectorXd>& sample,
+                           const IrisOptions& options,
+                           const solvers::SolverInterface& solver,
+                           RandomGenerator* generator, VectorXd* guess,
+                           HPolyhedron* P_candidate, IrisPolytope* polytope) {
+  RowMajorMatrixXd& A = polytope->A;
+  VectorXd& b = polytope->b;
+  int& num_constraints = polytope->num_constraints;
+  VectorXd closest(sample.size());
+  int consecutive_failures = 0;
+  ClosestCollisionProgram prog(
+      same_point_constraint, *geometries.frames.at(pair.geomA),
+      *geometries.frames.at(pair.geomB), *geometries.sets.at(pair.geomA),
+      *geometries.sets.at(pair.geomB), E, A.topRows(num_constraints),
+      b.head(num_constraints));
+  while (consecutive_failures < options.num_collision_infeasible_samples) {
+    if (prog.Solve(solver, *guess, &closest)) {
+      consecutive_failures = 0;
+      AddTangentToPolytope(E, closest, options.configuration_space_margin, &A,
+                           &b, &num_constraints);
+      *P_candidate =
+          HPolyhedron(A.topRows(num_constraints), b.head(num_constraints));
+      MakeGuessFeasible(*P_candidate, options, closest, guess);
+      if (options.require_sample_point_is_contained &&
+          A.row(num_constraints - 1) * sample > b(num_constraints - 1)) {
+        return false;
+      }
+      prog.UpdatePolytope(A.topRows(num_constraints), b.head(num_constraints));
+    } else {
+      ++consecutive_failures;
+    }
+    *guess = P_candidate->UniformSample(generator, *guess);
   }
+  return true;
+}
+
+// Makes the solver of the counter-example programs.
+std::unique_ptr<solvers::SolverInterface> MakeCounterExampleSolver() {
+  return solvers::MakeFirstAvailableSolver(
+      {solvers::SnoptSolver::id(), solvers::IpoptSolver::id()});
+}
+
+// Returns how many counter-example searches with `solver` may run at once,
+// given `num_threads`. IPOPT is not thread-safe, so only SNOPT runs on several
+// threads.
+int NumCounterExampleThreads(const solvers::SolverInterface& solver,
+                             int num_threads) {
+  return solver.solver_id() == solvers::SnoptSolver::id() ? num_threads : 1;
+}
+
+// Grows a single IRIS region from the positions in `context`. The
+// counter-example searches of up to `num_threads` collision pairs run
+// concurrently. If `on_iteration` is set, it is called with the number of
+// iterations done and the region after each iteration.
+HPolyhedron GrowIrisRegion(
+    const MultibodyPlant<double>& plant, const Context<double>& context,
+    const IrisCollisionGeometries& geometries, const IrisOptions& options,
+    int num_threads,
+    const std::function<void(int, const HPolyhedron&)>& on_iteration) {
+  const int nq = plant.num_positions();
+  const Eigen::VectorXd sample = plant.GetPositions(context);
 
   // Make the polytope and ellipsoid.
   HPolyhedron P = HPolyhedron::MakeBox(plant.GetPositionLowerLimits(),
@@ -625,37 +725,27 @@ HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
   const double kEpsilonEllipsoid = 1e-2;
   Hyperellipsoid E = Hyperellipsoid::MakeHypersphere(kEpsilonEllipsoid, sample);
 
-  // Make all of the convex sets and supporting quantities.
   auto query_object =
       plant.get_geometry_query_input_port().Eval<QueryObject<double>>(context);
   const SceneGraphInspector<double>& inspector = query_object.inspector();
-  IrisConvexSetMaker maker(query_object, inspector.world_frame_id());
-  std::unordered_map<GeometryId, copyable_unique_ptr<ConvexSet>> sets{};
-  std::unordered_map<GeometryId, const multibody::Frame<double>*> frames{};
-  const std::unordered_set<GeometryId> geom_ids = inspector.GetGeometryIds(
-      GeometrySet(inspector.GetAllGeometryIds()), Role::kProximity);
-  copyable_unique_ptr<ConvexSet> temp_set;
-  for (GeometryId geom_id : geom_ids) {
-    // Make all sets in the local geometry frame.
-    FrameId frame_id = inspector.GetFrameId(geom_id);
-    maker.set_reference_frame(frame_id);
-    maker.set_geometry_id(geom_id);
-    inspector.GetShape(geom_id).Reify(&maker, &temp_set);
-    sets.emplace(geom_id, std::move(temp_set));
-    frames.emplace(geom_id, &plant.GetBodyFromFrameId(frame_id)->body_frame());
+  const int N = static_cast<int>(geometries.pairs.size());
+  // Each concurrent counter-example search needs its own plant context and
+  // solver.
+  std::vector<std::shared_ptr<SamePointConstraint>> same_point_constraints;
+  std::vector<std::unique_ptr<solvers::SolverInterface>> worker_solvers;
+  for (int i = 0; i < std::min(num_threads, std::max(N, 1)); ++i) {
+    same_point_constraints.push_back(
+        std::make_shared<SamePointConstraint>(&plant, context));
+    worker_solvers.push_back(MakeCounterExampleSolver());
   }
-
-  auto pairs = inspector.GetCollisionCandidates();
-  const int N = static_cast<int>(pairs.size());
-  auto same_point_constraint =
-      std::make_shared<SamePointConstraint>(&plant, context);
+  const solvers::SolverInterface& solver = *worker_solvers[0];
 
   // As a surrogate for the true objective, the pairs are sorted by the distance
   // between each collision pair from the sample point configuration. This could
   // improve computation times in Ibex here and produce regions with fewer
   // faces.
   std::vector<GeometryPairWithDistance> sorted_pairs;
-  for (const auto& [geomA, geomB] : pairs) {
+  for (const auto& [geomA, geomB] : geometries.pairs) {
     const double distance =
         query_object.ComputeSignedDistancePairClosestPoints(geomA, geomB)
             .distance;
@@ -672,9 +762,11 @@ HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
   // On each iteration, we will build the collision-free polytope represented as
   // {x | A * x <= b}.  Here we pre-allocate matrices with a generous maximum
   // size.
-  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> A(
-      P.A().rows() + 2 * N, nq);
-  VectorXd b(P.A().rows() + 2 * N);
+  IrisPolytope polytope;
+  RowMajorMatrixXd& A = polytope.A;
+  VectorXd& b = polytope.b;
+  A.resize(P.A().rows() + 2 * N, nq);
+  b.resize(P.A().rows() + 2 * N);
   A.topRows(P.A().rows()) = P.A();
   b.head(P.A().rows()) = P.b();
   int num_initial_constraints = P.A().rows();
@@ -752,11 +844,9 @@ HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
   VectorXd closest(nq);
   RandomGenerator generator(options.random_seed);
 
-  auto solver = solvers::MakeFirstAvailableSolver(
-      {solvers::SnoptSolver::id(), solvers::IpoptSolver::id()});
-
   while (true) {
-    int num_constraints = num_initial_constraints;
+    int& num_constraints = polytope.num_constraints;
+    num_constraints = num_initial_constraints;
     bool sample_point_requirement = true;
     VectorXd guess = sample;
     HPolyhedron P_candidate = P;
@@ -765,33 +855,69 @@ HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
 
     // Use the fast nonlinear optimizer until it fails
     // num_collision_infeasible_samples consecutive times.
-    for (const auto& pair : sorted_pairs) {
-      int consecutive_failures = 0;
-      ClosestCollisionProgram prog(
-          same_point_constraint, *frames.at(pair.geomA), *frames.at(pair.geomB),
-          *sets.at(pair.geomA), *sets.at(pair.geomB), E,
-          A.topRows(num_constraints), b.head(num_constraints));
-      while (sample_point_requirement &&
-             consecutive_failures <
-                 options.num_collision_infeasible_samples) {
-        if (prog.Solve(*solver, guess, &closest)) {
-          consecutive_failures = 0;
-          AddTangentToPolytope(E, closest, options.configuration_space_margin,
-                               &A, &b, &num_constraints);
-          P_candidate = HPolyhedron(A.topRows(num_constraints),
-                          b.head(num_constraints));
-          MakeGuessFeasible(P_candidate, options, closest, &guess);
-          if (options.require_sample_point_is_contained) {
-            sample_point_requirement =
-                A.row(num_constraints - 1) * sample <= b(num_constraints - 1);
-            if (!sample_point_requirement) break;
+    if (same_point_constraints.size() <= 1) {
+      for (const auto& pair : sorted_pairs) {
+        sample_point_requirement = SeparateCollisionPair(
+            pair, geometries, same_point_constraints[0], E, sample, options,
+            solver, &generator, &guess, &P_candidate, &polytope);
+        if (!sample_point_requirement) break;
+      }
+    } else {
+      // The pairs are searched in rounds of one pair per thread. Within a
+      // round, every search starts from the polytope of the start of the round
+      // and only sees its own tangents. The tangents are then merged in the
+      // order of the pairs, so the region only depends on the number of
+      // threads. When the solver is not thread-safe, the searches of a round
+      // run one after the other, which finds the same region.
+      const int num_workers = static_cast<int>(same_point_constraints.size());
+      const int num_solver_threads =
+          NumCounterExampleThreads(solver, num_workers);
+      for (int start = 0; start < N && sample_point_requirement;
+           start += num_workers) {
+        const int num_tasks = std::min(num_workers, N - start);
+        std::vector<IrisPolytope> worker_polytopes(num_tasks, polytope);
+        std::vector<VectorXd> worker_guesses(num_tasks, guess);
+        std::vector<HPolyhedron> worker_P_candidates(num_tasks, P_candidate);
+        std::vector<RandomGenerator> worker_generators;
+        for (int i = 0; i < num_tasks; ++i) {
+          worker_generators.emplace_back(generator());
+        }
+        std::vector<uint8_t> worker_requirements(num_tasks, true);
+        ParallelFor(num_tasks, num_solver_threads, [&](int i) {
+          worker_requirements[i] = SeparateCollisionPair(
+              sorted_pairs[start + i], geometries, same_point_constraints[i], E,
+              sample, options, *worker_solvers[i], &worker_generators[i],
+              &worker_guesses[i], &worker_P_candidates[i],
+              &worker_polytopes[i]);
+        });
+
+        const int round_start = num_constraints;
+        for (int i = 0; i < num_tasks; ++i) {
+          const IrisPolytope& worker_polytope = worker_polytopes[i];
+          const int num_new = worker_polytope.num_constraints - round_start;
+          while (num_constraints + num_new > A.rows()) {
+            // Increase pre-allocated polytope size.
+            A.conservativeResize(A.rows() * 2, A.cols());
+            b.conservativeResize(b.rows() * 2);
+          }
+          A.middleRows(num_constraints, num_new) =
+              worker_polytope.A.middleRows(round_start, num_new);
+          b.segment(num_constraints, num_new) =
+              worker_polytope.b.segment(round_start, num_new);
+          num_constraints += num_new;
+          if (!worker_requirements[i]) {
+            sample_point_requirement = false;
+            break;
+          }
+        }
+        if (num_constraints > round_start) {
+          P_candidate =
+              HPolyhedron(A.topRows(num_constraints), b.head(num_constraints));
+          guess = worker_guesses[num_tasks - 1];
+          if (!P_candidate.PointInSet(guess, 1e-12)) {
+            guess = P_candidate.ChebyshevCenter();
           }
-          prog.UpdatePolytope(A.topRows(num_constraints),
-                              b.head(num_constraints));
-        } else {
-          ++consecutive_failures;
         }
-        guess = P_candidate.UniformSample(&generator, guess);
       }
     }
 
@@ -817,7 +943,7 @@ HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
                                             falsify_lower_bound);
             while (consecutive_failures <
                    options.num_additional_constraint_infeasible_samples) {
-              if (counter_example_prog->Solve(*solver, guess, &closest)) {
+              if (counter_example_prog->Solve(solver, guess, &closest)) {
                 consecutive_failures = 0;
                 AddTangentToPolytope(E, closest,
                                      options.configuration_space_margin, &A, &b,
@@ -848,6 +974,9 @@ HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
     P = HPolyhedron(A.topRows(num_constraints), b.head(num_constraints));
 
     iteration++;
+    if (on_iteration) {
+      on_iteration(iteration, P);
+    }
     if (iteration >= options.iteration_limit) {
       break;
     }
@@ -866,6 +995,83 @@ HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
   return P;
 }
 
+void CheckIrisInConfigurationSpaceArguments(
+    const MultibodyPlant<double>& plant, const Context<double>& context,
+    const IrisOptions& options) {
+  plant.ValidateContext(context);
+  // Note: We require finite joint limits to define the bounding box for the
+  // IRIS algorithm.
+  DRAKE_DEMAND(plant.GetPositionLowerLimits().array().isFinite().all());
+  DRAKE_DEMAND(plant.GetPositionUpperLimits().array().isFinite().all());
+  DRAKE_DEMAND(options.num_collision_infeasible_samples >= 0);
+  DRAKE_DEMAND(options.num_threads >= 1);
+
+  if (options.prog_with_additional_constraints) {
+    DRAKE_DEMAND(options.prog_with_additional_constraints->num_vars() ==
+                 plant.num_positions());
+    DRAKE_DEMAND(options.num_additional_constraint_infeasible_samples >= 0);
+  }
+}
+
+}  // namespace
+
+HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
+                                     const Context<double>& context,
+                                     const IrisOptions& options) {
+  CheckIrisInConfigurationSpaceArguments(plant, context, options);
+  auto query_object =
+      plant.get_geometry_query_input_port().Eval<QueryObject<double>>(context);
+  const IrisCollisionGeometries geometries =
+      MakeIrisCollisionGeometries(plant, query_object);
+  return GrowIrisRegion(plant, context, geometries, options,
+                        options.num_threads, nullptr);
+}
+
+std::vector<HPolyhedron> IrisInConfigurationSpace(
+    const MultibodyPlant<double>& plant, const Context<double>& root_context,
+    const std::vector<Eigen::VectorXd>& seeds, const IrisOptions& options,
+    const std::function<void(int, int, const HPolyhedron&)>&
+        progress_callback) {
+  DRAKE_THROW_UNLESS(root_context.is_root_context());
+  const Context<double>& context = plant.GetMyContextFromRoot(root_context);
+  CheckIrisInConfigurationSpaceArguments(plant, context, options);
+  for (const Eigen::VectorXd& seed : seeds) {
+    DRAKE_DEMAND(seed.size() == plant.num_positions());
+  }
+  auto query_object =
+      plant.get_geometry_query_input_port().Eval<QueryObject<double>>(context);
+  const IrisCollisionGeometries geometries =
+      MakeIrisCollisionGeometries(plant, query_object);
+
+  const int num_regions = static_cast<int>(seeds.size());
+  std::vector<HPolyhedron> regions(num_regions);
+  std::mutex progress_mutex;
+  // Each region is grown in its own clone of the diagram context, positioned
+  // at its seed.
+  auto grow_region = [&](int i) {
+    std::unique_ptr<Context<double>> region_root_context =
+        root_context.Clone();
+    Context<double>& region_context =
+        plant.GetMyMutableContextFromRoot(region_root_context.get());
+    plant.SetPositions(&region_context, seeds[i]);
+    std::function<void(int, const HPolyhedron&)> on_iteration;
+    if (progress_callback) {
+      on_iteration = [&, i](int iteration, const HPolyhedron& region) {
+        std::lock_guard<std::mutex> lock(progress_mutex);
+        progress_callback(i, iteration, region);
+      };
+    }
+    regions[i] = GrowIrisRegion(plant, region_context, geometries, options,
+                                1, on_iteration);
+  };
+  // Each region makes its own solvers, but IPOPT is not thread-safe at all.
+  ParallelFor(num_regions,
+              NumCounterExampleThreads(*MakeCounterExampleSolver(),
+                                       options.num_threads),
+              grow_region);
+  return regions;
+}
+
 }  // namespace optimization
 }  // namespace geometry
 }  // namespace drake
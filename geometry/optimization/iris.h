@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <optional>
 #include <vector>
@@ -86,6 +87,14 @@ struct IrisOptions {
   counter-examples for the additional constraints using in
   IrisInConfigurationSpace. Use this option to set the initial seed. */
   int random_seed{1234};
+
+  /** The number of threads used by IrisInConfigurationSpace. When growing a
+  single region, the counter-example searches for up to this many collision
+  pairs run concurrently; when growing several regions, this many regions are
+  grown concurrently. Each thread uses its own solver. Since IPOPT is not
+  thread-safe, only one thread is used unless SNOPT is available; the regions
+  found do not change. */
+  int num_threads{1};
 };
 
 /** The IRIS (Iterative Region Inflation by Semidefinite programming) algorithm,
@@ -159,6 +168,12 @@ the IRIS regions are collision free but can also significantly increase the
 run-time of the algorithm. The same goes for
 `options.num_additional_constraints_infeasible_samples`.
 
+When `options.num_threads` is greater than one, the collision pairs are
+searched in rounds of `options.num_threads` pairs. The searches of one round
+run concurrently, each with its own plant context, from the region found by
+the previous rounds. The resulting region only depends on the number of
+threads, but differs from the region found with one thread.
+
 @throws std::exception if the sample configuration in @p context is infeasible.
 @ingroup geometry_optimization
 */
@@ -167,6 +182,36 @@ HPolyhedron IrisInConfigurationSpace(
     const systems::Context<double>& context,
     const IrisOptions& options = IrisOptions());
 
+/** Grows one region with IrisInConfigurationSpace() from each of the @p seeds,
+for instance to build a roadmap of regions. The convex sets of the geometries
+and the collision candidate pairs are computed once and shared by all the
+regions. Up to `options.num_threads` regions are grown concurrently, each in
+its own clone of @p root_context, and each searches its collision pairs in a
+single thread. The i-th region is the region that IrisInConfigurationSpace()
+returns when the positions of @p plant are `seeds[i]` and
+`options.num_threads` is one.
+
+@param plant describes the kinematics of configuration space.  It must be
+connected to a SceneGraph in a systems::Diagram.
+@param root_context is a context of that diagram. Unlike the single region
+overload, this takes the root context so that it can be cloned.
+@param seeds are the configurations to grow the regions from. Each must have
+`plant.num_positions()` elements.
+@param progress_callback if set, is called after each iteration of each region
+with the index of its seed, the number of iterations done so far, and the
+current region. The calls are serialized, but may come from any thread.
+
+@throws std::exception if any of the @p seeds is infeasible.
+@ingroup geometry_optimization
+*/
+std::vector<HPolyhedron> IrisInConfigurationSpace(
+    const multibody::MultibodyPlant<double>& plant,
+    const systems::Context<double>& root_context,
+    const std::vector<Eigen::VectorXd>& seeds,
+    const IrisOptions& options = IrisOptions(),
+    const std::function<void(int, int, const HPolyhedron&)>&
+        progress_callback = nullptr);
+
 }  // namespace optimization
 }  // namespace geometry
 }  // namespace drake
@@ -1341,6 +1341,26 @@ GTEST_TEST(ShortestPathTest, RoundedSolution) {
                 rounded_result.GetSolution(edges[ii]->phi()) == 1);
   }
 
+  // Solving the rounded paths concurrently finds the same path.
+  options.max_rounding_threads = 4;
+  GraphOfConvexSetsStatistics statistics;
+  auto parallel_result = spp.SolveShortestPath(source->id(), target->id(),
+                                               options, &statistics);
+  ASSERT_TRUE(parallel_result.is_success());
+  EXPECT_NEAR(parallel_result.get_optimal_cost(),
+              rounded_result.get_optimal_cost(), 1e-6);
+  for (const auto& e : edges) {
+    EXPECT_EQ(parallel_result.GetSolution(e->phi()),
+              rounded_result.GetSolution(e->phi()));
+  }
+  EXPECT_GT(statistics.num_rounded_paths, 1);
+  EXPECT_LE(statistics.num_rounded_paths, options.max_rounded_paths);
+  EXPECT_GE(statistics.setup_time, 0);
+  EXPECT_GT(statistics.relaxation_time, 0);
+  EXPECT_GT(statistics.rounding_time, 0);
+  EXPECT_GE(statistics.postprocessing_time, 0);
+  options.max_rounding_threads = 1;
+
   if (!MixedIntegerSolverAvailable()) {
     return;
   }
@@ -266,6 +266,78 @@ GTEST_TEST(HPolyhedronTest, ChebyshevCenter2) {
   EXPECT_GE(distance[3], 1.0 - 1e-6);
 }
 
+class HPolyhedronTester {
+ public:
+  static int num_derived_quantities_computed(const HPolyhedron& H) {
+    return H.num_derived_quantities_computed();
+  }
+};
+
+GTEST_TEST(HPolyhedronTest, CachedDerivedQuantities) {
+  const HPolyhedron H =
+      HPolyhedron::MakeBox(Vector2d{1, -1}, Vector2d{5, 1});
+  EXPECT_EQ(HPolyhedronTester::num_derived_quantities_computed(H), 0);
+  const VectorXd center = H.ChebyshevCenter();
+  EXPECT_TRUE(CompareMatrices(center, Vector2d(3, 0), 1e-6));
+  const Hyperellipsoid E = H.MaximumVolumeInscribedEllipsoid();
+  EXPECT_TRUE(H.IsBounded());
+  EXPECT_EQ(HPolyhedronTester::num_derived_quantities_computed(H), 3);
+
+  // Copies share the cached values.
+  const HPolyhedron H_copy = H;
+  EXPECT_TRUE(CompareMatrices(H_copy.ChebyshevCenter(), center));
+  const Hyperellipsoid E_copy = H_copy.MaximumVolumeInscribedEllipsoid();
+  EXPECT_TRUE(CompareMatrices(E_copy.A(), E.A()));
+  EXPECT_TRUE(CompareMatrices(E_copy.center(), E.center()));
+  EXPECT_TRUE(H_copy.IsBounded());
+  EXPECT_TRUE(CompareMatrices(H.ChebyshevCenter(), center));
+  // None of these calls solved a program again.
+  EXPECT_EQ(HPolyhedronTester::num_derived_quantities_computed(H), 3);
+  EXPECT_EQ(HPolyhedronTester::num_derived_quantities_computed(H_copy), 3);
+
+  // A set that is assigned new data does not reuse the stale cache.
+  HPolyhedron H_assigned = H;
+  H_assigned = HPolyhedron::MakeUnitBox(2);
+  EXPECT_EQ(HPolyhedronTester::num_derived_quantities_computed(H_assigned), 0);
+  EXPECT_TRUE(
+      CompareMatrices(H_assigned.ChebyshevCenter(), Vector2d::Zero(), 1e-6));
+  EXPECT_EQ(HPolyhedronTester::num_derived_quantities_computed(H_assigned), 1);
+
+  // Neither does a set that is deserialized over a copy.
+  const std::string yaml =
+      yaml::SaveYamlString(HPolyhedron::MakeUnitBox(2));
+  const auto H_loaded =
+      yaml::LoadYamlString<HPolyhedron>(yaml, std::nullopt, H);
+  EXPECT_EQ(HPolyhedronTester::num_derived_quantities_computed(H_loaded), 0);
+  EXPECT_TRUE(
+      CompareMatrices(H_loaded.ChebyshevCenter(), Vector2d::Zero(), 1e-6));
+  EXPECT_TRUE(CompareMatrices(H.ChebyshevCenter(), center));
+  EXPECT_EQ(HPolyhedronTester::num_derived_quantities_computed(H), 3);
+}
+
+GTEST_TEST(HPolyhedronTest, PointsInSet) {
+  const HPolyhedron H = HPolyhedron::MakeL1Ball(3);
+  // More points than one block of the batched evaluation.
+  const int num_points = 1000;
+  const MatrixXd x = 0.8 * MatrixXd::Random(3, num_points);
+  const VectorX<bool> in_set = H.PointsInSet(x);
+  ASSERT_EQ(in_set.size(), num_points);
+  int num_in_set = 0;
+  for (int i = 0; i < num_points; ++i) {
+    EXPECT_EQ(in_set[i], H.PointInSet(x.col(i)));
+    num_in_set += in_set[i];
+  }
+  EXPECT_GT(num_in_set, 0);
+  EXPECT_LT(num_in_set, num_points);
+
+  const Vector3d on_boundary(0.5, 0.5, 0);
+  EXPECT_TRUE(H.PointsInSet(on_boundary)[0]);
+  EXPECT_FALSE(H.PointsInSet(on_boundary * 1.01)[0]);
+  EXPECT_TRUE(H.PointsInSet(on_boundary * 1.01, 0.02)[0]);
+  EXPECT_EQ(H.PointsInSet(MatrixXd(3, 0)).size(), 0);
+  EXPECT_TRUE(HPolyhedron(MatrixXd(0, 3), VectorXd(0)).PointsInSet(x).all());
+}
+
 GTEST_TEST(HPolyhedronTest, CloneTest) {
   HPolyhedron H = HPolyhedron::MakeBox(Vector3d{-3, -4, -5}, Vector3d{6, 7, 8});
   std::unique_ptr<ConvexSet> clone = H.Clone();
@@ -586,6 +658,79 @@ GTEST_TEST(HPolyhedronTest, ReduceL1LInfBallIntersection) {
   EXPECT_TRUE(CompareMatrices(reduced_polyhedron.b(), L1_ball.b()));
 }
 
+GTEST_TEST(HPolyhedronTest, ReduceL1LInfBallIntersection2D) {
+  // In 2D, the inequalities are reduced without solving linear programs. The
+  // sides of the box only touch the L1 ball at its vertices.
+  HPolyhedron L1_ball = HPolyhedron::MakeL1Ball(2);
+  HPolyhedron Linfty_ball = HPolyhedron::MakeUnitBox(2);
+  HPolyhedron reduced_polyhedron =
+      L1_ball.Intersection(Linfty_ball).ReduceInequalities();
+  EXPECT_TRUE(CompareMatrices(reduced_polyhedron.A(), L1_ball.A()));
+  EXPECT_TRUE(CompareMatrices(reduced_polyhedron.b(), L1_ball.b()));
+
+  // The box cuts the corners of a larger L1 ball. Of the duplicated rows, only
+  // the last one is kept, and the kept rows stay in their original order.
+  HPolyhedron large_L1_ball(L1_ball.A(), 1.5 * L1_ball.b());
+  HPolyhedron duplicated = Linfty_ball.Intersection(large_L1_ball)
+                               .Intersection(Linfty_ball);
+  reduced_polyhedron = duplicated.ReduceInequalities();
+  EXPECT_TRUE(CompareMatrices(reduced_polyhedron.A(),
+                              duplicated.A().bottomRows(8)));
+  EXPECT_TRUE(CompareMatrices(reduced_polyhedron.b(),
+                              duplicated.b().bottomRows(8)));
+
+  // An unbounded set falls back to the linear programs.
+  Matrix<double, 3, 2> A;
+  // clang-format off
+  A << 1, 0,
+       1, 0,
+       0, 1;
+  // clang-format on
+  reduced_polyhedron = HPolyhedron(A, Vector3d(2, 1, 1)).ReduceInequalities();
+  EXPECT_TRUE(CompareMatrices(reduced_polyhedron.A(), A.bottomRows(2)));
+  EXPECT_TRUE(CompareMatrices(reduced_polyhedron.b(), Vector2d(1, 1)));
+}
+
+GTEST_TEST(HPolyhedronTest, ReduceInequalities2DTolerance) {
+  // The last row cuts a small corner off the box.
+  Matrix<double, 5, 2> A;
+  // clang-format off
+  A << 1, 0,
+       0, 1,
+       -1, 0,
+       0, -1,
+       1, 1;
+  // clang-format on
+  Matrix<double, 5, 1> b;
+  b << 1, 1, 1, 1, 1.9999;
+  const HPolyhedron H(A, b);
+  // The cut is an edge of the set, which a zero tolerance keeps.
+  HPolyhedron reduced_polyhedron = H.ReduceInequalities(0);
+  EXPECT_TRUE(CompareMatrices(reduced_polyhedron.A(), A));
+  EXPECT_TRUE(CompareMatrices(reduced_polyhedron.b(), b));
+  // A larger tolerance removes it, but none of the sides of the box.
+  reduced_polyhedron = H.ReduceInequalities(1E-3);
+  EXPECT_TRUE(CompareMatrices(reduced_polyhedron.A(), A.topRows(4)));
+  EXPECT_TRUE(CompareMatrices(reduced_polyhedron.b(), b.head(4)));
+  // A large enough tolerance also removes the first two sides, which leaves a
+  // (bounded) triangle.
+  reduced_polyhedron = H.ReduceInequalities(2.5);
+  EXPECT_TRUE(CompareMatrices(reduced_polyhedron.A(), A.bottomRows(3)));
+  EXPECT_TRUE(CompareMatrices(reduced_polyhedron.b(), b.tail(3)));
+}
+
+GTEST_TEST(HPolyhedronTest, ReduceInequalities1D) {
+  Matrix<double, 5, 1> A;
+  A << 1, -2, 2, 0, -1;
+  Matrix<double, 5, 1> b;
+  // x ≤ 3, x ≥ -1, x ≤ 1, 0 ≤ 1, x ≥ -2.
+  b << 3, 2, 2, 1, 2;
+  const HPolyhedron reduced_polyhedron =
+      HPolyhedron(A, b).ReduceInequalities();
+  EXPECT_TRUE(CompareMatrices(reduced_polyhedron.A(), Vector2d(-2, 2)));
+  EXPECT_TRUE(CompareMatrices(reduced_polyhedron.b(), Vector2d(2, 2)));
+}
+
 GTEST_TEST(HPolyhedronTest, IntersectionTest) {
   HPolyhedron H_A = HPolyhedron::MakeUnitBox(2);
   HPolyhedron H_B = HPolyhedron::MakeBox(Vector2d(0, 0), Vector2d(2, 2));
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/geometry/meshcat.h"
 #include "drake/geometry/optimization/hpolyhedron.h"
@@ -120,6 +121,62 @@ GTEST_TEST(IrisInConfigurationSpaceTest, BoxesPrismatic) {
                               "The seed point is in collision.*");
 }
 
+// The collision pairs of the boxes are searched concurrently.
+GTEST_TEST(IrisInConfigurationSpaceTest, BoxesPrismaticParallel) {
+  const Vector1d sample = Vector1d::Zero();
+  IrisOptions options;
+  options.num_threads = 2;
+  HPolyhedron region = IrisFromUrdf(boxes_urdf, sample, options);
+
+  EXPECT_EQ(region.ambient_dimension(), 1);
+
+  const double kTol = 1e-3;  // due to ibex's rel_eps_f.
+  const double qmin = -1.0 + options.configuration_space_margin,
+               qmax = 1.0 - options.configuration_space_margin;
+  EXPECT_TRUE(region.PointInSet(Vector1d{qmin + kTol}));
+  EXPECT_TRUE(region.PointInSet(Vector1d{qmax - kTol}));
+  EXPECT_FALSE(region.PointInSet(Vector1d{qmin - kTol}));
+  EXPECT_FALSE(region.PointInSet(Vector1d{qmax + kTol}));
+}
+
+// Grows several regions of the boxes at once.
+GTEST_TEST(IrisInConfigurationSpaceTest, BoxesPrismaticSeeds) {
+  systems::DiagramBuilder<double> builder;
+  multibody::MultibodyPlant<double>& plant =
+      multibody::AddMultibodyPlantSceneGraph(&builder, 0.0);
+  multibody::Parser(&plant).AddModelFromString(boxes_urdf, "urdf");
+  plant.Finalize();
+  auto diagram = builder.Build();
+  auto context = diagram->CreateDefaultContext();
+
+  const std::vector<Eigen::VectorXd> seeds{Vector1d{0.0}, Vector1d{-0.5},
+                                           Vector1d{0.5}};
+  IrisOptions options;
+  options.num_threads = 2;
+  std::vector<int> num_iterations(seeds.size(), 0);
+  const std::vector<HPolyhedron> regions = IrisInConfigurationSpace(
+      plant, *context, seeds, options,
+      [&num_iterations](int index, int iteration, const HPolyhedron&) {
+        EXPECT_EQ(iteration, num_iterations.at(index) + 1);
+        num_iterations.at(index) = iteration;
+      });
+  ASSERT_EQ(regions.size(), seeds.size());
+
+  options.num_threads = 1;
+  for (int i = 0; i < static_cast<int>(seeds.size()); ++i) {
+    EXPECT_GT(num_iterations[i], 0);
+    // Each region is the one grown from its seed alone.
+    const HPolyhedron region = IrisFromUrdf(boxes_urdf, seeds[i], options);
+    EXPECT_TRUE(CompareMatrices(regions[i].A(), region.A()));
+    EXPECT_TRUE(CompareMatrices(regions[i].b(), region.b()));
+  }
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      IrisInConfigurationSpace(plant, *context,
+                               {Vector1d{0.0}, Vector1d{1.1}}, options),
+      "The seed point is in collision.*");
+}
+
 // Three spheres.  Two on the outside are fixed.  One in the middle on a
 // prismatic joint.  The configuration space is a (convex) line segment q ∈
 // (−1,1).
@@ -477,6 +477,47 @@ GTEST_TEST(VPolytopeTest, CalcVolume) {
   EXPECT_NEAR(VPolytope(vertices_3d_planar).CalcVolume(), 0., tol);
 }
 
+class VPolytopeTester {
+ public:
+  static int num_derived_quantities_computed(const VPolytope& V) {
+    return V.num_derived_quantities_computed();
+  }
+};
+
+GTEST_TEST(VPolytopeTest, CachedDerivedQuantities) {
+  Eigen::Matrix<double, 2, 5> vertices;
+  // clang-format off
+  vertices << 1, -1, 0, 0, 0,
+              0, 0, 1, -1, 0;
+  // clang-format on
+  const VPolytope V(vertices);
+  EXPECT_EQ(VPolytopeTester::num_derived_quantities_computed(V), 0);
+  const VPolytope V_minimal = V.GetMinimalRepresentation();
+  EXPECT_EQ(V_minimal.vertices().cols(), 4);
+  const double volume = V.CalcVolume();
+  EXPECT_NEAR(volume, 2, 1E-6);
+  EXPECT_EQ(VPolytopeTester::num_derived_quantities_computed(V), 2);
+
+  // Copies share the cached values, which are returned on every call.
+  const VPolytope V_copy = V;
+  EXPECT_EQ(V_copy.CalcVolume(), volume);
+  EXPECT_TRUE(CompareMatrices(V_copy.GetMinimalRepresentation().vertices(),
+                              V_minimal.vertices()));
+  EXPECT_TRUE(CompareMatrices(V.GetMinimalRepresentation().vertices(),
+                              V_minimal.vertices()));
+  // None of these calls computed anything again.
+  EXPECT_EQ(VPolytopeTester::num_derived_quantities_computed(V), 2);
+  EXPECT_EQ(VPolytopeTester::num_derived_quantities_computed(V_copy), 2);
+
+  // A set that is assigned new vertices does not reuse the stale cache.
+  VPolytope V_assigned = V;
+  V_assigned = VPolytope::MakeUnitBox(2);
+  EXPECT_EQ(VPolytopeTester::num_derived_quantities_computed(V_assigned), 0);
+  EXPECT_NEAR(V_assigned.CalcVolume(), 4, 1E-6);
+  EXPECT_EQ(VPolytopeTester::num_derived_quantities_computed(V_assigned), 1);
+  EXPECT_EQ(VPolytopeTester::num_derived_quantities_computed(V), 2);
+}
+
 double CalcPathLength(const Eigen::MatrixXd& vertices) {
   DRAKE_DEMAND(vertices.rows() == 2);
 
@@ -1,9 +1,11 @@
 #include "drake/geometry/optimization/vpolytope.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <numeric>
 
 #include <drake_vendor/libqhullcpp/Qhull.h>
@@ -75,16 +77,79 @@ Eigen::MatrixXd OrderCounterClockwise(const Eigen::MatrixXd& vertices) {
   return sorted_vertices;
 }
 
+/* Returns the vertices of the convex hull of `vertices`, ordered
+counter-clockwise in 2D. */
+Eigen::MatrixXd CalcMinimalVertices(const Eigen::MatrixXd& vertices) {
+  orgQhull::Qhull qhull;
+  qhull.runQhull("", vertices.rows(), vertices.cols(), vertices.data(), "");
+  if (qhull.qhullStatus() != 0) {
+    throw std::runtime_error(
+        fmt::format("Qhull terminated with status {} and  message:\n{}",
+                    qhull.qhullStatus(), qhull.qhullMessage()));
+  }
+
+  Eigen::MatrixXd minimal_vertices(vertices.rows(), qhull.vertexCount());
+  size_t j = 0;
+  for (const auto& qhull_vertex : qhull.vertexList()) {
+    size_t i = 0;
+    for (const auto& val : qhull_vertex.point()) {
+      minimal_vertices(i, j) = val;
+      ++i;
+    }
+    ++j;
+  }
+
+  // The qhull C++ interface iterates over the vertices in no specific order.
+  // For the 2D case, reorder the vertices according to the counter-clockwise
+  // convention.
+  if (vertices.rows() == 2) {
+    minimal_vertices = OrderCounterClockwise(minimal_vertices);
+  }
+
+  return minimal_vertices;
+}
+
+/* Returns the volume of the convex hull of `vertices`. */
+double CalcConvexHullVolume(const Eigen::MatrixXd& vertices) {
+  orgQhull::Qhull qhull;
+  try {
+    qhull.runQhull("", vertices.rows(), vertices.cols(), vertices.data(), "");
+  } catch (const orgQhull::QhullError& e) {
+    if (e.errorCode() == qh_ERRsingular) {
+      // The convex hull is singular. It has 0 volume.
+      return 0;
+    }
+  }
+  if (qhull.qhullStatus() != 0) {
+    throw std::runtime_error(
+        fmt::format("Qhull terminated with status {} and  message:\n{}",
+                    qhull.qhullStatus(), qhull.qhullMessage()));
+  }
+  return qhull.volume();
+}
+
 }  // namespace
 
+// Each quantity is computed by the first call that needs it; std::call_once
+// makes concurrent callers wait for it, and retries if the computation throws.
+struct VPolytope::DerivedQuantities {
+  std::once_flag minimal_vertices_flag;
+  Eigen::MatrixXd minimal_vertices;
+  std::once_flag volume_flag;
+  double volume{};
+  std::atomic<int> num_computed{0};
+};
+
 VPolytope::VPolytope(const Eigen::Ref<const Eigen::MatrixXd>& vertices)
     : ConvexSet(&ConvexSetCloner<VPolytope>, vertices.rows()),
-      vertices_{vertices} {}
+      vertices_{vertices},
+      derived_{std::make_shared<DerivedQuantities>()} {}
 
 VPolytope::VPolytope(const QueryObject<double>& query_object,
                      GeometryId geometry_id,
                      std::optional<FrameId> reference_frame)
-    : ConvexSet(&ConvexSetCloner<VPolytope>, 3) {
+    : ConvexSet(&ConvexSetCloner<VPolytope>, 3),
+      derived_{std::make_shared<DerivedQuantities>()} {
   Matrix3Xd vertices;
   query_object.inspector().GetShape(geometry_id).Reify(this, &vertices);
 
@@ -97,7 +162,8 @@ VPolytope::VPolytope(const QueryObject<double>& query_object,
 }
 
 VPolytope::VPolytope(const HPolyhedron& hpoly)
-    : ConvexSet(&ConvexSetCloner<VPolytope>, hpoly.ambient_dimension()) {
+    : ConvexSet(&ConvexSetCloner<VPolytope>, hpoly.ambient_dimension()),
+      derived_{std::make_shared<DerivedQuantities>()} {
   DRAKE_THROW_UNLESS(hpoly.IsBounded());
 
   Eigen::MatrixXd coeffs(hpoly.A().rows(), hpoly.A().cols() + 1);
@@ -186,52 +252,29 @@ VPolytope VPolytope::MakeUnitBox(int dim) {
 }
 
 VPolytope VPolytope::GetMinimalRepresentation() const {
-  orgQhull::Qhull qhull;
-  qhull.runQhull("", vertices_.rows(), vertices_.cols(), vertices_.data(), "");
-  if (qhull.qhullStatus() != 0) {
-    throw std::runtime_error(
-        fmt::format("Qhull terminated with status {} and  message:\n{}",
-                    qhull.qhullStatus(), qhull.qhullMessage()));
-  }
-
-  Eigen::MatrixXd minimal_vertices(vertices_.rows(), qhull.vertexCount());
-  size_t j = 0;
-  for (const auto& qhull_vertex : qhull.vertexList()) {
-    size_t i = 0;
-    for (const auto& val : qhull_vertex.point()) {
-      minimal_vertices(i, j) = val;
-      ++i;
-    }
-    ++j;
+  if (derived_ == nullptr) {
+    return VPolytope(CalcMinimalVertices(vertices_));
   }
-
-  // The qhull C++ interface iterates over the vertices in no specific order.
-  // For the 2D case, reorder the vertices according to the counter-clockwise
-  // convention.
-  if (vertices_.rows() == 2) {
-    minimal_vertices = OrderCounterClockwise(minimal_vertices);
-  }
-
-  return VPolytope(minimal_vertices);
+  std::call_once(derived_->minimal_vertices_flag, [this]() {
+    derived_->minimal_vertices = CalcMinimalVertices(vertices_);
+    ++derived_->num_computed;
+  });
+  return VPolytope(derived_->minimal_vertices);
 }
 
 double VPolytope::CalcVolume() const {
-  orgQhull::Qhull qhull;
-  try {
-    qhull.runQhull("", ambient_dimension_, vertices_.cols(), vertices_.data(),
-                   "");
-  } catch (const orgQhull::QhullError& e) {
-    if (e.errorCode() == qh_ERRsingular) {
-      // The convex hull is singular. It has 0 volume.
-      return 0;
-    }
+  if (derived_ == nullptr) {
+    return CalcConvexHullVolume(vertices_);
   }
-  if (qhull.qhullStatus() != 0) {
-    throw std::runtime_error(
-        fmt::format("Qhull terminated with status {} and  message:\n{}",
-                    qhull.qhullStatus(), qhull.qhullMessage()));
-  }
-  return qhull.volume();
+  std::call_once(derived_->volume_flag, [this]() {
+    derived_->volume = CalcConvexHullVolume(vertices_);
+    ++derived_->num_computed;
+  });
+  return derived_->volume;
+}
+
+int VPolytope::num_derived_quantities_computed() const {
+  return derived_ == nullptr ? 0 : derived_->num_computed.load();
 }
 
 bool VPolytope::DoPointInSet(const Eigen::Ref<const Eigen::VectorXd>& x,
@@ -21,6 +21,10 @@ namespace optimization {
  definition means the set is always bounded (hence the name polytope, instead of
  polyhedron).
 
+ The vertices never change after construction, so GetMinimalRepresentation() and
+ CalcVolume() run Qhull on the first call only and cache the result. Copies of a
+ VPolytope share the cache, which is safe to use from several threads at once.
+
 @ingroup geometry_optimization
 */
 class VPolytope final : public ConvexSet {
@@ -113,7 +117,18 @@ class VPolytope final : public ConvexSet {
   void ImplementGeometry(const Box& box, void* data) final;
   void ImplementGeometry(const Convex& convex, void* data) final;
 
+  // The lazily computed quantities, shared by the copies of this set. It is
+  // only null for a moved-from set, which then computes them without caching.
+  struct DerivedQuantities;
+
+  // Returns the number of quantities computed so far for the cache shared by
+  // this set (or zero if it has none), for unit testing.
+  int num_derived_quantities_computed() const;
+
+  friend class VPolytopeTester;
+
   Eigen::MatrixXd vertices_;
+  std::shared_ptr<DerivedQuantities> derived_;
 };
 
 }  // namespace optimization
@@ -45,6 +45,14 @@ GTEST_TEST(MeshcatAnimationTest, OptionsTest) {
   EXPECT_TRUE(animation.clamp_when_finished());
   animation.set_clamp_when_finished(false);
   EXPECT_FALSE(animation.clamp_when_finished());
+
+  EXPECT_FALSE(animation.decimation_tolerance());
+  animation.set_decimation_tolerance(1e-3);
+  EXPECT_EQ(animation.decimation_tolerance(), 1e-3);
+  animation.set_decimation_tolerance(std::nullopt);
+  EXPECT_FALSE(animation.decimation_tolerance());
+  DRAKE_EXPECT_THROWS_MESSAGE(animation.set_decimation_tolerance(-1),
+                              ".*tolerance.*");
 }
 
 GTEST_TEST(MeshcatAnimationTest, SetTransformTest) {
@@ -112,6 +120,13 @@ GTEST_TEST(MeshcatAnimationTest, SetPropertyTest) {
   EXPECT_EQ((*vec)[1], .2);
   EXPECT_EQ(animation.get_javascript_type("vector_test", "position"), "vector");
 
+  // Can't set a vector of a different size on a property that's already been
+  // set.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      animation.SetProperty(kFrame + 1, "vector_test", "position",
+                            std::vector<double>{0.1}),
+      ".*values of size 2 != 1.*");
+
   // Can't set a different type on a property that's already been set.
   DRAKE_EXPECT_THROWS_MESSAGE(
       animation.SetProperty(kFrame, "bool_test", "visible", 32.0),
@@ -122,6 +137,37 @@ GTEST_TEST(MeshcatAnimationTest, SetPropertyTest) {
       ".*already has a track.*");
 }
 
+// The keyframes may be set in any order, and setting a keyframe again replaces
+// its value.
+GTEST_TEST(MeshcatAnimationTest, KeyFrameOrderTest) {
+  MeshcatAnimation animation;
+  for (int frame : {5, 1, 9, 3, 7}) {
+    animation.SetProperty(frame, "test", "material.opacity", 0.1 * frame);
+    animation.SetTransform(frame, "test",
+                           RigidTransformd(Vector3d(frame, 0, 0)));
+  }
+  animation.SetProperty(3, "test", "material.opacity", -1.0);
+  animation.SetTransform(3, "test", RigidTransformd(Vector3d(-1, 0, 0)));
+
+  for (int frame = 0; frame < 11; ++frame) {
+    const std::optional<double> opacity =
+        animation.get_key_frame<double>(frame, "test", "material.opacity");
+    const std::optional<std::vector<double>> position =
+        animation.get_key_frame<std::vector<double>>(frame, "test",
+                                                     "position");
+    if (frame % 2 == 0 || frame > 9) {
+      EXPECT_FALSE(opacity);
+      EXPECT_FALSE(position);
+      continue;
+    }
+    ASSERT_TRUE(opacity);
+    ASSERT_TRUE(position);
+    const double x = (frame == 3) ? -1.0 : frame;
+    EXPECT_EQ(*opacity, (frame == 3) ? -1.0 : 0.1 * frame);
+    EXPECT_EQ(*position, std::vector<double>({x, 0.0, 0.0}));
+  }
+}
+
 }  // namespace
 }  // namespace geometry
 }  // namespace drake
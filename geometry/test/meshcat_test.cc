@@ -1,7 +1,11 @@
 #include "drake/geometry/meshcat.h"
 
+#include <chrono>
 #include <cstdlib>
+#include <functional>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include <fmt/format.h>
 #include <gmock/gmock.h>
@@ -42,7 +46,7 @@ int SystemCall(const std::vector<std::string>& argv) {
 // @param expect_success Whether to insist that the python helper finished and
 //     the expected_json (if given) was actually received.
 void CheckWebsocketCommand(
-    const Meshcat& meshcat,
+    const std::string& ws_url,
     std::optional<std::string> send_json,
     std::optional<int> expect_num_messages,
     std::optional<std::string> expect_json,
@@ -54,7 +58,7 @@ void CheckWebsocketCommand(
   // instrument the helper process. Our valgrind configuration recognizes this
   // argument and skips instrumentation of the child process.
   argv.push_back("--disable-drake-valgrind-tracing");
-  argv.push_back(fmt::format("--ws_url={}", meshcat.ws_url()));
+  argv.push_back(fmt::format("--ws_url={}", ws_url));
   if (send_json) {
     DRAKE_DEMAND(!send_json->empty());
     argv.push_back(fmt::format("--send_message={}", std::move(*send_json)));
@@ -75,6 +79,36 @@ void CheckWebsocketCommand(
   }
 }
 
+void CheckWebsocketCommand(
+    const Meshcat& meshcat,
+    std::optional<std::string> send_json,
+    std::optional<int> expect_num_messages,
+    std::optional<std::string> expect_json,
+    bool expect_success = true) {
+  CheckWebsocketCommand(meshcat.ws_url(), std::move(send_json),
+                        expect_num_messages, std::move(expect_json),
+                        expect_success);
+}
+
+// Like CheckWebsocketCommand (without a message to send), for the messages
+// caused by `update`, which is called only once the client has connected.
+// Upon connecting, the client receives one (show_realtime_rate) message from a
+// fresh Meshcat instance.
+void CheckWebsocketUpdate(Meshcat* meshcat, const std::function<void()>& update,
+                          int expect_num_messages, std::string expect_json) {
+  // The client runs in its own thread, which must not call into `meshcat`.
+  std::thread client([ws_url = meshcat->ws_url(), expect_num_messages,
+                      &expect_json]() {
+    CheckWebsocketCommand(ws_url, {}, expect_num_messages, expect_json);
+  });
+  for (int i = 0; i < 1000 && meshcat->GetNumActiveConnections() == 0; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_EQ(meshcat->GetNumActiveConnections(), 1);
+  update();
+  client.join();
+}
+
 GTEST_TEST(MeshcatTest, TestHttp) {
   Meshcat meshcat;
   // Note: The server doesn't respect all requests; unfortunately we can't use
@@ -445,6 +479,108 @@ GTEST_TEST(MeshcatTest, SetTransformWithMatrix) {
   EXPECT_TRUE(CompareMatrices(matrix, actual));
 }
 
+GTEST_TEST(MeshcatTest, SetTransforms) {
+  Meshcat meshcat;
+  const std::vector<std::string> paths{"frame", "other/frame"};
+  std::vector<RigidTransformd> X_ParentPaths{
+      RigidTransformd{math::RollPitchYawd(.5, .26, -3), Vector3d{.9, -2., .12}},
+      RigidTransformd{Vector3d{1., 2., 3.}}};
+
+  auto expect_transforms = [&]() {
+    for (int i = 0; i < 2; ++i) {
+      std::string transform = meshcat.GetPackedTransform(paths[i]);
+      msgpack::object_handle oh =
+          msgpack::unpack(transform.data(), transform.size());
+      auto data = oh.get().as<internal::SetTransformData>();
+      EXPECT_EQ(data.path, "/drake/" + paths[i]);
+      Eigen::Map<Eigen::Matrix4d> matrix(data.matrix);
+      EXPECT_TRUE(CompareMatrices(matrix, X_ParentPaths[i].GetAsMatrix4()));
+    }
+  };
+
+  meshcat.SetTransforms(paths, X_ParentPaths);
+  expect_transforms();
+
+  // Setting the same transforms again is a no-op.
+  meshcat.SetTransforms(paths, X_ParentPaths);
+  expect_transforms();
+
+  // A transform set by SetTransform is not skipped by the next SetTransforms,
+  // even when the latter sets it back to its previous value.
+  meshcat.SetTransform(paths[0], RigidTransformd{});
+  meshcat.SetTransforms(paths, X_ParentPaths);
+  expect_transforms();
+
+  // A deleted path is set again, even to the same transform.
+  meshcat.Delete("other");
+  EXPECT_FALSE(meshcat.HasPath(paths[1]));
+  meshcat.SetTransforms(paths, X_ParentPaths);
+  EXPECT_TRUE(meshcat.HasPath(paths[1]));
+  expect_transforms();
+
+  // Only the transforms that changed are sent.
+  X_ParentPaths[1] = RigidTransformd{Vector3d{4., 5., 6.}};
+  meshcat.SetTransforms(paths, X_ParentPaths);
+  expect_transforms();
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      meshcat.SetTransforms(paths, {RigidTransformd{}}),
+      ".*paths.size\\(\\) == X_ParentPaths.size\\(\\).*");
+}
+
+// Checks the set_transforms message as received by a browser. Its matrices are
+// packed into a single binary blob, which the client decodes into one list of
+// the column-major matrices.
+GTEST_TEST(MeshcatTest, SetTransformsWebSocket) {
+  Meshcat meshcat;
+  const std::vector<std::string> paths{"frame", "other/frame"};
+  CheckWebsocketUpdate(
+      &meshcat,
+      [&]() {
+        meshcat.SetTransforms(paths, {RigidTransformd{Vector3d{1, 2, 3}},
+                                      RigidTransformd{Vector3d{4, 5, 6}}});
+      },
+      2, R"""({
+      "type": "set_transforms",
+      "paths": ["/drake/frame", "/drake/other/frame"],
+      "matrices": [1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 2, 3, 1,
+                   1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 4, 5, 6, 1]
+    })""");
+}
+
+// Checks that the transforms set while a browser has backpressure are
+// coalesced, and sent to it as a single message once it has drained.
+GTEST_TEST(MeshcatTest, SetTransformsCoalesced) {
+  Meshcat meshcat;
+  const std::vector<std::string> paths{"frame", "other/frame"};
+  CheckWebsocketUpdate(
+      &meshcat,
+      [&]() {
+        meshcat.InjectTransformsBackpressure(true);
+        meshcat.SetTransforms(paths, {RigidTransformd{Vector3d{1, 2, 3}},
+                                      RigidTransformd{Vector3d{4, 5, 6}}});
+        // Only the latest transform of each path is sent.
+        meshcat.SetTransforms(paths, {RigidTransformd{Vector3d{1, 2, 3}},
+                                      RigidTransformd{Vector3d{7, 8, 9}}});
+        meshcat.InjectTransformsBackpressure(false);
+      },
+      2, R"""({
+      "type": "set_transforms",
+      "paths": ["/drake/frame", "/drake/other/frame"],
+      "matrices": [1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 2, 3, 1,
+                   1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 7, 8, 9, 1]
+    })""");
+
+  // The scene tree has the latest transforms, too.
+  std::string transform = meshcat.GetPackedTransform("other/frame");
+  msgpack::object_handle oh =
+      msgpack::unpack(transform.data(), transform.size());
+  auto data = oh.get().as<internal::SetTransformData>();
+  Eigen::Map<Eigen::Matrix4d> matrix(data.matrix);
+  EXPECT_TRUE(CompareMatrices(matrix, RigidTransformd{Vector3d{7, 8, 9}}
+                                          .GetAsMatrix4()));
+}
+
 GTEST_TEST(MeshcatTest, Delete) {
   Meshcat meshcat;
   // Ok to delete an empty tree.
@@ -806,16 +942,8 @@ GTEST_TEST(MeshcatTest, SetAnimation) {
               "tracks": [{
                   "name": ".visible",
                   "type": "boolean",
-                  "keys": [{
-                      "time": 0,
-                      "value": true
-                    },{
-                      "time": 20,
-                      "value": false
-                    },{
-                      "time": 40,
-                      "value": true
-                  }]
+                  "times": [0, 20, 40],
+                  "values": [true, false, true]
               }]
           }
       }, {
@@ -826,16 +954,8 @@ GTEST_TEST(MeshcatTest, SetAnimation) {
               "tracks": [{
                   "name": ".material.opacity",
                   "type": "number",
-                  "keys": [{
-                      "time": 0,
-                      "value": 0.0
-                    },{
-                      "time": 20,
-                      "value": 1.0
-                  },{
-                      "time": 40,
-                      "value": 0.0
-                  }]
+                  "times": [0, 20, 40],
+                  "values": [0.0, 1.0, 0.0]
               }]
           }
       }, {
@@ -846,29 +966,17 @@ GTEST_TEST(MeshcatTest, SetAnimation) {
               "tracks": [{
                   "name": ".position",
                   "type": "vector3",
-                  "keys": [{
-                      "time": 0,
-                      "value": [0.0, 0.0, 0.0]
-                    },{
-                      "time": 20,
-                      "value": [0.0, 0.0, 1.0]
-                    },{
-                      "time": 40,
-                      "value": [0.0, 0.0, 0.0]
-                  }]
+                  "times": [0, 20, 40],
+                  "values": [0.0, 0.0, 0.0,
+                             0.0, 0.0, 1.0,
+                             0.0, 0.0, 0.0]
               }, {
                   "name": ".quaternion",
                   "type": "quaternion",
-                  "keys": [{
-                      "time": 0,
-                      "value": [0.0, 0.0, 0.0, 1.0]
-                    },{
-                      "time": 20,
-                      "value": [0.0, 0.0, 0.0, 1.0]
-                    },{
-                      "time": 40,
-                      "value": [0.0, 0.0, 0.0, 1.0]
-                  }]
+                  "times": [0, 20, 40],
+                  "values": [0.0, 0.0, 0.0, 1.0,
+                             0.0, 0.0, 0.0, 1.0,
+                             0.0, 0.0, 0.0, 1.0]
               }]
           }
       }],
@@ -881,6 +989,67 @@ GTEST_TEST(MeshcatTest, SetAnimation) {
   })""");
 }
 
+// Checks that the keyframes are decimated when the animation is sent.
+GTEST_TEST(MeshcatTest, SetAnimationDecimated) {
+  Meshcat meshcat;
+  MeshcatAnimation animation;
+
+  // The sphere moves up at a constant speed, then back down, and does not
+  // rotate; the keyframes are set out of order.
+  const std::vector<double> heights{0, 1, 2, 3, 2};
+  for (int i : {4, 0, 2, 1, 3}) {
+    animation.SetTransform(10 * i, "sphere",
+                           RigidTransformd(Vector3d{0, 0, heights[i]}));
+    animation.SetProperty(10 * i, "cylinder", "visible", i == 2 || i == 3);
+  }
+  animation.set_decimation_tolerance(1e-12);
+  meshcat.SetAnimation(animation);
+
+  // Only the keyframes where the interpolation changes remain.
+  CheckWebsocketCommand(meshcat, {}, 1, R"""({
+      "type": "set_animation",
+      "animations": [{
+          "path": "/drake/cylinder",
+          "clip": {
+              "fps": 32.0,
+              "name": "default",
+              "tracks": [{
+                  "name": ".visible",
+                  "type": "boolean",
+                  "times": [0, 20, 40],
+                  "values": [false, true, false]
+              }]
+          }
+      }, {
+          "path": "/drake/sphere",
+          "clip": {
+              "fps": 32.0,
+              "name": "default",
+              "tracks": [{
+                  "name": ".position",
+                  "type": "vector3",
+                  "times": [0, 30, 40],
+                  "values": [0.0, 0.0, 0.0,
+                             0.0, 0.0, 3.0,
+                             0.0, 0.0, 2.0]
+              }, {
+                  "name": ".quaternion",
+                  "type": "quaternion",
+                  "times": [0, 40],
+                  "values": [0.0, 0.0, 0.0, 1.0,
+                             0.0, 0.0, 0.0, 1.0]
+              }]
+          }
+      }],
+      "options": {
+          "play": true,
+          "loopMode": 2201,
+          "repetitions": 1,
+          "clampWhenFinished": true
+      }
+  })""");
+}
+
 GTEST_TEST(MeshcatTest, Set2dRenderMode) {
   Meshcat meshcat;
   meshcat.Set2dRenderMode();
@@ -4,6 +4,7 @@ import argparse
 import asyncio
 import json
 import logging
+import struct
 import sys
 import umsgpack
 import websockets
@@ -87,6 +88,18 @@ def print_recursive_comparison(d1, d2, level='root'):
             print(f"{level:<20} {repr(d1)} != {repr(d2)}")
 
 
+def decode_message(message):
+    """Decodes the parts of a message that json cannot express. The matrices
+    of a set_transforms message are a single binary blob of 16 little-endian
+    doubles per path; they are decoded as one flat list of numbers.
+    """
+    if isinstance(message, dict) and message.get("type") == "set_transforms":
+        matrices = message["matrices"]
+        message["matrices"] = list(
+            struct.unpack(f"<{len(matrices) // 8}d", matrices))
+    return message
+
+
 async def socket_operations_async(args):
     logger.info("Connecting...")
     async with websockets.connect(args.ws_url, timeout=1) as websocket:
@@ -101,7 +114,7 @@ async def socket_operations_async(args):
             message = await asyncio.wait_for(websocket.recv(), timeout=10)
             logger.info("... received")
         if args.expect_message:
-            parsed = umsgpack.unpackb(message)
+            parsed = decode_message(umsgpack.unpackb(message))
             if parsed != args.expect_message:
                 print("FAILED")
                 print_recursive_comparison(parsed, args.expect_message)
@@ -1,9 +1,23 @@
 #include "drake/lcm/drake_lcm_log.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <limits>
 #include <map>
+#include <numeric>
 #include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -18,12 +32,440 @@ using HandlerFunction = DrakeLcmInterface::HandlerFunction;
 using MultichannelHandlerFunction =
     DrakeLcmInterface::MultichannelHandlerFunction;
 
+namespace {
+
+// In an LCM log, each message is a header of big-endian integers -- the sync
+// word (4 bytes), the event number (8), the timestamp in microseconds (8), the
+// length of the channel name (4) and the length of the data (4) -- followed by
+// the channel name and the data.
+constexpr uint32_t kSyncWord = 0xEDA1DA01;
+constexpr int64_t kTimestampOffset = 12;
+constexpr int64_t kChannelLengthOffset = 20;
+constexpr int64_t kDataLengthOffset = 24;
+constexpr int64_t kHeaderSize = 28;
+// The same limit as lcm's own log reader.
+constexpr int32_t kMaxChannelLength = 1000;
+
+// The sidecar index file starts with this magic string, followed by kSyncWord
+// in the host's byte order (the index is a cache, so it is only ever read back
+// on a host like the one that wrote it).
+constexpr std::string_view kIndexMagic{"drake_lcm_log_index_v2"};
+
+template <typename T>
+T ReadBigEndian(const uint8_t* bytes) {
+  std::make_unsigned_t<T> result = 0;
+  for (size_t i = 0; i < sizeof(T); ++i) {
+    result = (result << 8) | bytes[i];
+  }
+  return static_cast<T>(result);
+}
+
+// What identifies a version of a file, in order to detect a stale index: the
+// file's device and inode numbers (which change when the file is replaced),
+// and its size and modification time (which change when it is rewritten).
+struct FileStamp {
+  int64_t device{};
+  int64_t inode{};
+  int64_t size{};
+  int64_t mtime_sec{};
+  int64_t mtime_nsec{};
+
+  bool operator==(const FileStamp& other) const {
+    return device == other.device && inode == other.inode &&
+           size == other.size && mtime_sec == other.mtime_sec &&
+           mtime_nsec == other.mtime_nsec;
+  }
+};
+
+// A read-only memory mapping of a whole file.
+class MappedFile {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MappedFile)
+
+  // Maps the given file; good() is false if that failed.
+  explicit MappedFile(const std::string& file_name) {
+    const int fd = ::open(file_name.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return;
+    }
+    struct stat status {};
+    if (::fstat(fd, &status) == 0) {
+      size_ = status.st_size;
+#ifdef __APPLE__
+      const struct timespec& mtime = status.st_mtimespec;
+#else
+      const struct timespec& mtime = status.st_mtim;
+#endif
+      stamp_ = {static_cast<int64_t>(status.st_dev),
+                static_cast<int64_t>(status.st_ino), size_, mtime.tv_sec,
+                mtime.tv_nsec};
+      good_ = true;
+      // An empty file cannot be mapped, but is a valid (empty) log.
+      if (size_ > 0) {
+        void* const mapping =
+            ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+          good_ = false;
+        } else {
+          data_ = static_cast<const uint8_t*>(mapping);
+        }
+      }
+    }
+    ::close(fd);
+  }
+
+  ~MappedFile() {
+    if (data_ != nullptr) {
+      ::munmap(const_cast<uint8_t*>(data_), size_);
+    }
+  }
+
+  bool good() const { return good_; }
+  const uint8_t* data() const { return data_; }
+  int64_t size() const { return size_; }
+  const FileStamp& stamp() const { return stamp_; }
+
+ private:
+  bool good_{false};
+  const uint8_t* data_{nullptr};
+  int64_t size_{0};
+  FileStamp stamp_;
+};
+
+// The time, channel and file offset of every message of a log.
+struct LogIndex {
+  struct Entry {
+    // The message's timestamp, in microseconds.
+    int64_t timestamp{};
+    // The file offset of the message's header.
+    int64_t offset{};
+    // The index of the message's channel in `channels`.
+    int32_t channel{};
+  };
+
+  // The names of the channels, in the order of their first message.
+  std::vector<std::string> channels;
+  // The messages, in file order.
+  std::vector<Entry> entries;
+};
+
+// Adds to `index` the messages of the given log from `*offset` on, by reading
+// their headers, and sets `*offset` to where the next message would start. Like
+// lcm's own reader, this skips any garbage before a sync word, and stops at the
+// first message that is malformed or truncated (e.g., because the log is still
+// being written).
+void ExtendIndex(const MappedFile& file, int64_t* offset_in_out,
+                 LogIndex* index_in_out) {
+  const uint8_t* const data = file.data();
+  const int64_t size = file.size();
+  LogIndex& index = *index_in_out;
+  // The channel names are looked up by views, of the mapped file for the new
+  // channels and of a copy of the names for the known ones, since adding a
+  // channel to the index may move the names it holds.
+  const std::vector<std::string> known_channels = index.channels;
+  std::unordered_map<std::string_view, int32_t> channel_ids;
+  for (int32_t i = 0; i < static_cast<int32_t>(known_channels.size()); ++i) {
+    channel_ids.emplace(known_channels[i], i);
+  }
+  int64_t offset = *offset_in_out;
+  while (offset + kHeaderSize <= size) {
+    const uint8_t* const header = data + offset;
+    if (ReadBigEndian<uint32_t>(header) != kSyncWord) {
+      ++offset;
+      continue;
+    }
+    const int32_t channel_length =
+        ReadBigEndian<int32_t>(header + kChannelLengthOffset);
+    const int32_t data_length =
+        ReadBigEndian<int32_t>(header + kDataLengthOffset);
+    if (channel_length <= 0 || channel_length >= kMaxChannelLength ||
+        data_length < 0) {
+      break;
+    }
+    const int64_t end = offset + kHeaderSize + channel_length + data_length;
+    if (end > size) {
+      break;
+    }
+    const std::string_view channel(
+        reinterpret_cast<const char*>(header + kHeaderSize), channel_length);
+    const auto [iter, inserted] = channel_ids.emplace(
+        channel, static_cast<int32_t>(index.channels.size()));
+    if (inserted) {
+      index.channels.emplace_back(channel);
+    }
+    index.entries.push_back(
+        {ReadBigEndian<int64_t>(header + kTimestampOffset), offset,
+         iter->second});
+    offset = end;
+  }
+  *offset_in_out = offset;
+}
+
+// Returns the offset at which the message that follows the last message of
+// `index` would start, or zero if `index` is empty.
+int64_t GetIndexEnd(const MappedFile& file, const LogIndex& index) {
+  if (index.entries.empty()) {
+    return 0;
+  }
+  const LogIndex::Entry& last = index.entries.back();
+  const int64_t data_length =
+      ReadBigEndian<int32_t>(file.data() + last.offset + kDataLengthOffset);
+  return std::min(file.size(), last.offset + kHeaderSize +
+                                   static_cast<int64_t>(
+                                       index.channels[last.channel].size()) +
+                                   std::max<int64_t>(data_length, 0));
+}
+
+template <typename T>
+void Append(const T& value, std::string* buffer) {
+  buffer->append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+// Reads values in sequence from a buffer, failing (instead of reading past
+// its end) when the buffer is too short.
+class BufferReader {
+ public:
+  explicit BufferReader(std::string_view buffer) : buffer_(buffer) {}
+
+  template <typename T>
+  bool Read(T* value) {
+    if (buffer_.size() < sizeof(T)) {
+      return false;
+    }
+    std::memcpy(value, buffer_.data(), sizeof(T));
+    buffer_.remove_prefix(sizeof(T));
+    return true;
+  }
+
+  bool Read(size_t size, std::string_view* bytes) {
+    if (buffer_.size() < size) {
+      return false;
+    }
+    *bytes = buffer_.substr(0, size);
+    buffer_.remove_prefix(size);
+    return true;
+  }
+
+  bool empty() const { return buffer_.empty(); }
+
+ private:
+  std::string_view buffer_;
+};
+
+// Writes the index of the given log to a sidecar file, which records the
+// FileStamp of the log in order to detect a stale index. The file is written
+// under a unique temporary name and then renamed, so that the readers never
+// see a partial index. Errors are ignored, since the index can always be
+// rebuilt.
+void WriteIndexFile(const std::string& index_file_name, const MappedFile& file,
+                    const LogIndex& index) {
+  std::string buffer(kIndexMagic);
+  Append(kSyncWord, &buffer);
+  Append(file.stamp(), &buffer);
+  Append(static_cast<int64_t>(index.channels.size()), &buffer);
+  for (const std::string& channel : index.channels) {
+    Append(static_cast<int64_t>(channel.size()), &buffer);
+    buffer.append(channel);
+  }
+  Append(static_cast<int64_t>(index.entries.size()), &buffer);
+  for (const LogIndex::Entry& entry : index.entries) {
+    Append(entry.timestamp, &buffer);
+    Append(entry.offset, &buffer);
+    Append(entry.channel, &buffer);
+  }
+
+  std::string temp_file_name = index_file_name + ".XXXXXX";
+  const int fd = ::mkstemp(temp_file_name.data());
+  if (fd < 0) {
+    return;
+  }
+  // Like any other file, rather than mkstemp's owner-only permissions.
+  ::fchmod(fd, 0644);
+  bool good = true;
+  for (size_t written = 0; good && written < buffer.size();) {
+    const ssize_t result =
+        ::write(fd, buffer.data() + written, buffer.size() - written);
+    good = (result > 0);
+    written += good ? result : 0;
+  }
+  good = (::close(fd) == 0) && good;
+  if (!good || std::rename(temp_file_name.c_str(), index_file_name.c_str())) {
+    std::remove(temp_file_name.c_str());
+  }
+}
+
+// Reads the index of the given log from its sidecar file. Returns nullopt if
+// the sidecar file does not exist, is malformed, or is stale.
+std::optional<LogIndex> ReadIndexFile(const std::string& index_file_name,
+                                      const MappedFile& file) {
+  std::ifstream in(index_file_name, std::ios::binary | std::ios::ate);
+  if (!in) {
+    return std::nullopt;
+  }
+  std::string buffer(in.tellg(), '\0');
+  in.seekg(0);
+  if (!in.read(buffer.data(), buffer.size())) {
+    return std::nullopt;
+  }
+  BufferReader reader(buffer);
+  std::string_view magic;
+  uint32_t sync_word{};
+  FileStamp stamp;
+  int64_t num_channels{};
+  if (!reader.Read(kIndexMagic.size(), &magic) || magic != kIndexMagic ||
+      !reader.Read(&sync_word) || sync_word != kSyncWord ||
+      !reader.Read(&stamp) || !(stamp == file.stamp()) ||
+      !reader.Read(&num_channels) || num_channels < 0) {
+    return std::nullopt;
+  }
+  LogIndex index;
+  for (int64_t i = 0; i < num_channels; ++i) {
+    int64_t length{};
+    std::string_view channel;
+    if (!reader.Read(&length) || length < 0 ||
+        !reader.Read(static_cast<size_t>(length), &channel)) {
+      return std::nullopt;
+    }
+    index.channels.emplace_back(channel);
+  }
+  int64_t num_entries{};
+  if (!reader.Read(&num_entries) || num_entries < 0 ||
+      num_entries > file.size() / kHeaderSize) {
+    return std::nullopt;
+  }
+  index.entries.resize(num_entries);
+  for (LogIndex::Entry& entry : index.entries) {
+    if (!reader.Read(&entry.timestamp) || !reader.Read(&entry.offset) ||
+        !reader.Read(&entry.channel) || entry.offset < 0 ||
+        entry.offset > file.size() - kHeaderSize || entry.channel < 0 ||
+        entry.channel >= num_channels) {
+      return std::nullopt;
+    }
+  }
+  if (!reader.empty()) {
+    return std::nullopt;
+  }
+  return index;
+}
+
+}  // namespace
+
 class DrakeLcmLog::Impl {
  public:
   std::multimap<std::string, HandlerFunction> subscriptions_;
   std::vector<MultichannelHandlerFunction> multichannel_subscriptions_;
+
+  // Write mode only.
   std::unique_ptr<::lcm::LogFile> log_;
-  const ::lcm::LogEvent* next_event_{nullptr};
+
+  // Read mode only.
+  std::string file_name_;
+  std::unique_ptr<MappedFile> file_;
+  LogIndex index_;
+  // The file offset at which to look for the messages that follow index_.
+  int64_t index_end_{0};
+  // Whether the timestamps of index_ are non-decreasing.
+  bool is_sorted_{false};
+  // The channels to play back, or nullopt for all of them.
+  std::optional<std::vector<std::string>> selected_channels_;
+  // The indices into index_.entries of the messages on the selected channels.
+  std::vector<int> playlist_;
+  // The position in playlist_ of the next message.
+  int next_{0};
+
+  // Returns the next message, or nullptr at the end of the log.
+  const LogIndex::Entry* next_entry() const {
+    if (next_ >= static_cast<int>(playlist_.size())) {
+      return nullptr;
+    }
+    return &index_.entries[playlist_[next_]];
+  }
+
+  // Returns whether each channel of index_ is in selected_channels_.
+  std::vector<bool> GetSelectedChannels() const {
+    std::vector<bool> is_selected(index_.channels.size(), !selected_channels_);
+    if (selected_channels_) {
+      for (const std::string& channel : *selected_channels_) {
+        const auto iter = std::find(index_.channels.begin(),
+                                    index_.channels.end(), channel);
+        if (iter != index_.channels.end()) {
+          is_selected[iter - index_.channels.begin()] = true;
+        }
+      }
+    }
+    return is_selected;
+  }
+
+  // Plays back the given channels (or all channels, for nullopt), starting
+  // from the first of their messages that is not before the current one.
+  void SelectChannels(std::optional<std::vector<std::string>> channels) {
+    const int current = (next_entry() != nullptr)
+                            ? playlist_[next_]
+                            : static_cast<int>(index_.entries.size());
+    selected_channels_ = std::move(channels);
+    const std::vector<bool> is_selected = GetSelectedChannels();
+    playlist_.clear();
+    for (int i = 0; i < static_cast<int>(index_.entries.size()); ++i) {
+      if (is_selected[index_.entries[i].channel]) {
+        playlist_.push_back(i);
+      }
+    }
+    next_ = std::lower_bound(playlist_.begin(), playlist_.end(), current) -
+            playlist_.begin();
+  }
+
+  // Adds the messages that were appended to the log since it was mapped (e.g.,
+  // by a logger that is still writing it) to the index and the playlist, by
+  // mapping the log again. Nothing changes unless the same file grew.
+  void ReadAppendedMessages() {
+    struct stat status {};
+    if (::stat(file_name_.c_str(), &status) != 0 ||
+        status.st_size <= file_->size() ||
+        static_cast<int64_t>(status.st_dev) != file_->stamp().device ||
+        static_cast<int64_t>(status.st_ino) != file_->stamp().inode) {
+      return;
+    }
+    auto file = std::make_unique<MappedFile>(file_name_);
+    if (!file->good() || file->size() <= file_->size() ||
+        file->stamp().device != file_->stamp().device ||
+        file->stamp().inode != file_->stamp().inode) {
+      return;
+    }
+    file_ = std::move(file);
+    const int num_old_entries = index_.entries.size();
+    ExtendIndex(*file_, &index_end_, &index_);
+    const int num_entries = index_.entries.size();
+    for (int i = std::max(num_old_entries, 1); is_sorted_ && i < num_entries;
+         ++i) {
+      is_sorted_ =
+          index_.entries[i - 1].timestamp <= index_.entries[i].timestamp;
+    }
+    const std::vector<bool> is_selected = GetSelectedChannels();
+    for (int i = num_old_entries; i < num_entries; ++i) {
+      if (is_selected[index_.entries[i].channel]) {
+        playlist_.push_back(i);
+      }
+    }
+  }
+
+  // Returns the data of the given message. The sidecar index is only checked
+  // when it is loaded for what can be checked without reading the log, so the
+  // message is checked again here.
+  std::pair<const void*, int> GetData(const LogIndex::Entry& entry) const {
+    const uint8_t* const header = file_->data() + entry.offset;
+    const int64_t channel_length = index_.channels[entry.channel].size();
+    const int32_t data_length =
+        ReadBigEndian<int32_t>(header + kDataLengthOffset);
+    if (ReadBigEndian<uint32_t>(header) != kSyncWord ||
+        ReadBigEndian<int32_t>(header + kChannelLengthOffset) !=
+            channel_length ||
+        data_length < 0 ||
+        entry.offset + kHeaderSize + channel_length + data_length >
+            file_->size()) {
+      throw std::runtime_error("The LCM log or its index file is corrupt.");
+    }
+    return {header + kHeaderSize + channel_length, data_length};
+  }
 };
 
 DrakeLcmLog::DrakeLcmLog(const std::string& file_name, bool is_write,
@@ -35,13 +477,36 @@ DrakeLcmLog::DrakeLcmLog(const std::string& file_name, bool is_write,
       impl_(new Impl) {
   if (is_write_) {
     impl_->log_ = std::make_unique<::lcm::LogFile>(file_name, "w");
-  } else {
-    impl_->log_ = std::make_unique<::lcm::LogFile>(file_name, "r");
-    impl_->next_event_ = impl_->log_->readNextEvent();
+    if (!impl_->log_->good()) {
+      throw std::runtime_error("Failed to open log file: " + file_name);
+    }
+    return;
   }
-  if (!impl_->log_->good()) {
+
+  impl_->file_name_ = file_name;
+  impl_->file_ = std::make_unique<MappedFile>(file_name);
+  if (!impl_->file_->good()) {
     throw std::runtime_error("Failed to open log file: " + file_name);
   }
+  const std::string index_file_name = file_name + ".index";
+  std::optional<LogIndex> index =
+      ReadIndexFile(index_file_name, *impl_->file_);
+  if (index) {
+    impl_->index_end_ = GetIndexEnd(*impl_->file_, *index);
+  } else {
+    index.emplace();
+    ExtendIndex(*impl_->file_, &impl_->index_end_, &*index);
+    WriteIndexFile(index_file_name, *impl_->file_, *index);
+  }
+  impl_->index_ = std::move(*index);
+  impl_->is_sorted_ = std::is_sorted(
+      impl_->index_.entries.begin(), impl_->index_.entries.end(),
+      [](const LogIndex::Entry& a, const LogIndex::Entry& b) {
+        return a.timestamp < b.timestamp;
+      });
+  // All of the channels are played back, from the start.
+  impl_->playlist_.resize(impl_->index_.entries.size());
+  std::iota(impl_->playlist_.begin(), impl_->playlist_.end(), 0);
 }
 
 DrakeLcmLog::~DrakeLcmLog() = default;
@@ -109,10 +574,14 @@ double DrakeLcmLog::GetNextMessageTime() const {
   }
 
   std::lock_guard<std::mutex> lock(mutex_);
-  if (impl_->next_event_ == nullptr) {
+  if (impl_->next_entry() == nullptr) {
+    impl_->ReadAppendedMessages();
+  }
+  const LogIndex::Entry* const next_entry = impl_->next_entry();
+  if (next_entry == nullptr) {
     return std::numeric_limits<double>::infinity();
   }
-  return timestamp_to_second(impl_->next_event_->timestamp);
+  return timestamp_to_second(next_entry->timestamp);
 }
 
 void DrakeLcmLog::DispatchMessageAndAdvanceLog(double current_time) {
@@ -122,30 +591,74 @@ void DrakeLcmLog::DispatchMessageAndAdvanceLog(double current_time) {
   }
 
   std::lock_guard<std::mutex> lock(mutex_);
+  if (impl_->next_entry() == nullptr) {
+    impl_->ReadAppendedMessages();
+  }
   // End of log, do nothing.
-  if (impl_->next_event_ == nullptr) {
+  const LogIndex::Entry* const next_entry = impl_->next_entry();
+  if (next_entry == nullptr) {
     return;
   }
-  const ::lcm::LogEvent& next_event = *impl_->next_event_;
 
   // Do nothing if the call time does not match the event's time.
-  if (current_time != timestamp_to_second(next_event.timestamp)) {
+  if (current_time != timestamp_to_second(next_entry->timestamp)) {
     return;
   }
 
-  // Dispatch message if necessary.
-  const auto& range = impl_->subscriptions_.equal_range(next_event.channel);
+  // Dispatch message if necessary. The handlers are given the message's data
+  // straight from the mapped file.
+  const std::string& channel = impl_->index_.channels[next_entry->channel];
+  const auto [data, data_size] = impl_->GetData(*next_entry);
+  const auto& range = impl_->subscriptions_.equal_range(channel);
   for (auto iter = range.first; iter != range.second; ++iter) {
     const HandlerFunction& handler = iter->second;
-    handler(next_event.data, next_event.datalen);
+    handler(data, data_size);
   }
   for (const MultichannelHandlerFunction& handler :
            impl_->multichannel_subscriptions_) {
-    handler(next_event.channel, next_event.data, next_event.datalen);
+    handler(channel, data, data_size);
   }
 
   // Advance log.
-  impl_->next_event_ = impl_->log_->readNextEvent();
+  ++impl_->next_;
+}
+
+void DrakeLcmLog::SeekToTime(double time_sec) {
+  if (is_write_) {
+    throw std::logic_error("SeekToTime is only available for log playback.");
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  const std::vector<int>& playlist = impl_->playlist_;
+  const auto is_before = [this, time_sec](int i) {
+    return timestamp_to_second(impl_->index_.entries[i].timestamp) < time_sec;
+  };
+  const auto iter =
+      impl_->is_sorted_
+          ? std::partition_point(playlist.begin(), playlist.end(), is_before)
+          : std::find_if_not(playlist.begin(), playlist.end(), is_before);
+  impl_->next_ = iter - playlist.begin();
+}
+
+void DrakeLcmLog::SelectChannels(
+    std::optional<std::vector<std::string>> channels) {
+  if (is_write_) {
+    throw std::logic_error(
+        "SelectChannels is only available for log playback.");
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  impl_->SelectChannels(std::move(channels));
+}
+
+std::vector<std::string> DrakeLcmLog::GetChannelNames() const {
+  if (is_write_) {
+    throw std::logic_error(
+        "GetChannelNames is only available for log playback.");
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  return impl_->index_.channels;
 }
 
 void DrakeLcmLog::OnHandleSubscriptionsError(const std::string& error_message) {
@@ -4,6 +4,7 @@
 #include <mutex>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/lcm/drake_lcm_interface.h"
@@ -18,6 +19,26 @@ namespace lcm {
  * is generated by some external logger (the lcm-logger binary), which uses the
  * unix epoch time clock to record message arrival time, the user needs to
  * offset those timestamps properly to match and the clock used for playback.
+ *
+ * In read-only mode, the log file is memory-mapped rather than read through a
+ * buffered stream, and an index of the time, channel and file offset of every
+ * message is built when the log is opened. The index makes it possible to seek
+ * to an arbitrary time (SeekToTime()) and to play back only some of the
+ * channels (SelectChannels()) without reading the rest of the log. Since
+ * building the index reads the header of every message, it is cached in a
+ * sidecar file named `file_name + ".index"` next to the log, and reused by the
+ * next instances that open the same (unchanged) log. The sidecar file records
+ * the log's device and inode numbers, size, and nanosecond modification time,
+ * so that it is rebuilt when the log is rewritten or replaced. Failing to write
+ * the sidecar file, e.g., because the log's directory is read-only, is not an
+ * error; the index is then rebuilt each time the log is opened.
+ *
+ * The messages that are appended to the log after it is opened, e.g., by a
+ * logger that is still writing it, are played back too: once the playback
+ * reaches the end of the messages indexed so far, the log is mapped again if
+ * it grew, and the new messages are added to the index (but not to the
+ * sidecar file). A log that is rewritten or replaced while it is being played
+ * back is not reread.
  */
 class DrakeLcmLog : public DrakeLcmInterface {
  public:
@@ -112,6 +133,46 @@ class DrakeLcmLog : public DrakeLcmInterface {
    */
   void DispatchMessageAndAdvanceLog(double current_time);
 
+  /**
+   * Moves the log so that the next message is the first one (among the
+   * selected channels, see SelectChannels()) whose time is at or after
+   * @p time_sec. Unlike DispatchMessageAndAdvanceLog(), this can move the log
+   * backwards as well as forwards, and does not dispatch the messages that are
+   * skipped over. When the log's timestamps are non-decreasing, as they are
+   * when written by lcm-logger or by Publish(), this is a binary search of the
+   * index.
+   *
+   * Note that a LcmLogPlaybackSystem only schedules the messages after the
+   * time of its Context, so the Context's time should be set to match.
+   *
+   * @throws std::exception if this instance is not constructed in read-only
+   * mode.
+   */
+  void SeekToTime(double time_sec);
+
+  /**
+   * Restricts the playback to the messages on the given @p channels:
+   * GetNextMessageTime(), DispatchMessageAndAdvanceLog() and SeekToTime()
+   * skip the messages on every other channel as if they were not in the log.
+   * Passing std::nullopt (the default when constructed) plays back all of the
+   * channels. The position in the log is kept, i.e., the next message is the
+   * first selected one that is not before the current next message. Channels
+   * that are not in the log are allowed, and never match.
+   *
+   * @throws std::exception if this instance is not constructed in read-only
+   * mode.
+   */
+  void SelectChannels(std::optional<std::vector<std::string>> channels);
+
+  /**
+   * Returns the names of all the channels in the log, in the order of their
+   * first message.
+   *
+   * @throws std::exception if this instance is not constructed in read-only
+   * mode.
+   */
+  std::vector<std::string> GetChannelNames() const;
+
   /**
    * Returns true if this instance is constructed in write-only mode.
    */
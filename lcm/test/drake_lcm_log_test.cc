@@ -1,10 +1,18 @@
 #include "drake/lcm/drake_lcm_log.h"
 
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+#include "drake/common/temp_directory.h"
 #include "drake/lcmt_drake_signal.hpp"
 
 namespace drake {
@@ -66,6 +74,190 @@ GTEST_TEST(LcmLogTest, LcmLogTestSaveAndRead) {
   EXPECT_TRUE(multichannel_received);
 }
 
+// Writes a log with one byte long messages on three channels, where message
+// i has the data i and the time i + 1, for i in [0, num_messages).
+void WriteLog(const std::string& file_name, int num_messages) {
+  DrakeLcmLog log(file_name, true);
+  const std::vector<std::string> channels{"a", "b", "c"};
+  for (int i = 0; i < num_messages; ++i) {
+    const uint8_t data = i;
+    log.Publish(channels[i % 3], &data, 1, i + 1);
+  }
+}
+
+// Plays back the rest of the log, returning the data of the messages.
+std::vector<int> PlayBack(DrakeLcmLog* log) {
+  std::vector<int> result;
+  log->SubscribeAllChannels(
+      [&result](std::string_view, const void* data, int size) {
+        ASSERT_EQ(size, 1);
+        result.push_back(*static_cast<const uint8_t*>(data));
+      });
+  for (double time = log->GetNextMessageTime(); !std::isinf(time);
+       time = log->GetNextMessageTime()) {
+    log->DispatchMessageAndAdvanceLog(time);
+  }
+  return result;
+}
+
+GTEST_TEST(LcmLogTest, SeekAndSelectChannels) {
+  const std::string file_name = temp_directory() + "/seek.log";
+  WriteLog(file_name, 9);
+
+  // Each PlayBack() uses a new instance, since handlers cannot be removed.
+  auto make_log = [&file_name]() {
+    return std::make_unique<DrakeLcmLog>(file_name, false);
+  };
+  EXPECT_EQ(make_log()->GetChannelNames(),
+            std::vector<std::string>({"a", "b", "c"}));
+  EXPECT_EQ(PlayBack(make_log().get()),
+            std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8}));
+
+  // Seeking forwards skips the earlier messages, and an exact match is kept.
+  auto log = make_log();
+  log->SeekToTime(3.5);
+  EXPECT_EQ(log->GetNextMessageTime(), 4.0);
+  log->SeekToTime(6.0);
+  EXPECT_EQ(log->GetNextMessageTime(), 6.0);
+  // Seeking backwards rewinds the log.
+  log->SeekToTime(-1.0);
+  EXPECT_EQ(log->GetNextMessageTime(), 1.0);
+  log->SeekToTime(7.5);
+  EXPECT_EQ(PlayBack(log.get()), std::vector<int>({7, 8}));
+  log->SeekToTime(100.0);
+  EXPECT_TRUE(std::isinf(log->GetNextMessageTime()));
+
+  // Only the selected channels are played back; unknown channels are ignored.
+  log = make_log();
+  log->SelectChannels(std::vector<std::string>{"b", "not_in_log"});
+  EXPECT_EQ(log->GetNextMessageTime(), 2.0);
+  log->SeekToTime(2.5);
+  EXPECT_EQ(log->GetNextMessageTime(), 5.0);
+  // Changing the selection keeps the position in the log.
+  log->SelectChannels(std::vector<std::string>{"a", "c"});
+  EXPECT_EQ(log->GetNextMessageTime(), 6.0);
+  log->SelectChannels(std::nullopt);
+  EXPECT_EQ(PlayBack(log.get()), std::vector<int>({5, 6, 7, 8}));
+
+  // Write mode does not support any of the above.
+  DrakeLcmLog w_log(temp_directory() + "/write.log", true);
+  EXPECT_THROW(w_log.SeekToTime(0.0), std::exception);
+  EXPECT_THROW(w_log.SelectChannels(std::nullopt), std::exception);
+  EXPECT_THROW(w_log.GetChannelNames(), std::exception);
+}
+
+GTEST_TEST(LcmLogTest, IndexFile) {
+  const std::string file_name = temp_directory() + "/index.log";
+  const std::string index_file_name = file_name + ".index";
+  WriteLog(file_name, 4);
+  auto play_back = [&file_name]() {
+    DrakeLcmLog log(file_name, false);
+    return PlayBack(&log);
+  };
+
+  // The index is written when the log is first opened, and then reused.
+  EXPECT_FALSE(std::filesystem::exists(index_file_name));
+  EXPECT_EQ(play_back(),
+            std::vector<int>({0, 1, 2, 3}));
+  ASSERT_TRUE(std::filesystem::exists(index_file_name));
+  EXPECT_EQ(play_back(),
+            std::vector<int>({0, 1, 2, 3}));
+
+  // An index that is stale, because the log changed, is rebuilt. That is so
+  // even when the log is rewritten to the same size within the same second.
+  {
+    DrakeLcmLog log(file_name, true);
+    for (int i = 0; i < 4; ++i) {
+      const uint8_t data = 10 + i;
+      log.Publish("d", &data, 1, i + 1);
+    }
+  }
+  EXPECT_EQ(DrakeLcmLog(file_name, false).GetChannelNames(),
+            std::vector<std::string>({"d"}));
+  EXPECT_EQ(play_back(),
+            std::vector<int>({10, 11, 12, 13}));
+  WriteLog(file_name, 5);
+  EXPECT_EQ(play_back(),
+            std::vector<int>({0, 1, 2, 3, 4}));
+
+  // So is an index that is malformed.
+  std::ofstream(index_file_name, std::ios::trunc) << "garbage";
+  EXPECT_EQ(play_back(),
+            std::vector<int>({0, 1, 2, 3, 4}));
+
+  // A truncated last message, e.g., in a log that is still being written, is
+  // left out of the index.
+  std::filesystem::resize_file(file_name,
+                               std::filesystem::file_size(file_name) - 1);
+  EXPECT_EQ(play_back(),
+            std::vector<int>({0, 1, 2, 3}));
+
+  // The index files are written under unique temporary names, none of which
+  // are left behind.
+  for (const auto& entry :
+       std::filesystem::directory_iterator(temp_directory())) {
+    const std::string name = entry.path().filename().string();
+    EXPECT_TRUE(name.find(".index.") == std::string::npos) << name;
+  }
+
+  EXPECT_THROW(DrakeLcmLog(temp_directory() + "/no_such.log", false),
+               std::exception);
+}
+
+GTEST_TEST(LcmLogTest, AppendedMessages) {
+  const std::string file_name = temp_directory() + "/appended.log";
+  const std::string more_file_name = temp_directory() + "/more.log";
+  WriteLog(file_name, 3);
+  {
+    DrakeLcmLog log(more_file_name, true);
+    for (int i = 0; i < 2; ++i) {
+      const uint8_t data = 20 + i;
+      log.Publish("d", &data, 1, 10 + i);
+    }
+  }
+  // Appends the messages of more.log to the log, as a logger would.
+  auto append = [&]() {
+    std::ifstream in(more_file_name, std::ios::binary);
+    std::ofstream out(file_name, std::ios::binary | std::ios::app);
+    out << in.rdbuf();
+  };
+
+  // Plays back the rest of the log, returning the times of the messages.
+  // Unlike PlayBack(), this does not add a handler, so it can be called more
+  // than once on the same instance.
+  auto play_times = [](DrakeLcmLog* log) {
+    std::vector<double> times;
+    for (double time = log->GetNextMessageTime(); !std::isinf(time);
+         time = log->GetNextMessageTime()) {
+      log->DispatchMessageAndAdvanceLog(time);
+      times.push_back(time);
+    }
+    return times;
+  };
+
+  // The messages appended after the end of the log was reached are played
+  // back, including those on a selected channel that was not in the log yet.
+  // The second instance reads the index from the sidecar file.
+  DrakeLcmLog log(file_name, false);
+  DrakeLcmLog selected_log(file_name, false);
+  selected_log.SelectChannels(std::vector<std::string>{"b", "d"});
+  std::vector<int> received;
+  log.SubscribeAllChannels(
+      [&received](std::string_view, const void* data, int) {
+        received.push_back(*static_cast<const uint8_t*>(data));
+      });
+  EXPECT_EQ(play_times(&log), std::vector<double>({1, 2, 3}));
+  EXPECT_EQ(play_times(&selected_log), std::vector<double>({2}));
+  append();
+  EXPECT_EQ(play_times(&log), std::vector<double>({10, 11}));
+  EXPECT_EQ(received, std::vector<int>({0, 1, 2, 20, 21}));
+  EXPECT_EQ(log.GetChannelNames(),
+            std::vector<std::string>({"a", "b", "c", "d"}));
+  EXPECT_EQ(play_times(&selected_log), std::vector<double>({10, 11}));
+  log.SeekToTime(2.5);
+  EXPECT_EQ(play_times(&log), std::vector<double>({3, 10, 11}));
+}
+
 }  // namespace
 }  // namespace lcm
 }  // namespace drake
@@ -134,6 +134,23 @@ double* GetMutableRawMatrixStart(RigidTransform<double>* X) {
   return reinterpret_cast<double*>(X);
 }
 
+/* @pre X_BA is disjoint in memory from X_AB. */
+void InvertXNoAlias(const double* X_AB, double* X_BA) {
+  const double* p_AB = X_AB + 9;  // Make some nice aliases.
+  double* p_BA = X_BA + 9;
+
+  // X_AB⁻¹ = [ R_AB; p_AB ]⁻¹ = [ R_ABᵀ; (R_ABᵀ * -p_AB) ]
+
+  for (int r = 0; r < 3; ++r) {
+    for (int c = 0; c < 3; ++c) {
+      X_BA[3 * c + r] = X_AB[3 * r + c];  // Transpose.
+    }
+  }
+  p_BA[0] = -col_x_col(&X_AB[0], p_AB);  // The rows of R_ABᵀ are the columns
+  p_BA[1] = -col_x_col(&X_AB[3], p_AB);  // of R_AB.
+  p_BA[2] = -col_x_col(&X_AB[6], p_AB);
+}
+
 /* Wrapper class to select the appropriate implementation of the composition
 functions given: (1) the options enabled at build time, and (2) which features
 are supported by the hardware the process is currently running on. Note that
@@ -150,12 +167,18 @@ class PoseCompositionFunctionsHelper {
       compose_rinvr_ = internal::ComposeRinvRAvx;
       compose_xx_ = internal::ComposeXXAvx;
       compose_xinvx_ = internal::ComposeXinvXAvx;
+      compose_xx_batch_ = internal::ComposeXXBatchAvx;
+      invert_x_batch_ = internal::InvertXBatchAvx;
+      transform_points_batch_ = internal::TransformPointsBatchAvx;
       is_using_portable_functions_ = false;
     } else {
       compose_rr_ = internal::ComposeRRPortable;
       compose_rinvr_ = internal::ComposeRinvRPortable;
       compose_xx_ = internal::ComposeXXPortable;
       compose_xinvx_ = internal::ComposeXinvXPortable;
+      compose_xx_batch_ = internal::ComposeXXBatchPortable;
+      invert_x_batch_ = internal::InvertXBatchPortable;
+      transform_points_batch_ = internal::TransformPointsBatchPortable;
       is_using_portable_functions_ = true;
     }
   }
@@ -184,6 +207,23 @@ class PoseCompositionFunctionsHelper {
     (*compose_xinvx_)(X_BA, X_BC, X_AC);
   }
 
+  void ComposeXXBatch(const RigidTransform<double>* const* X_AB,
+                      const RigidTransform<double>* const* X_BC, int count,
+                      RigidTransform<double>* const* X_AC) const {
+    (*compose_xx_batch_)(X_AB, X_BC, count, X_AC);
+  }
+
+  void InvertXBatch(const RigidTransform<double>* const* X_AB, int count,
+                    RigidTransform<double>* const* X_BA) const {
+    (*invert_x_batch_)(X_AB, count, X_BA);
+  }
+
+  void TransformPointsBatch(const RigidTransform<double>& X_AB,
+                            const double* p_BoQ_B, int count,
+                            double* p_AoQ_A) const {
+    (*transform_points_batch_)(X_AB, p_BoQ_B, count, p_AoQ_A);
+  }
+
   bool is_using_portable_functions() const {
     return is_using_portable_functions_;
   }
@@ -209,6 +249,19 @@ class PoseCompositionFunctionsHelper {
       const RigidTransform<double>&,
       RigidTransform<double>*) = nullptr;
 
+  void (*compose_xx_batch_)(
+      const RigidTransform<double>* const*,
+      const RigidTransform<double>* const*, int,
+      RigidTransform<double>* const*) = nullptr;
+
+  void (*invert_x_batch_)(
+      const RigidTransform<double>* const*, int,
+      RigidTransform<double>* const*) = nullptr;
+
+  void (*transform_points_batch_)(
+      const RigidTransform<double>&,
+      const double*, int, double*) = nullptr;
+
   bool is_using_portable_functions_ = false;
 };
 
@@ -263,6 +316,48 @@ void ComposeXinvXPortable(const RigidTransform<double>& X_BA,
   std::copy(X_AC_temp, X_AC_temp + 12, GetMutableRawMatrixStart(X_AC));
 }
 
+/* Batched composition of transforms X_AC[i] = X_AB[i] * X_BC[i]. */
+void ComposeXXBatchPortable(const RigidTransform<double>* const* X_AB,
+                            const RigidTransform<double>* const* X_BC,
+                            int count, RigidTransform<double>* const* X_AC) {
+  assert(count == 0 || (X_AB != nullptr && X_BC != nullptr && X_AC != nullptr));
+  for (int i = 0; i < count; ++i) {
+    double X_AC_temp[12];  // Protect from overlap with inputs.
+    ComposeXXNoAlias(GetRawMatrixStart(*X_AB[i]), GetRawMatrixStart(*X_BC[i]),
+                     X_AC_temp);
+    std::copy(X_AC_temp, X_AC_temp + 12, GetMutableRawMatrixStart(X_AC[i]));
+  }
+}
+
+/* Batched inversion of transforms X_BA[i] = X_AB[i]⁻¹. */
+void InvertXBatchPortable(const RigidTransform<double>* const* X_AB, int count,
+                          RigidTransform<double>* const* X_BA) {
+  assert(count == 0 || (X_AB != nullptr && X_BA != nullptr));
+  for (int i = 0; i < count; ++i) {
+    double X_BA_temp[12];  // Protect from overlap with inputs.
+    InvertXNoAlias(GetRawMatrixStart(*X_AB[i]), X_BA_temp);
+    std::copy(X_BA_temp, X_BA_temp + 12, GetMutableRawMatrixStart(X_BA[i]));
+  }
+}
+
+/* Transforms the points p_AoQi_A = X_AB * p_BoQi_B. The points are 3 * count
+consecutive doubles, three per point. */
+void TransformPointsBatchPortable(const RigidTransform<double>& X_AB,
+                                  const double* p_BoQ_B, int count,
+                                  double* p_AoQ_A) {
+  assert(count == 0 || (p_BoQ_B != nullptr && p_AoQ_A != nullptr));
+  const double* X = GetRawMatrixStart(X_AB);
+  const double* p_AB = X + 9;
+  for (int i = 0; i < count; ++i) {
+    const double* p_BQ = p_BoQ_B + 3 * i;
+    const double p_AQ_temp[3] = {  // Protect from overlap with inputs.
+        p_AB[0] + row_x_col(&X[0], p_BQ),
+        p_AB[1] + row_x_col(&X[1], p_BQ),
+        p_AB[2] + row_x_col(&X[2], p_BQ)};
+    std::copy(p_AQ_temp, p_AQ_temp + 3, p_AoQ_A + 3 * i);
+  }
+}
+
 bool IsUsingPortableCompositionFunctions() {
   return g_pose_composition_functions_helper.is_using_portable_functions();
 }
@@ -291,6 +386,23 @@ void ComposeXinvX(const RigidTransform<double>& X_BA,
   g_pose_composition_functions_helper.ComposeXinvX(X_BA, X_BC, X_AC);
 }
 
+void ComposeXXBatch(const RigidTransform<double>* const* X_AB,
+                    const RigidTransform<double>* const* X_BC, int count,
+                    RigidTransform<double>* const* X_AC) {
+  g_pose_composition_functions_helper.ComposeXXBatch(X_AB, X_BC, count, X_AC);
+}
+
+void InvertXBatch(const RigidTransform<double>* const* X_AB, int count,
+                  RigidTransform<double>* const* X_BA) {
+  g_pose_composition_functions_helper.InvertXBatch(X_AB, count, X_BA);
+}
+
+void TransformPointsBatch(const RigidTransform<double>& X_AB,
+                          const double* p_BoQ_B, int count, double* p_AoQ_A) {
+  g_pose_composition_functions_helper.TransformPointsBatch(X_AB, p_BoQ_B, count,
+                                                           p_AoQ_A);
+}
+
 }  // namespace internal
 }  // namespace math
 }  // namespace drake
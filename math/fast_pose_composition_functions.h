@@ -78,6 +78,38 @@ void ComposeXinvX(const RigidTransform<double>& X_BA,
                   const RigidTransform<double>& X_BC,
                   RigidTransform<double>* X_AC);
 
+/* Composes `count` pairs of drake::math::RigidTransform<double> objects as
+quickly as possible, i.e., `*X_AC[i] = *X_AB[i] * *X_BC[i]` for each i in
+[0, count). The transforms are passed by pointer so that they can live anywhere
+(e.g., in the nodes of a tree or the values of a map), and the same transform
+may appear several times among the inputs. Composing a whole batch at once
+amortizes the function dispatch, which is a substantial fraction of the cost of
+a single composition.
+
+It is OK for X_AC[i] to be the same object as X_AB[i] and/or X_BC[i], but it
+must not be an input of any other pair. */
+void ComposeXXBatch(const RigidTransform<double>* const* X_AB,
+                    const RigidTransform<double>* const* X_BC, int count,
+                    RigidTransform<double>* const* X_AC);
+
+/* Inverts `count` drake::math::RigidTransform<double> objects as quickly as
+possible, i.e., `*X_BA[i] = X_AB[i]⁻¹` for each i in [0, count). Like
+ComposeXinvX(), this assumes that the rotation matrices are orthonormal. The
+transforms are passed by pointer as for ComposeXXBatch(), with the same overlap
+rules. */
+void InvertXBatch(const RigidTransform<double>* const* X_AB, int count,
+                  RigidTransform<double>* const* X_BA);
+
+/* Applies a single drake::math::RigidTransform<double> to `count` position
+vectors as quickly as possible, i.e., `p_AoQi_A = X_AB * p_BoQi_B` for each i
+in [0, count). The points are stored as a 3 x count column-ordered matrix of
+doubles (e.g., the data() of an Eigen::Matrix3Xd).
+
+It is OK for p_AoQ_A to be the same array as p_BoQ_B (an in-place transform) but
+the arrays must not otherwise partially overlap. */
+void TransformPointsBatch(const RigidTransform<double>& X_AB,
+                          const double* p_BoQ_B, int count, double* p_AoQ_A);
+
 /* Returns `true` if we are using the portable fallback implementations for
 the above functions. */
 bool IsUsingPortableCompositionFunctions();
@@ -100,6 +132,15 @@ void ComposeXinvXPortable(const RigidTransform<double>& X_BA,
                           const RigidTransform<double>& X_BC,
                           RigidTransform<double>* X_AC);
 
+void ComposeXXBatchPortable(const RigidTransform<double>* const* X_AB,
+                            const RigidTransform<double>* const* X_BC,
+                            int count, RigidTransform<double>* const* X_AC);
+void InvertXBatchPortable(const RigidTransform<double>* const* X_AB, int count,
+                          RigidTransform<double>* const* X_BA);
+void TransformPointsBatchPortable(const RigidTransform<double>& X_AB,
+                                  const double* p_BoQ_B, int count,
+                                  double* p_AoQ_A);
+
 }  // namespace internal
 }  // namespace math
 }  // namespace drake
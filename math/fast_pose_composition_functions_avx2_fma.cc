@@ -388,6 +388,58 @@ void ComposeXinvXAvx(const double* X_BA, const double* X_BC, double* X_AC) {
   // The compiler will generate a vzeroupper instruction if needed.
 }
 
+/* Applies X_AB to `count` points stored as a column-ordered 3 x count matrix.
+
+Using the notation from ComposeXXAvx() for X_AB, each point qᵢ = (Pᵢ Qᵢ Rᵢ)
+is transformed as
+
+    xxᵢ   x   a d g   Pᵢ
+    yyᵢ = y + b e h * Qᵢ
+    zzᵢ   z   c f i   Rᵢ
+
+The columns of X_AB are loaded into registers once. Each point then takes three
+packed fused-multiply-adds. We process four points (twelve consecutive doubles)
+per iteration, reading all of their coordinates before storing any result. That
+way the unmasked stores, which write one double past the end of each result
+into the next point's slot, never clobber an input that is yet to be read, and
+the transform can be done in place. */
+void TransformPointsBatchAvx(const double* X_AB, const double* p_BQ,
+                             int count, double* p_AQ) {
+  constexpr uint64_t yes = uint64_t(1ull << 63);
+  constexpr uint64_t no  = uint64_t(0);
+  const __m256i mask = _mm256_setr_epi64x(yes, yes, yes, no);
+
+  const __m256d abcd = _mm256_loadu_pd(X_AB);             // a b c (d)
+  const __m256d defg = _mm256_loadu_pd(X_AB+3);           // d e f (g)
+  const __m256d ghix = _mm256_loadu_pd(X_AB+6);           // g h i (x)
+  const __m256d xyz0 = _mm256_maskload_pd(X_AB+9, mask);  // x y z (0)
+
+  auto transform_one = [&](const double* q) {
+    __m256d res = _mm256_fmadd_pd(abcd, four(q[0]), xyz0);  // x+aP ...
+    res = _mm256_fmadd_pd(defg, four(q[1]), res);           // x+aP+dQ ...
+    return _mm256_fmadd_pd(ghix, four(q[2]), res);          // x+aP+dQ+gR ...
+  };
+
+  int i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const double* q = p_BQ + 3 * i;
+    double* r = p_AQ + 3 * i;
+    const __m256d r0 = transform_one(q);
+    const __m256d r1 = transform_one(q + 3);
+    const __m256d r2 = transform_one(q + 6);
+    const __m256d r3 = transform_one(q + 9);
+    _mm256_storeu_pd(r, r0);             // xx0 yy0 zz0 (-) overwritten next
+    _mm256_storeu_pd(r + 3, r1);         // xx1 yy1 zz1 (-) overwritten next
+    _mm256_storeu_pd(r + 6, r2);         // xx2 yy2 zz2 (-) overwritten next
+    _mm256_maskstore_pd(r + 9, mask, r3);  // xx3 yy3 zz3
+  }
+  for (; i < count; ++i) {
+    _mm256_maskstore_pd(p_AQ + 3 * i, mask, transform_one(p_BQ + 3 * i));
+  }
+
+  // The compiler will generate a vzeroupper instruction if needed.
+}
+
 }  // namespace
 
 // See note above as to why these reinterpret_casts are safe.
@@ -424,6 +476,127 @@ void ComposeXinvXAvx(const RigidTransform<double>& X_BA,
   ComposeXinvXAvx(GetRawMatrixStart(X_BA), GetRawMatrixStart(X_BC),
                   GetMutableRawMatrixStart(X_AC));
 }
+void TransformPointsBatchAvx(const RigidTransform<double>& X_AB,
+                             const double* p_BoQ_B, int count,
+                             double* p_AoQ_A) {
+  TransformPointsBatchAvx(GetRawMatrixStart(X_AB), p_BoQ_B, count, p_AoQ_A);
+}
+
+/* Batched composition of transforms X_AC[i] = X_AB[i] * X_BC[i], using the
+notation and strategy of ComposeXXAvx() for each pair.
+
+The columns of X_AB are kept in registers for as long as the same X_AB repeats,
+as it does when one frame's pose is composed with the poses of all the objects
+attached to it; only X_BC then needs to be loaded. Since an output may not be
+an input of another pair, a repeated X_AB cannot have been overwritten. Each
+pair reads all of its inputs before storing any result, so the outputs may
+overlap the inputs of their own pair. */
+void ComposeXXBatchAvx(const RigidTransform<double>* const* X_AB,
+                       const RigidTransform<double>* const* X_BC, int count,
+                       RigidTransform<double>* const* X_AC) {
+  constexpr uint64_t yes = uint64_t(1ull << 63);
+  constexpr uint64_t no  = uint64_t(0);
+  const __m256i mask = _mm256_setr_epi64x(yes, yes, yes, no);
+
+  // The columns of the current X_AB, which are loaded in the first iteration.
+  const double* a = nullptr;
+  __m256d abcd = _mm256_setzero_pd();
+  __m256d defg = abcd, ghix = abcd, xyz0 = abcd;
+  for (int i = 0; i < count; ++i) {
+    if (GetRawMatrixStart(*X_AB[i]) != a) {
+      a = GetRawMatrixStart(*X_AB[i]);
+      abcd = _mm256_loadu_pd(a);             // a b c (d)  d unused
+      defg = _mm256_loadu_pd(a+3);           // d e f (g)  g unused
+      ghix = _mm256_loadu_pd(a+6);           // g h i (x)  x unused
+      xyz0 = _mm256_maskload_pd(a+9, mask);  // x y z (0)
+    }
+    const double* A = GetRawMatrixStart(*X_BC[i]);
+    double* r = GetMutableRawMatrixStart(X_AC[i]);
+
+    const __m256d ABCD = _mm256_loadu_pd(A);             // A B C D
+    const __m256d EFGH = _mm256_loadu_pd(A+4);           // E F G H
+    const __m256d IXYZ = _mm256_loadu_pd(A+8);           // I X Y Z
+
+    __m256d a0, a1, a2, a3;  // Accumulators.
+
+    a0 = _mm256_mul_pd(abcd, four(ABCD[0]));          // aA bA cA (dA)
+    a1 = _mm256_mul_pd(abcd, four(ABCD[3]));          // aD bD cD (dD)
+    a2 = _mm256_mul_pd(abcd, four(EFGH[2]));          // aG bG cG (dG)
+    a3 = _mm256_fmadd_pd(abcd, four(IXYZ[1]), xyz0);  // x+aX y+bX z+cX (0+dX)
+
+    a0 = _mm256_fmadd_pd(defg, four(ABCD[1]), a0);    // aA+dB bA+eB cA+fB
+    a1 = _mm256_fmadd_pd(defg, four(EFGH[0]), a1);    // aD+dE bD+eE cD+fE
+    a2 = _mm256_fmadd_pd(defg, four(EFGH[3]), a2);    // aG+dH bG+eH cG+fH
+    a3 = _mm256_fmadd_pd(defg, four(IXYZ[2]), a3);    // x+aX+dY y+bX+eY
+                                                      //            z+cX+fY
+
+    a0 = _mm256_fmadd_pd(ghix, four(ABCD[2]), a0);    // r s t (-)
+    a1 = _mm256_fmadd_pd(ghix, four(EFGH[1]), a1);    // u v w (-)
+    a2 = _mm256_fmadd_pd(ghix, four(IXYZ[0]), a2);    // x' y' z' (-)
+    a3 = _mm256_fmadd_pd(ghix, four(IXYZ[3]), a3);    // xx yy zz (-)
+
+    _mm256_storeu_pd(r, a0);                          // r s t (u) overwritten
+    _mm256_storeu_pd(r+3, a1);                        // u v w (x') overwritten
+    _mm256_storeu_pd(r+6, a2);                        // x' y' z' (xx)
+                                                      //          overwritten
+    _mm256_maskstore_pd(r+9, mask, a3);               // xx yy zz
+  }
+
+  // The compiler will generate a vzeroupper instruction if needed.
+}
+
+/* Batched inversion of transforms X_BA[i] = X_AB[i]⁻¹.
+Using the notation from ComposeXXAvx() for X_AB, each inverse is
+
+       X_BA = [ R_ABᵀ; -R_ABᵀ * p_AB ]
+
+    a b c  -(ax + by + cz)
+    d e f  -(dx + ey + fz)
+    g h i  -(gx + hy + iz)
+
+The columns of R_ABᵀ are the rows of R_AB, which we gather with the shuffles of
+ComposeXinvXAvx(). The translation is then a combination of those columns,
+which takes one packed multiply and two packed fused-negated-multiply-adds. All
+of X_AB is read before any result is stored, so the inversion can be done in
+place. */
+void InvertXBatchAvx(const RigidTransform<double>* const* X_AB, int count,
+                     RigidTransform<double>* const* X_BA) {
+  constexpr uint64_t yes = uint64_t(1ull << 63);
+  constexpr uint64_t no  = uint64_t(0);
+  const __m256i mask = _mm256_setr_epi64x(yes, yes, yes, no);
+
+  for (int i = 0; i < count; ++i) {
+    const double* a = GetRawMatrixStart(*X_AB[i]);
+    double* r = GetMutableRawMatrixStart(X_BA[i]);
+
+    const __m256d abcd = _mm256_loadu_pd(a);                   // a b c d
+    const __m256d efgh = _mm256_loadu_pd(a+4);                 // e f g h
+    const __m256d ebgh = _mm256_blend_pd(abcd, efgh, 0b1101);  // e b g h
+    const __m256d behg = _mm256_permute_pd(ebgh, 0b0101);      // b e h (g)
+
+    const __m256d cdgh = _mm256_permute2f128_pd(abcd, efgh,
+                                                0b00110001);   // c d g h
+    const __m256d adgh = _mm256_blend_pd(abcd, cdgh, 0b1110);  // a d g (h)
+
+    const __m256d fghi = _mm256_loadu_pd(a+5);
+    const __m256d ffih = _mm256_permute_pd(fghi, 0b0100);      // f f i h
+    const __m256d cfih = _mm256_blend_pd(cdgh, ffih, 0b0110);  // c f i (h)
+
+    const __m256d ixyz = _mm256_loadu_pd(a+8);                 // i x y z
+
+    __m256d p = _mm256_mul_pd(adgh, four(-ixyz[1]));  // -ax -dx -gx (-)
+    p = _mm256_fnmadd_pd(behg, four(ixyz[2]), p);     // -ax-by -dx-ey -gx-hy
+    p = _mm256_fnmadd_pd(cfih, four(ixyz[3]), p);     // -ax-by-cz ... (-)
+
+    _mm256_storeu_pd(r, adgh);                        // a d g (h) overwritten
+    _mm256_storeu_pd(r+3, behg);                      // b e h (g) overwritten
+    _mm256_storeu_pd(r+6, cfih);                      // c f i (h) overwritten
+    _mm256_maskstore_pd(r+9, mask, p);                // translation
+  }
+
+  // The compiler will generate a vzeroupper instruction if needed.
+}
+
 #else
 namespace {
 void AbortNotEnabledInBuild(const char* func) {
@@ -457,6 +630,22 @@ void ComposeXinvXAvx(const RigidTransform<double>&,
                      RigidTransform<double>*) {
   AbortNotEnabledInBuild(__func__);
 }
+
+void ComposeXXBatchAvx(const RigidTransform<double>* const*,
+                       const RigidTransform<double>* const*, int,
+                       RigidTransform<double>* const*) {
+  AbortNotEnabledInBuild(__func__);
+}
+
+void InvertXBatchAvx(const RigidTransform<double>* const*, int,
+                     RigidTransform<double>* const*) {
+  AbortNotEnabledInBuild(__func__);
+}
+
+void TransformPointsBatchAvx(const RigidTransform<double>&,
+                             const double*, int, double*) {
+  AbortNotEnabledInBuild(__func__);
+}
 #endif
 
 }  // namespace internal
@@ -94,6 +94,33 @@ void ComposeXinvXAvx(
     const RigidTransform<double>& X_BC,
     RigidTransform<double>* X_AC);
 
+/* Composes `count` pairs of RigidTransforms, `*X_AC[i] = *X_AB[i] * *X_BC[i]`.
+See ComposeXXBatch() in fast_pose_composition_functions.h for the overlap
+rules.
+
+Note: if AVX2 is not supported, calling this function will crash the program. */
+void ComposeXXBatchAvx(
+    const RigidTransform<double>* const* X_AB,
+    const RigidTransform<double>* const* X_BC, int count,
+    RigidTransform<double>* const* X_AC);
+
+/* Inverts `count` RigidTransforms, `*X_BA[i] = X_AB[i]⁻¹`. See InvertXBatch()
+in fast_pose_composition_functions.h for the overlap rules.
+
+Note: if AVX2 is not supported, calling this function will crash the program. */
+void InvertXBatchAvx(
+    const RigidTransform<double>* const* X_AB, int count,
+    RigidTransform<double>* const* X_BA);
+
+/* Applies one RigidTransform to `count` points stored as a 3 x count
+column-ordered matrix, `p_AoQi_A = X_AB * p_BoQi_B`. See TransformPointsBatch()
+in fast_pose_composition_functions.h for the overlap rules.
+
+Note: if AVX2 is not supported, calling this function will crash the program. */
+void TransformPointsBatchAvx(
+    const RigidTransform<double>& X_AB,
+    const double* p_BoQ_B, int count, double* p_AoQ_A);
+
 }  // namespace internal
 }  // namespace math
 }  // namespace drake
@@ -564,21 +564,34 @@ class RigidTransform {
       throw std::logic_error(
           "Error: Inner dimension for matrix multiplication is not 3.");
     }
-    // Express position vectors in terms of frame A as p_BoQ_A = R_AB * p_BoQ_B.
-    const RotationMatrix<typename Derived::Scalar> &R_AB = rotation();
-    const Eigen::Matrix<typename Derived::Scalar, 3, Derived::ColsAtCompileTime>
-        p_BoQ_A = R_AB * p_BoQ_B;
-
-    // Reserve space (on stack or heap) to store the result.
-    const int number_of_position_vectors = p_BoQ_B.cols();
-    Eigen::Matrix<typename Derived::Scalar, 3, Derived::ColsAtCompileTime>
-        p_AoQ_A(3, number_of_position_vectors);
-
-    // Create each returned position vector as p_AoQi_A = p_AoBo_A + p_BoQi_A.
-    for (int i = 0;  i < number_of_position_vectors;  ++i)
-      p_AoQ_A.col(i) = translation() + p_BoQ_A.col(i);
-
-    return p_AoQ_A;
+    if constexpr (std::is_same_v<T, double> &&
+                  std::is_same_v<typename Derived::Scalar, double>) {
+      // Copy the position vectors into (column-ordered) result storage, then
+      // transform them in place with the batched kernel.
+      Eigen::Matrix<double, 3, Derived::ColsAtCompileTime> p_AoQ_A = p_BoQ_B;
+      internal::TransformPointsBatch(*this, p_AoQ_A.data(), p_AoQ_A.cols(),
+                                     p_AoQ_A.data());
+      return p_AoQ_A;
+    } else {
+      // Express position vectors in terms of frame A as
+      // p_BoQ_A = R_AB * p_BoQ_B.
+      const RotationMatrix<typename Derived::Scalar> &R_AB = rotation();
+      const Eigen::Matrix<typename Derived::Scalar, 3,
+                          Derived::ColsAtCompileTime>
+          p_BoQ_A = R_AB * p_BoQ_B;
+
+      // Reserve space (on stack or heap) to store the result.
+      const int number_of_position_vectors = p_BoQ_B.cols();
+      Eigen::Matrix<typename Derived::Scalar, 3, Derived::ColsAtCompileTime>
+          p_AoQ_A(3, number_of_position_vectors);
+
+      // Create each returned position vector as
+      // p_AoQi_A = p_AoBo_A + p_BoQi_A.
+      for (int i = 0;  i < number_of_position_vectors;  ++i)
+        p_AoQ_A.col(i) = translation() + p_BoQ_A.col(i);
+
+      return p_AoQ_A;
+    }
   }
 
   /// Compares each element of `this` to the corresponding element of `other`
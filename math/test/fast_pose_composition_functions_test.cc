@@ -1,8 +1,10 @@
 #include "drake/math/fast_pose_composition_functions.h"
 
 #include <limits>
+#include <vector>
 
 #include <Eigen/Dense>
+#include <fmt/format.h>
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -191,6 +193,184 @@ GTEST_TEST(TestFastPoseCompositionFunctions, TestXinvXPortable) {
   TestXxX(internal::ComposeXinvXPortable, true);
 }
 
+/* The batched compositions and inversions are tested against Eigen, with
+(not necessarily legitimate RigidTransform) integer values, so the results
+should match exactly. We check a repeated left-hand transform and the permitted
+in-place usage. */
+
+using BatchComposeFunction = std::function<void(
+    const RigidTransform<double>* const*, const RigidTransform<double>* const*,
+    int, RigidTransform<double>* const*)>;
+using BatchInvertFunction = std::function<void(
+    const RigidTransform<double>* const*, int,
+    RigidTransform<double>* const*)>;
+
+// Returns `count` 3x4 matrices filled with integer values.
+std::vector<Matrix34d> MakeMatrix34dArray(int count, int offset) {
+  std::vector<Matrix34d> result(count);
+  for (int i = 0; i < count; ++i) {
+    for (int j = 0; j < 12; ++j) {
+      result[i].data()[j] = offset + ((7 * i + 3 * j) % 11) - 5;
+    }
+  }
+  return result;
+}
+
+const RigidTransform<double>* AsX(const Matrix34d& X) {
+  return reinterpret_cast<const RigidTransform<double>*>(X.data());
+}
+
+RigidTransform<double>* AsMutableX(Matrix34d* X) {
+  return reinterpret_cast<RigidTransform<double>*>(X->data());
+}
+
+Matrix34d ExpectedComposition(const Matrix34d& M, const Matrix34d& N) {
+  Matrix34d result;
+  result.leftCols(3) = M.leftCols(3) * N.leftCols(3);
+  result.col(3) = M.col(3) + M.leftCols(3) * N.col(3);
+  return result;
+}
+
+Matrix34d ExpectedInverse(const Matrix34d& M) {
+  Matrix34d result;
+  result.leftCols(3) = M.leftCols(3).transpose();
+  result.col(3) = -M.leftCols(3).transpose() * M.col(3);
+  return result;
+}
+
+void TestXXBatch(BatchComposeFunction compose_batch) {
+  for (int count : {0, 1, 3, 5}) {
+    SCOPED_TRACE(fmt::format("count = {}", count));
+    std::vector<Matrix34d> M = MakeMatrix34dArray(count, 0);
+    std::vector<Matrix34d> N = MakeMatrix34dArray(count, 2);
+    std::vector<Matrix34d> MxN(count);
+    // The first two pairs share the same left-hand transform.
+    std::vector<const RigidTransform<double>*> X_AB, X_BC;
+    std::vector<RigidTransform<double>*> X_AC, X_AB_out, X_BC_out;
+    for (int i = 0; i < count; ++i) {
+      X_AB.push_back(AsX(M[i == 1 ? 0 : i]));
+      X_BC.push_back(AsX(N[i]));
+      X_AC.push_back(AsMutableX(&MxN[i]));
+    }
+    compose_batch(X_AB.data(), X_BC.data(), count, X_AC.data());
+    for (int i = 0; i < count; ++i) {
+      EXPECT_TRUE(
+          CompareMatrices(MxN[i], ExpectedComposition(M[i == 1 ? 0 : i], N[i]),
+                          0));
+    }
+
+    // In place, overwriting either input.
+    const std::vector<Matrix34d> M0 = M, N0 = N;
+    X_AB.clear();
+    X_BC.clear();
+    for (int i = 0; i < count; ++i) {
+      X_AB.push_back(AsX(M[i]));
+      X_BC.push_back(AsX(N[i]));
+      X_AB_out.push_back(AsMutableX(&M[i]));
+      X_BC_out.push_back(AsMutableX(&N[i]));
+    }
+    compose_batch(X_AB.data(), X_BC.data(), count, X_AB_out.data());
+    for (int i = 0; i < count; ++i) {
+      EXPECT_TRUE(
+          CompareMatrices(M[i], ExpectedComposition(M0[i], N0[i]), 0));
+    }
+    M = M0;
+    compose_batch(X_AB.data(), X_BC.data(), count, X_BC_out.data());
+    for (int i = 0; i < count; ++i) {
+      EXPECT_TRUE(
+          CompareMatrices(N[i], ExpectedComposition(M0[i], N0[i]), 0));
+    }
+  }
+}
+
+void TestXinvBatch(BatchInvertFunction invert_batch) {
+  for (int count : {0, 1, 3, 5}) {
+    SCOPED_TRACE(fmt::format("count = {}", count));
+    std::vector<Matrix34d> M = MakeMatrix34dArray(count, 1);
+    const std::vector<Matrix34d> M0 = M;
+    std::vector<Matrix34d> Minv(count);
+    std::vector<const RigidTransform<double>*> X_AB;
+    std::vector<RigidTransform<double>*> X_BA, X_AB_out;
+    for (int i = 0; i < count; ++i) {
+      X_AB.push_back(AsX(M[i]));
+      X_BA.push_back(AsMutableX(&Minv[i]));
+      X_AB_out.push_back(AsMutableX(&M[i]));
+    }
+    invert_batch(X_AB.data(), count, X_BA.data());
+    for (int i = 0; i < count; ++i) {
+      EXPECT_TRUE(CompareMatrices(Minv[i], ExpectedInverse(M0[i]), 0));
+    }
+
+    // In place.
+    invert_batch(X_AB.data(), count, X_AB_out.data());
+    for (int i = 0; i < count; ++i) {
+      EXPECT_TRUE(CompareMatrices(M[i], ExpectedInverse(M0[i]), 0));
+    }
+  }
+}
+
+GTEST_TEST(TestFastPoseCompositionFunctions, TestXXBatch) {
+  SCOPED_TRACE("testing ComposeXXBatch()");
+  TestXXBatch(internal::ComposeXXBatch);
+}
+
+GTEST_TEST(TestFastPoseCompositionFunctions, TestXXBatchPortable) {
+  SCOPED_TRACE("testing internal::ComposeXXBatchPortable()");
+  TestXXBatch(internal::ComposeXXBatchPortable);
+}
+
+GTEST_TEST(TestFastPoseCompositionFunctions, TestXinvBatch) {
+  SCOPED_TRACE("testing InvertXBatch()");
+  TestXinvBatch(internal::InvertXBatch);
+}
+
+GTEST_TEST(TestFastPoseCompositionFunctions, TestXinvBatchPortable) {
+  SCOPED_TRACE("testing internal::InvertXBatchPortable()");
+  TestXinvBatch(internal::InvertXBatchPortable);
+}
+
+/* The batched point transform is tested against Eigen. We use enough points to
+exercise both the main loop and the tail handling of the SIMD implementation,
+and we check the permitted in-place usage. */
+
+using BatchTransformPointsFunction = std::function<void(
+    const RigidTransform<double>&, const double*, int, double*)>;
+
+void TestTransformPointsBatch(BatchTransformPointsFunction transform_batch) {
+  Matrix34d X;
+  for (int j = 0; j < 12; ++j) {
+    X.data()[j] = ((3 * j) % 11) - 5;
+  }
+  const auto& X_AB = reinterpret_cast<const RigidTransform<double>&>(X);
+  for (int count : {0, 1, 3, 4, 5, 9}) {
+    SCOPED_TRACE(fmt::format("count = {}", count));
+    Eigen::Matrix3Xd p_B(3, count);
+    for (int i = 0; i < count; ++i) {
+      p_B.col(i) << i, 2 * i - 3, 5 - i;
+    }
+    const Eigen::Matrix3Xd expected =
+        (X.leftCols(3) * p_B).colwise() + X.col(3);
+
+    Eigen::Matrix3Xd p_A(3, count);
+    transform_batch(X_AB, p_B.data(), count, p_A.data());
+    EXPECT_TRUE(CompareMatrices(p_A, expected, 0));
+
+    // In place.
+    transform_batch(X_AB, p_B.data(), count, p_B.data());
+    EXPECT_TRUE(CompareMatrices(p_B, expected, 0));
+  }
+}
+
+GTEST_TEST(TestFastPoseCompositionFunctions, TestTransformPointsBatch) {
+  SCOPED_TRACE("testing TransformPointsBatch()");
+  TestTransformPointsBatch(internal::TransformPointsBatch);
+}
+
+GTEST_TEST(TestFastPoseCompositionFunctions, TestTransformPointsBatchPortable) {
+  SCOPED_TRACE("testing internal::TransformPointsBatchPortable()");
+  TestTransformPointsBatch(internal::TransformPointsBatchPortable);
+}
+
 }  // namespace
 
 }  // namespace math
@@ -2,7 +2,8 @@
 // Benchmark for InverseKinematics.
 //
 // This benchmark is intended to analyze the performance of nonlinear
-// optimization with position constraints.
+// optimization with position constraints, and with several kinematic
+// constraints on the same frame that share their kinematics evaluations.
 
 #include "drake/common/find_resource.h"
 #include "drake/multibody/inverse_kinematics/inverse_kinematics.h"
@@ -112,6 +113,83 @@ BENCHMARK_F(RelaxedPosIkBenchmark, Iiwa)(benchmark::State& state) {  // NOLINT
   }
 }
 
+BENCHMARK_F(RelaxedPosIkBenchmark, IiwaPoseAndGaze)(  // NOLINT
+    benchmark::State& state) {
+  // Solve an inverse kinematics problem for Kuka iiwa with position,
+  // orientation, and gaze constraints on the end effector. All constraints are
+  // added through InverseKinematics, so their gradient evaluations share the
+  // memoized body Jacobians of the end-effector link.
+
+  // Define constants.
+  // A uniform relaxation for end-effector position.
+  const Eigen::Vector3d kPosTol = 1e-3 * Eigen::Vector3d::Ones();
+  // The relaxation for end-effector orientation.
+  const double kAngleTol = 1e-2;
+  // The half angle of the gaze cone.
+  const double kGazeHalfAngle = 0.1;
+  // The number of random goals.
+  const int kNumRandGoals = 10;
+  // The number of random initial guesses for each goal.
+  const int kNumRandInitGuess = 2;
+
+  const std::string iiwa_path = FindResourceOrThrow(
+      "drake/manipulation/models/iiwa_description/iiwa7/"
+      "iiwa7_no_collision.sdf");
+  multibody::MultibodyPlant<double> plant(0.0);
+  multibody::Parser parser{&plant};
+  const multibody::ModelInstanceIndex model_instance =
+      parser.AddModelFromFile(iiwa_path);
+  plant.WeldFrames(plant.world_frame(),
+                   plant.GetFrameByName("iiwa_link_0", model_instance));
+  plant.Finalize();
+  std::unique_ptr<systems::Context<double>> context =
+      plant.CreateDefaultContext();
+
+  const std::string ee_link_name = "iiwa_link_7";
+  const multibody::Body<double>& ee_body = plant.GetBodyByName(ee_link_name);
+  const multibody::Frame<double>& ee_frame = plant.GetFrameByName(ee_link_name);
+
+  // Create one IK problem per random goal configuration.
+  std::vector<std::unique_ptr<multibody::InverseKinematics>> relaxed_iks;
+  for (int i = 0; i < kNumRandGoals; ++i) {
+    // Sample a random joint pose assuming that the random range [-1, 1] rad
+    // does not violate any of the joint position limits.
+    context->get_mutable_continuous_state()
+        .get_mutable_generalized_position()
+        .SetFromVector(Eigen::VectorXd::Random(plant.num_positions()));
+    const math::RigidTransformd X_WE =
+        plant.EvalBodyPoseInWorld(*context, ee_body);
+
+    auto ik = std::make_unique<multibody::InverseKinematics>(plant, true);
+    ik->AddPositionConstraint(ee_frame, Eigen::Vector3d::Zero(),
+                              plant.world_frame(),
+                              X_WE.translation() - kPosTol,
+                              X_WE.translation() + kPosTol);
+    ik->AddOrientationConstraint(plant.world_frame(), X_WE.rotation(),
+                                 ee_frame, math::RotationMatrixd(),
+                                 kAngleTol);
+    // The end effector's z axis points at a target 0.5 m ahead of it.
+    const Eigen::Vector3d p_WT = X_WE * Eigen::Vector3d(0, 0, 0.5);
+    ik->AddGazeTargetConstraint(ee_frame, Eigen::Vector3d::Zero(),
+                                Eigen::Vector3d::UnitZ(), plant.world_frame(),
+                                p_WT, kGazeHalfAngle);
+    relaxed_iks.push_back(std::move(ik));
+  }
+
+  const Eigen::MatrixXd q0(
+      Eigen::MatrixXd::Random(plant.num_positions(), kNumRandInitGuess));
+
+  for (auto _ : state) {
+    for (int i = 0; i < kNumRandGoals; ++i) {
+      solvers::MathematicalProgram* prog = relaxed_iks[i]->get_mutable_prog();
+      for (int j = 0; j < kNumRandInitGuess; ++j) {
+        prog->SetInitialGuess(relaxed_iks[i]->q(), q0.col(j));
+        solvers::Solve(*prog);
+      }
+    }
+  }
+}
+
 }  // namespace
 }  // namespace inverse_kinematics
 }  // namespace multibody
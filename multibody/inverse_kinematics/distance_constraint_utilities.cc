@@ -1,6 +1,7 @@
 #include "drake/multibody/inverse_kinematics/distance_constraint_utilities.h"
 
 #include "drake/math/autodiff_gradient.h"
+#include "drake/multibody/inverse_kinematics/kinematic_evaluator_utilities.h"
 
 namespace drake {
 namespace multibody {
@@ -12,7 +13,8 @@ void CalcDistanceDerivatives(const MultibodyPlant<double>& plant,
                              const Eigen::Vector3d& p_ACa, double distance,
                              const Eigen::Vector3d& nhat_BA_W,
                              const Eigen::Ref<const AutoDiffVecXd>& q,
-                             AutoDiffXd* distance_autodiff) {
+                             AutoDiffXd* distance_autodiff,
+                             KinematicsCache* kinematics_cache) {
   // Derivation to compute the gradient of the signed distance function w.r.t q:
   // The distance is
   // d = n̂_BA_Wᵀ * (p_WCa - p_WCb)             (1)
@@ -33,9 +35,14 @@ void CalcDistanceDerivatives(const MultibodyPlant<double>& plant,
   // Note that ∂p_CbCa_W / ∂q is computed as a Jacobian matrix in
   // MultibodyPlant.
   Eigen::Matrix<double, 3, Eigen::Dynamic> Jq_v_BCa_W(3, plant.num_positions());
-  plant.CalcJacobianTranslationalVelocity(context, JacobianWrtVariable::kQDot,
-                                          frameA, p_ACa, frameB,
-                                          plant.world_frame(), &Jq_v_BCa_W);
+  if (kinematics_cache != nullptr) {
+    kinematics_cache->CalcJacobianTranslationalVelocity(
+        frameA, p_ACa, frameB, plant.world_frame(), &Jq_v_BCa_W);
+  } else {
+    plant.CalcJacobianTranslationalVelocity(context, JacobianWrtVariable::kQDot,
+                                            frameA, p_ACa, frameB,
+                                            plant.world_frame(), &Jq_v_BCa_W);
+  }
   const Eigen::RowVectorXd ddistance_dq = nhat_BA_W.transpose() * Jq_v_BCa_W;
   distance_autodiff->value() = distance;
   distance_autodiff->derivatives() = ddistance_dq * math::ExtractGradient(q);
@@ -48,7 +55,7 @@ void CalcDistanceDerivatives(const MultibodyPlant<AutoDiffXd>&,
                              const AutoDiffXd& distance_autodiff,
                              const Vector3<AutoDiffXd>&,
                              const Eigen::Ref<const Eigen::VectorXd>&,
-                             double* distance) {
+                             double* distance, KinematicsCache*) {
   *distance = distance_autodiff.value();
 }
 
@@ -6,6 +6,8 @@
 namespace drake {
 namespace multibody {
 namespace internal {
+class KinematicsCache;
+
 /*
  * @param plant The plant for which the distance is computed.
  * @param context The context containing the generalized position for computing
@@ -21,6 +23,9 @@ namespace internal {
  * dq / dz, where z is some other variables.
  * @param[out] distance_autodiff Containing the gradient of @p distance w.r.t
  * z (the same variable as shown up in the gradient of q).
+ * @param kinematics_cache If non-null, the Jacobian of the witness point is
+ * computed from the body Jacobians memoized in this cache, which must be
+ * bound to @p context.
  */
 void CalcDistanceDerivatives(const MultibodyPlant<double>& plant,
                              const systems::Context<double>& context,
@@ -29,7 +34,8 @@ void CalcDistanceDerivatives(const MultibodyPlant<double>& plant,
                              const Eigen::Vector3d& p_ACa, double distance,
                              const Eigen::Vector3d& nhat_BA_W,
                              const Eigen::Ref<const AutoDiffVecXd>& q,
-                             AutoDiffXd* distance_autodiff);
+                             AutoDiffXd* distance_autodiff,
+                             KinematicsCache* kinematics_cache = nullptr);
 
 /*
  * This is the overloaded version of CalcDistanceDerivatives for plant being
@@ -43,7 +49,8 @@ void CalcDistanceDerivatives(const MultibodyPlant<AutoDiffXd>& plant,
                              const AutoDiffXd& distance_autodiff,
                              const Vector3<AutoDiffXd>& nhat_BA_W,
                              const Eigen::Ref<const Eigen::VectorXd>& q,
-                             double* distance);
+                             double* distance,
+                             KinematicsCache* kinematics_cache = nullptr);
 
 /*
  * This is the overloaded version of CalcDistanceDerivatives for the input q of
@@ -55,7 +62,7 @@ void CalcDistanceDerivatives(const MultibodyPlant<T>&,
                              const Frame<T>&, const Vector3<T>&, T distance_in,
                              const Vector3<T>&,
                              const Eigen::Ref<const VectorX<T>>&,
-                             T* distance_out) {
+                             T* distance_out, KinematicsCache* = nullptr) {
   *distance_out = distance_in;
 }
 
@@ -1,10 +1,12 @@
 #include "drake/multibody/inverse_kinematics/gaze_target_constraint.h"
 
 #include <limits>
+#include <utility>
 
 #include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/inverse_kinematics/kinematic_evaluator_utilities.h"
 
+using drake::multibody::internal::KinematicsCache;
 using drake::multibody::internal::NormalizeVector;
 using drake::multibody::internal::RefFromPtrOrThrow;
 using drake::multibody::internal::UpdateContextConfiguration;
@@ -69,6 +71,13 @@ GazeTargetConstraint::GazeTargetConstraint(
   }
 }
 
+void GazeTargetConstraint::set_kinematics_cache(
+    std::shared_ptr<KinematicsCache> kinematics_cache) {
+  DRAKE_DEMAND(!use_autodiff());
+  DRAKE_DEMAND(&kinematics_cache->context() == context_double_);
+  kinematics_cache_ = std::move(kinematics_cache);
+}
+
 void EvalConstraintGradient(
     const systems::Context<double>& context,
     const MultibodyPlant<double>& plant, const Frame<double>& frameA,
@@ -76,7 +85,8 @@ void EvalConstraintGradient(
     const Eigen::Vector3d& n_A,
     const Eigen::Vector3d& cos_cone_half_angle_squared_times_p,
     const double& p_dot_n, const Eigen::Vector2d& g,
-    const Eigen::Ref<const AutoDiffVecXd>& x, AutoDiffVecXd* y) {
+    const Eigen::Ref<const AutoDiffVecXd>& x, AutoDiffVecXd* y,
+    KinematicsCache* kinematics_cache) {
   // The constraint values are
   //   g(q)  = ⎡ p · n_unit_A                                 ⎤
   //           ⎣(p · n_unit_A)² - (cosθ)²p · p⎦
@@ -85,11 +95,16 @@ void EvalConstraintGradient(
   //   ∂g/∂q = ⎡n_unit_Aᵀ                               ⎤ ∂p/∂q,
   //           ⎣2 [(p · n_unit_A) n_unit_A -  (cosθ)²p]ᵀ⎦
   // Position of target point T measured and expressed in A frame.
-  Eigen::MatrixXd Jq_V_ABt(6, plant.num_positions());
-  plant.CalcJacobianSpatialVelocity(context, JacobianWrtVariable::kQDot, frameB,
-                                    p_BT, frameA, frameA, &Jq_V_ABt);
   // Jq_p = Jq_v_ABt = ∂p/∂q.
-  const Matrix3X<double> Jq_p = Jq_V_ABt.bottomRows<3>();
+  Matrix3X<double> Jq_p(3, plant.num_positions());
+  if (kinematics_cache != nullptr) {
+    kinematics_cache->CalcJacobianTranslationalVelocity(frameB, p_BT, frameA,
+                                                        frameA, &Jq_p);
+  } else {
+    plant.CalcJacobianTranslationalVelocity(context,
+                                            JacobianWrtVariable::kQDot, frameB,
+                                            p_BT, frameA, frameA, &Jq_p);
+  }
   // J_g_p = ∂g/∂p.
   const Eigen::Matrix<double, 2, 3> Jp_g =
       (Eigen::Matrix<double, 2, 3>() << n_A.transpose(),
@@ -104,7 +119,8 @@ void DoEvalGeneric(const MultibodyPlant<T>& plant, systems::Context<T>* context,
                    const FrameIndex frameA_index, const FrameIndex frameB_index,
                    const Eigen::Vector3d& p_AS, const Eigen::Vector3d& n_A,
                    const Eigen::Vector3d p_BT, double cos_cone_half_angle,
-                   const Eigen::Ref<const VectorX<S>>& x, VectorX<S>* y) {
+                   const Eigen::Ref<const VectorX<S>>& x, VectorX<S>* y,
+                   KinematicsCache* kinematics_cache = nullptr) {
   UpdateContextConfiguration(context, plant, x);
   const Frame<T>& frameA = plant.get_frame(frameA_index);
   const Frame<T>& frameB = plant.get_frame(frameB_index);
@@ -124,7 +140,7 @@ void DoEvalGeneric(const MultibodyPlant<T>& plant, systems::Context<T>* context,
   } else {
     EvalConstraintGradient(*context, plant, frameA, frameB, p_BT, n_A,
                            cos_cone_half_angle_squared_times_p, p_dot_n, g, x,
-                           y);
+                           y, kinematics_cache);
   }
 }
 
@@ -148,7 +164,8 @@ void GazeTargetConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
                   y);
   } else {
     DoEvalGeneric(*plant_double_, context_double_, frameA_index_, frameB_index_,
-                  p_AS_, n_A_, p_BT_, cos_cone_half_angle_, x, y);
+                  p_AS_, n_A_, p_BT_, cos_cone_half_angle_, x, y,
+                  kinematics_cache_.get());
   }
 }
 
@@ -7,6 +7,10 @@
 
 namespace drake {
 namespace multibody {
+namespace internal {
+class KinematicsCache;
+}  // namespace internal
+
 /**
  * Constrains a target point T to be within a cone K. The point T ("T" stands
  * for "target") is fixed in a frame B, with position p_BT. The cone
@@ -78,6 +82,12 @@ class GazeTargetConstraint : public solvers::Constraint {
   ~GazeTargetConstraint() override{};
 
  private:
+  friend class InverseKinematics;
+
+  // Set by InverseKinematics; see internal::KinematicsCache.
+  void set_kinematics_cache(
+      std::shared_ptr<internal::KinematicsCache> kinematics_cache);
+
   void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
               Eigen::VectorXd* y) const override;
 
@@ -104,6 +114,7 @@ class GazeTargetConstraint : public solvers::Constraint {
 
   const MultibodyPlant<AutoDiffXd>* const plant_autodiff_;
   systems::Context<AutoDiffXd>* const context_autodiff_;
+  std::shared_ptr<internal::KinematicsCache> kinematics_cache_;
 };
 }  // namespace multibody
 }  // namespace drake
@@ -6,6 +6,7 @@
 #include "drake/multibody/inverse_kinematics/angle_between_vectors_cost.h"
 #include "drake/multibody/inverse_kinematics/distance_constraint.h"
 #include "drake/multibody/inverse_kinematics/gaze_target_constraint.h"
+#include "drake/multibody/inverse_kinematics/kinematic_evaluator_utilities.h"
 #include "drake/multibody/inverse_kinematics/minimum_distance_constraint.h"
 #include "drake/multibody/inverse_kinematics/orientation_constraint.h"
 #include "drake/multibody/inverse_kinematics/orientation_cost.h"
@@ -23,7 +24,9 @@ InverseKinematics::InverseKinematics(const MultibodyPlant<double>& plant,
       plant_(plant),
       owned_context_(plant_.CreateDefaultContext()),
       context_(owned_context_.get()),
-      q_(prog_->NewContinuousVariables(plant_.num_positions(), "q")) {
+      q_(prog_->NewContinuousVariables(plant_.num_positions(), "q")),
+      kinematics_cache_(std::make_shared<internal::KinematicsCache>(
+          &plant_, context_)) {
   if (with_joint_limits) {
     prog_->AddBoundingBoxConstraint(plant.GetPositionLowerLimits(),
                                     plant.GetPositionUpperLimits(), q_);
@@ -38,7 +41,9 @@ InverseKinematics::InverseKinematics(const MultibodyPlant<double>& plant,
       plant_(plant),
       owned_context_(nullptr),
       context_(plant_context),
-      q_(prog_->NewContinuousVariables(plant.num_positions(), "q")) {
+      q_(prog_->NewContinuousVariables(plant.num_positions(), "q")),
+      kinematics_cache_(std::make_shared<internal::KinematicsCache>(
+          &plant_, context_)) {
   DRAKE_DEMAND(plant_context != nullptr);
   if (with_joint_limits) {
     prog_->AddBoundingBoxConstraint(plant.GetPositionLowerLimits(),
@@ -55,6 +60,7 @@ solvers::Binding<solvers::Constraint> InverseKinematics::AddPositionConstraint(
   auto constraint = std::make_shared<PositionConstraint>(
       &plant_, frameA, p_AQ_lower, p_AQ_upper, frameB, p_BQ,
       get_mutable_context());
+  constraint->set_kinematics_cache(kinematics_cache_);
   return prog_->AddConstraint(constraint, q_);
 }
 
@@ -67,6 +73,7 @@ solvers::Binding<solvers::Constraint> InverseKinematics::AddPositionConstraint(
   auto constraint = std::make_shared<PositionConstraint>(
       &plant_, frameAbar, X_AbarA, p_AQ_lower, p_AQ_upper, frameB, p_BQ,
       get_mutable_context());
+  constraint->set_kinematics_cache(kinematics_cache_);
   return prog_->AddConstraint(constraint, q_);
 }
 
@@ -87,6 +94,7 @@ InverseKinematics::AddOrientationConstraint(
   auto constraint = std::make_shared<OrientationConstraint>(
       &plant_, frameAbar, R_AbarA, frameBbar, R_BbarB, angle_bound,
       get_mutable_context());
+  constraint->set_kinematics_cache(kinematics_cache_);
   return prog_->AddConstraint(constraint, q_);
 }
 
@@ -108,6 +116,7 @@ InverseKinematics::AddGazeTargetConstraint(
   auto constraint = std::make_shared<GazeTargetConstraint>(
       &plant_, frameA, p_AS, n_A, frameB, p_BT, cone_half_angle,
       get_mutable_context());
+  constraint->set_kinematics_cache(kinematics_cache_);
   return prog_->AddConstraint(constraint, q_);
 }
 
@@ -138,6 +147,7 @@ InverseKinematics::AddMinimumDistanceConstraint(
       std::shared_ptr<MinimumDistanceConstraint>(new MinimumDistanceConstraint(
           &plant_, minimum_distance, get_mutable_context(), {},
           influence_distance_offset));
+  constraint->set_kinematics_cache(kinematics_cache_);
   return prog_->AddConstraint(constraint, q_);
 }
 
@@ -10,6 +10,10 @@
 
 namespace drake {
 namespace multibody {
+namespace internal {
+class KinematicsCache;
+}  // namespace internal
+
 /**
  * Solves an inverse kinematics (IK) problem on a MultibodyPlant, to find the
  * postures of the robot satisfying certain constraints.
@@ -372,6 +376,9 @@ class InverseKinematics {
   std::unique_ptr<systems::Context<double>> const owned_context_;
   systems::Context<double>* const context_;
   solvers::VectorXDecisionVariable q_;
+  // Shared by the kinematic constraints bound to context_, so that each body
+  // Jacobian is computed once per configuration q visited by the solver.
+  std::shared_ptr<internal::KinematicsCache> kinematics_cache_;
 };
 }  // namespace multibody
 }  // namespace drake
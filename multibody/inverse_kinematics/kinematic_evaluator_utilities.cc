@@ -1,5 +1,9 @@
 #include "drake/multibody/inverse_kinematics/kinematic_evaluator_utilities.h"
 
+#include <algorithm>
+
+#include "drake/math/cross_product.h"
+
 namespace drake {
 namespace multibody {
 namespace internal {
@@ -69,6 +73,84 @@ void UpdateContextPositionsAndVelocities(
     plant.SetPositionsAndVelocities(context, q_v);
   }
 }
+
+KinematicsCache::KinematicsCache(const MultibodyPlant<double>* plant,
+                                 const systems::Context<double>* context)
+    : plant_{RefFromPtrOrThrow(plant)},
+      context_{PtrOrThrow(context, "KinematicsCache: context is nullptr.")},
+      q_{Eigen::VectorXd::Constant(plant->num_positions(),
+                                   std::numeric_limits<double>::quiet_NaN())},
+      jacobians_(plant->num_bodies()),
+      is_valid_(plant->num_bodies(), false) {}
+
+const Eigen::Matrix<double, 6, Eigen::Dynamic>&
+KinematicsCache::EvalBodyJacobianInWorld(const Body<double>& body) {
+  // q_ starts out as NaN, hence the first call always misses.
+  if (plant_.GetPositions(*context_) != q_) {
+    q_ = plant_.GetPositions(*context_);
+    std::fill(is_valid_.begin(), is_valid_.end(), false);
+  }
+  const int index = body.index();
+  Eigen::Matrix<double, 6, Eigen::Dynamic>& Jq_V_WBo_W = jacobians_[index];
+  if (!is_valid_[index]) {
+    Jq_V_WBo_W.resize(6, plant_.num_positions());
+    plant_.CalcJacobianSpatialVelocity(
+        *context_, JacobianWrtVariable::kQDot, body.body_frame(),
+        Eigen::Vector3d::Zero(), plant_.world_frame(), plant_.world_frame(),
+        &Jq_V_WBo_W);
+    is_valid_[index] = true;
+  }
+  return Jq_V_WBo_W;
+}
+
+Eigen::Matrix3Xd KinematicsCache::CalcPointJacobianInWorld(
+    const Body<double>& body, const Eigen::Vector3d& p_WP) {
+  const Eigen::Matrix<double, 6, Eigen::Dynamic>& Jq_V_WBo_W =
+      EvalBodyJacobianInWorld(body);
+  // v_WP = v_WBo + w_WB × p_BoP = v_WBo - p_BoP × w_WB.
+  const Eigen::Vector3d p_BoP_W =
+      p_WP - plant_.EvalBodyPoseInWorld(*context_, body).translation();
+  return Jq_V_WBo_W.bottomRows<3>() -
+         math::VectorToSkewSymmetric(p_BoP_W) * Jq_V_WBo_W.topRows<3>();
+}
+
+void KinematicsCache::CalcJacobianTranslationalVelocity(
+    const Frame<double>& frame_B,
+    const Eigen::Ref<const Eigen::Vector3d>& p_BoBi_B,
+    const Frame<double>& frame_A, const Frame<double>& frame_E,
+    EigenPtr<Eigen::Matrix3Xd> Jq_v_ABi_E) {
+  DRAKE_DEMAND(Jq_v_ABi_E != nullptr);
+  DRAKE_DEMAND(Jq_v_ABi_E->cols() == plant_.num_positions());
+  const Eigen::Vector3d p_WBi =
+      frame_B.CalcPoseInWorld(*context_) * Eigen::Vector3d(p_BoBi_B);
+  // The velocity of Bi in A is v_ABi = v_WBi - v_WAi, with Ai the point of A
+  // coincident with Bi.
+  *Jq_v_ABi_E = CalcPointJacobianInWorld(frame_B.body(), p_WBi);
+  if (frame_A.body().index() != world_index()) {
+    *Jq_v_ABi_E -= CalcPointJacobianInWorld(frame_A.body(), p_WBi);
+  }
+  if (frame_E.index() != plant_.world_frame().index()) {
+    const math::RotationMatrixd R_EW =
+        frame_E.CalcRotationMatrixInWorld(*context_).inverse();
+    *Jq_v_ABi_E = R_EW.matrix() * (*Jq_v_ABi_E);
+  }
+}
+
+void KinematicsCache::CalcJacobianAngularVelocity(
+    const Frame<double>& frame_B, const Frame<double>& frame_A,
+    const Frame<double>& frame_E, EigenPtr<Eigen::Matrix3Xd> Jq_w_AB_E) {
+  DRAKE_DEMAND(Jq_w_AB_E != nullptr);
+  DRAKE_DEMAND(Jq_w_AB_E->cols() == plant_.num_positions());
+  *Jq_w_AB_E = EvalBodyJacobianInWorld(frame_B.body()).topRows<3>();
+  if (frame_A.body().index() != world_index()) {
+    *Jq_w_AB_E -= EvalBodyJacobianInWorld(frame_A.body()).topRows<3>();
+  }
+  if (frame_E.index() != plant_.world_frame().index()) {
+    const math::RotationMatrixd R_EW =
+        frame_E.CalcRotationMatrixInWorld(*context_).inverse();
+    *Jq_w_AB_E = R_EW.matrix() * (*Jq_w_AB_E);
+  }
+}
 }  // namespace internal
 }  // namespace multibody
 }  // namespace drake
@@ -2,6 +2,7 @@
 
 #include <limits>
 #include <string>
+#include <vector>
 
 #include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/plant/multibody_plant.h"
@@ -93,6 +94,74 @@ T* PtrOrThrow(T* ptr, std::string_view error) {
   return ptr;
 }
 
+/*
+ * Memoizes the spatial velocity Jacobians of the bodies of a
+ * MultibodyPlant<double>, keyed on the generalized positions q stored in a
+ * plant context. Kinematic evaluators that share a context (as the constraints
+ * added through InverseKinematics do) can share one KinematicsCache, so that
+ * for a given q each body Jacobian is computed at most once no matter how many
+ * evaluators need it. Forward kinematics is already memoized by the context's
+ * own cache; this class only stores Jacobians.
+ *
+ * Memoized Jacobians are discarded whenever the positions in the context
+ * differ from the ones they were computed at. Changes to the context that
+ * affect kinematics without changing q (e.g. parameters) are not detected.
+ */
+class KinematicsCache {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(KinematicsCache)
+
+  /*
+   * @param plant The plant whose Jacobians are memoized. It must outlive this.
+   * @param context The context for `plant` from which q is read. It must
+   * outlive this.
+   */
+  KinematicsCache(const MultibodyPlant<double>* plant,
+                  const systems::Context<double>* context);
+
+  const systems::Context<double>& context() const { return *context_; }
+
+  /*
+   * Returns Jq_V_WBo_W, the Jacobian with respect to q̇ of the spatial
+   * velocity of the origin of `body` in the world frame W, expressed in W.
+   */
+  const Eigen::Matrix<double, 6, Eigen::Dynamic>& EvalBodyJacobianInWorld(
+      const Body<double>& body);
+
+  /*
+   * Computes the same result as
+   * MultibodyPlant::CalcJacobianTranslationalVelocity() with
+   * JacobianWrtVariable::kQDot, reusing the memoized body Jacobians.
+   */
+  void CalcJacobianTranslationalVelocity(
+      const Frame<double>& frame_B,
+      const Eigen::Ref<const Eigen::Vector3d>& p_BoBi_B,
+      const Frame<double>& frame_A, const Frame<double>& frame_E,
+      EigenPtr<Eigen::Matrix3Xd> Jq_v_ABi_E);
+
+  /*
+   * Computes the same result as MultibodyPlant::CalcJacobianAngularVelocity()
+   * with JacobianWrtVariable::kQDot, reusing the memoized body Jacobians.
+   */
+  void CalcJacobianAngularVelocity(const Frame<double>& frame_B,
+                                   const Frame<double>& frame_A,
+                                   const Frame<double>& frame_E,
+                                   EigenPtr<Eigen::Matrix3Xd> Jq_w_AB_E);
+
+ private:
+  // Returns Jq_v_WP_W for a point P of `body` located at p_WP.
+  Eigen::Matrix3Xd CalcPointJacobianInWorld(const Body<double>& body,
+                                            const Eigen::Vector3d& p_WP);
+
+  const MultibodyPlant<double>& plant_;
+  const systems::Context<double>* const context_;
+  // The generalized positions at which the entries of jacobians_ flagged in
+  // is_valid_ were computed.
+  Eigen::VectorXd q_;
+  std::vector<Eigen::Matrix<double, 6, Eigen::Dynamic>> jacobians_;
+  std::vector<bool> is_valid_;
+};
+
 }  // namespace internal
 }  // namespace multibody
 }  // namespace drake
@@ -1,6 +1,7 @@
 #include "drake/multibody/inverse_kinematics/minimum_distance_constraint.h"
 
 #include <limits>
+#include <utility>
 #include <vector>
 
 #include <Eigen/Dense>
@@ -16,7 +17,8 @@ template <typename T, typename S>
 VectorX<S> Distances(const MultibodyPlant<T>& plant,
                      systems::Context<T>* context,
                      const Eigen::Ref<const VectorX<S>>& q,
-                     double influence_distance) {
+                     double influence_distance,
+                     internal::KinematicsCache* kinematics_cache) {
   internal::UpdateContextConfiguration(context, plant, q);
   const auto& query_port = plant.get_geometry_query_input_port();
   if (!query_port.HasValue(*context)) {
@@ -56,7 +58,7 @@ VectorX<S> Distances(const MultibodyPlant<T>& plant,
                   .template cast<T>() *
               signed_distance_pair.p_ACa,
           signed_distance_pair.distance, signed_distance_pair.nhat_BA_W, q,
-          &distances(distance_count++));
+          &distances(distance_count++), kinematics_cache);
     }
   }
   distances.resize(distance_count);
@@ -89,13 +91,14 @@ void MinimumDistanceConstraint::Initialize(
   minimum_value_constraint_ = std::make_unique<solvers::MinimumValueConstraint>(
       this->num_vars(), minimum_distance, influence_distance_offset,
       num_collision_candidates,
-      [&plant, plant_context](const auto& x, double influence_distance) {
+      [this, &plant, plant_context](const auto& x, double influence_distance) {
         return Distances<T, AutoDiffXd>(plant, plant_context, x,
-                                        influence_distance);
+                                        influence_distance,
+                                        kinematics_cache_.get());
       },
       [&plant, plant_context](const auto& x, double influence_distance) {
         return Distances<T, double>(plant, plant_context, x,
-                                    influence_distance);
+                                    influence_distance, nullptr);
       });
   this->set_bounds(minimum_value_constraint_->lower_bound(),
                    minimum_value_constraint_->upper_bound());
@@ -134,6 +137,13 @@ MinimumDistanceConstraint::MinimumDistanceConstraint(
              influence_distance_offset, penalty_function);
 }
 
+void MinimumDistanceConstraint::set_kinematics_cache(
+    std::shared_ptr<internal::KinematicsCache> kinematics_cache) {
+  DRAKE_DEMAND(plant_double_ != nullptr);
+  DRAKE_DEMAND(&kinematics_cache->context() == plant_context_double_);
+  kinematics_cache_ = std::move(kinematics_cache);
+}
+
 template <typename T>
 void MinimumDistanceConstraint::DoEvalGeneric(
     const Eigen::Ref<const VectorX<T>>& x, VectorX<T>* y) const {
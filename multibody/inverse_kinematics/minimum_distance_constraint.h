@@ -10,6 +10,9 @@
 
 namespace drake {
 namespace multibody {
+namespace internal {
+class KinematicsCache;
+}  // namespace internal
 
 /** Computes the penalty function φ(x) and its derivatives dφ(x)/dx. Valid
 penalty functions must meet the following criteria:
@@ -120,6 +123,13 @@ class MinimumDistanceConstraint final : public solvers::Constraint {
   }
 
  private:
+  friend class InverseKinematics;
+
+  // Set by InverseKinematics; only the witness point Jacobians are
+  // memoized, the signed distance queries are not.
+  void set_kinematics_cache(
+      std::shared_ptr<internal::KinematicsCache> kinematics_cache);
+
   void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
               Eigen::VectorXd* y) const override;
 
@@ -148,6 +158,7 @@ class MinimumDistanceConstraint final : public solvers::Constraint {
   std::unique_ptr<solvers::MinimumValueConstraint> minimum_value_constraint_;
   const multibody::MultibodyPlant<AutoDiffXd>* const plant_autodiff_;
   systems::Context<AutoDiffXd>* const plant_context_autodiff_;
+  std::shared_ptr<internal::KinematicsCache> kinematics_cache_;
 };
 }  // namespace multibody
 }  // namespace drake
@@ -0,0 +1,163 @@
+#include "drake/multibody/inverse_kinematics/multi_start_inverse_kinematics.h"
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/parallel_for.h"
+#include "drake/common/text_logging.h"
+#include "drake/solvers/choose_best_solver.h"
+#include "drake/solvers/ipopt_solver.h"
+#include "drake/solvers/nlopt_solver.h"
+#include "drake/solvers/solver_interface.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+using solvers::MathematicalProgramResult;
+
+int SelectNumberOfThreadsToUse(int num_parallel_executions) {
+  if (num_parallel_executions == -1) {
+    return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  }
+  if (num_parallel_executions < 1) {
+    throw std::runtime_error(fmt::format(
+        "SolveMultiStartInverseKinematics: num_parallel_executions = {} is "
+        "not valid; it must be -1 or >= 1.",
+        num_parallel_executions));
+  }
+  return num_parallel_executions;
+}
+
+// The state shared by all parallel executions. Each seed index is handed out
+// exactly once, so every entry of `results` is written by a single worker.
+struct SharedState {
+  const Eigen::Ref<const Eigen::MatrixXd>& q_seeds;
+  const MultiStartInverseKinematicsOptions& options;
+  std::atomic<int> next_seed{0};
+  std::atomic<int> num_successes{0};
+  std::vector<std::optional<MathematicalProgramResult>> results;
+};
+
+// Solves seeds from `state` with `ik` until none is left or enough of them
+// have succeeded.
+void SolveSeeds(InverseKinematics* ik,
+                const solvers::SolverInterface& solver, SharedState* state) {
+  const std::optional<int>& target = state->options.num_feasible_solutions;
+  while (true) {
+    if (target.has_value() && state->num_successes.load() >= *target) {
+      return;
+    }
+    const int seed = state->next_seed.fetch_add(1);
+    if (seed >= state->q_seeds.cols()) {
+      return;
+    }
+    ik->get_mutable_prog()->SetInitialGuess(ik->q(), state->q_seeds.col(seed));
+    MathematicalProgramResult result;
+    solver.Solve(ik->prog(), std::nullopt, state->options.solver_options,
+                 &result);
+    if (result.is_success()) {
+      ++state->num_successes;
+    }
+    state->results[seed] = std::move(result);
+  }
+}
+}  // namespace
+
+std::vector<MathematicalProgramResult> SolveMultiStartInverseKinematics(
+    const InverseKinematicsFactory& make_ik,
+    const Eigen::Ref<const Eigen::MatrixXd>& q_seeds,
+    const MultiStartInverseKinematicsOptions& options) {
+  if (options.num_feasible_solutions.has_value() &&
+      *options.num_feasible_solutions < 1) {
+    throw std::runtime_error(fmt::format(
+        "SolveMultiStartInverseKinematics: num_feasible_solutions = {} must "
+        "be >= 1.",
+        *options.num_feasible_solutions));
+  }
+  int num_threads = std::min<int>(
+      SelectNumberOfThreadsToUse(options.num_parallel_executions),
+      std::max<int>(1, q_seeds.cols()));
+
+  // Build one problem (and solver) per parallel execution on this thread.
+  std::vector<std::unique_ptr<InverseKinematics>> iks;
+  iks.push_back(make_ik());
+  DRAKE_THROW_UNLESS(iks.back() != nullptr);
+  solvers::SolverId solver_id =
+      options.solver_id.has_value()
+          ? *options.solver_id
+          : solvers::ChooseBestSolver(iks.back()->prog());
+  // IPOPT is not thread-safe. When it was chosen automatically for a parallel
+  // solve, use NLopt instead if we can; otherwise, its seeds are all solved on
+  // this thread.
+  if (solver_id == solvers::IpoptSolver::id() && num_threads > 1) {
+    if (!options.solver_id.has_value() &&
+        solvers::NloptSolver::is_available() &&
+        solvers::NloptSolver::is_enabled()) {
+      drake::log()->debug(
+          "SolveMultiStartInverseKinematics: using {} instead of {} for {} "
+          "parallel executions.",
+          solvers::NloptSolver::id(), solver_id, num_threads);
+      solver_id = solvers::NloptSolver::id();
+    } else {
+      static const logging::Warn log_once(
+          "SolveMultiStartInverseKinematics: {} is not thread-safe; its seeds "
+          "are solved serially, ignoring num_parallel_executions. Set "
+          "MultiStartInverseKinematicsOptions::solver_id to a thread-safe "
+          "solver (e.g., NloptSolver or SnoptSolver) to solve them in "
+          "parallel.",
+          solver_id);
+      num_threads = 1;
+    }
+  }
+  while (static_cast<int>(iks.size()) < num_threads) {
+    iks.push_back(make_ik());
+    DRAKE_THROW_UNLESS(iks.back() != nullptr);
+  }
+  std::vector<std::unique_ptr<solvers::SolverInterface>> ik_solvers;
+  for (int i = 0; i < num_threads; ++i) {
+    ik_solvers.push_back(solvers::MakeSolver(solver_id));
+  }
+  if (q_seeds.rows() != iks[0]->q().rows()) {
+    throw std::runtime_error(fmt::format(
+        "SolveMultiStartInverseKinematics: q_seeds has {} rows, but the "
+        "plant has {} positions.",
+        q_seeds.rows(), iks[0]->q().rows()));
+  }
+  drake::log()->debug(
+      "SolveMultiStartInverseKinematics: solving {} seeds with {} and {} "
+      "parallel executions",
+      q_seeds.cols(), ik_solvers[0]->solver_id(), num_threads);
+
+  SharedState state{q_seeds, options};
+  state.results.resize(q_seeds.cols());
+  // Each parallel execution solves seeds with its own problem and solver.
+  drake::internal::ParallelFor(num_threads, num_threads, [&](int i) {
+    SolveSeeds(iks[i].get(), *ik_solvers[i], &state);
+  });
+
+  std::vector<MathematicalProgramResult> ranked;
+  for (auto& result : state.results) {
+    if (result.has_value()) {
+      ranked.push_back(std::move(*result));
+    }
+  }
+  std::stable_sort(ranked.begin(), ranked.end(),
+                   [](const MathematicalProgramResult& a,
+                      const MathematicalProgramResult& b) {
+                     if (a.is_success() != b.is_success()) {
+                       return a.is_success();
+                     }
+                     return a.is_success() &&
+                            a.get_optimal_cost() < b.get_optimal_cost();
+                   });
+  return ranked;
+}
+
+}  // namespace multibody
+}  // namespace drake
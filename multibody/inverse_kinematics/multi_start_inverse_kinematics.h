@@ -0,0 +1,84 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "drake/multibody/inverse_kinematics/inverse_kinematics.h"
+#include "drake/solvers/mathematical_program_result.h"
+#include "drake/solvers/solver_id.h"
+#include "drake/solvers/solver_options.h"
+
+namespace drake {
+namespace multibody {
+/**
+ * Constructs the InverseKinematics problem that is solved from every seed in
+ * SolveMultiStartInverseKinematics(). Each call must return a new problem with
+ * the same decision variables and constraints. The returned problem must own
+ * its plant context (or be the only user of it), so that problems returned by
+ * different calls can be solved concurrently.
+ */
+using InverseKinematicsFactory =
+    std::function<std::unique_ptr<InverseKinematics>()>;
+
+/**
+ * Options for SolveMultiStartInverseKinematics().
+ */
+struct MultiStartInverseKinematicsOptions {
+  /** Number of seeds solved concurrently. Each parallel execution owns one
+   * InverseKinematics problem made by the factory. Must be >= 1, or -1 to use
+   * std::thread::hardware_concurrency(). IPOPT is not thread-safe, so when
+   * ChooseBestSolver() picks it (e.g., when SNOPT is not available), NLopt is
+   * used instead if it is available. When IPOPT is set in solver_id, or NLopt
+   * is not available, the seeds are solved serially (with a warning, logged
+   * once per process). To solve in parallel, set solver_id to a thread-safe
+   * solver such as solvers::NloptSolver::id() or solvers::SnoptSolver::id().
+   */
+  int num_parallel_executions{1};
+
+  /** If set, no new seed is started once this many seeds have been solved
+   * successfully. Seeds already in progress are still completed. Must be
+   * >= 1. */
+  std::optional<int> num_feasible_solutions;
+
+  /** The solver used for every seed. If not set, ChooseBestSolver() picks one
+   * for the problem (see num_parallel_executions for how IPOPT is handled).
+   * Unless it is IPOPT, the solver must be safe to run on several programs at
+   * once. */
+  std::optional<solvers::SolverId> solver_id;
+
+  /** Options passed to the solver for every seed. */
+  std::optional<solvers::SolverOptions> solver_options;
+};
+
+/**
+ * Solves an InverseKinematics problem from many initial guesses of the
+ * generalized positions q, and ranks the results.
+ *
+ * The problem is built once per parallel execution by @p make_ik, not once per
+ * seed; every seed only updates the initial guess of q in the program and
+ * calls the solver.
+ *
+ * @param make_ik Makes the problem to solve, see InverseKinematicsFactory. It
+ * is only called from the calling thread.
+ * @param q_seeds The initial guesses of q, one per column. Each column is
+ * used as the initial guess of InverseKinematics::q(); the initial guess of
+ * any other decision variable is the one set by @p make_ik.
+ * @param options See MultiStartInverseKinematicsOptions.
+ * @returns The results of the seeds that were solved, ranked: the successful
+ * results come first in ascending order of optimal cost, followed by the
+ * unsuccessful ones. Results that compare equal keep the order of their seeds.
+ * Since InverseKinematics creates q before any other decision variable, q is
+ * `result.get_x_val().head(plant.num_positions())` for any result.
+ * @throws std::exception if q_seeds does not have one row per position of the
+ * plant, or if options are invalid.
+ */
+std::vector<solvers::MathematicalProgramResult>
+SolveMultiStartInverseKinematics(
+    const InverseKinematicsFactory& make_ik,
+    const Eigen::Ref<const Eigen::MatrixXd>& q_seeds,
+    const MultiStartInverseKinematicsOptions& options = {});
+
+}  // namespace multibody
+}  // namespace drake
@@ -1,8 +1,11 @@
 #include "drake/multibody/inverse_kinematics/orientation_constraint.h"
 
+#include <utility>
+
 #include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/inverse_kinematics/kinematic_evaluator_utilities.h"
 
+using drake::multibody::internal::KinematicsCache;
 using drake::multibody::internal::RefFromPtrOrThrow;
 using drake::multibody::internal::UpdateContextConfiguration;
 
@@ -56,6 +59,13 @@ OrientationConstraint::OrientationConstraint(
   }
 }
 
+void OrientationConstraint::set_kinematics_cache(
+    std::shared_ptr<KinematicsCache> kinematics_cache) {
+  DRAKE_DEMAND(!use_autodiff());
+  DRAKE_DEMAND(&kinematics_cache->context() == context_double_);
+  kinematics_cache_ = std::move(kinematics_cache);
+}
+
 namespace {
 
 void EvalConstraintGradient(const systems::Context<double>& context,
@@ -65,7 +75,8 @@ void EvalConstraintGradient(const systems::Context<double>& context,
                             const math::RotationMatrix<double>& R_AAbar,
                             const math::RotationMatrix<double>& R_AB,
                             const Eigen::Ref<const AutoDiffVecXd>& x,
-                            AutoDiffVecXd* y) {
+                            AutoDiffVecXd* y,
+                            KinematicsCache* kinematics_cache) {
   // The constraint function is
   //  g(q) = tr(R_AB(q)).
   // To derive the Jacobian of g, ∂g/∂q, we first differentiate
@@ -92,10 +103,15 @@ void EvalConstraintGradient(const systems::Context<double>& context,
   const Eigen::Matrix3d& m = R_AB.matrix();
   const Eigen::Vector3d r_AB{m(1, 2) - m(2, 1), m(2, 0) - m(0, 2),
                              m(0, 1) - m(1, 0)};
-  Eigen::MatrixXd Jq_w_AbarBbar(3, plant.num_positions());
-  plant.CalcJacobianAngularVelocity(context, JacobianWrtVariable::kQDot,
-                                    frameBbar, frameAbar, frameAbar,
-                                    &Jq_w_AbarBbar);
+  Eigen::Matrix3Xd Jq_w_AbarBbar(3, plant.num_positions());
+  if (kinematics_cache != nullptr) {
+    kinematics_cache->CalcJacobianAngularVelocity(frameBbar, frameAbar,
+                                                  frameAbar, &Jq_w_AbarBbar);
+  } else {
+    plant.CalcJacobianAngularVelocity(context, JacobianWrtVariable::kQDot,
+                                      frameBbar, frameAbar, frameAbar,
+                                      &Jq_w_AbarBbar);
+  }
   // Jq_w_AB = Jq_w_AbarBbar_A.
   const Eigen::MatrixXd Jq_w_AB = R_AAbar.matrix() * Jq_w_AbarBbar;
   (*y)(0).value() = R_AB.matrix().trace();
@@ -107,7 +123,8 @@ void DoEvalGeneric(const MultibodyPlant<T>& plant, systems::Context<T>* context,
                    FrameIndex frameAbar_index, FrameIndex frameBbar_index,
                    const math::RotationMatrix<double>& R_AAbar,
                    const math::RotationMatrix<double>& R_BbarB,
-                   const Eigen::Ref<const VectorX<S>>& x, VectorX<S>* y) {
+                   const Eigen::Ref<const VectorX<S>>& x, VectorX<S>* y,
+                   KinematicsCache* kinematics_cache = nullptr) {
   y->resize(1);
   UpdateContextConfiguration(context, plant, x);
   const Frame<T>& frameAbar = plant.get_frame(frameAbar_index);
@@ -125,7 +142,7 @@ void DoEvalGeneric(const MultibodyPlant<T>& plant, systems::Context<T>* context,
     (*y)(0) = R_AB.matrix().trace();
   } else {
     EvalConstraintGradient(*context, plant, frameAbar, frameBbar, R_AAbar, R_AB,
-                           x, y);
+                           x, y, kinematics_cache);
   }
 }
 
@@ -150,7 +167,8 @@ void OrientationConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
                   frameBbar_index_, R_AAbar_, R_BbarB_, x, y);
   } else {
     DoEvalGeneric(*plant_double_, context_double_, frameAbar_index_,
-                  frameBbar_index_, R_AAbar_, R_BbarB_, x, y);
+                  frameBbar_index_, R_AAbar_, R_BbarB_, x, y,
+                  kinematics_cache_.get());
   }
 }
 
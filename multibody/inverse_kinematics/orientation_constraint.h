@@ -8,6 +8,10 @@
 
 namespace drake {
 namespace multibody {
+namespace internal {
+class KinematicsCache;
+}  // namespace internal
+
 /**
  * Constrains that the angle difference θ between the orientation of frame A
  * and the orientation of frame B to satisfy θ ≤ θ_bound. The angle
@@ -83,6 +87,12 @@ class OrientationConstraint : public solvers::Constraint {
   ~OrientationConstraint() override {}
 
  private:
+  friend class InverseKinematics;
+
+  // Set by InverseKinematics; see internal::KinematicsCache.
+  void set_kinematics_cache(
+      std::shared_ptr<internal::KinematicsCache> kinematics_cache);
+
   void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
               Eigen::VectorXd* y) const override;
 
@@ -107,6 +117,7 @@ class OrientationConstraint : public solvers::Constraint {
 
   const MultibodyPlant<AutoDiffXd>* const plant_autodiff_;
   systems::Context<AutoDiffXd>* context_autodiff_;
+  std::shared_ptr<internal::KinematicsCache> kinematics_cache_;
 };
 }  // namespace multibody
 }  // namespace drake
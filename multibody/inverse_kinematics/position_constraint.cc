@@ -1,8 +1,11 @@
 #include "drake/multibody/inverse_kinematics/position_constraint.h"
 
+#include <utility>
+
 #include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/inverse_kinematics/kinematic_evaluator_utilities.h"
 
+using drake::multibody::internal::KinematicsCache;
 using drake::multibody::internal::RefFromPtrOrThrow;
 using drake::multibody::internal::UpdateContextConfiguration;
 
@@ -78,16 +81,29 @@ PositionConstraint::PositionConstraint(
     : PositionConstraint(plant, frameA, std::nullopt, p_AQ_lower, p_AQ_upper,
                          frameB, p_BQ, plant_context) {}
 
+void PositionConstraint::set_kinematics_cache(
+    std::shared_ptr<KinematicsCache> kinematics_cache) {
+  DRAKE_DEMAND(!use_autodiff());
+  DRAKE_DEMAND(&kinematics_cache->context() == context_double_);
+  kinematics_cache_ = std::move(kinematics_cache);
+}
+
 void EvalConstraintGradient(
     const systems::Context<double>& context,
     const MultibodyPlant<double>& plant, const Frame<double>& frameAbar,
     const math::RigidTransformd& X_AAbar, const Frame<double>& frameB,
     const Eigen::Vector3d& p_AQ, const Eigen::Vector3d& p_BQ,
-    const Eigen::Ref<const AutoDiffVecXd>& x, AutoDiffVecXd* y) {
+    const Eigen::Ref<const AutoDiffVecXd>& x, AutoDiffVecXd* y,
+    KinematicsCache* kinematics_cache) {
   Eigen::Matrix3Xd Jq_V_AbarBq(3, plant.num_positions());
-  plant.CalcJacobianTranslationalVelocity(context, JacobianWrtVariable::kQDot,
-                                          frameB, p_BQ, frameAbar, frameAbar,
-                                          &Jq_V_AbarBq);
+  if (kinematics_cache != nullptr) {
+    kinematics_cache->CalcJacobianTranslationalVelocity(
+        frameB, p_BQ, frameAbar, frameAbar, &Jq_V_AbarBq);
+  } else {
+    plant.CalcJacobianTranslationalVelocity(
+        context, JacobianWrtVariable::kQDot, frameB, p_BQ, frameAbar,
+        frameAbar, &Jq_V_AbarBq);
+  }
   *y =
       math::InitializeAutoDiff(p_AQ, X_AAbar.rotation().matrix() * Jq_V_AbarBq *
                                          math::ExtractGradient(x));
@@ -98,7 +114,8 @@ void DoEvalGeneric(const MultibodyPlant<T>& plant, systems::Context<T>* context,
                    const FrameIndex frameAbar_index,
                    const math::RigidTransformd& X_AAbar,
                    const FrameIndex frameB_index, const Eigen::Vector3d& p_BQ,
-                   const Eigen::Ref<const VectorX<S>>& x, VectorX<S>* y) {
+                   const Eigen::Ref<const VectorX<S>>& x, VectorX<S>* y,
+                   KinematicsCache* kinematics_cache = nullptr) {
   y->resize(3);
   UpdateContextConfiguration(context, plant, x);
   const Frame<T>& frameAbar = plant.get_frame(frameAbar_index);
@@ -110,7 +127,7 @@ void DoEvalGeneric(const MultibodyPlant<T>& plant, systems::Context<T>* context,
     *y = X_AAbar.cast<S>() * p_AbarQ;
   } else {
     EvalConstraintGradient(*context, plant, frameAbar, X_AAbar, frameB,
-                           X_AAbar * p_AbarQ, p_BQ, x, y);
+                           X_AAbar * p_AbarQ, p_BQ, x, y, kinematics_cache);
   }
 }
 
@@ -130,7 +147,7 @@ void PositionConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
                                 AutoDiffVecXd* y) const {
   if (!use_autodiff()) {
     DoEvalGeneric(*plant_double_, context_double_, frameAbar_index_, X_AAbar_,
-                  frameB_index_, p_BQ_, x, y);
+                  frameB_index_, p_BQ_, x, y, kinematics_cache_.get());
   } else {
     DoEvalGeneric(*plant_autodiff_, context_autodiff_, frameAbar_index_,
                   X_AAbar_, frameB_index_, p_BQ_, x, y);
@@ -9,6 +9,10 @@
 
 namespace drake {
 namespace multibody {
+namespace internal {
+class KinematicsCache;
+}  // namespace internal
+
 /**
  * Constrains the position of a point Q, rigidly attached to a frame B, to be
  * within a bounding box measured and expressed in frame A. Namely
@@ -119,6 +123,13 @@ class PositionConstraint : public solvers::Constraint {
   using Constraint::UpdateUpperBound;
 
  private:
+  friend class InverseKinematics;
+
+  // Used by InverseKinematics to share memoized Jacobians between the
+  // constraints bound to its context.
+  void set_kinematics_cache(
+      std::shared_ptr<internal::KinematicsCache> kinematics_cache);
+
   void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
               Eigen::VectorXd* y) const override;
 
@@ -142,6 +153,7 @@ class PositionConstraint : public solvers::Constraint {
 
   const MultibodyPlant<AutoDiffXd>* const plant_autodiff_;
   systems::Context<AutoDiffXd>* const context_autodiff_;
+  std::shared_ptr<internal::KinematicsCache> kinematics_cache_;
 };
 }  // namespace multibody
 }  // namespace drake
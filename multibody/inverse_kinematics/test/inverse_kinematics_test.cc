@@ -4,8 +4,13 @@
 
 #include "drake/common/find_resource.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/autodiff_gradient.h"
 #include "drake/math/rotation_matrix.h"
 #include "drake/math/wrap_to.h"
+#include "drake/multibody/inverse_kinematics/gaze_target_constraint.h"
+#include "drake/multibody/inverse_kinematics/kinematic_evaluator_utilities.h"
+#include "drake/multibody/inverse_kinematics/orientation_constraint.h"
+#include "drake/multibody/inverse_kinematics/position_constraint.h"
 #include "drake/multibody/inverse_kinematics/test/inverse_kinematics_test_utilities.h"
 #include "drake/solvers/create_constraint.h"
 #include "drake/solvers/solve.h"
@@ -284,6 +289,105 @@ TEST_F(TwoFreeBodiesTest, GazeTargetConstraint) {
             std::cos(cone_half_angle) * p_ST_A.norm() * n_A.norm() - 1E-3);
 }
 
+TEST_F(TwoFreeBodiesTest, KinematicsCache) {
+  auto context = two_bodies_plant_->CreateDefaultContext();
+  internal::KinematicsCache cache(two_bodies_plant_.get(), context.get());
+  const Eigen::Vector3d p_BQ(0.2, -0.3, 0.5);
+  const double tol = 1E-12;
+
+  auto check_jacobians = [&]() {
+    for (const auto* frame_A : {&body1_frame_, &body2_frame_,
+                                &two_bodies_plant_->world_frame()}) {
+      for (const auto* frame_B : {&body1_frame_, &body2_frame_}) {
+        Eigen::Matrix3Xd J_expected(3, two_bodies_plant_->num_positions());
+        Eigen::Matrix3Xd J(3, two_bodies_plant_->num_positions());
+        two_bodies_plant_->CalcJacobianTranslationalVelocity(
+            *context, JacobianWrtVariable::kQDot, *frame_B, p_BQ, *frame_A,
+            body1_frame_, &J_expected);
+        cache.CalcJacobianTranslationalVelocity(*frame_B, p_BQ, *frame_A,
+                                                body1_frame_, &J);
+        EXPECT_TRUE(CompareMatrices(J, J_expected, tol));
+        two_bodies_plant_->CalcJacobianAngularVelocity(
+            *context, JacobianWrtVariable::kQDot, *frame_B, *frame_A,
+            body2_frame_, &J_expected);
+        cache.CalcJacobianAngularVelocity(*frame_B, *frame_A, body2_frame_,
+                                          &J);
+        EXPECT_TRUE(CompareMatrices(J, J_expected, tol));
+      }
+    }
+  };
+
+  Eigen::VectorXd q(two_bodies_plant_->num_positions());
+  q << Eigen::Vector4d(0.1, -0.3, 0.4, 0.7).normalized(), 0.2, -0.5, 1.1,
+      Eigen::Vector4d(-0.5, 0.2, 0.6, 0.1).normalized(), -0.4, 0.3, 0.8;
+  two_bodies_plant_->SetPositions(context.get(), q);
+  check_jacobians();
+  // The memoized Jacobians must be recomputed once q changes.
+  q.head<4>() = Eigen::Vector4d(0.9, 0.1, -0.2, 0.3).normalized();
+  q.tail<3>() << 1.2, -0.1, 0.4;
+  two_bodies_plant_->SetPositions(context.get(), q);
+  check_jacobians();
+}
+
+TEST_F(TwoFreeBodiesTest, SharedKinematicsCacheGradients) {
+  // The constraints added through InverseKinematics share one kinematics cache.
+  // Their values and gradients must match those of standalone constraints,
+  // which evaluate the plant Jacobians on their own.
+  const Eigen::Vector3d p_BQ(0.2, 0.3, 0.5);
+  const Eigen::Vector3d p_AQ_lower(-0.1, -0.2, -0.3);
+  const Eigen::Vector3d p_AQ_upper(-0.05, -0.12, -0.28);
+  const math::RotationMatrix<double> R_AbarA(
+      math::RollPitchYaw<double>(0.2, -0.4, 1.1));
+  const math::RotationMatrix<double> R_BbarB(
+      math::RollPitchYaw<double>(-0.3, 0.5, 0.7));
+  const double angle_bound = 0.05 * M_PI;
+  const Eigen::Vector3d p_AS(0.01, 0.2, 0.4);
+  const Eigen::Vector3d n_A(0.2, 0.4, -0.1);
+  const Eigen::Vector3d p_BT(0.4, -0.2, 1.5);
+  const double cone_half_angle{0.2 * M_PI};
+
+  std::vector<solvers::Binding<solvers::Constraint>> bindings;
+  bindings.push_back(ik_.AddPositionConstraint(body1_frame_, p_BQ, body2_frame_,
+                                               p_AQ_lower, p_AQ_upper));
+  bindings.push_back(ik_.AddOrientationConstraint(
+      body1_frame_, R_AbarA, body2_frame_, R_BbarB, angle_bound));
+  bindings.push_back(ik_.AddGazeTargetConstraint(
+      body1_frame_, p_AS, n_A, body2_frame_, p_BT, cone_half_angle));
+
+  auto context = two_bodies_plant_->CreateDefaultContext();
+  const PositionConstraint position_constraint(
+      two_bodies_plant_.get(), body2_frame_, p_AQ_lower, p_AQ_upper,
+      body1_frame_, p_BQ, context.get());
+  const OrientationConstraint orientation_constraint(
+      two_bodies_plant_.get(), body1_frame_, R_AbarA, body2_frame_, R_BbarB,
+      angle_bound, context.get());
+  const GazeTargetConstraint gaze_target_constraint(
+      two_bodies_plant_.get(), body1_frame_, p_AS, n_A, body2_frame_, p_BT,
+      cone_half_angle, context.get());
+  const std::vector<const solvers::Constraint*> standalone{
+      &position_constraint, &orientation_constraint, &gaze_target_constraint};
+
+  auto check_gradients = [&](const Eigen::VectorXd& q) {
+    const AutoDiffVecXd q_autodiff = math::InitializeAutoDiff(q);
+    for (int i = 0; i < static_cast<int>(bindings.size()); ++i) {
+      AutoDiffVecXd y, y_expected;
+      bindings[i].evaluator()->Eval(q_autodiff, &y);
+      standalone[i]->Eval(q_autodiff, &y_expected);
+      EXPECT_TRUE(CompareMatrices(math::ExtractValue(y),
+                                  math::ExtractValue(y_expected), 1E-12));
+      EXPECT_TRUE(CompareMatrices(math::ExtractGradient(y),
+                                  math::ExtractGradient(y_expected), 1E-12));
+    }
+  };
+
+  Eigen::VectorXd q(two_bodies_plant_->num_positions());
+  q << Eigen::Vector4d(0.1, -0.3, 0.4, 0.7).normalized(), 0.2, -0.5, 1.1,
+      Eigen::Vector4d(-0.5, 0.2, 0.6, 0.1).normalized(), -0.4, 0.3, 0.8;
+  check_gradients(q);
+  q.segment<3>(4) << 0.3, 1.2, -0.7;
+  check_gradients(q);
+}
+
 TEST_F(TwoFreeBodiesTest, AngleBetweenVectorsConstraint) {
   const Eigen::Vector3d n_A(0.2, -0.4, 0.9);
   const Eigen::Vector3d n_B(1.4, -0.1, 1.8);
@@ -0,0 +1,174 @@
+#include "drake/multibody/inverse_kinematics/multi_start_inverse_kinematics.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/multibody/inverse_kinematics/test/inverse_kinematics_test_utilities.h"
+#include "drake/solvers/choose_best_solver.h"
+#include "drake/solvers/ipopt_solver.h"
+#include "drake/solvers/nlopt_solver.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+class MultiStartInverseKinematicsTest : public ::testing::Test {
+ public:
+  MultiStartInverseKinematicsTest()
+      : plant_(ConstructTwoFreeBodiesPlant<double>()) {
+    const int num_seeds = 8;
+    q_seeds_.resize(plant_->num_positions(), num_seeds);
+    for (int i = 0; i < num_seeds; ++i) {
+      q_seeds_.col(i) << Eigen::Vector4d::Random().normalized(),
+          Eigen::Vector3d::Random(), Eigen::Vector4d::Random().normalized(),
+          Eigen::Vector3d::Random();
+    }
+  }
+
+  std::unique_ptr<InverseKinematics> MakeInverseKinematics() const {
+    auto ik = std::make_unique<InverseKinematics>(*plant_);
+    ik->AddPositionConstraint(plant_->GetFrameByName("body1"), p_BQ_,
+                              plant_->GetFrameByName("body2"),
+                              p_AQ_ - Eigen::Vector3d::Constant(0.01),
+                              p_AQ_ + Eigen::Vector3d::Constant(0.01));
+    ik->get_mutable_prog()->AddQuadraticErrorCost(
+        Eigen::MatrixXd::Identity(plant_->num_positions(),
+                                  plant_->num_positions()),
+        q_seeds_.col(0), ik->q());
+    return ik;
+  }
+
+ protected:
+  std::unique_ptr<MultibodyPlant<double>> plant_;
+  const Eigen::Vector3d p_BQ_{0.2, 0.3, 0.5};
+  const Eigen::Vector3d p_AQ_{-0.1, 0.4, 0.2};
+  Eigen::MatrixXd q_seeds_;
+};
+
+TEST_F(MultiStartInverseKinematicsTest, SolveAllSeeds) {
+  for (int num_parallel_executions : {1, 4}) {
+    MultiStartInverseKinematicsOptions options;
+    options.num_parallel_executions = num_parallel_executions;
+    const std::vector<solvers::MathematicalProgramResult> results =
+        SolveMultiStartInverseKinematics(
+            [this]() {
+              return MakeInverseKinematics();
+            },
+            q_seeds_, options);
+    ASSERT_EQ(results.size(), q_seeds_.cols());
+    for (int i = 0; i < static_cast<int>(results.size()); ++i) {
+      ASSERT_TRUE(results[i].is_success());
+      if (i > 0) {
+        EXPECT_LE(results[i - 1].get_optimal_cost(),
+                  results[i].get_optimal_cost());
+      }
+      // The position constraint holds at the solution.
+      auto context = plant_->CreateDefaultContext();
+      plant_->SetPositions(
+          context.get(), results[i].get_x_val().head(plant_->num_positions()));
+      Eigen::Vector3d p_AQ;
+      plant_->CalcPointsPositions(
+          *context, plant_->GetFrameByName("body1"), p_BQ_,
+          plant_->GetFrameByName("body2"), &p_AQ);
+      EXPECT_TRUE(((p_AQ - p_AQ_).array().abs() <= 0.01 + 1E-6).all());
+    }
+  }
+}
+
+TEST_F(MultiStartInverseKinematicsTest, EarlyTermination) {
+  MultiStartInverseKinematicsOptions options;
+  options.num_feasible_solutions = 2;
+  const std::vector<solvers::MathematicalProgramResult> results =
+      SolveMultiStartInverseKinematics(
+          [this]() {
+            return MakeInverseKinematics();
+          },
+          q_seeds_, options);
+  // With a single execution, seeds are solved in order and no more seeds are
+  // started once two of them succeeded.
+  ASSERT_EQ(results.size(), 2);
+  EXPECT_TRUE(results[0].is_success());
+  EXPECT_TRUE(results[1].is_success());
+
+  options.num_parallel_executions = 3;
+  const std::vector<solvers::MathematicalProgramResult> parallel_results =
+      SolveMultiStartInverseKinematics(
+          [this]() {
+            return MakeInverseKinematics();
+          },
+          q_seeds_, options);
+  // Seeds already in progress still complete, so at most one extra result
+  // per parallel execution.
+  EXPECT_GE(parallel_results.size(), 2);
+  EXPECT_LE(parallel_results.size(), 2 + 3);
+}
+
+// IPOPT is not thread-safe, so when it is set as the solver its seeds are
+// solved serially. Just like with a single execution, no seed is then started
+// once two of them succeeded.
+TEST_F(MultiStartInverseKinematicsTest, IpoptIsSerial) {
+  if (!solvers::IpoptSolver::is_available()) {
+    return;
+  }
+  MultiStartInverseKinematicsOptions options;
+  options.num_parallel_executions = 3;
+  options.num_feasible_solutions = 2;
+  options.solver_id = solvers::IpoptSolver::id();
+  int num_calls = 0;
+  const InverseKinematicsFactory make_ik = [this, &num_calls]() {
+    ++num_calls;
+    return MakeInverseKinematics();
+  };
+  const std::vector<solvers::MathematicalProgramResult> results =
+      SolveMultiStartInverseKinematics(make_ik, q_seeds_, options);
+  EXPECT_EQ(num_calls, 1);
+  ASSERT_EQ(results.size(), 2);
+  EXPECT_EQ(results[0].get_solver_id(), solvers::IpoptSolver::id());
+}
+
+// When IPOPT is the solver chosen for the problem, NLopt is used instead so
+// that the seeds can still be solved in parallel.
+TEST_F(MultiStartInverseKinematicsTest, ChosenIpoptIsReplaced) {
+  if (solvers::ChooseBestSolver(MakeInverseKinematics()->prog()) !=
+          solvers::IpoptSolver::id() ||
+      !solvers::NloptSolver::is_available()) {
+    return;
+  }
+  MultiStartInverseKinematicsOptions options;
+  options.num_parallel_executions = 3;
+  int num_calls = 0;
+  const InverseKinematicsFactory make_ik = [this, &num_calls]() {
+    ++num_calls;
+    return MakeInverseKinematics();
+  };
+  const std::vector<solvers::MathematicalProgramResult> results =
+      SolveMultiStartInverseKinematics(make_ik, q_seeds_, options);
+  EXPECT_EQ(num_calls, 3);
+  ASSERT_EQ(results.size(), q_seeds_.cols());
+  for (const auto& result : results) {
+    EXPECT_EQ(result.get_solver_id(), solvers::NloptSolver::id());
+  }
+}
+
+TEST_F(MultiStartInverseKinematicsTest, InvalidArguments) {
+  const InverseKinematicsFactory make_ik = [this]() {
+    return MakeInverseKinematics();
+  };
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SolveMultiStartInverseKinematics(make_ik, q_seeds_.topRows(3)),
+      ".*q_seeds has 3 rows, but the plant has 14 positions.");
+  MultiStartInverseKinematicsOptions options;
+  options.num_parallel_executions = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SolveMultiStartInverseKinematics(make_ik, q_seeds_, options),
+      ".*num_parallel_executions = 0 is not valid.*");
+  options.num_parallel_executions = 1;
+  options.num_feasible_solutions = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SolveMultiStartInverseKinematics(make_ik, q_seeds_, options),
+      ".*num_feasible_solutions = 0 must be >= 1.");
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -2,6 +2,7 @@
 
 #include <unordered_map>
 
+#include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/inverse_kinematics/kinematic_evaluator_utilities.h"
 
 namespace drake {
@@ -31,13 +32,95 @@ ManipulatorEquationConstraint::ManipulatorEquationConstraint(
               GetLambdaSize(contact_pair_to_wrench_evaluator) + 1 /* for dt */,
           Eigen::VectorXd::Zero(plant->num_velocities()),
           Eigen::VectorXd::Zero(plant->num_velocities())),
+      plant_double_{nullptr},
+      context_double_{nullptr},
       plant_{plant},
       context_{context},
       contact_pair_to_wrench_evaluator_(contact_pair_to_wrench_evaluator),
-      B_actuation_{plant_->MakeActuationMatrix()} {}
+      B_actuation_{plant->MakeActuationMatrix()} {}
+
+ManipulatorEquationConstraint::ManipulatorEquationConstraint(
+    const MultibodyPlant<double>* plant, systems::Context<double>* context)
+    : solvers::Constraint(
+          plant->num_velocities(),
+          plant->num_velocities() + plant->num_positions() +
+              plant->num_velocities() + plant->num_actuated_dofs() +
+              1 /* for dt */,
+          Eigen::VectorXd::Zero(plant->num_velocities()),
+          Eigen::VectorXd::Zero(plant->num_velocities())),
+      plant_double_{plant},
+      context_double_{context},
+      plant_{nullptr},
+      context_{nullptr},
+      B_actuation_double_{plant->MakeActuationMatrix()} {
+  if (plant->num_positions() != plant->num_velocities()) {
+    throw std::invalid_argument(
+        "ManipulatorEquationConstraint: the MultibodyPlant<double> overload "
+        "requires qdot = v; the plant has floating bodies or joints with "
+        "num_positions() != num_velocities().");
+  }
+}
+
+// With Δv = vₙ₊₁ - vₙ, the constraint is
+//   y = (Bu + tau_g(q) - C(q, vₙ₊₁)vₙ₊₁) dt - M(q)Δv
+//     = Bu dt - (ID(q, vₙ₊₁, 0) dt + M(q)Δv),
+// where ID(q, v, v̇) = M(q)v̇ + C(q, v)v - tau_g(q) is the inverse dynamics.
+// Since ID is affine in v̇, ∂(M(q)Δv)/∂q = ∂ID(q, vₙ₊₁, Δv)/∂q -
+// ∂ID(q, vₙ₊₁, 0)/∂q.
+void ManipulatorEquationConstraint::EvalWithAnalyticalGradient(
+    const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+    Eigen::MatrixXd* dy_dx) const {
+  const int nq = plant_double_->num_positions();
+  const int nv = plant_double_->num_velocities();
+  const int nu = plant_double_->num_actuated_dofs();
+  const auto& v = x.head(nv);
+  const auto& qv_next = x.segment(nv, nq + nv);
+  const auto& v_next = x.segment(nv + nq, nv);
+  const auto& u_next = x.segment(nv + nq + nv, nu);
+  const double time_step = x(x.rows() - 1);
+
+  UpdateContextPositionsAndVelocities(context_double_, *plant_double_,
+                                      qv_next);
+  Eigen::VectorXd C_bias(nv);
+  plant_double_->CalcBiasTerm(*context_double_, &C_bias);
+  // ID(q, vₙ₊₁, 0) = C(q, vₙ₊₁)vₙ₊₁ - tau_g(q).
+  const Eigen::VectorXd id_zero =
+      C_bias - plant_double_->CalcGravityGeneralizedForces(*context_double_);
+  const Eigen::VectorXd Bu = B_actuation_double_ * u_next;
+
+  Eigen::MatrixXd did_dq(nv, nq);
+  Eigen::MatrixXd did_dv(nv, nv);
+  Eigen::MatrixXd M(nv, nv);
+  plant_double_->CalcInverseDynamicsDerivatives(
+      *context_double_, Eigen::VectorXd::Zero(nv), &did_dq, &did_dv, &M);
+  const Eigen::VectorXd delta_v = v_next - v;
+  *y = (Bu - id_zero) * time_step - M * delta_v;
+  if (dy_dx == nullptr) {
+    return;
+  }
+
+  Eigen::MatrixXd did_dq_delta_v(nv, nq);
+  Eigen::MatrixXd unused_did_dv(nv, nv);
+  Eigen::MatrixXd unused_M(nv, nv);
+  plant_double_->CalcInverseDynamicsDerivatives(*context_double_, delta_v,
+                                                &did_dq_delta_v,
+                                                &unused_did_dv, &unused_M);
+
+  dy_dx->resize(nv, num_vars());
+  dy_dx->block(0, 0, nv, nv) = M;
+  dy_dx->block(0, nv, nv, nq) =
+      -time_step * did_dq - (did_dq_delta_v - did_dq);
+  dy_dx->block(0, nv + nq, nv, nv) = -time_step * did_dv - M;
+  dy_dx->block(0, nv + nq + nv, nv, nu) = B_actuation_double_ * time_step;
+  dy_dx->col(num_vars() - 1) = Bu - id_zero;
+}
 
 void ManipulatorEquationConstraint::DoEval(
     const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y) const {
+  if (!use_autodiff()) {
+    EvalWithAnalyticalGradient(x, y, nullptr);
+    return;
+  }
   AutoDiffVecXd y_autodiff(num_constraints());
   DoEval(x.cast<AutoDiffXd>(), &y_autodiff);
   *y = math::ExtractValue(y_autodiff);
@@ -50,6 +133,13 @@ void ManipulatorEquationConstraint::DoEval(
 //  StaticEquilibriumConstraint.
 void ManipulatorEquationConstraint::DoEval(
     const Eigen::Ref<const AutoDiffVecXd>& x, AutoDiffVecXd* y) const {
+  if (!use_autodiff()) {
+    Eigen::VectorXd y_val;
+    Eigen::MatrixXd dy_dx;
+    EvalWithAnalyticalGradient(math::ExtractValue(x), &y_val, &dy_dx);
+    *y = math::InitializeAutoDiff(y_val, dy_dx * math::ExtractGradient(x));
+    return;
+  }
   const auto num_positions = plant_->num_positions();
   const auto num_velocities = plant_->num_velocities();
   const auto& v = x.head(num_velocities);
@@ -256,5 +346,33 @@ ManipulatorEquationConstraint::MakeBinding(
   return solvers::Binding<ManipulatorEquationConstraint>(
       manipulator_equation_constraint, bound_x);
 }
+
+solvers::Binding<ManipulatorEquationConstraint>
+ManipulatorEquationConstraint::MakeBinding(
+    const MultibodyPlant<double>* plant, systems::Context<double>* context,
+    const Eigen::Ref<const VectorX<symbolic::Variable>>& v_vars,
+    const Eigen::Ref<const VectorX<symbolic::Variable>>& q_next_vars,
+    const Eigen::Ref<const VectorX<symbolic::Variable>>& v_next_vars,
+    const Eigen::Ref<const VectorX<symbolic::Variable>>& u_next_vars,
+    const symbolic::Variable& dt_var) {
+  DRAKE_DEMAND(v_vars.rows() == plant->num_velocities());
+  DRAKE_DEMAND(q_next_vars.rows() == plant->num_positions());
+  DRAKE_DEMAND(v_next_vars.rows() == plant->num_velocities());
+  DRAKE_DEMAND(u_next_vars.rows() == plant->num_actuated_dofs());
+
+  // The bound variable for this ManipulatorEquationConstraint is
+  // bound_x = {v, q_next, v_next, u_next, dt}.
+  VectorX<symbolic::Variable> bound_x(
+      plant->num_velocities() + plant->num_positions() +
+      plant->num_velocities() + plant->num_actuated_dofs() + 1);
+  bound_x << v_vars, q_next_vars, v_next_vars, u_next_vars, dt_var;
+  auto manipulator_equation_constraint =
+      // Do not call make_shared because the constructor
+      // ManipulatorEquationConstraint is private.
+      std::shared_ptr<ManipulatorEquationConstraint>(
+          new ManipulatorEquationConstraint(plant, context));
+  return solvers::Binding<ManipulatorEquationConstraint>(
+      manipulator_equation_constraint, bound_x);
+}
 }  // namespace multibody
 }  // namespace drake
@@ -63,6 +63,34 @@ class ManipulatorEquationConstraint final : public solvers::Constraint {
       const Eigen::Ref<const VectorX<symbolic::Variable>>& u_next_vars,
       const symbolic::Variable& dt_var);
 
+  /**
+   * Overloaded MakeBinding() for a MultibodyPlant<double> without contact.
+   * This constraint depends on the decision variable vector:
+   * {vₙ, qₙ₊₁, vₙ₊₁, uₙ₊₁, dt}.
+   * Instead of propagating AutoDiffXd scalars through the plant, the gradient
+   * of the constraint is computed from the analytical derivatives in
+   * MultibodyPlant::CalcInverseDynamicsDerivatives(), hence @p plant must
+   * satisfy the requirements of that method (only revolute, prismatic and
+   * weld joints).
+   * @param plant The plant on which the constraint is imposed.
+   * @param context The context for the subsystem @p plant. This context stores
+   * the next state {qₙ₊₁, vₙ₊₁}.
+   * @param v_vars The decision variables for vₙ.
+   * @param q_next_vars The decision variables for qₙ₊₁.
+   * @param v_next_vars The decision variables for vₙ₊₁.
+   * @param u_next_vars The decision variables for uₙ₊₁.
+   * @param dt_var The decision variable for dt.
+   * @return binding The binding between the manipulator equation constraint
+   * and the variables vₙ, qₙ₊₁, vₙ₊₁, uₙ₊₁ and dt.
+   */
+  static solvers::Binding<ManipulatorEquationConstraint> MakeBinding(
+      const MultibodyPlant<double>* plant, systems::Context<double>* context,
+      const Eigen::Ref<const VectorX<symbolic::Variable>>& v_vars,
+      const Eigen::Ref<const VectorX<symbolic::Variable>>& q_next_vars,
+      const Eigen::Ref<const VectorX<symbolic::Variable>>& v_next_vars,
+      const Eigen::Ref<const VectorX<symbolic::Variable>>& u_next_vars,
+      const symbolic::Variable& dt_var);
+
   ~ManipulatorEquationConstraint() override {}
 
   /**
@@ -86,6 +114,17 @@ class ManipulatorEquationConstraint final : public solvers::Constraint {
                      GeometryPairContactWrenchEvaluatorBinding>&
           contact_pair_to_wrench_evaluator);
 
+  ManipulatorEquationConstraint(const MultibodyPlant<double>* plant,
+                                systems::Context<double>* context);
+
+  bool use_autodiff() const { return plant_ != nullptr; }
+
+  // Evaluates the constraint and its gradient with respect to x using the
+  // analytical inverse dynamics derivatives of plant_double_.
+  void EvalWithAnalyticalGradient(const Eigen::Ref<const Eigen::VectorXd>& x,
+                                  Eigen::VectorXd* y,
+                                  Eigen::MatrixXd* dy_dx) const;
+
   void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
               Eigen::VectorXd* y) const final;
   void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
@@ -93,12 +132,17 @@ class ManipulatorEquationConstraint final : public solvers::Constraint {
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
               VectorX<symbolic::Expression>* y) const final;
 
+  const MultibodyPlant<double>* const plant_double_;
+  systems::Context<double>* const context_double_;
   const MultibodyPlant<AutoDiffXd>* const plant_;
   systems::Context<AutoDiffXd>* const context_;
   const std::map<SortedPair<geometry::GeometryId>,
                  GeometryPairContactWrenchEvaluatorBinding>
       contact_pair_to_wrench_evaluator_;
+  // Only one of B_actuation_ and B_actuation_double_ is non-empty, depending
+  // on the scalar type of the plant.
   const MatrixX<AutoDiffXd> B_actuation_;
+  const Eigen::MatrixXd B_actuation_double_;
 };
 
 }  // namespace multibody
@@ -2,10 +2,12 @@
 
 #include <gtest/gtest.h>
 
+#include "drake/common/find_resource.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/math/autodiff_gradient.h"
 #include "drake/math/compute_numerical_gradient.h"
 #include "drake/multibody/optimization/test/optimization_with_contact_utilities.h"
+#include "drake/multibody/parsing/parser.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/solve.h"
 
@@ -413,6 +415,77 @@ TEST_F(TwoFreeSpheresTest, Eval) {
   EXPECT_TRUE(CompareMatrices(sphere0_total_wrench, lhs.head<6>(), tol));
   EXPECT_TRUE(CompareMatrices(sphere1_total_wrench, lhs.tail<6>(), tol));
 }
+
+// Tests the MultibodyPlant<double> overload, whose gradient is computed from
+// the analytical inverse dynamics derivatives. The expected value and gradient
+// are computed with MultibodyPlant<AutoDiffXd>.
+GTEST_TEST(ManipulatorEquationConstraintDoubleTest, IiwaEval) {
+  MultibodyPlant<double> plant(0.0);
+  Parser(&plant).AddModelFromFile(FindResourceOrThrow(
+      "drake/manipulation/models/iiwa_description/sdf/"
+      "iiwa14_no_collision.sdf"));
+  plant.WeldFrames(plant.world_frame(), plant.GetFrameByName("iiwa_link_0"));
+  plant.Finalize();
+  auto context = plant.CreateDefaultContext();
+  const int nq = plant.num_positions();
+  const int nv = plant.num_velocities();
+  const int nu = plant.num_actuated_dofs();
+
+  solvers::MathematicalProgram prog;
+  const auto v_vars = prog.NewContinuousVariables(nv, "v");
+  const auto q_next_vars = prog.NewContinuousVariables(nq, "q_next");
+  const auto v_next_vars = prog.NewContinuousVariables(nv, "v_next");
+  const auto u_next_vars = prog.NewContinuousVariables(nu, "u_next");
+  const symbolic::Variable dt_var = prog.NewContinuousVariables(1, "dt")(0);
+  const auto binding = ManipulatorEquationConstraint::MakeBinding(
+      &plant, context.get(), v_vars, q_next_vars, v_next_vars, u_next_vars,
+      dt_var);
+  EXPECT_EQ(binding.evaluator()->num_vars(), nv + nq + nv + nu + 1);
+  EXPECT_EQ(binding.evaluator()->num_constraints(), nv);
+  EXPECT_TRUE(binding.evaluator()->contact_pair_to_wrench_evaluator().empty());
+
+  std::unique_ptr<MultibodyPlant<AutoDiffXd>> plant_autodiff =
+      systems::System<double>::ToAutoDiffXd(plant);
+  auto context_autodiff = plant_autodiff->CreateDefaultContext();
+  const MatrixX<AutoDiffXd> B = plant_autodiff->MakeActuationMatrix();
+
+  for (const double dt_val : {0.1, 0.0}) {
+    Eigen::VectorXd x_val(nv + nq + nv + nu + 1);
+    x_val << 0.1, -0.2, 0.3, -0.4, 0.5, -0.6, 0.7,  // v
+        0.2, -0.5, 0.4, -1.2, 0.3, 0.8, -0.1,       // q_next
+        -0.3, 0.6, 0.1, 0.5, -0.4, 0.2, 0.9,        // v_next
+        1.0, -2.0, 3.0, -1.5, 0.5, 0.2, -0.3,       // u_next
+        dt_val;
+    const AutoDiffVecXd x_autodiff = math::InitializeAutoDiff(x_val);
+    const auto v = x_autodiff.head(nv);
+    const auto v_next = x_autodiff.segment(nv + nq, nv);
+    const auto u_next = x_autodiff.segment(nv + nq + nv, nu);
+    const AutoDiffXd& dt = x_autodiff(x_autodiff.rows() - 1);
+    plant_autodiff->SetPositions(context_autodiff.get(),
+                                 x_autodiff.segment(nv, nq));
+    plant_autodiff->SetVelocities(context_autodiff.get(), v_next);
+    VectorX<AutoDiffXd> C_bias(nv);
+    plant_autodiff->CalcBiasTerm(*context_autodiff, &C_bias);
+    MatrixX<AutoDiffXd> M(nv, nv);
+    plant_autodiff->CalcMassMatrixViaInverseDynamics(*context_autodiff, &M);
+    const AutoDiffVecXd y_expected =
+        (B * u_next +
+         plant_autodiff->CalcGravityGeneralizedForces(*context_autodiff) -
+         C_bias) * dt -
+        M * (v_next - v);
+
+    AutoDiffVecXd y_autodiff;
+    binding.evaluator()->Eval(x_autodiff, &y_autodiff);
+    Eigen::VectorXd y_val;
+    binding.evaluator()->Eval(x_val, &y_val);
+    const double tol = 1000 * kEps;
+    EXPECT_TRUE(CompareMatrices(y_val, math::ExtractValue(y_expected), tol));
+    EXPECT_TRUE(CompareMatrices(math::ExtractValue(y_autodiff),
+                                math::ExtractValue(y_expected), tol));
+    EXPECT_TRUE(CompareMatrices(math::ExtractGradient(y_autodiff),
+                                math::ExtractGradient(y_expected), tol));
+  }
+}
 }  // namespace
 }  // namespace multibody
 }  // namespace drake
@@ -3062,6 +3062,82 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     return internal_tree().CalcGravityGeneralizedForces(context);
   }
 
+  /// Computes the partial derivatives of the inverse dynamics
+  /// <pre>
+  ///   tau_id = ID(q, v, v̇) = M(q)v̇ + C(q, v)v - tau_g(q)
+  /// </pre>
+  /// with respect to q, v and v̇, evaluated at the generalized positions and
+  /// velocities stored in `context` and at the given `known_vdot`. Reflected
+  /// inertias (see JointActuator::reflected_inertia()) are included in M(q)
+  /// as in CalcInverseDynamics(), and so is gravity. Other force elements and
+  /// externally applied forces are not included.
+  ///
+  /// The derivatives are computed analytically in O(n⋅d²) operations, with n
+  /// the number of bodies and d the depth of the tree (each body contributes
+  /// to the d×d block of the mobilities inboard of it), plus the O(n²) cost of
+  /// zeroing the dense outputs. This avoids the overhead of propagating
+  /// AutoDiffXd scalars through the plant.
+  ///
+  /// @param[in] context
+  ///   The context storing the state of the model.
+  /// @param[in] known_vdot
+  ///   A vector of generalized accelerations of size num_velocities().
+  /// @param[out] dtau_dq
+  ///   ∂tau_id/∂q, of size num_velocities() x num_positions().
+  /// @param[out] dtau_dv
+  ///   ∂tau_id/∂v, of size num_velocities() x num_velocities().
+  /// @param[out] dtau_dvdot
+  ///   ∂tau_id/∂v̇ = M(q), of size num_velocities() x num_velocities().
+  /// @throws std::exception if any of the output pointers is nullptr or has
+  ///   the wrong size.
+  /// @throws std::exception if the model contains joints other than
+  ///   RevoluteJoint, PrismaticJoint or WeldJoint, or any floating body.
+  void CalcInverseDynamicsDerivatives(
+      const systems::Context<T>& context, const VectorX<T>& known_vdot,
+      EigenPtr<MatrixX<T>> dtau_dq, EigenPtr<MatrixX<T>> dtau_dv,
+      EigenPtr<MatrixX<T>> dtau_dvdot) const {
+    this->ValidateContext(context);
+    internal_tree().CalcInverseDynamicsDerivatives(context, known_vdot,
+                                                   dtau_dq, dtau_dv,
+                                                   dtau_dvdot);
+  }
+
+  /// Computes the generalized accelerations v̇ solving
+  /// <pre>
+  ///   M(q)v̇ + C(q, v)v = tau_g(q) + tau
+  /// </pre>
+  /// for the generalized positions and velocities stored in `context` and the
+  /// given generalized forces `tau`, together with the partial derivatives of
+  /// v̇ with respect to q, v and tau. These are obtained from
+  /// CalcInverseDynamicsDerivatives() as ∂v̇/∂q = -M⁻¹∂tau_id/∂q,
+  /// ∂v̇/∂v = -M⁻¹∂tau_id/∂v and ∂v̇/∂tau = M⁻¹. The same modeling
+  /// restrictions as in CalcInverseDynamicsDerivatives() apply; in particular
+  /// contact, joint limits and force elements other than gravity are ignored.
+  ///
+  /// @param[in] context
+  ///   The context storing the state of the model.
+  /// @param[in] tau
+  ///   A vector of generalized forces of size num_velocities().
+  /// @param[out] vdot
+  ///   The generalized accelerations, of size num_velocities().
+  /// @param[out] dvdot_dq
+  ///   ∂v̇/∂q, of size num_velocities() x num_positions().
+  /// @param[out] dvdot_dv
+  ///   ∂v̇/∂v, of size num_velocities() x num_velocities().
+  /// @param[out] dvdot_dtau
+  ///   ∂v̇/∂tau, of size num_velocities() x num_velocities().
+  /// @throws std::exception under the same conditions as
+  ///   CalcInverseDynamicsDerivatives().
+  void CalcForwardDynamicsDerivatives(
+      const systems::Context<T>& context, const VectorX<T>& tau,
+      EigenPtr<VectorX<T>> vdot, EigenPtr<MatrixX<T>> dvdot_dq,
+      EigenPtr<MatrixX<T>> dvdot_dv, EigenPtr<MatrixX<T>> dvdot_dtau) const {
+    this->ValidateContext(context);
+    internal_tree().CalcForwardDynamicsDerivatives(context, tau, vdot,
+                                                   dvdot_dq, dvdot_dv,
+                                                   dvdot_dtau);
+  }
+
   // Preserve access to base overload from this class.
   using systems::System<T>::MapVelocityToQDot;
 
@@ -3,7 +3,9 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/common/test_utilities/limit_malloc.h"
+#include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/multibody/plant/test/kuka_iiwa_model_tests.h"
 #include "drake/systems/framework/context.h"
@@ -280,6 +282,108 @@ GTEST_TEST(MultibodyPlantTest, CartPoleLinearization) {
   EXPECT_TRUE(CompareMatrices(dt_linearization->B(), B_expected, 1e-16));
 }
 
+// Verifies CalcInverseDynamicsDerivatives() and
+// CalcForwardDynamicsDerivatives() against the gradients of
+// M(q)v̇ + C(q, v)v - tau_g(q) computed with MultibodyPlant<AutoDiffXd>.
+void CompareDynamicsDerivatives(const MultibodyPlant<double>& plant,
+                                const VectorXd& q, const VectorXd& v,
+                                const VectorXd& vdot) {
+  const int nq = plant.num_positions();
+  const int nv = plant.num_velocities();
+  auto context = plant.CreateDefaultContext();
+  plant.SetPositions(context.get(), q);
+  plant.SetVelocities(context.get(), v);
+
+  MatrixX<double> dtau_dq(nv, nq), dtau_dv(nv, nv), dtau_dvdot(nv, nv);
+  plant.CalcInverseDynamicsDerivatives(*context, vdot, &dtau_dq, &dtau_dv,
+                                       &dtau_dvdot);
+
+  // Reference gradients with respect to x = [q; v; v̇].
+  std::unique_ptr<MultibodyPlant<AutoDiffXd>> plant_ad =
+      systems::System<double>::ToAutoDiffXd(plant);
+  auto context_ad = plant_ad->CreateDefaultContext();
+  const auto [q_ad, v_ad, vdot_ad] = math::InitializeAutoDiffTuple(q, v, vdot);
+  plant_ad->SetPositions(context_ad.get(), q_ad);
+  plant_ad->SetVelocities(context_ad.get(), v_ad);
+  MatrixX<AutoDiffXd> M_ad(nv, nv);
+  plant_ad->CalcMassMatrix(*context_ad, &M_ad);
+  VectorX<AutoDiffXd> Cv_ad(nv);
+  plant_ad->CalcBiasTerm(*context_ad, &Cv_ad);
+  const VectorX<AutoDiffXd> tau_ad =
+      M_ad * vdot_ad + Cv_ad -
+      plant_ad->CalcGravityGeneralizedForces(*context_ad);
+  const MatrixX<double> dtau_dx = math::ExtractGradient(tau_ad);
+
+  const double kTolerance = 64 * kEpsilon;
+  EXPECT_TRUE(CompareMatrices(dtau_dq, dtau_dx.leftCols(nq), kTolerance,
+                              MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(dtau_dv, dtau_dx.middleCols(nq, nv),
+                              kTolerance, MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(dtau_dvdot, dtau_dx.rightCols(nv), kTolerance,
+                              MatrixCompareType::relative));
+
+  // Forward dynamics: for tau = ID(q, v, v̇) we must recover v̇, and the
+  // derivatives must follow from the implicit function theorem.
+  const VectorXd tau = math::ExtractValue(tau_ad);
+  VectorXd vdot_fd(nv);
+  MatrixX<double> dvdot_dq(nv, nq), dvdot_dv(nv, nv), dvdot_dtau(nv, nv);
+  plant.CalcForwardDynamicsDerivatives(*context, tau, &vdot_fd, &dvdot_dq,
+                                       &dvdot_dv, &dvdot_dtau);
+  const MatrixX<double> M = math::ExtractValue(M_ad);
+  const double kappa = 1.0 / M.llt().rcond();
+  const double kFdTolerance = 64 * kappa * kEpsilon;
+  EXPECT_TRUE(CompareMatrices(vdot_fd, vdot, kFdTolerance,
+                              MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(M * dvdot_dtau, MatrixX<double>::Identity(nv, nv),
+                              kFdTolerance, MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(M * dvdot_dq, -dtau_dq, kFdTolerance,
+                              MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(M * dvdot_dv, -dtau_dv, kFdTolerance,
+                              MatrixCompareType::relative));
+}
+
+GTEST_TEST(MultibodyPlantDynamicsDerivatives, CartPole) {
+  MultibodyPlant<double> plant(0.0);
+  Parser(&plant).AddModelFromFile(FindResourceOrThrow(
+      "drake/examples/multibody/cart_pole/cart_pole.sdf"));
+  plant.Finalize();
+  CompareDynamicsDerivatives(plant, Eigen::Vector2d(0.3, -1.2),
+                             Eigen::Vector2d(-0.7, 2.1),
+                             Eigen::Vector2d(1.5, -0.4));
+}
+
+GTEST_TEST(MultibodyPlantDynamicsDerivatives, WeldedIiwaWithReflectedInertia) {
+  MultibodyPlant<double> plant(0.0);
+  Parser(&plant).AddModelFromFile(FindResourceOrThrow(
+      "drake/manipulation/models/iiwa_description/sdf/"
+      "iiwa14_no_collision.sdf"));
+  plant.WeldFrames(plant.world_frame(),
+                   plant.GetFrameByName("iiwa_link_0"));
+  for (JointActuatorIndex index(0); index < plant.num_actuators(); ++index) {
+    JointActuator<double>& actuator = plant.get_mutable_joint_actuator(index);
+    actuator.set_default_rotor_inertia(1.0e-4 * (int{index} + 1));
+    actuator.set_default_gear_ratio(100.0);
+  }
+  plant.Finalize();
+
+  VectorXd q(7), v(7), vdot(7);
+  q << 0.1, -0.4, 0.7, -1.1, 0.3, 0.9, -0.2;
+  v << 0.5, -0.2, 0.3, 0.8, -0.6, 0.1, 0.4;
+  vdot << -1.0, 0.3, 0.2, -0.5, 0.7, -0.3, 0.6;
+  CompareDynamicsDerivatives(plant, q, v, vdot);
+  CompareDynamicsDerivatives(plant, q, VectorXd::Zero(7), VectorXd::Zero(7));
+}
+
+TEST_F(KukaIiwaModelForwardDynamicsTests, DynamicsDerivativesFloatingBase) {
+  const int nv = plant_->num_velocities();
+  MatrixX<double> dtau_dq(nv, plant_->num_positions());
+  MatrixX<double> dtau_dv(nv, nv), dtau_dvdot(nv, nv);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      plant_->CalcInverseDynamicsDerivatives(*context_, VectorXd::Zero(nv),
+                                             &dtau_dq, &dtau_dv, &dtau_dvdot),
+      ".*mobilizer that is not supported.*");
+}
+
 // TODO(amcastro-tri): Include test with non-zero actuation and external forces.
 
 }  // namespace
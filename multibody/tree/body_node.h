@@ -1,11 +1,15 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
+#include "drake/math/fast_pose_composition_functions.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/math/rotation_matrix.h"
 #include "drake/multibody/math/spatial_algebra.h"
@@ -243,6 +247,67 @@ class BodyNode : public MultibodyElement<BodyNode, T, BodyNodeIndex> {
     // body B and its parent body P expressed in the world frame W.
   }
 
+  // Batched version of CalcPositionKinematicsCache_BaseToTip() for the `count`
+  // nodes in `nodes`, all of which must belong to the same tree level. For
+  // T = double the body poses of all of the nodes are composed and inverted
+  // with the batched kernels in drake::math::internal; for other scalar types
+  // this is equivalent to calling CalcPositionKinematicsCache_BaseToTip() on
+  // each node in turn.
+  // @pre CalcPositionKinematicsCache_BaseToTip() (or this method) must have
+  // already been called for all of the nodes in the previous level.
+  static void CalcPositionKinematicsCacheBatch_BaseToTip(
+      const systems::Context<T>& context, const BodyNode<T>* const* nodes,
+      int count, PositionKinematicsCache<T>* pc) {
+    DRAKE_ASSERT(nodes != nullptr);
+    DRAKE_ASSERT(pc != nullptr);
+    if constexpr (std::is_same_v<T, double>) {
+      constexpr int kBatchSize = 16;
+      std::array<math::RigidTransform<double>, kBatchSize> X_MB;
+      std::array<const math::RigidTransform<double>*, kBatchSize> X_FM_ptrs;
+      std::array<const math::RigidTransform<double>*, kBatchSize> X_WP_ptrs;
+      std::array<math::RigidTransform<double>*, kBatchSize> X_MB_ptrs;
+      std::array<math::RigidTransform<double>*, kBatchSize> X_PB_ptrs;
+      std::array<math::RigidTransform<double>*, kBatchSize> X_WB_ptrs;
+      for (int i = 0; i < kBatchSize; ++i) X_MB_ptrs[i] = &X_MB[i];
+      for (int start = 0; start < count; start += kBatchSize) {
+        const int n = std::min(kBatchSize, count - start);
+        const BodyNode<T>* const* batch = nodes + start;
+        for (int i = 0; i < n; ++i) {
+          const BodyNode<T>& node = *batch[i];
+          // This method must not be called for the "world" body node.
+          DRAKE_ASSERT(node.topology_.body != world_index());
+          node.CalcAcrossMobilizerPositionKinematicsCache(context, pc);
+          X_MB[i] =
+              node.get_mobilizer().outboard_frame().CalcPoseInBodyFrame(
+                  context);
+          X_FM_ptrs[i] = &node.get_X_FM(*pc);
+          X_WP_ptrs[i] = &node.get_X_WP(*pc);
+          X_PB_ptrs[i] = &node.get_mutable_X_PB(pc);
+          X_WB_ptrs[i] = &node.get_mutable_X_WB(pc);
+        }
+        // X_MB = X_BM⁻¹, then X_FB = X_FM * X_MB, both in place.
+        math::internal::InvertXBatch(X_MB_ptrs.data(), n, X_MB_ptrs.data());
+        math::internal::ComposeXXBatch(X_FM_ptrs.data(), X_MB_ptrs.data(), n,
+                                       X_MB_ptrs.data());
+        for (int i = 0; i < n; ++i) {
+          const Frame<T>& frame_F = batch[i]->get_mobilizer().inboard_frame();
+          *X_PB_ptrs[i] = frame_F.CalcOffsetPoseInBody(context, X_MB[i]);
+        }
+        // X_WP belongs to the previous level, so it is never an output here.
+        math::internal::ComposeXXBatch(X_WP_ptrs.data(), X_PB_ptrs.data(), n,
+                                       X_WB_ptrs.data());
+        for (int i = 0; i < n; ++i) {
+          batch[i]->get_mutable_p_PoBo_W(pc) =
+              X_WP_ptrs[i]->rotation() * X_PB_ptrs[i]->translation();
+        }
+      }
+    } else {
+      for (int i = 0; i < count; ++i) {
+        nodes[i]->CalcPositionKinematicsCache_BaseToTip(context, pc);
+      }
+    }
+  }
+
   // This method is used by MultibodyTree within a base-to-tip loop to compute
   // this node's kinematics that depend on the generalized velocities.
   // This method aborts in Debug builds when:
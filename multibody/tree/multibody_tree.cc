@@ -1,6 +1,7 @@
 #include "drake/multibody/tree/multibody_tree.h"
 
 #include <algorithm>
+#include <array>
 #include <limits>
 #include <memory>
 #include <stdexcept>
@@ -16,10 +17,13 @@
 #include "drake/math/rotation_matrix.h"
 #include "drake/multibody/tree/body_node_welded.h"
 #include "drake/multibody/tree/multibody_tree-inl.h"
+#include "drake/multibody/tree/prismatic_mobilizer.h"
 #include "drake/multibody/tree/quaternion_floating_mobilizer.h"
+#include "drake/multibody/tree/revolute_mobilizer.h"
 #include "drake/multibody/tree/rigid_body.h"
 #include "drake/multibody/tree/spatial_inertia.h"
 #include "drake/multibody/tree/uniform_gravity_field_element.h"
+#include "drake/multibody/tree/weld_mobilizer.h"
 
 namespace drake {
 namespace multibody {
@@ -962,15 +966,29 @@ void MultibodyTree<T>::CalcPositionKinematicsCache(
   // information for each body, we are now in position to perform a base-to-tip
   // recursion to update world positions and parent to child body transforms.
   // This skips the world, level = 0.
+  // The nodes of a level are independent of each other, so each level is
+  // updated in batches of nodes.
+  constexpr int kBatchSize = 16;
+  std::array<const BodyNode<T>*, kBatchSize> batch;
   for (int level = 1; level < tree_height(); ++level) {
+    int count = 0;
     for (BodyNodeIndex body_node_index : body_node_levels_[level]) {
       const BodyNode<T>& node = *body_nodes_[body_node_index];
 
       DRAKE_ASSERT(node.get_topology().level == level);
       DRAKE_ASSERT(node.index() == body_node_index);
 
-      // Update per-node kinematics.
-      node.CalcPositionKinematicsCache_BaseToTip(context, pc);
+      batch[count] = &node;
+      if (++count == kBatchSize) {
+        // Update per-node kinematics.
+        BodyNode<T>::CalcPositionKinematicsCacheBatch_BaseToTip(
+            context, batch.data(), count, pc);
+        count = 0;
+      }
+    }
+    if (count > 0) {
+      BodyNode<T>::CalcPositionKinematicsCacheBatch_BaseToTip(
+          context, batch.data(), count, pc);
     }
   }
 }
@@ -1623,6 +1641,256 @@ VectorX<T> MultibodyTree<T>::CalcGravityGeneralizedForces(
   return VectorX<T>::Zero(num_velocities());
 }
 
+namespace {
+
+// Helpers for CalcInverseDynamicsDerivatives(). All spatial vectors here are
+// Plücker vectors measured at the world origin Wo and expressed in the world
+// frame W, with the rotational part first (as for SpatialVelocity and
+// SpatialForce).
+
+// Returns the spatial cross product m × n of two motion vectors.
+template <typename T>
+Vector6<T> CrossMotion(const Vector6<T>& m, const Vector6<T>& n) {
+  Vector6<T> result;
+  result.template head<3>() = m.template head<3>().cross(n.template head<3>());
+  result.template tail<3>() =
+      m.template tail<3>().cross(n.template head<3>()) +
+      m.template head<3>().cross(n.template tail<3>());
+  return result;
+}
+
+// Returns the spatial cross product m ×* f of a motion vector with a force
+// vector.
+template <typename T>
+Vector6<T> CrossForce(const Vector6<T>& m, const Vector6<T>& f) {
+  Vector6<T> result;
+  result.template head<3>() =
+      m.template head<3>().cross(f.template head<3>()) +
+      m.template tail<3>().cross(f.template tail<3>());
+  result.template tail<3>() = m.template head<3>().cross(f.template tail<3>());
+  return result;
+}
+
+// Returns the derivative of I * x (for a fixed x) due to a unit rate of the
+// screw motion S of the body whose spatial inertia is I, i.e.
+// (S ×* I − I S ×) x.
+template <typename T>
+Vector6<T> CalcInertiaRateTimes(
+    const Matrix6<T>& I, const Vector6<T>& S, const Vector6<T>& x) {
+  return CrossForce<T>(S, I * x) - I * CrossMotion<T>(S, x);
+}
+
+}  // namespace
+
+// The derivatives are computed following the recursive Newton-Euler
+// derivatives of [Carpentier and Mansard, 2018], with every spatial quantity
+// measured at the world origin. In those coordinates, a generalized position
+// qₖ of a 1-dof mobilizer moves the whole subtree outboard of it as a rigid
+// screw motion Sₖ, so that any motion vector m rigidly attached to that
+// subtree satisfies ∂m/∂qₖ = Sₖ × m. With vᵢ, aᵢ the spatial velocity and
+// acceleration of body i (gravity enters as a_W = −g), for each mobilizer k
+// inboard of (or at) body i:
+//   ∂vᵢ/∂qₖ = Sₖ × (vᵢ − vₖ),   ∂vᵢ/∂q̇ₖ = Sₖ,
+//   ∂aᵢ/∂qₖ = Sₖ × (aᵢ − aₖ) − (Sₖ × vₖ) × (vᵢ − vₖ),
+//   ∂aᵢ/∂q̇ₖ = Sₖ × (vᵢ − vₖ) + vₖ × Sₖ,   ∂aᵢ/∂q̈ₖ = Sₖ.
+// These are chained through fᵢ = Iᵢ aᵢ + vᵢ ×* Iᵢ vᵢ and τⱼ = Sⱼᵀ Σ fᵢ, the
+// sum being over the bodies outboard of mobilizer j.
+//
+// Reference:
+//   Carpentier, J. and Mansard, N., 2018. Analytical derivatives of rigid body
+//   dynamics algorithms. Robotics: Science and Systems.
+template <typename T>
+void MultibodyTree<T>::CalcInverseDynamicsDerivatives(
+    const systems::Context<T>& context, const VectorX<T>& known_vdot,
+    EigenPtr<MatrixX<T>> dtau_dq, EigenPtr<MatrixX<T>> dtau_dv,
+    EigenPtr<MatrixX<T>> dtau_dvdot) const {
+  DRAKE_MBT_THROW_IF_NOT_FINALIZED();
+  DRAKE_THROW_UNLESS(known_vdot.size() == num_velocities());
+  DRAKE_THROW_UNLESS(dtau_dq != nullptr);
+  DRAKE_THROW_UNLESS(dtau_dv != nullptr);
+  DRAKE_THROW_UNLESS(dtau_dvdot != nullptr);
+  DRAKE_THROW_UNLESS(dtau_dq->rows() == num_velocities() &&
+                     dtau_dq->cols() == num_positions());
+  DRAKE_THROW_UNLESS(dtau_dv->rows() == num_velocities() &&
+                     dtau_dv->cols() == num_velocities());
+  DRAKE_THROW_UNLESS(dtau_dvdot->rows() == num_velocities() &&
+                     dtau_dvdot->cols() == num_velocities());
+
+  const int num_nodes = num_bodies();
+  const BodyNodeIndex world_node(0);
+
+  // For each node, the index of its mobilizer's single generalized position
+  // and velocity, or -1 for a weld. Only mobilizers with q̇ = v and a constant
+  // (in its inboard and outboard frames) axis are supported.
+  std::vector<int> q_index(num_nodes, -1);
+  std::vector<int> v_index(num_nodes, -1);
+  for (BodyNodeIndex n(1); n < num_nodes; ++n) {
+    const Mobilizer<T>& mobilizer = body_nodes_[n]->get_mobilizer();
+    if (dynamic_cast<const WeldMobilizer<T>*>(&mobilizer) != nullptr) {
+      continue;
+    }
+    if (dynamic_cast<const RevoluteMobilizer<T>*>(&mobilizer) == nullptr &&
+        dynamic_cast<const PrismaticMobilizer<T>*>(&mobilizer) == nullptr) {
+      throw std::logic_error(fmt::format(
+          "CalcInverseDynamicsDerivatives(): body '{}' is connected to its "
+          "parent by a mobilizer that is not supported. Only revolute, "
+          "prismatic, and weld joints are supported.",
+          body_nodes_[n]->body().name()));
+    }
+    q_index[n] = mobilizer.position_start_in_q();
+    v_index[n] = mobilizer.velocity_start_in_v();
+  }
+
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+  const std::vector<Vector6<T>>& H_PB_W_cache =
+      EvalAcrossNodeJacobianWrtVExpressedInWorld(context);
+  const std::vector<SpatialInertia<T>>& M_B_W_cache =
+      EvalSpatialInertiaInWorldCache(context);
+  const VectorX<T>& reflected_inertia = EvalReflectedInertiaCache(context);
+  const VectorX<T>& v = get_positions_and_velocities(context).tail(
+      num_velocities());
+
+  // Base-to-tip: spatial quantities about Wo for each node.
+  std::vector<Vector6<T>> S(num_nodes, Vector6<T>::Zero());
+  std::vector<Vector6<T>> V(num_nodes, Vector6<T>::Zero());
+  std::vector<Vector6<T>> A(num_nodes, Vector6<T>::Zero());
+  std::vector<Matrix6<T>> I(num_nodes, Matrix6<T>::Zero());
+  if (gravity_field_) {
+    A[world_node].template tail<3>() =
+        -gravity_field_->gravity_vector().template cast<T>();
+  }
+  for (int depth = 1; depth < tree_height(); ++depth) {
+    for (BodyNodeIndex n : body_node_levels_[depth]) {
+      const BodyNode<T>& node = *body_nodes_[n];
+      const BodyNodeIndex parent = node.get_topology().parent_body_node;
+      const Vector3<T>& p_WBo = pc.get_X_WB(n).translation();
+      I[n] = M_B_W_cache[n].Shift(-p_WBo).CopyToFullMatrix6();
+      V[n] = V[parent];
+      A[n] = A[parent];
+      if (v_index[n] >= 0) {
+        // Shift the hinge column V_PB_W from Bo to Wo.
+        const Vector6<T>& H = H_PB_W_cache[v_index[n]];
+        S[n].template head<3>() = H.template head<3>();
+        S[n].template tail<3>() =
+            H.template tail<3>() - H.template head<3>().cross(p_WBo);
+        const Vector6<T> Sqdot = S[n] * v(v_index[n]);
+        V[n] += Sqdot;
+        A[n] += S[n] * known_vdot(v_index[n]) + CrossMotion<T>(V[n], Sqdot);
+      }
+    }
+  }
+
+  dtau_dq->setZero();
+  dtau_dv->setZero();
+  dtau_dvdot->setZero();
+
+  // For each body i, form fᵢ and its partials with respect to the mobilities
+  // k inboard of it, and project them onto each mobility j inboard of it. This
+  // costs O(d²) per body, for a tree of depth d.
+  std::vector<Vector6<T>> F(num_nodes, Vector6<T>::Zero());
+  std::vector<BodyNodeIndex> path;
+  for (BodyNodeIndex i(1); i < num_nodes; ++i) {
+    const Matrix6<T>& Ii = I[i];
+    const Vector6<T> h = Ii * V[i];
+    F[i] = Ii * A[i] + CrossForce<T>(V[i], h);
+
+    // The nodes with mobilities from the base to i, inclusive.
+    path.clear();
+    for (BodyNodeIndex n = i; n != world_node;
+         n = body_nodes_[n]->get_topology().parent_body_node) {
+      if (v_index[n] >= 0) path.push_back(n);
+    }
+
+    for (const BodyNodeIndex k : path) {
+      const Vector6<T>& Sk = S[k];
+      const Vector6<T> dV_dq = CrossMotion<T>(Sk, V[i] - V[k]);
+      const Vector6<T> dA_dq = CrossMotion<T>(Sk, A[i] - A[k]) -
+                               CrossMotion<T>(CrossMotion<T>(Sk, V[k]),
+                                              V[i] - V[k]);
+      const Vector6<T> dA_dv =
+          CrossMotion<T>(Sk, V[i] - V[k]) + CrossMotion<T>(V[k], Sk);
+
+      const Vector6<T> df_dq =
+          CalcInertiaRateTimes<T>(Ii, Sk, A[i]) + Ii * dA_dq +
+          CrossForce<T>(dV_dq, h) +
+          CrossForce<T>(V[i], CalcInertiaRateTimes<T>(Ii, Sk, V[i]) +
+                                   Ii * dV_dq);
+      const Vector6<T> df_dv = Ii * dA_dv + CrossForce<T>(Sk, h) +
+                               CrossForce<T>(V[i], Ii * Sk);
+      const Vector6<T> df_dvdot = Ii * Sk;
+
+      for (const BodyNodeIndex j : path) {
+        const Vector6<T>& Sj = S[j];
+        (*dtau_dq)(v_index[j], q_index[k]) += Sj.dot(df_dq);
+        (*dtau_dv)(v_index[j], v_index[k]) += Sj.dot(df_dv);
+        (*dtau_dvdot)(v_index[j], v_index[k]) += Sj.dot(df_dvdot);
+      }
+    }
+  }
+
+  // Tip-to-base: accumulate the total force Fⱼ outboard of each mobilizer to
+  // add the motion of the mobilizer axes, ∂Sⱼ/∂qₖ = Sₖ × Sⱼ for k strictly
+  // inboard of j, in τⱼ = Sⱼᵀ Fⱼ.
+  for (int depth = tree_height() - 1; depth > 0; --depth) {
+    for (BodyNodeIndex j : body_node_levels_[depth]) {
+      const BodyNodeIndex parent =
+          body_nodes_[j]->get_topology().parent_body_node;
+      if (v_index[j] >= 0) {
+        for (BodyNodeIndex k = parent; k != world_node;
+             k = body_nodes_[k]->get_topology().parent_body_node) {
+          if (v_index[k] < 0) continue;
+          (*dtau_dq)(v_index[j], q_index[k]) +=
+              CrossMotion<T>(S[k], S[j]).dot(F[j]);
+        }
+      }
+      F[parent] += F[j];
+    }
+  }
+
+  // Add the effect of reflected inertias.
+  // See JointActuator::reflected_inertia().
+  dtau_dvdot->diagonal() += reflected_inertia;
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcForwardDynamicsDerivatives(
+    const systems::Context<T>& context, const VectorX<T>& tau,
+    EigenPtr<VectorX<T>> vdot, EigenPtr<MatrixX<T>> dvdot_dq,
+    EigenPtr<MatrixX<T>> dvdot_dv, EigenPtr<MatrixX<T>> dvdot_dtau) const {
+  DRAKE_MBT_THROW_IF_NOT_FINALIZED();
+  DRAKE_THROW_UNLESS(tau.size() == num_velocities());
+  DRAKE_THROW_UNLESS(vdot != nullptr && vdot->size() == num_velocities());
+  DRAKE_THROW_UNLESS(dvdot_dq != nullptr);
+  DRAKE_THROW_UNLESS(dvdot_dv != nullptr);
+  DRAKE_THROW_UNLESS(dvdot_dtau != nullptr);
+  DRAKE_THROW_UNLESS(dvdot_dtau->rows() == num_velocities() &&
+                     dvdot_dtau->cols() == num_velocities());
+
+  // With ID(q, v, v̇) = M(q)v̇ + C(q, v)v − τ_g(q), forward dynamics solves
+  // ID(q, v, v̇) = τ. By the implicit function theorem,
+  //   ∂v̇/∂τ = M⁻¹ and ∂v̇/∂x = −M⁻¹ ∂ID/∂x for x ∈ {q, v}.
+  MatrixX<T> M(num_velocities(), num_velocities());
+  CalcMassMatrix(context, &M);
+  VectorX<T> Cv(num_velocities());
+  CalcBiasTerm(context, &Cv);
+  const VectorX<T> tau_g = CalcGravityGeneralizedForces(context);
+  const Eigen::LLT<MatrixX<T>> M_llt(M);
+  if (M_llt.info() != Eigen::Success) {
+    throw std::runtime_error(
+        "CalcForwardDynamicsDerivatives(): the mass matrix is not positive "
+        "definite.");
+  }
+  *vdot = M_llt.solve(tau - Cv + tau_g);
+
+  MatrixX<T> dtau_dvdot(num_velocities(), num_velocities());
+  CalcInverseDynamicsDerivatives(context, *vdot, dvdot_dq, dvdot_dv,
+                                 &dtau_dvdot);
+  *dvdot_dq = -M_llt.solve(*dvdot_dq);
+  *dvdot_dv = -M_llt.solve(*dvdot_dv);
+  *dvdot_dtau = M_llt.solve(MatrixX<T>::Identity(num_velocities(),
+                                                 num_velocities()));
+}
+
 template <typename T>
 RigidTransform<T> MultibodyTree<T>::CalcRelativeTransform(
     const systems::Context<T>& context,
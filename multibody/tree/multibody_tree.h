@@ -1653,6 +1653,18 @@ class MultibodyTree {
   VectorX<T> CalcGravityGeneralizedForces(
       const systems::Context<T>& context) const;
 
+  // See MultibodyPlant method.
+  void CalcInverseDynamicsDerivatives(
+      const systems::Context<T>& context, const VectorX<T>& known_vdot,
+      EigenPtr<MatrixX<T>> dtau_dq, EigenPtr<MatrixX<T>> dtau_dv,
+      EigenPtr<MatrixX<T>> dtau_dvdot) const;
+
+  // See MultibodyPlant method.
+  void CalcForwardDynamicsDerivatives(
+      const systems::Context<T>& context, const VectorX<T>& tau,
+      EigenPtr<VectorX<T>> vdot, EigenPtr<MatrixX<T>> dvdot_dq,
+      EigenPtr<MatrixX<T>> dvdot_dv, EigenPtr<MatrixX<T>> dvdot_dtau) const;
+
   // See MultibodyPlant method.
   void MapVelocityToQDot(
       const systems::Context<T>& context,
@@ -0,0 +1,115 @@
+#include <cmath>
+#include <limits>
+
+#include "drake/perception/depth_image_to_point_cloud.h"
+#include "drake/perception/point_cloud.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+// Makes a cloud of `num_points` points with colors on the surface of a unit
+// sphere, similar to a depth camera view of an object.
+PointCloud MakeSphereCloud(int num_points) {
+  PointCloud cloud(num_points, pc_flags::kXYZs | pc_flags::kRGBs);
+  // Spread the points with the golden angle.
+  const double golden_angle = M_PI * (3 - std::sqrt(5.0));
+  for (int i = 0; i < num_points; ++i) {
+    const double z = 1 - 2 * (i + 0.5) / num_points;
+    const double r = std::sqrt(1 - z * z);
+    const double theta = golden_angle * i;
+    cloud.mutable_xyz(i) = Eigen::Vector3d(r * std::cos(theta),
+                                           r * std::sin(theta), z)
+                               .cast<float>();
+    cloud.mutable_rgb(i) = Eigen::Vector3i(i % 256, (i / 256) % 256, 128)
+                               .cast<uint8_t>();
+  }
+  return cloud;
+}
+
+// The arguments are the number of points and the number of threads.
+static void BenchmarkVoxelizedDownSample(benchmark::State& state) {  // NOLINT
+  const PointCloud cloud = MakeSphereCloud(state.range(0));
+  const int num_threads = state.range(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cloud.VoxelizedDownSample(0.005, num_threads));
+  }
+}
+
+BENCHMARK(BenchmarkVoxelizedDownSample)
+    ->Args({100000, 1})
+    ->Args({1200000, 1})
+    ->Args({1200000, 4})
+    ->Unit(benchmark::kMillisecond);
+
+// The arguments are the number of points and the number of threads. The
+// spatial index is built by the first iteration and reused by the others.
+static void BenchmarkEstimateNormals(benchmark::State& state) {  // NOLINT
+  PointCloud cloud = MakeSphereCloud(state.range(0));
+  const int num_threads = state.range(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cloud.EstimateNormals(0.05, 30, num_threads));
+  }
+}
+
+BENCHMARK(BenchmarkEstimateNormals)
+    ->Args({100000, 1})
+    ->Args({100000, 4})
+    ->Unit(benchmark::kMillisecond);
+
+// The arguments are the number of points and the number of threads. Queries
+// the nearest neighbor of each point of a second cloud, as in an iteration of
+// ICP.
+static void BenchmarkFindNearestNeighbors(benchmark::State& state) {  // NOLINT
+  const PointCloud cloud = MakeSphereCloud(state.range(0));
+  const Eigen::Matrix3Xf queries =
+      1.01 * MakeSphereCloud(state.range(0) / 10).xyzs();
+  const int num_threads = state.range(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        cloud.FindNearestNeighbors(queries, 1, num_threads));
+  }
+}
+
+BENCHMARK(BenchmarkFindNearestNeighbors)
+    ->Args({100000, 1})
+    ->Args({100000, 4})
+    ->Unit(benchmark::kMillisecond);
+
+// The arguments are whether the invalid points are dropped and the pixel
+// stride. Converts a VGA depth image in which one pixel in 13 is too far, with
+// a camera pose, into the same cloud on every iteration.
+static void BenchmarkDepthImageToPointCloud(benchmark::State& state) {  // NOLINT
+  const int kWidth = 640;
+  const int kHeight = 480;
+  const systems::sensors::CameraInfo camera_info(kWidth, kHeight, M_PI / 4);
+  systems::sensors::ImageDepth32F depth_image(kWidth, kHeight);
+  for (int v = 0; v < kHeight; ++v) {
+    for (int u = 0; u < kWidth; ++u) {
+      *depth_image.at(u, v) = ((7 * u + v) % 13 == 0)
+                                  ? std::numeric_limits<float>::infinity()
+                                  : 1.0f + 0.001f * u;
+    }
+  }
+  const math::RigidTransformd X_PC(math::RollPitchYawd(0.1, -0.2, 0.3),
+                                   Eigen::Vector3d(1.1, -1.2, 1.3));
+  const bool drop_invalid_points = state.range(0);
+  const int pixel_stride = state.range(1);
+  PointCloud cloud;
+  for (auto _ : state) {
+    DepthImageToPointCloud::Convert(camera_info, X_PC, depth_image,
+                                    std::nullopt, std::nullopt, &cloud,
+                                    drop_invalid_points, pixel_stride);
+  }
+}
+
+BENCHMARK(BenchmarkDepthImageToPointCloud)
+    ->Args({0, 1})
+    ->Args({1, 1})
+    ->Args({1, 2})
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
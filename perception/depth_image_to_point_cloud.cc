@@ -1,5 +1,6 @@
 #include "drake/perception/depth_image_to_point_cloud.h"
 
+#include <cmath>
 #include <limits>
 #include <optional>
 
@@ -23,6 +24,7 @@ namespace drake {
 namespace perception {
 namespace {
 
+using pc_flags::kRGBs;
 using pc_flags::kXYZs;
 
 // Given a PixelType, return a Value<Image<PixelType>> dummy.
@@ -42,72 +44,189 @@ const AbstractValue& GetModelValue(PixelType pixel_type) {
   throw std::logic_error("Unsupported pixel_type in DepthImageToPointCloud");
 }
 
-// TODO(russt): Consider dropping NaN/kTooClose/kTooFar points from the point
-// cloud output? (This would require adding support for colored point clouds,
-// because current implementation assume that an RGB image will still line up).
+// Converts the image in a single pass over its pixels, which fuses the
+// unprojection, the transform by X_PC, the detection of the invalid depths, the
+// copy of the colors and (optionally) the compaction of the valid points.
+template <PixelType pixel_type>
+int ConvertPixels(const CameraInfo& camera_info,
+                  const math::RigidTransform<float>& X_PC,
+                  const Image<pixel_type>& depth_image,
+                  const ImageRgba8U* color_image, const float scale,
+                  const internal::DepthImageConversion& conversion,
+                  float* const xyzs, uint8_t* const rgbs) {
+  using Pixel = typename ImageTraits<pixel_type>::ChannelType;
+  static_assert(ImageTraits<pixel_type>::kNumChannels == 1);
+  constexpr int kColorChannels = ImageTraits<PixelType::kRgba8U>::kNumChannels;
+  constexpr float kInf = std::numeric_limits<float>::infinity();
+  const int pixel_stride = conversion.pixel_stride;
+  const bool drop_invalid_points = conversion.drop_invalid_points;
+  const Vector3f& lower_xyz = conversion.lower_xyz;
+  const Vector3f& upper_xyz = conversion.upper_xyz;
+  DRAKE_THROW_UNLESS(pixel_stride >= 1);
+
+  const int height = depth_image.height();
+  const int num_u = (depth_image.width() + pixel_stride - 1) / pixel_stride;
+  const float cx = camera_info.center_x();
+  const float cy = camera_info.center_y();
+  const float fx_inv = 1.f / camera_info.focal_x();
+  const float fy_inv = 1.f / camera_info.focal_y();
+  const Eigen::Matrix3f R_PC = X_PC.rotation().matrix();
+  const Vector3f p_PC = X_PC.translation();
+
+  // The point of pixel (u, v) with depth z is p_PC + z (a(u) + b(v)), where
+  // a(u) = R_PC [x(u), 0, 0], b(v) = R_PC [0, y(v), 1], x(u) = (u - cx) / fx
+  // and y(v) = (v - cy) / fy. The a(u) are computed once for all rows, and
+  // stored by coordinate.
+  Eigen::RowVectorXf x(num_u);
+  for (int k = 0; k < num_u; ++k) {
+    x(k) = (k * pixel_stride - cx) * fx_inv;
+  }
+  const Eigen::Matrix<float, 3, Eigen::Dynamic, Eigen::RowMajor> a =
+      R_PC.col(0) * x;
+  const float* const ax = a.row(0).data();
+  const float* const ay = a.row(1).data();
+  const float* const az = a.row(2).data();
+
+  int size = 0;
+  for (int v = 0; v < height; v += pixel_stride) {
+    const Pixel* const depths = depth_image.at(0, v);
+    const uint8_t* const colors =
+        color_image ? color_image->at(0, v) : nullptr;
+    const Vector3f b = (v - cy) * fy_inv * R_PC.col(1) + R_PC.col(2);
+    const float bx = b.x();
+    const float by = b.y();
+    const float bz = b.z();
+    for (int k = 0; k < num_u; ++k) {
+      const Pixel depth = depths[k * pixel_stride];
+      const bool is_too_close_or_far =
+          (depth == ImageTraits<pixel_type>::kTooClose) ||
+          (depth == ImageTraits<pixel_type>::kTooFar);
+      // N.B. This handles both true depths *and* NaNs.
+      const float z = scale * depth;
+      float* const xyz = xyzs + 3 * size;
+      xyz[0] = is_too_close_or_far ? kInf : p_PC.x() + z * (ax[k] + bx);
+      xyz[1] = is_too_close_or_far ? kInf : p_PC.y() + z * (ay[k] + by);
+      xyz[2] = is_too_close_or_far ? kInf : p_PC.z() + z * (az[k] + bz);
+      if (colors) {
+        const uint8_t* const color = colors + k * pixel_stride * kColorChannels;
+        uint8_t* const rgb = rgbs + 3 * size;
+        rgb[0] = color[0];
+        rgb[1] = color[1];
+        rgb[2] = color[2];
+      }
+      // When dropping the invalid points, every point is still written, but
+      // only the valid ones are kept, by moving the end of the output past
+      // them. This compacts the points without branching. (NaNs and
+      // infinities always fail the crop test.)
+      size += !drop_invalid_points ||
+              ((xyz[0] >= lower_xyz.x()) & (xyz[0] <= upper_xyz.x()) &
+               (xyz[1] >= lower_xyz.y()) & (xyz[1] <= upper_xyz.y()) &
+               (xyz[2] >= lower_xyz.z()) & (xyz[2] <= upper_xyz.z()) &
+               !is_too_close_or_far);
+    }
+  }
+  return size;
+}
+
 template <PixelType pixel_type>
 void DoConvert(const std::optional<pc_flags::BaseFieldT>& exact_base_fields,
                const CameraInfo& camera_info,
                const RigidTransformd* const camera_pose,
                const Image<pixel_type>& depth_image,
                const ImageRgba8U* color_image, const float scale,
+               const bool drop_invalid_points, const int pixel_stride,
                PointCloud* output) {
   if (exact_base_fields) {
     DRAKE_THROW_UNLESS(output->fields().base_fields() == *exact_base_fields);
   }
+  internal::DepthImageConversion conversion;
+  conversion.drop_invalid_points = drop_invalid_points;
+  conversion.pixel_stride = pixel_stride;
+  const int max_size = conversion.max_size(depth_image);
 
   // Reset the output size, if necessary.  We can leave the memory
-  // uninitialized iff we are going to fill it in below.
-  if (output->size() != depth_image.size()) {
-    const bool skip_initialize = (output->fields().base_fields() == kXYZs);
-    output->resize(depth_image.size(), skip_initialize);
-  }
-  Eigen::Ref<Matrix3Xf> output_xyz = output->mutable_xyzs();
-  std::optional<Eigen::Ref<Matrix3X<uint8_t>>> output_rgb;
-  if (color_image) {
-    output_rgb = output->mutable_rgbs();
+  // uninitialized iff we are going to fill it in below.  When dropping the
+  // invalid points, the output is truncated below, and keeps its memory for
+  // the next call.
+  if (output->size() != max_size) {
+    const pc_flags::BaseFieldT base_fields = output->fields().base_fields();
+    const bool skip_initialize =
+        (base_fields == kXYZs) ||
+        (color_image != nullptr && base_fields == (kXYZs | kRGBs));
+    output->resize(max_size, skip_initialize);
   }
 
-  const int height = depth_image.height();
-  const int width = depth_image.width();
-  const float cx = camera_info.center_x();
-  const float cy = camera_info.center_y();
-  const float fx_inv = 1.f / camera_info.focal_x();
-  const float fy_inv = 1.f / camera_info.focal_y();
   const math::RigidTransform<float> X_PC = (camera_pose != nullptr) ?
       camera_pose->cast<float>() : math::RigidTransform<float>::Identity();
-
-  for (int v = 0; v < height; ++v) {
-    for (int u = 0; u < width; ++u) {
-      const int col = v * width + u;
-      const auto z = depth_image.at(u, v)[0];
-      if ((z == ImageTraits<pixel_type>::kTooClose) ||
-          (z == ImageTraits<pixel_type>::kTooFar)) {
-        output_xyz.col(col).array() = std::numeric_limits<float>::infinity();
-      } else {
-        // N.B. This clause handles both true depths *and* NaNs.
-        output_xyz.col(col) =
-            X_PC * Vector3f(scale * z * (u - cx) * fx_inv,
-                            scale * z * (v - cy) * fy_inv,
-                            scale * z);
-      }
-      if (color_image) {
-        const auto color = color_image->at(u, v);
-        output_rgb->col(col) = Vector3<uint8_t>(color[0], color[1], color[2]);
-      }
-    }
+  // The outputs are written through raw pointers, to keep the loop tight.
+  Eigen::Ref<Matrix3Xf> output_xyz = output->mutable_xyzs();
+  DRAKE_DEMAND(output_xyz.outerStride() == 3);
+  uint8_t* rgbs = nullptr;
+  if (color_image) {
+    Eigen::Ref<Matrix3X<uint8_t>> output_rgb = output->mutable_rgbs();
+    DRAKE_DEMAND(output_rgb.outerStride() == 3);
+    rgbs = output_rgb.data();
+  }
+  const int size = internal::ConvertDepthImage(
+      camera_info, X_PC, depth_image, color_image, scale, conversion,
+      output_xyz.data(), rgbs);
+  if (size != output->size()) {
+    output->resize(size);
   }
 }
 
 }  // namespace
 
+namespace internal {
+
+int DepthImageConversion::max_size(
+    const systems::sensors::ImageDepth32F& depth_image) const {
+  DRAKE_THROW_UNLESS(pixel_stride >= 1);
+  return ((depth_image.width() + pixel_stride - 1) / pixel_stride) *
+         ((depth_image.height() + pixel_stride - 1) / pixel_stride);
+}
+
+int DepthImageConversion::max_size(
+    const systems::sensors::ImageDepth16U& depth_image) const {
+  DRAKE_THROW_UNLESS(pixel_stride >= 1);
+  return ((depth_image.width() + pixel_stride - 1) / pixel_stride) *
+         ((depth_image.height() + pixel_stride - 1) / pixel_stride);
+}
+
+int ConvertDepthImage(const systems::sensors::CameraInfo& camera_info,
+                      const math::RigidTransform<float>& X_PC,
+                      const systems::sensors::ImageDepth32F& depth_image,
+                      const systems::sensors::ImageRgba8U* color_image,
+                      float scale, const DepthImageConversion& conversion,
+                      float* xyzs, uint8_t* rgbs) {
+  return ConvertPixels(camera_info, X_PC, depth_image, color_image, scale,
+                       conversion, xyzs, rgbs);
+}
+
+int ConvertDepthImage(const systems::sensors::CameraInfo& camera_info,
+                      const math::RigidTransform<float>& X_PC,
+                      const systems::sensors::ImageDepth16U& depth_image,
+                      const systems::sensors::ImageRgba8U* color_image,
+                      float scale, const DepthImageConversion& conversion,
+                      float* xyzs, uint8_t* rgbs) {
+  return ConvertPixels(camera_info, X_PC, depth_image, color_image, scale,
+                       conversion, xyzs, rgbs);
+}
+
+}  // namespace internal
+
 DepthImageToPointCloud::DepthImageToPointCloud(
     const CameraInfo& camera_info, PixelType depth_pixel_type, float scale,
-    const pc_flags::BaseFieldT fields)
+    const pc_flags::BaseFieldT fields, bool drop_invalid_points,
+    int pixel_stride)
     : camera_info_(camera_info),
       depth_pixel_type_(depth_pixel_type),
       scale_(scale),
-      fields_(fields) {
+      fields_(fields),
+      drop_invalid_points_(drop_invalid_points),
+      pixel_stride_(pixel_stride) {
+  DRAKE_THROW_UNLESS(pixel_stride >= 1);
+
   // Input port for depth image.
   depth_image_input_port_ =
       this->DeclareAbstractInputPort("depth_image",
@@ -137,10 +256,11 @@ void DepthImageToPointCloud::Convert(
     const std::optional<math::RigidTransformd>& camera_pose,
     const systems::sensors::ImageDepth32F& depth_image,
     const std::optional<systems::sensors::ImageRgba8U>& color_image,
-    const std::optional<float>& scale, PointCloud* output) {
+    const std::optional<float>& scale, PointCloud* output,
+    bool drop_invalid_points, int pixel_stride) {
   DoConvert(std::nullopt, camera_info, camera_pose ? &*camera_pose : nullptr,
             depth_image, color_image ? &*color_image : nullptr,
-            scale.value_or(1.0f), output);
+            scale.value_or(1.0f), drop_invalid_points, pixel_stride, output);
 }
 
 void DepthImageToPointCloud::Convert(
@@ -148,10 +268,11 @@ void DepthImageToPointCloud::Convert(
     const std::optional<math::RigidTransformd>& camera_pose,
     const systems::sensors::ImageDepth16U& depth_image,
     const std::optional<systems::sensors::ImageRgba8U>& color_image,
-    const std::optional<float>& scale, PointCloud* output) {
+    const std::optional<float>& scale, PointCloud* output,
+    bool drop_invalid_points, int pixel_stride) {
   DoConvert(std::nullopt, camera_info, camera_pose ? &*camera_pose : nullptr,
             depth_image, color_image ? &*color_image : nullptr,
-            scale.value_or(1.0f), output);
+            scale.value_or(1.0f), drop_invalid_points, pixel_stride, output);
 }
 
 void DepthImageToPointCloud::CalcOutput32F(
@@ -164,7 +285,8 @@ void DepthImageToPointCloud::CalcOutput32F(
       this->EvalInputValue<RigidTransformd>(context, camera_pose_input_port_);
   DRAKE_THROW_UNLESS(depth_image != nullptr);
   DoConvert(fields_, camera_info_, pose_or_null, *depth_image,
-            color_image_or_null, scale_, output);
+            color_image_or_null, scale_, drop_invalid_points_, pixel_stride_,
+            output);
 }
 
 void DepthImageToPointCloud::CalcOutput16U(
@@ -177,7 +299,8 @@ void DepthImageToPointCloud::CalcOutput16U(
       this->EvalInputValue<RigidTransformd>(context, camera_pose_input_port_);
   DRAKE_THROW_UNLESS(depth_image != nullptr);
   DoConvert(fields_, camera_info_, pose_or_null, *depth_image,
-            color_image_or_null, scale_, output);
+            color_image_or_null, scale_, drop_invalid_points_, pixel_stride_,
+            output);
 }
 
 }  // namespace perception
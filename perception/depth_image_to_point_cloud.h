@@ -1,5 +1,6 @@
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -42,7 +43,14 @@ namespace perception {
 /// If a pixel is NaN, the converted point will be (NaN, NaN, NaN).  If a pixel
 /// is kTooClose or kTooFar (as defined by ImageTraits), the converted point
 /// will be (+Inf, +Inf, +Inf). Note that this matches the convention used by
-/// the Point Cloud Library (PCL).
+/// the Point Cloud Library (PCL). Alternatively, these invalid points can be
+/// dropped from the point cloud (see `drop_invalid_points`).
+///
+/// The point cloud can also be down-sampled in the same pass, by only
+/// converting every `pixel_stride`-th pixel of every `pixel_stride`-th row.
+///
+/// The points are ordered like the pixels they come from, row by row. The
+/// output point cloud keeps its memory from one conversion to the next.
 ///
 /// @ingroup perception_systems
 class DepthImageToPointCloud final : public systems::LeafSystem<double> {
@@ -58,11 +66,18 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   ///   before projecting to a point cloud.  (This is useful for converting mm
   ///   to meters, etc.)
   /// @param[in] fields The fields the point cloud contains.
+  /// @param[in] drop_invalid_points If true, the pixels that are NaN, kTooClose
+  ///   or kTooFar are left out of the point cloud, which is then smaller than
+  ///   the image.
+  /// @param[in] pixel_stride Only the pixels whose row and column are
+  ///   multiples of this stride are converted.
+  /// @throws std::exception if pixel_stride < 1.
   explicit DepthImageToPointCloud(
       const systems::sensors::CameraInfo& camera_info,
       systems::sensors::PixelType depth_pixel_type =
           systems::sensors::PixelType::kDepth32F,
-      float scale = 1.0, pc_flags::BaseFieldT fields = pc_flags::kXYZs);
+      float scale = 1.0, pc_flags::BaseFieldT fields = pc_flags::kXYZs,
+      bool drop_invalid_points = false, int pixel_stride = 1);
 
   /// Returns the abstract valued input port that expects either an
   /// ImageDepth16U or ImageDepth32F (depending on the constructor argument).
@@ -94,28 +109,34 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   /// in the class overview and constructor.
   ///
   /// @param[in,out] cloud Destination for point data; must not be nullptr.
-  /// The `cloud` will be resized to match the size of the depth image.  The
-  /// `cloud` must have the XYZ channel enabled.
+  /// The `cloud` will be resized to match the number of converted pixels
+  /// (the size of the depth image, by default).  The `cloud` must have the
+  /// XYZ channel enabled.
+  /// @throws std::exception if pixel_stride < 1.
   static void Convert(
       const systems::sensors::CameraInfo& camera_info,
       const std::optional<math::RigidTransformd>& camera_pose,
       const systems::sensors::ImageDepth32F& depth_image,
       const std::optional<systems::sensors::ImageRgba8U>& color_image,
-      const std::optional<float>& scale, PointCloud* cloud);
+      const std::optional<float>& scale, PointCloud* cloud,
+      bool drop_invalid_points = false, int pixel_stride = 1);
 
   /// Converts a depth image to a point cloud using direct arguments instead of
   /// System input and output ports.  The semantics are the same as documented
   /// in the class overview and constructor.
   ///
   /// @param[in,out] cloud Destination for point data; must not be nullptr.
-  /// The `cloud` will be resized to match the size of the depth image.  The
-  /// `cloud` must have the XYZ channel enabled.
+  /// The `cloud` will be resized to match the number of converted pixels
+  /// (the size of the depth image, by default).  The `cloud` must have the
+  /// XYZ channel enabled.
+  /// @throws std::exception if pixel_stride < 1.
   static void Convert(
       const systems::sensors::CameraInfo& camera_info,
       const std::optional<math::RigidTransformd>& camera_pose,
       const systems::sensors::ImageDepth16U& depth_image,
       const std::optional<systems::sensors::ImageRgba8U>& color_image,
-      const std::optional<float>& scale, PointCloud* cloud);
+      const std::optional<float>& scale, PointCloud* cloud,
+      bool drop_invalid_points = false, int pixel_stride = 1);
 
  private:
   void CalcOutput16U(const systems::Context<double>&, PointCloud*) const;
@@ -125,11 +146,56 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   const systems::sensors::PixelType depth_pixel_type_;
   const float scale_;
   const pc_flags::BaseFieldT fields_;
+  const bool drop_invalid_points_;
+  const int pixel_stride_;
 
   systems::InputPortIndex depth_image_input_port_{};
   systems::InputPortIndex color_image_input_port_{};
   systems::InputPortIndex camera_pose_input_port_{};
 };
 
+namespace internal {
+
+/* The options of ConvertDepthImage(). */
+struct DepthImageConversion {
+  /* Returns the number of points converted from `depth_image` (before any
+  invalid or cropped points are dropped). */
+  int max_size(const systems::sensors::ImageDepth32F& depth_image) const;
+  int max_size(const systems::sensors::ImageDepth16U& depth_image) const;
+
+  /* Whether the invalid points and the points outside of the box
+  [lower_xyz, upper_xyz] are left out. The box is not used otherwise. */
+  bool drop_invalid_points{false};
+  int pixel_stride{1};
+  Eigen::Vector3f lower_xyz{
+      Eigen::Vector3f::Constant(-std::numeric_limits<float>::infinity())};
+  Eigen::Vector3f upper_xyz{
+      Eigen::Vector3f::Constant(std::numeric_limits<float>::infinity())};
+};
+
+/* Converts `depth_image` (and, if not null, `color_image`) to points expressed
+in frame P. The points are written to `xyzs` (and their colors to `rgbs`) as
+packed triplets, which must have room for `conversion.max_size(depth_image)`
+points; `rgbs` is only used if `color_image` is given. Returns the number of
+points written. This is the kernel of DepthImageToPointCloud, shared with
+DepthImagesToFusedPointCloud, which converts several images into disjoint
+slices of the same cloud from several threads; taking raw pointers keeps those
+threads away from the PointCloud itself. */
+int ConvertDepthImage(const systems::sensors::CameraInfo& camera_info,
+                      const math::RigidTransform<float>& X_PC,
+                      const systems::sensors::ImageDepth32F& depth_image,
+                      const systems::sensors::ImageRgba8U* color_image,
+                      float scale, const DepthImageConversion& conversion,
+                      float* xyzs, uint8_t* rgbs);
+
+int ConvertDepthImage(const systems::sensors::CameraInfo& camera_info,
+                      const math::RigidTransform<float>& X_PC,
+                      const systems::sensors::ImageDepth16U& depth_image,
+                      const systems::sensors::ImageRgba8U* color_image,
+                      float scale, const DepthImageConversion& conversion,
+                      float* xyzs, uint8_t* rgbs);
+
+}  // namespace internal
+
 }  // namespace perception
 }  // namespace drake
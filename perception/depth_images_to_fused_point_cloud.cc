@@ -0,0 +1,213 @@
+#include "drake/perception/depth_images_to_fused_point_cloud.h"
+
+#include <algorithm>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/never_destroyed.h"
+#include "drake/common/parallel_for.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/perception/depth_image_to_point_cloud.h"
+#include "drake/systems/sensors/image.h"
+
+using drake::AbstractValue;
+using drake::Value;
+using drake::math::RigidTransformd;
+using drake::systems::sensors::CameraInfo;
+using drake::systems::sensors::Image;
+using drake::systems::sensors::ImageDepth16U;
+using drake::systems::sensors::ImageDepth32F;
+using drake::systems::sensors::ImageRgba8U;
+using drake::systems::sensors::PixelType;
+
+namespace drake {
+namespace perception {
+namespace {
+
+using pc_flags::kRGBs;
+using pc_flags::kXYZs;
+
+// Given a depth PixelType, return a Value<Image<PixelType>> dummy.
+const AbstractValue& GetDepthModelValue(PixelType pixel_type) {
+  if (pixel_type == PixelType::kDepth32F) {
+    static const never_destroyed<Value<ImageDepth32F>> image32f;
+    return image32f.access();
+  }
+  if (pixel_type == PixelType::kDepth16U) {
+    static const never_destroyed<Value<ImageDepth16U>> image16u;
+    return image16u.access();
+  }
+  throw std::logic_error(
+      "Unsupported pixel_type in DepthImagesToFusedPointCloud");
+}
+
+}  // namespace
+
+DepthImagesToFusedPointCloud::DepthImagesToFusedPointCloud(
+    std::vector<CameraInfo> camera_infos, PixelType depth_pixel_type,
+    float scale, pc_flags::BaseFieldT fields,
+    const Eigen::Vector3d& lower_xyz, const Eigen::Vector3d& upper_xyz,
+    double voxel_size, int num_threads)
+    : camera_infos_(std::move(camera_infos)),
+      depth_pixel_type_(depth_pixel_type),
+      scale_(scale),
+      fields_(fields),
+      lower_xyz_(lower_xyz.cast<float>()),
+      upper_xyz_(upper_xyz.cast<float>()),
+      voxel_size_(voxel_size),
+      num_threads_(num_threads) {
+  DRAKE_THROW_UNLESS(!camera_infos_.empty());
+  DRAKE_THROW_UNLESS(fields == kXYZs || fields == (kXYZs | kRGBs));
+  DRAKE_THROW_UNLESS((lower_xyz.array() <= upper_xyz.array()).all());
+  DRAKE_THROW_UNLESS(voxel_size >= 0);
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+
+  const AbstractValue& depth_model_value = GetDepthModelValue(depth_pixel_type);
+  for (int i = 0; i < num_cameras(); ++i) {
+    depth_image_input_ports_.push_back(
+        this->DeclareAbstractInputPort(fmt::format("depth_image_{}", i),
+                                       depth_model_value)
+            .get_index());
+    color_image_input_ports_.push_back(
+        this->DeclareAbstractInputPort(fmt::format("color_image_{}", i),
+                                       Value<ImageRgba8U>{})
+            .get_index());
+    camera_pose_input_ports_.push_back(
+        this->DeclareAbstractInputPort(fmt::format("camera_pose_{}", i),
+                                       Value<RigidTransformd>{})
+            .get_index());
+  }
+
+  this->DeclareAbstractOutputPort(
+      "point_cloud", PointCloud{0, fields},
+      (depth_pixel_type_ == PixelType::kDepth32F)
+          ? &DepthImagesToFusedPointCloud::CalcOutput<PixelType::kDepth32F>
+          : &DepthImagesToFusedPointCloud::CalcOutput<PixelType::kDepth16U>);
+  scratch_cloud_cache_index_ =
+      this->DeclareCacheEntry(
+              "scratch point cloud",
+              systems::ValueProducer(PointCloud{0, fields},
+                                     &systems::ValueProducer::NoopCalc),
+              {this->nothing_ticket()})
+          .cache_index();
+}
+
+const systems::InputPort<double>&
+DepthImagesToFusedPointCloud::depth_image_input_port(int i) const {
+  DRAKE_THROW_UNLESS(0 <= i && i < num_cameras());
+  return this->get_input_port(depth_image_input_ports_[i]);
+}
+
+const systems::InputPort<double>&
+DepthImagesToFusedPointCloud::color_image_input_port(int i) const {
+  DRAKE_THROW_UNLESS(0 <= i && i < num_cameras());
+  return this->get_input_port(color_image_input_ports_[i]);
+}
+
+const systems::InputPort<double>&
+DepthImagesToFusedPointCloud::camera_pose_input_port(int i) const {
+  DRAKE_THROW_UNLESS(0 <= i && i < num_cameras());
+  return this->get_input_port(camera_pose_input_ports_[i]);
+}
+
+template <PixelType pixel_type>
+void DepthImagesToFusedPointCloud::CalcOutput(
+    const systems::Context<double>& context, PointCloud* output) const {
+  const int num_cameras = this->num_cameras();
+  const bool has_rgbs = (fields_ & kRGBs) != 0;
+
+  // The inputs are evaluated up front, since the cache is not thread-safe.
+  std::vector<const Image<pixel_type>*> depth_images(num_cameras);
+  std::vector<const ImageRgba8U*> color_images(num_cameras);
+  std::vector<math::RigidTransform<float>> poses(num_cameras);
+  // Camera i is converted into the points [offsets[i], offsets[i + 1]) of the
+  // output, which are then compacted.
+  std::vector<int> offsets(num_cameras + 1, 0);
+  for (int i = 0; i < num_cameras; ++i) {
+    depth_images[i] = this->template EvalInputValue<Image<pixel_type>>(
+        context, depth_image_input_ports_[i]);
+    DRAKE_THROW_UNLESS(depth_images[i] != nullptr);
+    if (has_rgbs) {
+      color_images[i] = this->template EvalInputValue<ImageRgba8U>(
+          context, color_image_input_ports_[i]);
+      if (color_images[i] != nullptr) {
+        DRAKE_THROW_UNLESS(
+            color_images[i]->width() == depth_images[i]->width() &&
+            color_images[i]->height() == depth_images[i]->height());
+      }
+    }
+    const auto* const pose_or_null = this->template EvalInputValue<
+        RigidTransformd>(context, camera_pose_input_ports_[i]);
+    poses[i] = (pose_or_null != nullptr)
+                   ? pose_or_null->cast<float>()
+                   : math::RigidTransform<float>::Identity();
+    DRAKE_THROW_UNLESS(depth_images[i]->width() == camera_infos_[i].width());
+    DRAKE_THROW_UNLESS(depth_images[i]->height() ==
+                       camera_infos_[i].height());
+    offsets[i + 1] = offsets[i] + depth_images[i]->size();
+  }
+
+  // The images are converted into the output, unless the points are to be
+  // down-sampled, which cannot be done in place.
+  PointCloud* const cloud =
+      (voxel_size_ > 0)
+          ? &this->get_cache_entry(scratch_cloud_cache_index_)
+                 .get_mutable_cache_entry_value(context)
+                 .GetMutableValueOrThrow<PointCloud>()
+          : output;
+  // Every point that is kept is written below, so the memory can be left
+  // uninitialized. The cloud keeps its memory from one call to the next.
+  cloud->resize(offsets.back(), true /* skip_initialize */);
+  // The points are written through raw pointers, since the threads must not
+  // touch the PointCloud itself.
+  Eigen::Ref<Matrix3X<float>> output_xyz = cloud->mutable_xyzs();
+  DRAKE_DEMAND(output_xyz.outerStride() == 3);
+  float* const xyzs = output_xyz.data();
+  uint8_t* rgbs = nullptr;
+  if (has_rgbs) {
+    Eigen::Ref<Matrix3X<uint8_t>> output_rgb = cloud->mutable_rgbs();
+    DRAKE_DEMAND(output_rgb.outerStride() == 3);
+    rgbs = output_rgb.data();
+  }
+
+  internal::DepthImageConversion conversion;
+  conversion.drop_invalid_points = true;
+  conversion.lower_xyz = lower_xyz_;
+  conversion.upper_xyz = upper_xyz_;
+  std::vector<int> sizes(num_cameras);
+  drake::internal::ParallelFor(num_cameras, num_threads_, [&](int i) {
+    float* const camera_xyzs = xyzs + 3 * offsets[i];
+    uint8_t* const camera_rgbs = has_rgbs ? rgbs + 3 * offsets[i] : nullptr;
+    sizes[i] = internal::ConvertDepthImage(
+        camera_infos_[i], poses[i], *depth_images[i], color_images[i], scale_,
+        conversion, camera_xyzs, camera_rgbs);
+    if (has_rgbs && color_images[i] == nullptr) {
+      std::fill(camera_rgbs, camera_rgbs + 3 * sizes[i],
+                PointCloud::kDefaultColor);
+    }
+  });
+
+  // Gathers the points of all the cameras at the front of the cloud. Each
+  // slice only moves towards the front, so it never overwrites the points of
+  // the slices that are still to be moved.
+  int size = sizes[0];
+  for (int i = 1; i < num_cameras; ++i) {
+    std::copy(xyzs + 3 * offsets[i], xyzs + 3 * (offsets[i] + sizes[i]),
+              xyzs + 3 * size);
+    if (has_rgbs) {
+      std::copy(rgbs + 3 * offsets[i], rgbs + 3 * (offsets[i] + sizes[i]),
+                rgbs + 3 * size);
+    }
+    size += sizes[i];
+  }
+  cloud->resize(size);
+
+  if (voxel_size_ > 0) {
+    cloud->VoxelizedDownSample(voxel_size_, num_threads_, output);
+  }
+}
+
+}  // namespace perception
+}  // namespace drake
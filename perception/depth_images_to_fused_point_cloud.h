@@ -0,0 +1,136 @@
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/perception/point_cloud.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/sensors/camera_info.h"
+#include "drake/systems/sensors/pixel_types.h"
+
+namespace drake {
+namespace perception {
+
+/// Converts the depth images of several cameras to a single point cloud.
+///
+/// @system
+/// name: DepthImagesToFusedPointCloud
+/// input_ports:
+/// - depth_image_0
+/// - color_image_0 (optional)
+/// - camera_pose_0 (optional)
+/// - ...
+/// - depth_image_N-1
+/// - color_image_N-1 (optional)
+/// - camera_pose_N-1 (optional)
+/// output_ports:
+/// - point_cloud
+/// @endsystem
+///
+/// Each camera has the same three input ports as DepthImageToPointCloud: a
+/// depth image, an optional color image, and an optional camera pose X_PC
+/// (the identity when unconnected). The images are converted like
+/// DepthImageToPointCloud does, except that the invalid points (NaN,
+/// kTooClose or kTooFar) are always dropped, as are the points outside of the
+/// workspace box [lower_xyz, upper_xyz] of frame P. The points of all the
+/// cameras are then gathered, in the order of the cameras, into a single point
+/// cloud, which is optionally down-sampled to one point per voxel (see
+/// PointCloud::VoxelizedDownSample()).
+///
+/// This is equivalent to, but cheaper than, a diagram of N
+/// DepthImageToPointCloud systems followed by PointCloud::Crop(),
+/// Concatenate() and PointCloud::VoxelizedDownSample(): the images are
+/// converted in parallel, and cropped while they are converted, straight into
+/// the storage of the output port. When the cloud is down-sampled, the images
+/// are instead converted into a scratch cloud of the Context, which is then
+/// down-sampled into the output port. Both clouds keep their memory from one
+/// evaluation to the next.
+///
+/// When the RGB channel is requested, the points of the cameras whose color
+/// image is not connected get PointCloud::kDefaultColor.
+///
+/// @ingroup perception_systems
+class DepthImagesToFusedPointCloud final : public systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DepthImagesToFusedPointCloud)
+
+  /// Constructs the fusion system.
+  ///
+  /// @param[in] camera_infos The info of each camera, which also sets the
+  ///   number of cameras.
+  /// @param[in] depth_pixel_type The pixel type of all the depth image inputs.
+  ///   Only 16U and 32F are supported.
+  /// @param[in] scale The depth image inputs are multiplied by this scale
+  ///   factor before projecting to a point cloud.
+  /// @param[in] fields The fields the point cloud contains; either kXYZs or
+  ///   kXYZs | kRGBs.
+  /// @param[in] lower_xyz The lower corner of the workspace box, in frame P.
+  /// @param[in] upper_xyz The upper corner of the workspace box, in frame P.
+  /// @param[in] voxel_size If positive, the edge length of the voxels the
+  ///   fused point cloud is down-sampled with. If zero, the point cloud is not
+  ///   down-sampled.
+  /// @param[in] num_threads The maximum number of threads used to convert the
+  ///   images and to down-sample the point cloud.
+  /// @throws std::exception if `camera_infos` is empty, `fields` is not
+  ///   supported, lower_xyz > upper_xyz, voxel_size < 0 or num_threads < 1.
+  explicit DepthImagesToFusedPointCloud(
+      std::vector<systems::sensors::CameraInfo> camera_infos,
+      systems::sensors::PixelType depth_pixel_type =
+          systems::sensors::PixelType::kDepth32F,
+      float scale = 1.0, pc_flags::BaseFieldT fields = pc_flags::kXYZs,
+      const Eigen::Vector3d& lower_xyz = Eigen::Vector3d::Constant(
+          -std::numeric_limits<double>::infinity()),
+      const Eigen::Vector3d& upper_xyz = Eigen::Vector3d::Constant(
+          std::numeric_limits<double>::infinity()),
+      double voxel_size = 0.0, int num_threads = 1);
+
+  /// Returns the number of cameras.
+  int num_cameras() const { return static_cast<int>(camera_infos_.size()); }
+
+  /// Returns the abstract valued input port of the i-th camera that expects
+  /// either an ImageDepth16U or ImageDepth32F (depending on the constructor
+  /// argument).
+  const systems::InputPort<double>& depth_image_input_port(int i) const;
+
+  /// Returns the abstract valued input port of the i-th camera that expects
+  /// an ImageRgba8U.
+  const systems::InputPort<double>& color_image_input_port(int i) const;
+
+  /// Returns the abstract valued input port of the i-th camera that expects
+  /// X_PC as a RigidTransformd.
+  const systems::InputPort<double>& camera_pose_input_port(int i) const;
+
+  /// Returns the abstract valued output port that provides the fused
+  /// PointCloud.
+  const systems::OutputPort<double>& point_cloud_output_port() const {
+    return LeafSystem<double>::get_output_port(0);
+  }
+
+ private:
+  template <systems::sensors::PixelType pixel_type>
+  void CalcOutput(const systems::Context<double>&, PointCloud*) const;
+
+  const std::vector<systems::sensors::CameraInfo> camera_infos_;
+  const systems::sensors::PixelType depth_pixel_type_;
+  const float scale_;
+  const pc_flags::BaseFieldT fields_;
+  const Eigen::Vector3f lower_xyz_;
+  const Eigen::Vector3f upper_xyz_;
+  const double voxel_size_;
+  const int num_threads_;
+
+  // The cloud that the images are converted into before they are
+  // down-sampled into the output, when voxel_size_ > 0.
+  systems::CacheIndex scratch_cloud_cache_index_;
+
+  // The input ports of each camera.
+  std::vector<systems::InputPortIndex> depth_image_input_ports_;
+  std::vector<systems::InputPortIndex> color_image_input_ports_;
+  std::vector<systems::InputPortIndex> camera_pose_input_ports_;
+};
+
+}  // namespace perception
+}  // namespace drake
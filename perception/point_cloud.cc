@@ -1,8 +1,12 @@
 #include "drake/perception/point_cloud.h"
 
 #include <algorithm>
-#include <functional>
-#include <unordered_map>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <numeric>
 #include <utility>
 #include <vector>
 
@@ -12,7 +16,7 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_throw.h"
-#include "drake/common/unused.h"
+#include "drake/common/parallel_for.h"
 
 using Eigen::Map;
 using Eigen::NoChange;
@@ -27,6 +31,88 @@ typedef PointCloud::T T;
 typedef PointCloud::C C;
 typedef PointCloud::D D;
 
+/*
+ * A k-d tree of the finite xyzs of a point cloud, for the spatial queries of
+ * `PointCloud`. It keeps its own copy of the xyzs, so that it stays valid
+ * while it is shared, and so that it can tell whether the cloud has changed
+ * since.
+ */
+class SpatialIndex {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SpatialIndex)
+
+  explicit SpatialIndex(const Eigen::Ref<const Matrix3X<T>>& xyzs)
+      : xyzs_(xyzs) {
+    for (int i = 0; i < xyzs.cols(); ++i) {
+      if (xyzs.col(i).array().isFinite().all()) {
+        cloud_indices_.push_back(i);
+      }
+    }
+    data_.resize(cloud_indices_.size(), 3);
+    for (int k = 0; k < static_cast<int>(cloud_indices_.size()); ++k) {
+      data_.row(k) = xyzs.col(cloud_indices_[k]).transpose();
+    }
+    if (data_.rows() > 0) {
+      kd_tree_ = std::make_unique<KdTree>(3, data_);
+    }
+  }
+
+  // Returns true iff `xyzs` are bitwise the xyzs this index was built from.
+  // The xyzs of a cloud are contiguous, so this is a single memcmp.
+  bool Matches(const Eigen::Ref<const Matrix3X<T>>& xyzs) const {
+    DRAKE_ASSERT(xyzs.outerStride() == 3);
+    return xyzs.cols() == xyzs_.cols() &&
+           std::memcmp(xyzs.data(), xyzs_.data(), xyzs_.size() * sizeof(T)) ==
+               0;
+  }
+
+  // Writes the indices in the cloud of the (up to) `num_closest` points
+  // closest to `p` and their squared distances to `p`, sorted by increasing
+  // distance, and returns their number.
+  int FindNearest(const T* p, int num_closest, Eigen::Index* indices,
+                  T* squared_distances) const {
+    if (kd_tree_ == nullptr) {
+      return 0;
+    }
+    const int count = kd_tree_->index->knnSearch(p, num_closest, indices,
+                                                 squared_distances);
+    for (int j = 0; j < count; ++j) {
+      indices[j] = cloud_indices_[indices[j]];
+    }
+    return count;
+  }
+
+  // Sets `matches` to the (index in the cloud, squared distance) of the points
+  // closer to `p` than the square root of `squared_radius`, sorted by
+  // increasing distance.
+  void FindWithinRadius(const T* p, T squared_radius,
+                        std::vector<std::pair<Eigen::Index, T>>* matches)
+      const {
+    matches->clear();
+    if (kd_tree_ == nullptr) {
+      return;
+    }
+    kd_tree_->index->radiusSearch(p, squared_radius, *matches,
+                                  nanoflann::SearchParams());
+    for (auto& match : *matches) {
+      match.first = cloud_indices_[match.first];
+    }
+  }
+
+ private:
+  using KdTree =
+      nanoflann::KDTreeEigenMatrixAdaptor<Eigen::MatrixX3f, 3,
+                                          nanoflann::metric_L2_Simple>;
+
+  // The xyzs of the cloud, including the non-finite ones.
+  Matrix3X<T> xyzs_;
+  // The index in the cloud of each row of data_.
+  std::vector<int> cloud_indices_;
+  Eigen::MatrixX3f data_;
+  // Refers to data_; null when the cloud has no finite xyzs.
+  std::unique_ptr<KdTree> kd_tree_;
+};
+
 }  // namespace
 
 /*
@@ -49,17 +135,15 @@ class PointCloud::Storage {
   // Returns size of the storage.
   int size() const { return size_; }
 
-  // Resize to parent cloud's size.
+  // Resize to parent cloud's size. The matrices only ever grow, so that
+  // shrinking and then growing back the cloud does not reallocate.
   void resize(int new_size) {
+    ResetSpatialIndex();
     size_ = new_size;
-    if (fields_.contains(pc_flags::kXYZs))
-      xyzs_.conservativeResize(NoChange, new_size);
-    if (fields_.contains(pc_flags::kNormals))
-      normals_.conservativeResize(NoChange, new_size);
-    if (fields_.contains(pc_flags::kRGBs))
-      rgbs_.conservativeResize(NoChange, new_size);
-    if (fields_.has_descriptor())
-      descriptors_.conservativeResize(NoChange, new_size);
+    if (fields_.contains(pc_flags::kXYZs)) Reserve(&xyzs_, new_size);
+    if (fields_.contains(pc_flags::kNormals)) Reserve(&normals_, new_size);
+    if (fields_.contains(pc_flags::kRGBs)) Reserve(&rgbs_, new_size);
+    if (fields_.has_descriptor()) Reserve(&descriptors_, new_size);
     CheckInvariants();
   }
 
@@ -71,31 +155,60 @@ class PointCloud::Storage {
     rgbs_.conservativeResize(NoChange, f.contains(pc_flags::kRGBs) ? size_ : 0);
     descriptors_.conservativeResize(NoChange, f.has_descriptor() ? size_ : 0);
     fields_ = f;
+    if (!f.contains(pc_flags::kXYZs)) {
+      ResetSpatialIndex();
+    }
     CheckInvariants();
   }
 
-  Eigen::Ref<Matrix3X<T>> xyzs() { return xyzs_; }
-  Eigen::Ref<Matrix3X<T>> normals() { return normals_; }
-  Eigen::Ref<Matrix3X<C>> rgbs() { return rgbs_; }
-  Eigen::Ref<MatrixX<T>> descriptors() { return descriptors_; }
+  // Discards the spatial index, to release its memory early.
+  void ResetSpatialIndex() { spatial_index_.reset(); }
+
+  // Returns the spatial index of the xyzs, building it if there is none or
+  // if the xyzs have changed since it was built, including through a
+  // previously returned mutable reference. May be called concurrently.
+  std::shared_ptr<const SpatialIndex> GetSpatialIndex() {
+    std::lock_guard<std::mutex> lock(spatial_index_mutex_);
+    if (spatial_index_ == nullptr || !spatial_index_->Matches(xyzs())) {
+      spatial_index_ = std::make_shared<const SpatialIndex>(xyzs());
+    }
+    return spatial_index_;
+  }
+
+  // The matrices may have more columns than the size of the cloud; only the
+  // leading ones are exposed.
+  Eigen::Ref<Matrix3X<T>> xyzs() { return xyzs_.leftCols(size_); }
+  Eigen::Ref<Matrix3X<T>> normals() { return normals_.leftCols(size_); }
+  Eigen::Ref<Matrix3X<C>> rgbs() { return rgbs_.leftCols(size_); }
+  Eigen::Ref<MatrixX<T>> descriptors() {
+    return descriptors_.leftCols(size_);
+  }
 
  private:
+  // Grows `matrix` to at least `size` columns, keeping its values.
+  template <typename Derived>
+  static void Reserve(Eigen::PlainObjectBase<Derived>* matrix, int size) {
+    if (matrix->cols() < size) {
+      matrix->conservativeResize(NoChange, size);
+    }
+  }
+
   void CheckInvariants() const {
     if (fields_.contains(pc_flags::kXYZs)) {
       const int xyz_size = xyzs_.cols();
-      DRAKE_DEMAND(xyz_size == size());
+      DRAKE_DEMAND(xyz_size >= size());
     }
     if (fields_.contains(pc_flags::kNormals)) {
       const int normals_size = normals_.cols();
-      DRAKE_DEMAND(normals_size == size());
+      DRAKE_DEMAND(normals_size >= size());
     }
     if (fields_.contains(pc_flags::kRGBs)) {
       const int rgbs_size = rgbs_.cols();
-      DRAKE_DEMAND(rgbs_size == size());
+      DRAKE_DEMAND(rgbs_size >= size());
     }
     if (fields_.has_descriptor()) {
       const int descriptor_size = descriptors_.cols();
-      DRAKE_DEMAND(descriptor_size == size());
+      DRAKE_DEMAND(descriptor_size >= size());
     }
   }
 
@@ -105,6 +218,8 @@ class PointCloud::Storage {
   Matrix3X<T> normals_;
   Matrix3X<C> rgbs_;
   MatrixX<T> descriptors_;
+  std::mutex spatial_index_mutex_;
+  std::shared_ptr<const SpatialIndex> spatial_index_;
 };
 
 namespace {
@@ -411,105 +526,304 @@ PointCloud Concatenate(const std::vector<PointCloud>& clouds) {
 
 namespace {
 
-// Hash function for Eigen::Vector3i
-// implemented as in boost::hash_combine.
-struct Vector3iHash {
-  std::size_t operator()(const Eigen::Vector3i& index) const {
-    size_t hash = 0;
-    const auto add_to_hash = [&hash] (int value) {
-      hash ^= std::hash<int>{}(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-    };
-    add_to_hash(index.x());
-    add_to_hash(index.y());
-    add_to_hash(index.z());
-    return hash;
+using drake::internal::ParallelFor;
+
+// Returns the first index of the chunk-th of num_chunks contiguous chunks of
+// [0, size).
+int ChunkBegin(int size, int num_chunks, int chunk) {
+  return static_cast<int64_t>(size) * chunk / num_chunks;
+}
+
+// Sorts the points in [begin, end) by (voxel key, index), given that they are
+// ordered by index. This is a least significant digit radix sort on the key,
+// which is stable, using [scratch, scratch + (end - begin)) as its buffer.
+void SortRange(std::pair<uint64_t, int>* begin, std::pair<uint64_t, int>* end,
+               std::pair<uint64_t, int>* scratch) {
+  constexpr int kDigitBits = 11;
+  constexpr uint64_t kDigitMask = (uint64_t{1} << kDigitBits) - 1;
+  uint64_t all_bits = 0;
+  for (auto* p = begin; p != end; ++p) {
+    all_bits |= p->first;
+  }
+  std::array<int, kDigitMask + 1> counts;
+  std::pair<uint64_t, int>* source = begin;
+  std::pair<uint64_t, int>* destination = scratch;
+  for (int shift = 0; shift < 64 && (all_bits >> shift) != 0;
+       shift += kDigitBits) {
+    counts.fill(0);
+    for (auto* p = source; p != source + (end - begin); ++p) {
+      ++counts[(p->first >> shift) & kDigitMask];
+    }
+    int offset = 0;
+    for (int& count : counts) {
+      std::swap(count, offset);
+      offset += count;
+    }
+    for (auto* p = source; p != source + (end - begin); ++p) {
+      destination[counts[(p->first >> shift) & kDigitMask]++] = *p;
+    }
+    std::swap(source, destination);
+  }
+  if (source != begin) {
+    std::copy(source, source + (end - begin), begin);
+  }
+}
+
+// Sorts the points in [begin, end) by (voxel key, index).
+template <typename Key>
+void SortRange(std::pair<Key, int>* begin, std::pair<Key, int>* end,
+               std::pair<Key, int>*) {
+  std::sort(begin, end);
+}
+
+// Sorts the points by (voxel key, index), given that they are ordered by
+// index, by sorting num_threads chunks concurrently and then merging them
+// pairwise. `scratch` is used as the buffer of both steps.
+template <typename Item>
+void ParallelSort(int num_threads, std::vector<Item>* items,
+                  std::vector<Item>* scratch) {
+  const int size = items->size();
+  const int num_chunks = std::max(1, std::min(num_threads, size));
+  scratch->resize(size);
+  ParallelFor(num_chunks, num_threads, [&](int chunk) {
+    const int begin = ChunkBegin(size, num_chunks, chunk);
+    const int end = ChunkBegin(size, num_chunks, chunk + 1);
+    SortRange(items->data() + begin, items->data() + end,
+              scratch->data() + begin);
+  });
+  for (int width = 1; width < num_chunks; width *= 2) {
+    const int num_merges = (num_chunks + 2 * width - 1) / (2 * width);
+    ParallelFor(num_merges, num_threads, [&](int merge) {
+      const int c0 = 2 * width * merge;
+      const int c1 = std::min(c0 + width, num_chunks);
+      const int c2 = std::min(c0 + 2 * width, num_chunks);
+      const auto begin = items->begin();
+      std::merge(begin + ChunkBegin(size, num_chunks, c0),
+                 begin + ChunkBegin(size, num_chunks, c1),
+                 begin + ChunkBegin(size, num_chunks, c1),
+                 begin + ChunkBegin(size, num_chunks, c2),
+                 scratch->begin() + ChunkBegin(size, num_chunks, c0));
+    });
+    items->swap(*scratch);
+  }
+}
+
+// Interleaves the lowest 21 bits of `value` with zeros, so that the Morton
+// code of (x, y, z) is Spread(x) | Spread(y) << 1 | Spread(z) << 2.
+uint64_t Spread(uint64_t value) {
+  value &= 0x1fffff;
+  value = (value | value << 32) & 0x1f00000000ffff;
+  value = (value | value << 16) & 0x1f0000ff0000ff;
+  value = (value | value << 8) & 0x100f00f00f00f00f;
+  value = (value | value << 4) & 0x10c30c30c30c30c3;
+  value = (value | value << 2) & 0x1249249249249249;
+  return value;
+}
+
+// Orders voxels along a Z-order curve. Requires voxel coordinates in
+// [0, 2²¹).
+struct MortonVoxelKey {
+  uint64_t operator()(const Eigen::Vector3i& voxel) const {
+    return Spread(voxel.x()) | Spread(voxel.y()) << 1 |
+           Spread(voxel.z()) << 2;
   }
 };
 
-}  // namespace
+// Orders voxels lexicographically, for any voxel coordinates.
+struct LexicographicVoxelKey {
+  std::array<int, 3> operator()(const Eigen::Vector3i& voxel) const {
+    return {voxel.x(), voxel.y(), voxel.z()};
+  }
+};
 
-PointCloud PointCloud::VoxelizedDownSample(double voxel_size) const {
-  // This is a simple, narrow, no-frills implementation of the
-  // voxel_down_sample algorithm in Open3d and/or the down-sampling by a
-  // VoxelGrid filter in PCL.
-  DRAKE_THROW_UNLESS(has_xyzs());
-  DRAKE_THROW_UNLESS(voxel_size > 0);
-  Eigen::Vector3f lower_xyz =
-      Eigen::Vector3f::Constant(std::numeric_limits<float>::infinity());
-  for (int i = 0; i < size_; ++i) {
-    if (xyz(i).array().isFinite().all()) {
-      lower_xyz[0] = std::min(xyz(i)[0], lower_xyz[0]);
-      lower_xyz[1] = std::min(xyz(i)[1], lower_xyz[1]);
-      lower_xyz[2] = std::min(xyz(i)[2], lower_xyz[2]);
+// Implements VoxelizedDownSample, once the key that orders the voxels has been
+// chosen. The points are sorted by (voxel key, index) into a flat array, so
+// the voxels are contiguous runs of that array and can be averaged
+// independently. The voxels are written into `down_sampled`.
+template <typename VoxelKey>
+void DownSample(const PointCloud& cloud, double voxel_size,
+                const Eigen::Vector3f& lower_xyz, int num_threads,
+                PointCloud* down_sampled) {
+  using Key = decltype(VoxelKey{}(Eigen::Vector3i{}));
+  const int size = cloud.size();
+  const int num_chunks = std::max(1, std::min(num_threads, size));
+  const Eigen::Ref<const Matrix3X<T>> xyzs = cloud.xyzs();
+
+  // Count the points with finite xyz values in each chunk, to know where each
+  // chunk writes its points.
+  std::vector<int> chunk_offset(num_chunks + 1, 0);
+  ParallelFor(num_chunks, num_threads, [&](int chunk) {
+    int count = 0;
+    for (int i = ChunkBegin(size, num_chunks, chunk);
+         i < ChunkBegin(size, num_chunks, chunk + 1); ++i) {
+      count += xyzs.col(i).array().isFinite().all();
     }
+    chunk_offset[chunk + 1] = count;
+  });
+  std::partial_sum(chunk_offset.begin(), chunk_offset.end(),
+                   chunk_offset.begin());
+
+  std::vector<std::pair<Key, int>> points(chunk_offset.back());
+  ParallelFor(num_chunks, num_threads, [&](int chunk) {
+    int k = chunk_offset[chunk];
+    for (int i = ChunkBegin(size, num_chunks, chunk);
+         i < ChunkBegin(size, num_chunks, chunk + 1); ++i) {
+      if (xyzs.col(i).array().isFinite().all()) {
+        points[k++] = {
+            VoxelKey{}(((xyzs.col(i) - lower_xyz) / voxel_size).cast<int>()),
+            i};
+      }
+    }
+  });
+  {
+    std::vector<std::pair<Key, int>> scratch;
+    ParallelSort(num_threads, &points, &scratch);
   }
 
-  // Create a map from voxel coordinate to a set of points.
-  std::unordered_map<Eigen::Vector3i, std::vector<int>, Vector3iHash>
-      voxel_map;
-  for (int i = 0; i < size_; ++i) {
-    if (xyz(i).array().isFinite().all()) {
-      voxel_map[((xyz(i) - lower_xyz) / voxel_size).cast<int>()].emplace_back(
-          i);
+  // voxel_begin[v] is the first point of the v-th voxel in `points`.
+  std::vector<int> voxel_begin;
+  for (int k = 0; k < static_cast<int>(points.size()); ++k) {
+    if (k == 0 || points[k].first != points[k - 1].first) {
+      voxel_begin.push_back(k);
     }
   }
-  PointCloud down_sampled(voxel_map.size(), fields());
-
-  // Iterate through the map populating the elements of the down_sampled cloud.
-  // TODO(russt): Consider using OpenMP. Sample code from calderpg-tri provided
-  // during review of #17885.
-  int index_in_down_sampled = 0;
-  for (const auto& [coordinates, indices_in_this] : voxel_map) {
-    unused(coordinates);
-    // Use doubles instead of floats for accumulators to avoid round-off errors.
-    Eigen::Vector3d xyz{Eigen::Vector3d::Zero()};
-    Eigen::Vector3d normal{Eigen::Vector3d::Zero()};
-    Eigen::Vector3d rgb{Eigen::Vector3d::Zero()};
-    Eigen::VectorXd descriptor{
-        Eigen::VectorXd::Zero(has_descriptors() ? descriptors().rows() : 0)};
-    int num_normals{0};
-    int num_descriptors{0};
-
-    for (int index_in_this : indices_in_this) {
-      xyz += xyzs().col(index_in_this).cast<double>();
-      if (has_normals() &&
-          normals().col(index_in_this).array().isFinite().all()) {
-        normal += normals().col(index_in_this).cast<double>();
-        ++num_normals;
+  const int num_voxels = voxel_begin.size();
+  voxel_begin.push_back(points.size());
+
+  // Access the fields through references obtained once, with empty matrices
+  // standing in for the fields that the cloud does not have.
+  const bool has_normals = cloud.has_normals();
+  const bool has_rgbs = cloud.has_rgbs();
+  const bool has_descriptors = cloud.has_descriptors();
+  Matrix3X<T> no_normals;
+  Matrix3X<C> no_rgbs;
+  MatrixX<D> no_descriptors;
+  using ConstRef3XT = Eigen::Ref<const Matrix3X<T>>;
+  using ConstRef3XC = Eigen::Ref<const Matrix3X<C>>;
+  using ConstRefXD = Eigen::Ref<const MatrixX<D>>;
+  const ConstRef3XT normals =
+      has_normals ? cloud.normals() : ConstRef3XT(no_normals);
+  const ConstRef3XC rgbs = has_rgbs ? cloud.rgbs() : ConstRef3XC(no_rgbs);
+  const ConstRefXD descriptors =
+      has_descriptors ? cloud.descriptors() : ConstRefXD(no_descriptors);
+  // Every voxel is written below, so the memory can be left uninitialized.
+  down_sampled->resize(num_voxels, true /* skip_initialize */);
+  Eigen::Ref<Matrix3X<T>> new_xyzs = down_sampled->mutable_xyzs();
+  Eigen::Ref<Matrix3X<T>> new_normals =
+      has_normals ? down_sampled->mutable_normals()
+                  : Eigen::Ref<Matrix3X<T>>(no_normals);
+  Eigen::Ref<Matrix3X<C>> new_rgbs =
+      has_rgbs ? down_sampled->mutable_rgbs()
+               : Eigen::Ref<Matrix3X<C>>(no_rgbs);
+  Eigen::Ref<MatrixX<D>> new_descriptors =
+      has_descriptors ? down_sampled->mutable_descriptors()
+                      : Eigen::Ref<MatrixX<D>>(no_descriptors);
+
+  const int num_voxel_chunks = std::max(1, std::min(num_threads, num_voxels));
+  ParallelFor(num_voxel_chunks, num_threads, [&](int chunk) {
+    // Use doubles instead of floats for accumulators to avoid round-off
+    // errors.
+    Eigen::VectorXd descriptor(descriptors.rows());
+    for (int v = ChunkBegin(num_voxels, num_voxel_chunks, chunk);
+         v < ChunkBegin(num_voxels, num_voxel_chunks, chunk + 1); ++v) {
+      Eigen::Vector3d xyz{Eigen::Vector3d::Zero()};
+      Eigen::Vector3d normal{Eigen::Vector3d::Zero()};
+      Eigen::Vector3d rgb{Eigen::Vector3d::Zero()};
+      descriptor.setZero();
+      int num_normals{0};
+      int num_descriptors{0};
+      for (int k = voxel_begin[v]; k < voxel_begin[v + 1]; ++k) {
+        const int index_in_cloud = points[k].second;
+        xyz += xyzs.col(index_in_cloud).cast<double>();
+        if (has_normals &&
+            normals.col(index_in_cloud).array().isFinite().all()) {
+          normal += normals.col(index_in_cloud).cast<double>();
+          ++num_normals;
+        }
+        if (has_rgbs) {
+          rgb += rgbs.col(index_in_cloud).cast<double>();
+        }
+        if (has_descriptors &&
+            descriptors.col(index_in_cloud).array().isFinite().all()) {
+          descriptor += descriptors.col(index_in_cloud).cast<double>();
+          ++num_descriptors;
+        }
       }
-      if (has_rgbs()) {
-        rgb += rgbs().col(index_in_this).cast<double>();
+      const int num_points = voxel_begin[v + 1] - voxel_begin[v];
+      new_xyzs.col(v) = (xyz / num_points).cast<T>();
+      if (has_normals) {
+        new_normals.col(v) = (normal / num_normals).normalized().cast<T>();
       }
-      if (has_descriptors() &&
-          descriptors().col(index_in_this).array().isFinite().all()) {
-        descriptor += descriptors().col(index_in_this).cast<double>();
-        ++num_descriptors;
+      if (has_rgbs) {
+        new_rgbs.col(v) = (rgb / num_points).cast<C>();
+      }
+      if (has_descriptors) {
+        new_descriptors.col(v) = (descriptor / num_descriptors).cast<D>();
       }
     }
-    down_sampled.mutable_xyzs().col(index_in_down_sampled) =
-        (xyz / indices_in_this.size()).cast<T>();
-    if (has_normals()) {
-      down_sampled.mutable_normals().col(index_in_down_sampled) =
-          (normal / num_normals).normalized().cast<T>();
-    }
-    if (has_rgbs()) {
-      down_sampled.mutable_rgbs().col(index_in_down_sampled) =
-          (rgb / indices_in_this.size()).cast<C>();
-    }
-    if (has_descriptors()) {
-      down_sampled.mutable_descriptors().col(index_in_down_sampled) =
-          (descriptor / num_descriptors).cast<D>();
-    }
-    ++index_in_down_sampled;
-  }
+  });
+}
+
+}  // namespace
 
+PointCloud PointCloud::VoxelizedDownSample(double voxel_size,
+                                           int num_threads) const {
+  PointCloud down_sampled(0, fields());
+  VoxelizedDownSample(voxel_size, num_threads, &down_sampled);
   return down_sampled;
 }
 
-bool PointCloud::EstimateNormals(double radius, int num_closest) {
+void PointCloud::VoxelizedDownSample(double voxel_size, int num_threads,
+                                     PointCloud* output) const {
+  // This is a simple, narrow, no-frills implementation of the
+  // voxel_down_sample algorithm in Open3d and/or the down-sampling by a
+  // VoxelGrid filter in PCL, using a sort of the points by voxel instead of a
+  // hash map of per-voxel index lists.
+  DRAKE_THROW_UNLESS(has_xyzs());
+  DRAKE_THROW_UNLESS(voxel_size > 0);
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  DRAKE_THROW_UNLESS(output != nullptr && output != this);
+  output->RequireExactFields(fields());
+  const Eigen::Ref<const Matrix3X<T>> xyzs = this->xyzs();
+  const int num_chunks = std::max(1, std::min(num_threads, size_));
+  Eigen::Matrix3Xf chunk_lower(3, num_chunks);
+  Eigen::Matrix3Xf chunk_upper(3, num_chunks);
+  ParallelFor(num_chunks, num_threads, [&](int chunk) {
+    Eigen::Vector3f lower_xyz =
+        Eigen::Vector3f::Constant(std::numeric_limits<float>::infinity());
+    Eigen::Vector3f upper_xyz = -lower_xyz;
+    for (int i = ChunkBegin(size_, num_chunks, chunk);
+         i < ChunkBegin(size_, num_chunks, chunk + 1); ++i) {
+      if (xyzs.col(i).array().isFinite().all()) {
+        lower_xyz = lower_xyz.cwiseMin(xyzs.col(i));
+        upper_xyz = upper_xyz.cwiseMax(xyzs.col(i));
+      }
+    }
+    chunk_lower.col(chunk) = lower_xyz;
+    chunk_upper.col(chunk) = upper_xyz;
+  });
+  const Eigen::Vector3f lower_xyz = chunk_lower.rowwise().minCoeff();
+  const Eigen::Vector3f upper_xyz = chunk_upper.rowwise().maxCoeff();
+
+  // Sort the voxels along a Z-order curve when their coordinates fit in a
+  // 64-bit Morton code, which keeps nearby voxels nearby in the output.
+  const float max_voxel_coordinate =
+      ((upper_xyz - lower_xyz) / voxel_size).maxCoeff();
+  if (max_voxel_coordinate < (1 << 21)) {
+    DownSample<MortonVoxelKey>(*this, voxel_size, lower_xyz, num_threads,
+                               output);
+  } else {
+    DownSample<LexicographicVoxelKey>(*this, voxel_size, lower_xyz,
+                                      num_threads, output);
+  }
+}
+
+bool PointCloud::EstimateNormals(double radius, int num_closest,
+                                 int num_threads) {
   DRAKE_DEMAND(radius > 0);
   DRAKE_DEMAND(num_closest >= 3);
   DRAKE_THROW_UNLESS(has_xyzs());
+  DRAKE_THROW_UNLESS(num_threads >= 1);
   constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
   const double squared_radius = radius * radius;
 
@@ -518,50 +832,54 @@ bool PointCloud::EstimateNormals(double radius, int num_closest) {
     storage_->UpdateFields(fields_);
   }
 
-  const Eigen::MatrixX3f data = xyzs().transpose();
-  nanoflann::KDTreeEigenMatrixAdaptor<Eigen::MatrixX3f, 3,
-                                      nanoflann::metric_L2_Simple>
-      kd_tree(3, data);
-
-  // Iterate through all points and compute their normals.
-  // TODO(russt): Make an OpenMP implementation of this.
-  VectorX<Eigen::Index> indices(num_closest);
-  Eigen::VectorXf distances(num_closest);
-  Eigen::Vector3d mean;
-  Eigen::Matrix3d covariance;
-
-  bool all_points_have_at_least_three_neighbors = true;
-  for (int i = 0; i < size_; ++i) {
-    // With nanoflann, I can either search for the num_closest and
-    // take the ones closer than radius, or search for all points closer than
-    // radius and keep the num_closest.
-    const int num_neighbors = kd_tree.index->knnSearch(
-        xyz(i).data(), num_closest, indices.data(), distances.data());
-
-    if (num_neighbors < 3) {
-      all_points_have_at_least_three_neighbors = false;
-    }
+  const std::shared_ptr<const SpatialIndex> index =
+      storage_->GetSpatialIndex();
+  const Eigen::Ref<const Matrix3X<T>> xyzs = this->xyzs();
+  Eigen::Ref<Matrix3X<T>> normals = mutable_normals();
+
+  // Each point is processed independently, so the points are split into
+  // chunks that are pulled by the threads.
+  const int num_chunks = std::max(1, std::min(size_, 16 * num_threads));
+  std::vector<uint8_t> chunk_ok(num_chunks, true);
+  ParallelFor(num_chunks, num_threads, [&](int chunk) {
+    VectorX<Eigen::Index> indices(num_closest);
+    Eigen::VectorXf distances(num_closest);
+    Eigen::Vector3d mean;
+    Eigen::Matrix3d covariance;
+    for (int i = ChunkBegin(size_, num_chunks, chunk);
+         i < ChunkBegin(size_, num_chunks, chunk + 1); ++i) {
+      // With nanoflann, I can either search for the num_closest and
+      // take the ones closer than radius, or search for all points closer than
+      // radius and keep the num_closest.
+      const int num_neighbors =
+          xyzs.col(i).array().isFinite().all()
+              ? index->FindNearest(xyzs.col(i).data(), num_closest,
+                                   indices.data(), distances.data())
+              : 0;
+
+      if (num_neighbors < 3) {
+        chunk_ok[chunk] = false;
+      }
 
-    if (num_neighbors < 2) {
-      mutable_normal(i) = Eigen::Vector3f::Constant(kNaN);
-      continue;
-    }
+      if (num_neighbors < 2) {
+        normals.col(i) = Eigen::Vector3f::Constant(kNaN);
+        continue;
+      }
 
-    // Compute the covariance matrix.
-    {
+      // Compute the covariance matrix.
       int count = 0;
       mean.setZero();
       for (int j = 0; j < num_neighbors; ++j) {
         if (distances[j] <= squared_radius) {
           ++count;
-          mean += xyz(indices[j]).cast<double>();
+          mean += xyzs.col(indices[j]).cast<double>();
         }
       }
       if (count < 3) {
-        all_points_have_at_least_three_neighbors = false;
+        chunk_ok[chunk] = false;
       }
       if (count < 2) {
-        mutable_normal(i) = Eigen::Vector3f::Constant(kNaN);
+        normals.col(i) = Eigen::Vector3f::Constant(kNaN);
         continue;
       }
 
@@ -569,20 +887,80 @@ bool PointCloud::EstimateNormals(double radius, int num_closest) {
       covariance.setZero();
       for (int j = 0; j < num_neighbors; ++j) {
         if (distances[j] <= squared_radius) {
-          const Eigen::VectorXd x_minus_mean =
-              xyz(indices[j]).cast<double>() - mean;
+          const Eigen::Vector3d x_minus_mean =
+              xyzs.col(indices[j]).cast<double>() - mean;
           covariance += x_minus_mean * x_minus_mean.transpose();
         }
       }
+
+      // TODO(russt): Open3d implements a "FastEigen3x3" for an optimized
+      // version of this. We probably should, too.
+      Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
+      solver.computeDirect(covariance, Eigen::ComputeEigenvectors);
+      normals.col(i) = solver.eigenvectors().col(0).cast<float>();
     }
+  });
+  return std::all_of(chunk_ok.begin(), chunk_ok.end(),
+                     [](uint8_t ok) { return ok; });
+}
 
-    // TODO(russt): Open3d implements a "FastEigen3x3" for an optimized version
-    // of this. We probably should, too.
-    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
-    solver.computeDirect(covariance, Eigen::ComputeEigenvectors);
-    mutable_normal(i) = solver.eigenvectors().col(0).cast<float>();
+Eigen::MatrixXi PointCloud::FindNearestNeighbors(
+    const Eigen::Ref<const Matrix3X<T>>& queries, int num_closest,
+    int num_threads, MatrixX<T>* squared_distances) const {
+  DRAKE_THROW_UNLESS(has_xyzs());
+  DRAKE_THROW_UNLESS(num_closest >= 1);
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  const std::shared_ptr<const SpatialIndex> index =
+      storage_->GetSpatialIndex();
+  const int num_queries = queries.cols();
+  Eigen::MatrixXi indices(num_closest, num_queries);
+  MatrixX<T> distances(num_closest, num_queries);
+  const int num_chunks = std::max(1, std::min(num_queries, 16 * num_threads));
+  ParallelFor(num_chunks, num_threads, [&](int chunk) {
+    VectorX<Eigen::Index> found(num_closest);
+    for (int j = ChunkBegin(num_queries, num_chunks, chunk);
+         j < ChunkBegin(num_queries, num_chunks, chunk + 1); ++j) {
+      // The columns of queries may not be contiguous.
+      const Vector3<T> query = queries.col(j);
+      const int count = index->FindNearest(query.data(), num_closest,
+                                           found.data(), &distances(0, j));
+      indices.col(j).head(count) = found.head(count).cast<int>();
+      indices.col(j).tail(num_closest - count).setConstant(-1);
+      distances.col(j).tail(num_closest - count).setConstant(
+          std::numeric_limits<T>::infinity());
+    }
+  });
+  if (squared_distances != nullptr) {
+    *squared_distances = std::move(distances);
   }
-  return all_points_have_at_least_three_neighbors;
+  return indices;
+}
+
+std::vector<std::vector<int>> PointCloud::FindNeighborsWithinRadius(
+    const Eigen::Ref<const Matrix3X<T>>& queries, double radius,
+    int num_threads) const {
+  DRAKE_THROW_UNLESS(has_xyzs());
+  DRAKE_THROW_UNLESS(radius > 0);
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  const std::shared_ptr<const SpatialIndex> index =
+      storage_->GetSpatialIndex();
+  const T squared_radius = radius * radius;
+  const int num_queries = queries.cols();
+  std::vector<std::vector<int>> neighbors(num_queries);
+  const int num_chunks = std::max(1, std::min(num_queries, 16 * num_threads));
+  ParallelFor(num_chunks, num_threads, [&](int chunk) {
+    std::vector<std::pair<Eigen::Index, T>> matches;
+    for (int j = ChunkBegin(num_queries, num_chunks, chunk);
+         j < ChunkBegin(num_queries, num_chunks, chunk + 1); ++j) {
+      const Vector3<T> query = queries.col(j);
+      index->FindWithinRadius(query.data(), squared_radius, &matches);
+      neighbors[j].reserve(matches.size());
+      for (const auto& match : matches) {
+        neighbors[j].push_back(match.first);
+      }
+    }
+  });
+  return neighbors;
 }
 
 }  // namespace perception
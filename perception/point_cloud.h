@@ -134,6 +134,10 @@ class PointCloud final {
   ///    true.
   /// @param skip_initialize
   ///    Do not default-initialize new values.
+  ///
+  /// Like `std::vector`, shrinking the cloud does not release its memory, so
+  /// that growing it back (e.g. when converting a stream of images into the
+  /// same cloud) does not reallocate. Copy the cloud to release the memory.
   void resize(int new_size, bool skip_initialize = false);
 
   /// @name Geometric Descriptors - XYZs
@@ -333,9 +337,28 @@ class PointCloud final {
   /// non-finite xyz values are ignored. All other fields (e.g. rgbs, normals,
   /// and descriptors) with finite values will also be averaged across the
   /// points in a voxel.
+  ///
+  /// The points are sorted by voxel (along a Z-order curve, when the voxel
+  /// coordinates allow it), so nearby voxels are usually nearby in the
+  /// returned cloud. Up to `num_threads` threads are used; the result does not
+  /// depend on the number of threads.
+  /// @throws std::exception if has_xyzs() is false.
+  /// @throws std::exception if voxel_size <= 0.
+  /// @throws std::exception if num_threads < 1.
+  PointCloud VoxelizedDownSample(double voxel_size, int num_threads = 1) const;
+
+  /// Down-samples this cloud as above, but writes the result into `output`,
+  /// which is resized to the number of occupied voxels. The memory of
+  /// `output` is reused when it is large enough, so down-sampling repeatedly
+  /// into the same cloud does not allocate.
+  /// @throws std::exception if `output` is nullptr or `this`.
+  /// @throws std::exception if `output` does not have exactly the fields of
+  ///   this cloud.
   /// @throws std::exception if has_xyzs() is false.
   /// @throws std::exception if voxel_size <= 0.
-  PointCloud VoxelizedDownSample(double voxel_size) const;
+  /// @throws std::exception if num_threads < 1.
+  void VoxelizedDownSample(double voxel_size, int num_threads,
+                           PointCloud* output) const;
 
   /// Estimates the normal vectors in `this` by fitting a plane at each point
   /// in the cloud using up to `num_closest` points within Euclidean distance
@@ -350,9 +373,56 @@ class PointCloud final {
   /// @returns true iff all points were assigned normals by having at least
   /// *three* closest points within @p radius.
   ///
+  /// The neighbors are found with the spatial index (see
+  /// FindNearestNeighbors()), and the normals are estimated with up to
+  /// `num_threads` threads; the result does not depend on the number of
+  /// threads. Points with non-finite xyz values receive NaN normals.
+  ///
   /// @pre @p radius > 0 and @p num_closest >= 3.
   /// @throws std::exception if has_xyzs() is false.
-  bool EstimateNormals(double radius, int num_closest);
+  /// @throws std::exception if num_threads < 1.
+  bool EstimateNormals(double radius, int num_closest, int num_threads = 1);
+
+  /// @name Spatial Queries
+  /// These queries use a spatial index (a k-d tree) of the points of `this`
+  /// with finite xyz values. The index is built by the first query, and is
+  /// reused by the following ones as long as the xyzs are unchanged. Each
+  /// query compares the xyzs with the copy kept by the index (a linear-time
+  /// memory comparison), so changes made by any means, including through a
+  /// reference obtained earlier from mutable_xyzs() or from Python, are
+  /// always seen. Queries on the same cloud may run concurrently, but not
+  /// concurrently with changes.
+  /// @{
+
+  /// Finds, for each column of `queries`, the `num_closest` points of `this`
+  /// closest to it. Returns a `num_closest` x `queries.cols()` matrix whose
+  /// column j holds the indices of the points closest to `queries.col(j)`,
+  /// sorted by increasing distance. When `this` has fewer than `num_closest`
+  /// points with finite xyzs, the columns are padded with -1.
+  ///
+  /// @param squared_distances If not null, is resized like the returned
+  /// matrix and set to the squared distances to the found points, and
+  /// infinity for the padding.
+  /// @param num_threads The queries are split across up to this many threads.
+  /// @throws std::exception if has_xyzs() is false.
+  /// @throws std::exception if num_closest < 1 or num_threads < 1.
+  Eigen::MatrixXi FindNearestNeighbors(
+      const Eigen::Ref<const Matrix3X<T>>& queries, int num_closest,
+      int num_threads = 1, MatrixX<T>* squared_distances = nullptr) const;
+
+  /// Finds, for each column of `queries`, the points of `this` at a Euclidean
+  /// distance less than `radius` from it. Element j of the result holds the
+  /// indices of the points near `queries.col(j)`, sorted by increasing
+  /// distance.
+  ///
+  /// @param num_threads The queries are split across up to this many threads.
+  /// @throws std::exception if has_xyzs() is false.
+  /// @throws std::exception if radius <= 0 or num_threads < 1.
+  std::vector<std::vector<int>> FindNeighborsWithinRadius(
+      const Eigen::Ref<const Matrix3X<T>>& queries, double radius,
+      int num_threads = 1) const;
+
+  /// @}
 
  private:
   void SetDefault(int start, int num);
@@ -3,6 +3,7 @@
 #include <cmath>
 #include <limits>
 #include <stdexcept>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -145,7 +146,8 @@ class DepthImageToPointCloudTest : public ::testing::Test {
       const std::optional<RigidTransformd>& camera_pose,
       const MatrixX<Pixel>& depth_image_matrix,
       const std::optional<systems::sensors::ImageRgba8U>& color_image,
-      const std::optional<float>& scale) {
+      const std::optional<float>& scale, bool drop_invalid_points = false,
+      int pixel_stride = 1) {
     const auto depth_image = MakeDepthImage(depth_image_matrix);
 
     // Call the DUT to convert Image to PointCloud.
@@ -153,7 +155,8 @@ class DepthImageToPointCloudTest : public ::testing::Test {
     if (kUseSystem) {
       PointCloud result(0, kFields);
       const DepthImageToPointCloud dut(camera_info, kConfiguredPixelType,
-                                       scale.value_or(1.0), kFields);
+                                       scale.value_or(1.0), kFields,
+                                       drop_invalid_points, pixel_stride);
       auto context = dut.CreateDefaultContext();
       dut.get_input_port(0).FixValue(context.get(), depth_image);
       if (kFields & pc_flags::kRGBs) {
@@ -167,10 +170,12 @@ class DepthImageToPointCloudTest : public ::testing::Test {
       PointCloud result(0, kFields);
       if (kFields & pc_flags::kRGBs) {
         DepthImageToPointCloud::Convert(camera_info, camera_pose, depth_image,
-                                        color_image, scale, &result);
+                                        color_image, scale, &result,
+                                        drop_invalid_points, pixel_stride);
       } else {
         DepthImageToPointCloud::Convert(camera_info, camera_pose, depth_image,
-                                        std::nullopt, scale, &result);
+                                        std::nullopt, scale, &result,
+                                        drop_invalid_points, pixel_stride);
       }
       return result;
     }
@@ -482,6 +487,71 @@ TYPED_TEST(DepthImageToPointCloudTest, ResetStorage) {
   }
 }
 
+// Verifies that the invalid pixels can be dropped, and that the image can be
+// down-sampled, in the same pass as the conversion.
+TYPED_TEST(DepthImageToPointCloudTest, DropInvalidAndStride) {
+  using TestFixturePixel = typename TestFixture::Pixel;
+  using Traits = typename TestFixture::ConfiguredImageTraits;
+
+  static constexpr int kImageWidth = 5;
+  static constexpr int kImageHeight = 3;
+  static constexpr float kFocal = 10.0f;
+  const CameraInfo camera(kImageWidth, kImageHeight, kFocal, kFocal, 2.0, 1.0);
+  const auto& pose = this->random_transform_;
+
+  // Every pixel has a distinct depth, except for the invalid ones.
+  MatrixX<TestFixturePixel> depth_image(kImageWidth, kImageHeight);
+  for (int v = 0; v < kImageHeight; ++v) {
+    for (int u = 0; u < kImageWidth; ++u) {
+      depth_image(u, v) = 1 + u + kImageWidth * v;
+    }
+  }
+  depth_image(1, 0) = Traits::kTooClose;
+  depth_image(2, 2) = Traits::kTooFar;
+  if constexpr (!std::is_same_v<TestFixturePixel, uint16_t>) {
+    depth_image(4, 1) = kFloatNaN;
+  }
+
+  // The color of a pixel is its row and column.
+  ImageRgba8U color_image(kImageWidth, kImageHeight);
+  for (int v = 0; v < kImageHeight; ++v) {
+    for (int u = 0; u < kImageWidth; ++u) {
+      color_image.at(u, v)[0] = u;
+      color_image.at(u, v)[1] = v;
+    }
+  }
+
+  const PointCloud full =
+      this->DoConvert(camera, pose, depth_image, color_image, std::nullopt);
+  ASSERT_EQ(full.size(), kImageWidth * kImageHeight);
+
+  for (int pixel_stride : {1, 2}) {
+    for (bool drop_invalid_points : {false, true}) {
+      const PointCloud result =
+          this->DoConvert(camera, pose, depth_image, color_image, std::nullopt,
+                          drop_invalid_points, pixel_stride);
+      // Find the expected points in the full conversion.
+      std::vector<int> expected;
+      for (int v = 0; v < kImageHeight; v += pixel_stride) {
+        for (int u = 0; u < kImageWidth; u += pixel_stride) {
+          const int i = u + kImageWidth * v;
+          if (!drop_invalid_points ||
+              full.xyz(i).array().isFinite().all()) {
+            expected.push_back(i);
+          }
+        }
+      }
+      ASSERT_EQ(result.size(), static_cast<int>(expected.size()));
+      for (int k = 0; k < result.size(); ++k) {
+        EXPECT_TRUE(CompareMatrices(result.xyz(k), full.xyz(expected[k])));
+        if (TestFixture::kFields & pc_flags::kRGBs) {
+          EXPECT_EQ(result.rgb(k), full.rgb(expected[k]));
+        }
+      }
+    }
+  }
+}
+
 }  // namespace
 }  // namespace perception
 }  // namespace drake
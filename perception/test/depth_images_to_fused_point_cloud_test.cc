@@ -0,0 +1,200 @@
+#include "drake/perception/depth_images_to_fused_point_cloud.h"
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/perception/depth_image_to_point_cloud.h"
+#include "drake/systems/sensors/camera_info.h"
+#include "drake/systems/sensors/image.h"
+
+using drake::math::RigidTransformd;
+using drake::math::RollPitchYawd;
+using drake::systems::sensors::CameraInfo;
+using drake::systems::sensors::ImageDepth32F;
+using drake::systems::sensors::ImageRgba8U;
+using drake::systems::sensors::PixelType;
+using Eigen::Vector3d;
+using Eigen::Vector3f;
+
+namespace drake {
+namespace perception {
+namespace {
+
+constexpr float kFloatInf = std::numeric_limits<float>::infinity();
+constexpr float kFloatNaN = std::numeric_limits<float>::quiet_NaN();
+
+// Two cameras of different sizes looking at the same workspace; only the
+// first one has a color image.
+class DepthImagesToFusedPointCloudTest : public ::testing::Test {
+ protected:
+  DepthImagesToFusedPointCloudTest() {
+    camera_infos_.emplace_back(5, 4, 4.0, 4.0, 2.0, 1.5);
+    camera_infos_.emplace_back(3, 6, 3.0, 5.0, 1.0, 2.5);
+    poses_.emplace_back(RollPitchYawd(0.1, 0.2, 0.3), Vector3d(0.1, 0, 0));
+    poses_.emplace_back(RollPitchYawd(-0.2, 0.4, 1.0), Vector3d(0, 0.2, 0.1));
+    for (const CameraInfo& info : camera_infos_) {
+      ImageDepth32F depth(info.width(), info.height());
+      ImageRgba8U color(info.width(), info.height());
+      for (int v = 0; v < info.height(); ++v) {
+        for (int u = 0; u < info.width(); ++u) {
+          const int k = v * info.width() + u;
+          depth.at(u, v)[0] =
+              (k % 7 == 3) ? kFloatInf : (k % 11 == 5) ? kFloatNaN
+                                                      : 0.5f + 0.05f * k;
+          for (int c = 0; c < 4; ++c) {
+            color.at(u, v)[c] = static_cast<uint8_t>(10 * k + c);
+          }
+        }
+      }
+      depth_images_.push_back(depth);
+      color_images_.push_back(color);
+    }
+  }
+
+  // Converts the images with DepthImageToPointCloud and the PointCloud
+  // functions, which DepthImagesToFusedPointCloud is equivalent to.
+  PointCloud MakeExpected(pc_flags::BaseFieldT fields, const Vector3f& lower,
+                          const Vector3f& upper, double voxel_size) {
+    std::vector<PointCloud> clouds;
+    for (int i = 0; i < 2; ++i) {
+      PointCloud cloud(0, fields);
+      const bool use_color = (fields & pc_flags::kRGBs) && i == 0;
+      DepthImageToPointCloud::Convert(
+          camera_infos_[i], poses_[i], depth_images_[i],
+          use_color ? std::optional<ImageRgba8U>(color_images_[i])
+                    : std::nullopt,
+          std::nullopt, &cloud, true /* drop_invalid_points */);
+      clouds.push_back(cloud.Crop(lower, upper));
+    }
+    PointCloud expected = Concatenate(clouds);
+    if (voxel_size > 0) {
+      expected = expected.VoxelizedDownSample(voxel_size);
+    }
+    return expected;
+  }
+
+  // Evaluates a DepthImagesToFusedPointCloud with the images of the fixture.
+  PointCloud Fuse(pc_flags::BaseFieldT fields, const Vector3f& lower,
+                  const Vector3f& upper, double voxel_size, int num_threads) {
+    const DepthImagesToFusedPointCloud dut(
+        camera_infos_, PixelType::kDepth32F, 1.0, fields, lower.cast<double>(),
+        upper.cast<double>(), voxel_size, num_threads);
+    auto context = dut.CreateDefaultContext();
+    for (int i = 0; i < 2; ++i) {
+      dut.depth_image_input_port(i).FixValue(context.get(), depth_images_[i]);
+      dut.camera_pose_input_port(i).FixValue(context.get(), poses_[i]);
+    }
+    dut.color_image_input_port(0).FixValue(context.get(), color_images_[0]);
+    return dut.point_cloud_output_port().Eval<PointCloud>(*context);
+  }
+
+  std::vector<CameraInfo> camera_infos_;
+  std::vector<RigidTransformd> poses_;
+  std::vector<ImageDepth32F> depth_images_;
+  std::vector<ImageRgba8U> color_images_;
+};
+
+TEST_F(DepthImagesToFusedPointCloudTest, Ports) {
+  const DepthImagesToFusedPointCloud dut(camera_infos_);
+  EXPECT_EQ(dut.num_cameras(), 2);
+  EXPECT_EQ(dut.num_input_ports(), 6);
+  EXPECT_EQ(dut.depth_image_input_port(1).get_name(), "depth_image_1");
+  EXPECT_EQ(dut.color_image_input_port(1).get_name(), "color_image_1");
+  EXPECT_EQ(dut.camera_pose_input_port(1).get_name(), "camera_pose_1");
+  EXPECT_EQ(dut.point_cloud_output_port().get_name(), "point_cloud");
+  EXPECT_THROW(dut.depth_image_input_port(2), std::exception);
+}
+
+TEST_F(DepthImagesToFusedPointCloudTest, BadArguments) {
+  EXPECT_THROW(DepthImagesToFusedPointCloud({}), std::exception);
+  EXPECT_THROW(DepthImagesToFusedPointCloud(camera_infos_, PixelType::kRgba8U),
+               std::exception);
+  EXPECT_THROW(DepthImagesToFusedPointCloud(
+                   camera_infos_, PixelType::kDepth32F, 1.0,
+                   pc_flags::kXYZs | pc_flags::kNormals),
+               std::exception);
+  EXPECT_THROW(DepthImagesToFusedPointCloud(
+                   camera_infos_, PixelType::kDepth32F, 1.0, pc_flags::kXYZs,
+                   Vector3d::Constant(1), Vector3d::Constant(0)),
+               std::exception);
+  EXPECT_THROW(DepthImagesToFusedPointCloud(
+                   camera_infos_, PixelType::kDepth32F, 1.0, pc_flags::kXYZs,
+                   Vector3d::Constant(0), Vector3d::Constant(1), -1.0),
+               std::exception);
+  EXPECT_THROW(DepthImagesToFusedPointCloud(
+                   camera_infos_, PixelType::kDepth32F, 1.0, pc_flags::kXYZs,
+                   Vector3d::Constant(0), Vector3d::Constant(1), 0.0, 0),
+               std::exception);
+}
+
+TEST_F(DepthImagesToFusedPointCloudTest, Fuse) {
+  const Vector3f lower(-0.5, -0.5, 0.2);
+  const Vector3f upper(0.5, 0.6, 1.5);
+  for (const pc_flags::BaseFieldT fields : std::vector<pc_flags::BaseFieldT>{
+           pc_flags::kXYZs, pc_flags::kXYZs | pc_flags::kRGBs}) {
+    const PointCloud expected = MakeExpected(fields, lower, upper, 0.0);
+    // The workspace box crops some of the valid points.
+    ASSERT_GT(expected.size(), 0);
+    ASSERT_LT(expected.size(),
+              MakeExpected(fields, Vector3f::Constant(-kFloatInf),
+                           Vector3f::Constant(kFloatInf), 0.0)
+                  .size());
+    for (int num_threads : {1, 2}) {
+      const PointCloud fused = Fuse(fields, lower, upper, 0.0, num_threads);
+      EXPECT_EQ(fused.fields(), expected.fields());
+      EXPECT_TRUE(CompareMatrices(fused.xyzs(), expected.xyzs()));
+      if (fields & pc_flags::kRGBs) {
+        EXPECT_TRUE(CompareMatrices(fused.rgbs(), expected.rgbs()));
+      }
+    }
+  }
+}
+
+TEST_F(DepthImagesToFusedPointCloudTest, FuseVoxels) {
+  const Vector3f lower = Vector3f::Constant(-kFloatInf);
+  const Vector3f upper = Vector3f::Constant(kFloatInf);
+  const pc_flags::BaseFieldT fields = pc_flags::kXYZs | pc_flags::kRGBs;
+  const PointCloud expected = MakeExpected(fields, lower, upper, 0.2);
+  const PointCloud fused = Fuse(fields, lower, upper, 0.2, 2);
+  EXPECT_TRUE(CompareMatrices(fused.xyzs(), expected.xyzs(), 1e-6));
+  EXPECT_TRUE(CompareMatrices(fused.rgbs(), expected.rgbs()));
+}
+
+// The down-sampled output keeps its memory from one evaluation to the next,
+// even when the second evaluation has fewer voxels.
+TEST_F(DepthImagesToFusedPointCloudTest, FuseVoxelsReusesOutput) {
+  const DepthImagesToFusedPointCloud dut(
+      camera_infos_, PixelType::kDepth32F, 1.0, pc_flags::kXYZs,
+      Vector3d::Constant(-kFloatInf), Vector3d::Constant(kFloatInf), 0.2, 2);
+  auto context = dut.CreateDefaultContext();
+  for (int i = 0; i < 2; ++i) {
+    dut.depth_image_input_port(i).FixValue(context.get(), depth_images_[i]);
+    dut.camera_pose_input_port(i).FixValue(context.get(), poses_[i]);
+  }
+  const PointCloud& fused =
+      dut.point_cloud_output_port().Eval<PointCloud>(*context);
+  const float* const data = fused.xyzs().data();
+  const int size = fused.size();
+
+  // Drop the points of the second camera.
+  std::fill(depth_images_[1].at(0, 0),
+            depth_images_[1].at(0, 0) + depth_images_[1].size(), kFloatNaN);
+  dut.depth_image_input_port(1).FixValue(context.get(), depth_images_[1]);
+  dut.point_cloud_output_port().Eval<PointCloud>(*context);
+  EXPECT_LT(fused.size(), size);
+  EXPECT_EQ(fused.xyzs().data(), data);
+  const PointCloud expected =
+      MakeExpected(pc_flags::kXYZs, Vector3f::Constant(-kFloatInf),
+                   Vector3f::Constant(kFloatInf), 0.2);
+  EXPECT_TRUE(CompareMatrices(fused.xyzs(), expected.xyzs(), 1e-6));
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
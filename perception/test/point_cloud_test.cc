@@ -1,12 +1,19 @@
 #include "drake/perception/point_cloud.h"
 
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <map>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "drake/common/random.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_no_throw.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
 
 using Eigen::Matrix3Xf;
 using Eigen::Matrix4Xf;
@@ -21,6 +28,9 @@ namespace drake {
 namespace perception {
 namespace {
 
+const float kInf = std::numeric_limits<float>::infinity();
+const float kNaN = std::numeric_limits<float>::quiet_NaN();
+
 // Provides a helper mechanism to (a) check default types and (b) compare
 // matrices, handling the special case of unsigned values.
 template <typename T>
@@ -521,6 +531,85 @@ GTEST_TEST(PointCloudTest, VoxelizedDownSample) {
   EXPECT_TRUE(found_match_for_cloud_0);
 }
 
+GTEST_TEST(PointCloudTest, VoxelizedDownSampleThreads) {
+  const auto fields = pc_flags::kXYZs | pc_flags::kRGBs;
+  PointCloud cloud(10000, fields);
+  std::srand(1234);
+  cloud.mutable_xyzs().setRandom();
+  cloud.mutable_rgbs().setRandom();
+  cloud.mutable_xyz(17)[2] = std::numeric_limits<float>::quiet_NaN();
+
+  // Compare with an explicit grouping of the points by voxel.
+  const double voxel_size = 0.25;
+  Vector3f lower_xyz = cloud.xyz(0);
+  for (int i = 0; i < cloud.size(); ++i) {
+    if (i != 17) {
+      lower_xyz = lower_xyz.cwiseMin(cloud.xyz(i));
+    }
+  }
+  std::map<std::array<int, 3>, std::vector<int>> voxels;
+  for (int i = 0; i < cloud.size(); ++i) {
+    if (i != 17) {
+      const Eigen::Vector3i voxel =
+          ((cloud.xyz(i) - lower_xyz) / voxel_size).cast<int>();
+      voxels[{voxel.x(), voxel.y(), voxel.z()}].push_back(i);
+    }
+  }
+  const PointCloud down_sampled = cloud.VoxelizedDownSample(voxel_size);
+  ASSERT_EQ(down_sampled.size(), voxels.size());
+  for (int i = 0; i < down_sampled.size(); ++i) {
+    const Eigen::Vector3i voxel =
+        ((down_sampled.xyz(i) - lower_xyz) / voxel_size).cast<int>();
+    const std::vector<int>& indices = voxels.at({voxel.x(), voxel.y(),
+                                                 voxel.z()});
+    Eigen::Vector3d xyz = Eigen::Vector3d::Zero();
+    for (int index : indices) {
+      xyz += cloud.xyz(index).cast<double>();
+    }
+    EXPECT_TRUE(CompareMatrices(down_sampled.xyz(i),
+                                (xyz / indices.size()).cast<float>(), 1e-6));
+  }
+
+  // The result does not depend on the number of threads.
+  for (int num_threads : {2, 3, 8}) {
+    const PointCloud threaded =
+        cloud.VoxelizedDownSample(voxel_size, num_threads);
+    EXPECT_EQ(threaded.xyzs(), down_sampled.xyzs());
+    EXPECT_EQ(threaded.rgbs(), down_sampled.rgbs());
+  }
+  EXPECT_THROW(cloud.VoxelizedDownSample(voxel_size, 0), std::exception);
+
+  // Voxel coordinates that do not fit in a Morton code.
+  const PointCloud fine = cloud.VoxelizedDownSample(1e-7, 4);
+  EXPECT_EQ(fine.size(), cloud.size() - 1);
+  EXPECT_EQ(cloud.VoxelizedDownSample(1e-7).xyzs(), fine.xyzs());
+}
+
+GTEST_TEST(PointCloudTest, VoxelizedDownSampleIntoOutput) {
+  const auto fields = pc_flags::kXYZs | pc_flags::kRGBs;
+  PointCloud cloud(1000, fields);
+  std::srand(1234);
+  cloud.mutable_xyzs().setRandom();
+  cloud.mutable_rgbs().setRandom();
+  const PointCloud expected = cloud.VoxelizedDownSample(0.5, 2);
+
+  // The output is resized, and its memory is reused once it is large enough.
+  PointCloud output(2000, fields);
+  const float* const data = output.xyzs().data();
+  cloud.VoxelizedDownSample(0.5, 2, &output);
+  EXPECT_EQ(output.xyzs(), expected.xyzs());
+  EXPECT_EQ(output.rgbs(), expected.rgbs());
+  EXPECT_EQ(output.xyzs().data(), data);
+  cloud.VoxelizedDownSample(0.25, 2, &output);
+  EXPECT_EQ(output.xyzs(), cloud.VoxelizedDownSample(0.25).xyzs());
+  EXPECT_EQ(output.xyzs().data(), data);
+
+  PointCloud xyzs_only(0, pc_flags::kXYZs);
+  EXPECT_THROW(cloud.VoxelizedDownSample(0.5, 1, &xyzs_only), std::exception);
+  EXPECT_THROW(cloud.VoxelizedDownSample(0.5, 1, &cloud), std::exception);
+  EXPECT_THROW(cloud.VoxelizedDownSample(0.5, 1, nullptr), std::exception);
+}
+
 // Checks that normal has unit magnitude and that normal == expected up to a
 // sign flip.
 void CheckNormal(const Eigen::Ref<const Eigen::Vector3f>& normal,
@@ -606,6 +695,134 @@ GTEST_TEST(PointCloudTest, EstimateNormalsTwoPoints) {
   }
 }
 
+// Tests that shrinking a cloud keeps its memory for growing it back.
+GTEST_TEST(PointCloudTest, ResizeKeepsMemory) {
+  PointCloud cloud(10, pc_flags::kXYZs | pc_flags::kRGBs);
+  const float* const xyzs = cloud.xyzs().data();
+  const uint8_t* const rgbs = cloud.rgbs().data();
+  cloud.mutable_xyzs().setZero();
+  cloud.resize(3);
+  EXPECT_EQ(cloud.xyzs().cols(), 3);
+  EXPECT_EQ(cloud.rgbs().cols(), 3);
+  cloud.resize(10);
+  EXPECT_EQ(cloud.xyzs().data(), xyzs);
+  EXPECT_EQ(cloud.rgbs().data(), rgbs);
+  // The points that are added back are initialized.
+  EXPECT_TRUE(cloud.xyzs().leftCols(3).isZero());
+  EXPECT_TRUE(cloud.xyzs().rightCols(7).array().isNaN().all());
+}
+
+// Tests that the threaded estimate matches the single-threaded one.
+GTEST_TEST(PointCloudTest, EstimateNormalsThreads) {
+  const int kSize{2000};
+  PointCloud cloud(kSize);
+  RandomGenerator generator(1234);
+  std::normal_distribution<double> distribution(0, 1.0);
+  for (int i = 0; i < 3 * kSize; ++i) {
+    cloud.mutable_xyzs().data()[i] = distribution(generator);
+  }
+  cloud.mutable_xyz(7) = Vector3f::Constant(kInf);
+
+  PointCloud threaded = cloud;
+  EXPECT_FALSE(cloud.EstimateNormals(0.2, 10));
+  EXPECT_FALSE(threaded.EstimateNormals(0.2, 10, 4));
+  EXPECT_TRUE(CompareMatrices(threaded.normals(), cloud.normals()));
+  EXPECT_TRUE(cloud.normal(7).array().isNaN().all());
+  DRAKE_EXPECT_THROWS_MESSAGE(cloud.EstimateNormals(0.2, 10, 0),
+                              ".*num_threads >= 1.*");
+}
+
+// Checks the spatial queries against a brute force search.
+GTEST_TEST(PointCloudTest, SpatialQueries) {
+  const int kSize{500};
+  PointCloud cloud(kSize);
+  RandomGenerator generator(1234);
+  std::uniform_real_distribution<double> distribution(-1, 1);
+  for (int i = 0; i < 3 * kSize; ++i) {
+    cloud.mutable_xyzs().data()[i] = distribution(generator);
+  }
+  cloud.mutable_xyz(3) = Vector3f::Constant(kNaN);
+  Eigen::Matrix3Xf queries(3, 20);
+  for (int i = 0; i < queries.size(); ++i) {
+    queries.data()[i] = distribution(generator);
+  }
+
+  // Returns the (squared distance, index) of the finite points, sorted.
+  const auto brute_force = [&cloud](const Vector3f& query) {
+    std::vector<std::pair<float, int>> result;
+    for (int i = 0; i < cloud.size(); ++i) {
+      if (cloud.xyz(i).array().isFinite().all()) {
+        result.emplace_back((cloud.xyz(i) - query).squaredNorm(), i);
+      }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  };
+
+  const int kNumClosest = 5;
+  const double kRadius = 0.3;
+  for (int num_threads : {1, 3}) {
+    Eigen::MatrixXf squared_distances;
+    const Eigen::MatrixXi indices = cloud.FindNearestNeighbors(
+        queries, kNumClosest, num_threads, &squared_distances);
+    ASSERT_EQ(indices.rows(), kNumClosest);
+    ASSERT_EQ(indices.cols(), queries.cols());
+    ASSERT_EQ(squared_distances.rows(), kNumClosest);
+    ASSERT_EQ(squared_distances.cols(), queries.cols());
+    const std::vector<std::vector<int>> neighbors =
+        cloud.FindNeighborsWithinRadius(queries, kRadius, num_threads);
+    ASSERT_EQ(neighbors.size(), queries.cols());
+    for (int j = 0; j < queries.cols(); ++j) {
+      const auto expected = brute_force(queries.col(j));
+      for (int k = 0; k < kNumClosest; ++k) {
+        EXPECT_EQ(indices(k, j), expected[k].second);
+        EXPECT_NEAR(squared_distances(k, j), expected[k].first, 1e-6);
+      }
+      std::vector<int> expected_neighbors;
+      for (const auto& [squared_distance, i] : expected) {
+        if (squared_distance < kRadius * kRadius) {
+          expected_neighbors.push_back(i);
+        }
+      }
+      EXPECT_EQ(neighbors[j], expected_neighbors);
+    }
+  }
+
+  // Fewer points than requested are padded.
+  Eigen::MatrixXf squared_distances;
+  const Eigen::MatrixXi indices =
+      cloud.FindNearestNeighbors(queries, kSize + 1, 1, &squared_distances);
+  EXPECT_EQ(indices(kSize - 2, 0), brute_force(queries.col(0)).back().second);
+  EXPECT_EQ(indices(kSize - 1, 0), -1);
+  EXPECT_EQ(indices(kSize, 0), -1);
+  EXPECT_EQ(squared_distances(kSize, 0), kInf);
+
+  // Changes to the xyzs are seen by the following queries.
+  cloud.mutable_xyz(42) = queries.col(0);
+  EXPECT_EQ(cloud.FindNearestNeighbors(queries.col(0), 1)(0, 0), 42);
+  cloud.mutable_xyzs().col(43) = queries.col(1);
+  EXPECT_EQ(cloud.FindNeighborsWithinRadius(queries.col(1), 1e-6)[0],
+            std::vector<int>{43});
+  // So are writes through a reference held across queries.
+  Eigen::Ref<Eigen::Matrix3Xf> held_xyzs = cloud.mutable_xyzs();
+  EXPECT_EQ(cloud.FindNearestNeighbors(queries.col(2), 1)(0, 0),
+            brute_force(queries.col(2)).front().second);
+  held_xyzs.col(44) = queries.col(2);
+  EXPECT_EQ(cloud.FindNearestNeighbors(queries.col(2), 1)(0, 0), 44);
+  held_xyzs.col(44) = Vector3f::Constant(kNaN);
+  EXPECT_NE(cloud.FindNearestNeighbors(queries.col(2), 1)(0, 0), 44);
+  cloud.resize(10);
+  EXPECT_EQ(cloud.FindNearestNeighbors(queries.col(0), 11)(9, 0), -1);
+  PointCloud empty(0);
+  EXPECT_EQ(empty.FindNearestNeighbors(queries.col(0), 1)(0, 0), -1);
+  EXPECT_TRUE(empty.FindNeighborsWithinRadius(queries.col(0), 1)[0].empty());
+
+  DRAKE_EXPECT_THROWS_MESSAGE(cloud.FindNearestNeighbors(queries, 0),
+                              ".*num_closest >= 1.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(cloud.FindNeighborsWithinRadius(queries, 0),
+                              ".*radius > 0.*");
+}
+
 }  // namespace
 }  // namespace perception
 }  // namespace drake
@@ -1,8 +1,11 @@
 #include "drake/solvers/aggregate_costs_constraints.h"
 
 #include <algorithm>
+#include <array>
 #include <limits>
 #include <map>
+#include <memory>
+#include <mutex>
 
 #include <fmt/format.h>
 
@@ -212,6 +215,166 @@ const Binding<QuadraticCost>* FindNonconvexQuadraticCost(
 }
 
 namespace internal {
+// The part of AggregatedLinearConstraints that only depends on the bindings
+// of a program and the sparsity of their evaluators.
+struct LinearConstraintsStructure {
+  int num_vars{};
+  // The stacked A, with the sparsity of the aggregated A and zero values.
+  Eigen::SparseMatrix<double, Eigen::RowMajor> A;
+  // start_row[k] is the first row of the k-th binding, and start_row.back()
+  // is the number of rows.
+  std::vector<int> start_row;
+  // The entries of the A of the k-th evaluator, in column-major order, are
+  // the entries entry_begin[k], ..., entry_begin[k + 1] - 1 below.
+  std::vector<int> entry_begin;
+  // The row and column of each entry in the A of its evaluator.
+  std::vector<int> entry_row;
+  std::vector<int> entry_col;
+  // The index of each entry in A.valuePtr().
+  std::vector<int> entry_position;
+};
+
+namespace {
+// Calls visit(evaluator, variables) on each linear constraint, linear
+// equality constraint and bounding box constraint of prog, in that order.
+template <typename Visitor>
+void ForEachLinearConstraint(const MathematicalProgram& prog,
+                             const Visitor& visit) {
+  for (const auto& binding : prog.linear_constraints()) {
+    visit(*binding.evaluator(), binding.variables());
+  }
+  for (const auto& binding : prog.linear_equality_constraints()) {
+    visit(*binding.evaluator(), binding.variables());
+  }
+  for (const auto& binding : prog.bounding_box_constraints()) {
+    visit(*binding.evaluator(), binding.variables());
+  }
+}
+
+std::shared_ptr<const LinearConstraintsStructure>
+MakeLinearConstraintsStructure(const MathematicalProgram& prog) {
+  auto structure = std::make_shared<LinearConstraintsStructure>();
+  structure->num_vars = prog.num_vars();
+  // The (row, column, entry index) in the stacked A of each entry.
+  std::vector<std::array<int, 3>> entries;
+  int num_rows = 0;
+  ForEachLinearConstraint(prog, [&](const LinearConstraint& evaluator,
+                                    const VectorXDecisionVariable& vars) {
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(vars);
+    const Eigen::SparseMatrix<double>& A = evaluator.get_sparse_A();
+    structure->start_row.push_back(num_rows);
+    structure->entry_begin.push_back(structure->entry_row.size());
+    for (int j = 0; j < A.outerSize(); ++j) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(A, j); it; ++it) {
+        entries.push_back({num_rows + static_cast<int>(it.row()),
+                           var_indices[j],
+                           static_cast<int>(structure->entry_row.size())});
+        structure->entry_row.push_back(it.row());
+        structure->entry_col.push_back(j);
+      }
+    }
+    num_rows += A.rows();
+  });
+  structure->start_row.push_back(num_rows);
+  structure->entry_begin.push_back(structure->entry_row.size());
+
+  // Sorting the entries by row and then column gives the order of the
+  // compressed row storage; repeated (row, column) pairs share one position.
+  std::sort(entries.begin(), entries.end());
+  structure->entry_position.resize(entries.size());
+  std::vector<Eigen::Triplet<double>> triplets;
+  triplets.reserve(entries.size());
+  for (const auto& [row, col, entry] : entries) {
+    if (triplets.empty() || triplets.back().row() != row ||
+        triplets.back().col() != col) {
+      triplets.emplace_back(row, col, 0.0);
+    }
+    structure->entry_position[entry] = triplets.size() - 1;
+  }
+  structure->A.resize(num_rows, prog.num_vars());
+  structure->A.setFromTriplets(triplets.begin(), triplets.end());
+  DRAKE_DEMAND(structure->A.nonZeros() == static_cast<int>(triplets.size()));
+  return structure;
+}
+
+// Fills `result` with the coefficients and bounds of the evaluators in prog.
+// Returns false if the evaluators no longer match `structure`.
+bool FillAggregatedLinearConstraints(
+    const MathematicalProgram& prog,
+    const LinearConstraintsStructure& structure,
+    AggregatedLinearConstraints* result) {
+  if (structure.num_vars != prog.num_vars()) {
+    return false;
+  }
+  result->A = structure.A;
+  result->A.coeffs().setZero();
+  double* const values = result->A.valuePtr();
+  result->lower_bound.resize(structure.A.rows());
+  result->upper_bound.resize(structure.A.rows());
+  int k = 0;
+  bool matches = true;
+  ForEachLinearConstraint(prog, [&](const LinearConstraint& evaluator,
+                                    const VectorXDecisionVariable&) {
+    if (!matches) {
+      return;
+    }
+    const Eigen::SparseMatrix<double>& A = evaluator.get_sparse_A();
+    const int start_row = structure.start_row[k];
+    if (A.rows() != structure.start_row[k + 1] - start_row) {
+      matches = false;
+      return;
+    }
+    int p = structure.entry_begin[k];
+    const int p_end = structure.entry_begin[k + 1];
+    for (int j = 0; j < A.outerSize(); ++j) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(A, j); it; ++it) {
+        if (p == p_end || structure.entry_row[p] != it.row() ||
+            structure.entry_col[p] != j) {
+          matches = false;
+          return;
+        }
+        values[structure.entry_position[p]] += it.value();
+        ++p;
+      }
+    }
+    if (p != p_end) {
+      matches = false;
+      return;
+    }
+    result->lower_bound.segment(start_row, A.rows()) = evaluator.lower_bound();
+    result->upper_bound.segment(start_row, A.rows()) = evaluator.upper_bound();
+    ++k;
+  });
+  if (!matches) {
+    return false;
+  }
+  result->start_row.assign(structure.start_row.begin(),
+                           structure.start_row.end() - 1);
+  return true;
+}
+}  // namespace
+
+AggregatedLinearConstraints AggregateLinearConstraints(
+    const MathematicalProgram& prog) {
+  std::shared_ptr<const LinearConstraintsStructure> structure;
+  {
+    std::lock_guard<std::mutex> lock(prog.linear_constraints_structure_mutex_);
+    structure = prog.linear_constraints_structure_;
+  }
+  AggregatedLinearConstraints result;
+  if (structure == nullptr ||
+      !FillAggregatedLinearConstraints(prog, *structure, &result)) {
+    structure = MakeLinearConstraintsStructure(prog);
+    const bool filled =
+        FillAggregatedLinearConstraints(prog, *structure, &result);
+    DRAKE_DEMAND(filled);
+    std::lock_guard<std::mutex> lock(prog.linear_constraints_structure_mutex_);
+    prog.linear_constraints_structure_ = std::move(structure);
+  }
+  return result;
+}
+
 bool CheckConvexSolverAttributes(const MathematicalProgram& prog,
                                  const ProgramAttributes& solver_capabilities,
                                  std::string_view solver_name,
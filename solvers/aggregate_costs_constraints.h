@@ -90,6 +90,35 @@ void AggregateBoundingBoxConstraints(const MathematicalProgram& prog,
     const std::vector<Binding<QuadraticCost>>& quadratic_costs);
 
 namespace internal {
+// The linear constraints, linear equality constraints and bounding box
+// constraints of a program, stacked in that order as
+//
+//     lower_bound ≤ A x ≤ upper_bound
+//
+// where x is prog.decision_variables().
+struct AggregatedLinearConstraints {
+  // A in compressed row (CSR) storage. The entries of a variable that appears
+  // more than once in a binding are summed.
+  Eigen::SparseMatrix<double, Eigen::RowMajor> A;
+  Eigen::VectorXd lower_bound;
+  Eigen::VectorXd upper_bound;
+  // The row of A where each binding starts; the bindings are ordered as
+  // prog.linear_constraints(), prog.linear_equality_constraints(),
+  // prog.bounding_box_constraints().
+  std::vector<int> start_row;
+};
+
+// Stacks the linear constraints of @p prog. The sparsity structure of A (the
+// map from the entries of each evaluator's A to the entries of the stacked A)
+// is computed once and cached in @p prog until a linear constraint is added or
+// removed, so that repeatedly converting the same program only copies the
+// coefficients and bounds of the evaluators. Changing the coefficients with
+// UpdateCoefficients() is allowed; if it changes the sparsity of an evaluator,
+// the structure is recomputed. This function may be called concurrently for
+// the same program.
+AggregatedLinearConstraints AggregateLinearConstraints(
+    const MathematicalProgram& prog);
+
 // If the program is compatible with this solver (the solver meets the required
 // capabilities of the program, and the program is convex), returns true and
 // clears the explanation.  Otherwise, returns false and sets the explanation.
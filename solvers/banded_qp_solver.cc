@@ -0,0 +1,375 @@
+#include "drake/solvers/banded_qp_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "drake/common/never_destroyed.h"
+#include "drake/common/text_logging.h"
+#include "drake/common/unused.h"
+#include "drake/solvers/aggregate_costs_constraints.h"
+#include "drake/solvers/banded_qp_solver_internal.h"
+#include "drake/solvers/mathematical_program.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+using internal::BandedKktStructure;
+using internal::BandedQpData;
+
+// The rows of the parsed program that one constraint of a binding maps to, or
+// -1 if there is none.
+struct ConstraintRows {
+  int equality{-1};
+  int lower{-1};
+  int upper{-1};
+};
+
+// The program in the form of BandedQpData, and the rows of every constraint.
+struct ParsedProgram {
+  BandedQpData data;
+  double constant_cost{};
+  std::vector<std::vector<ConstraintRows>> linear_constraint_rows;
+  std::vector<std::vector<ConstraintRows>> linear_equality_constraint_rows;
+  std::vector<std::vector<ConstraintRows>> bounding_box_constraint_rows;
+};
+
+// Adds the rows of `bindings` to E * x = f (when the lower and upper bounds
+// of a row match) or to G * x ≥ h (for each finite bound otherwise).
+template <typename C>
+void ParseLinearConstraints(
+    const MathematicalProgram& prog, const std::vector<Binding<C>>& bindings,
+    std::vector<Eigen::Triplet<double>>* E_triplets, std::vector<double>* f,
+    std::vector<Eigen::Triplet<double>>* G_triplets, std::vector<double>* h,
+    std::vector<std::vector<ConstraintRows>>* rows) {
+  rows->reserve(bindings.size());
+  for (const auto& binding : bindings) {
+    const auto& evaluator = binding.evaluator();
+    const Eigen::SparseMatrix<double, Eigen::RowMajor> A =
+        evaluator->get_sparse_A();
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding.variables());
+    std::vector<ConstraintRows>& binding_rows = rows->emplace_back(A.rows());
+    for (int i = 0; i < A.rows(); ++i) {
+      const double lower = evaluator->lower_bound()(i);
+      const double upper = evaluator->upper_bound()(i);
+      auto add_row = [&](std::vector<Eigen::Triplet<double>>* triplets,
+                         std::vector<double>* rhs, double sign,
+                         double value) {
+        const int row = static_cast<int>(rhs->size());
+        for (Eigen::SparseMatrix<double, Eigen::RowMajor>::InnerIterator it(
+                 A, i);
+             it; ++it) {
+          triplets->emplace_back(row, var_indices[it.col()],
+                                 sign * it.value());
+        }
+        rhs->push_back(sign * value);
+        return row;
+      };
+      if (lower == upper) {
+        binding_rows[i].equality = add_row(E_triplets, f, 1, lower);
+        continue;
+      }
+      if (std::isfinite(lower)) {
+        binding_rows[i].lower = add_row(G_triplets, h, 1, lower);
+      }
+      if (std::isfinite(upper)) {
+        binding_rows[i].upper = add_row(G_triplets, h, -1, upper);
+      }
+    }
+  }
+}
+
+ParsedProgram ParseProgram(const MathematicalProgram& prog) {
+  const int num_vars = prog.num_vars();
+  ParsedProgram parsed;
+  BandedQpData& data = parsed.data;
+  data.q = Eigen::VectorXd::Zero(num_vars);
+  std::vector<Eigen::Triplet<double>> P_triplets;
+  for (const auto& binding : prog.quadratic_costs()) {
+    const auto& Q = binding.evaluator()->Q();
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding.variables());
+    for (int j = 0; j < Q.cols(); ++j) {
+      for (int i = 0; i < Q.rows(); ++i) {
+        if (Q(i, j) != 0) {
+          P_triplets.emplace_back(var_indices[i], var_indices[j], Q(i, j));
+        }
+      }
+      data.q(var_indices[j]) += binding.evaluator()->b()(j);
+    }
+    parsed.constant_cost += binding.evaluator()->c();
+  }
+  for (const auto& binding : prog.linear_costs()) {
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding.variables());
+    for (int j = 0; j < binding.evaluator()->a().rows(); ++j) {
+      data.q(var_indices[j]) += binding.evaluator()->a()(j);
+    }
+    parsed.constant_cost += binding.evaluator()->b();
+  }
+
+  std::vector<Eigen::Triplet<double>> E_triplets;
+  std::vector<Eigen::Triplet<double>> G_triplets;
+  std::vector<double> f;
+  std::vector<double> h;
+  ParseLinearConstraints(prog, prog.linear_constraints(), &E_triplets, &f,
+                         &G_triplets, &h, &parsed.linear_constraint_rows);
+  ParseLinearConstraints(prog, prog.linear_equality_constraints(), &E_triplets,
+                         &f, &G_triplets, &h,
+                         &parsed.linear_equality_constraint_rows);
+  ParseLinearConstraints(prog, prog.bounding_box_constraints(), &E_triplets,
+                         &f, &G_triplets, &h,
+                         &parsed.bounding_box_constraint_rows);
+
+  data.P.resize(num_vars, num_vars);
+  data.P.setFromTriplets(P_triplets.begin(), P_triplets.end());
+  data.E.resize(f.size(), num_vars);
+  data.E.setFromTriplets(E_triplets.begin(), E_triplets.end());
+  data.f = Eigen::Map<const Eigen::VectorXd>(f.data(), f.size());
+  data.G.resize(h.size(), num_vars);
+  data.G.setFromTriplets(G_triplets.begin(), G_triplets.end());
+  data.h = Eigen::Map<const Eigen::VectorXd>(h.data(), h.size());
+  return parsed;
+}
+
+// Returns true if any row of `bindings` has equal lower and upper bounds.
+template <typename C>
+bool HasEqualityRow(const std::vector<Binding<C>>& bindings) {
+  for (const auto& binding : bindings) {
+    const auto& evaluator = binding.evaluator();
+    if ((evaluator->lower_bound().array() == evaluator->upper_bound().array())
+            .any()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Throws unless the factorization of the KKT matrix of `structure` takes at
+// most a tenth of the work of a dense LDLᵀ factorization, i.e., ⅓ N³
+// multiply-adds for a KKT matrix of size N. A program whose factorization is
+// cheap in absolute terms is accepted regardless.
+void ThrowUnlessBanded(const BandedKktStructure& structure) {
+  const double kMaxRelativeCost = 0.1;
+  const double kMaxCheapCost = 1E6;
+  const double kkt_size = structure.ordering.size();
+  const double dense_cost = kkt_size * kkt_size * kkt_size / 3;
+  if (structure.factorization_cost >
+      std::max(kMaxRelativeCost * dense_cost, kMaxCheapCost)) {
+    throw std::invalid_argument(fmt::format(
+        "BandedQPSolver is unable to solve because the KKT matrix of size {} "
+        "is not banded: its half bandwidth is {}, and its factorization "
+        "takes {:.0f}% of the work of a dense one.",
+        kkt_size, structure.half_bandwidth,
+        100 * structure.factorization_cost / dense_cost));
+  }
+}
+
+// Computes the dual solution of a binding, given the rows of its constraints.
+void CalcDualSolution(const std::vector<ConstraintRows>& binding_rows,
+                      const internal::BandedQpSolution& solution,
+                      Eigen::VectorXd* dual) {
+  for (int i = 0; i < dual->rows(); ++i) {
+    const ConstraintRows& rows = binding_rows[i];
+    if (rows.equality >= 0) {
+      (*dual)(i) = solution.y(rows.equality);
+    } else {
+      // The multiplier of the upper bound row -a * x ≥ -upper is the negation
+      // of the shadow price of the upper bound.
+      (*dual)(i) = (rows.lower >= 0 ? solution.z(rows.lower) : 0.0) -
+                   (rows.upper >= 0 ? solution.z(rows.upper) : 0.0);
+    }
+  }
+}
+
+template <typename C>
+void SetDualSolutions(
+    const std::vector<Binding<C>>& bindings,
+    const std::vector<std::vector<ConstraintRows>>& rows,
+    const internal::BandedQpSolution& solution,
+    MathematicalProgramResult* result) {
+  for (int i = 0; i < static_cast<int>(bindings.size()); ++i) {
+    Eigen::VectorXd dual(bindings[i].evaluator()->num_constraints());
+    CalcDualSolution(rows[i], solution, &dual);
+    result->set_dual_solution(bindings[i], dual);
+  }
+}
+
+internal::BandedQpOptions GetBandedQpOptions(
+    const SolverOptions& solver_options) {
+  DRAKE_ASSERT_VOID(solver_options.CheckOptionKeysForSolver(
+      BandedQPSolver::id(), {BandedQPSolver::ToleranceOptionName()},
+      {BandedQPSolver::MaxIterationsOptionName()}, {}));
+  internal::BandedQpOptions options;
+  const auto& options_double =
+      solver_options.GetOptionsDouble(BandedQPSolver::id());
+  auto it_double = options_double.find(BandedQPSolver::ToleranceOptionName());
+  if (it_double != options_double.end()) {
+    if (it_double->second > 0) {
+      options.tolerance = it_double->second;
+    } else {
+      throw std::invalid_argument(
+          "BandedQPSolver: Tolerance should be a positive number.");
+    }
+  }
+  const auto& options_int = solver_options.GetOptionsInt(BandedQPSolver::id());
+  auto it_int = options_int.find(BandedQPSolver::MaxIterationsOptionName());
+  if (it_int != options_int.end()) {
+    if (it_int->second >= 0) {
+      options.max_iterations = it_int->second;
+    } else {
+      throw std::invalid_argument(
+          "BandedQPSolver: MaxIterations should be a non-negative number.");
+    }
+  }
+  return options;
+}
+
+// If the program is compatible with this solver, returns true and clears the
+// explanation.  Otherwise, returns false and sets the explanation.  In either
+// case, the explanation can be nullptr in which case it is ignored.
+bool CheckAttributes(const MathematicalProgram& prog,
+                     std::string* explanation) {
+  static const never_destroyed<ProgramAttributes> solver_capabilities(
+      std::initializer_list<ProgramAttribute>{
+          ProgramAttribute::kLinearCost, ProgramAttribute::kQuadraticCost,
+          ProgramAttribute::kLinearConstraint,
+          ProgramAttribute::kLinearEqualityConstraint});
+  const ProgramAttributes& required_capabilities = prog.required_capabilities();
+  if (!AreRequiredAttributesSupported(required_capabilities,
+                                      solver_capabilities.access(),
+                                      explanation)) {
+    if (explanation) {
+      *explanation = fmt::format(
+          "BandedQPSolver is unable to solve because {}.", *explanation);
+    }
+    return false;
+  }
+  if (required_capabilities.count(ProgramAttribute::kQuadraticCost) == 0) {
+    if (explanation) {
+      *explanation =
+          "BandedQPSolver is unable to solve because a QuadraticCost is "
+          "required but has not been declared.";
+    }
+    return false;
+  }
+  const Binding<QuadraticCost>* nonconvex_quadratic_cost =
+      FindNonconvexQuadraticCost(prog.quadratic_costs());
+  if (nonconvex_quadratic_cost != nullptr) {
+    if (explanation) {
+      *explanation =
+          "BandedQPSolver is unable to solve because the quadratic cost " +
+          nonconvex_quadratic_cost->to_string() + " is non-convex.";
+    }
+    return false;
+  }
+  if (!HasEqualityRow(prog.linear_equality_constraints()) &&
+      !HasEqualityRow(prog.linear_constraints()) &&
+      !HasEqualityRow(prog.bounding_box_constraints())) {
+    if (explanation) {
+      *explanation =
+          "BandedQPSolver is unable to solve because the program has no "
+          "linear equality constraint.";
+    }
+    return false;
+  }
+  if (explanation) {
+    explanation->clear();
+  }
+  return true;
+}
+}  // namespace
+
+BandedQPSolver::BandedQPSolver()
+    : SolverBase(&id, &is_available, &is_enabled, &ProgramAttributesSatisfied,
+                 &UnsatisfiedProgramAttributes),
+      workspace_(std::make_unique<internal::BandedQpWorkspace>()) {}
+
+BandedQPSolver::~BandedQPSolver() = default;
+
+void BandedQPSolver::DoSolve(const MathematicalProgram& prog,
+                             const Eigen::VectorXd& initial_guess,
+                             const SolverOptions& merged_options,
+                             MathematicalProgramResult* result) const {
+  if (!prog.GetVariableScaling().empty()) {
+    static const logging::Warn log_once(
+        "BandedQPSolver doesn't support the feature of variable scaling.");
+  }
+  // The interior point method starts from its own initial point.
+  unused(initial_guess);
+
+  const internal::BandedQpOptions options = GetBandedQpOptions(merged_options);
+  const ParsedProgram parsed = ParseProgram(prog);
+  const BandedKktStructure structure =
+      internal::MakeBandedKktStructure(parsed.data);
+  ThrowUnlessBanded(structure);
+
+  // Reuse the memory of the previous solve, unless another thread is using it.
+  std::unique_lock<std::mutex> lock(workspace_mutex_, std::try_to_lock);
+  internal::BandedQpWorkspace local_workspace;
+  internal::BandedQpWorkspace* const workspace =
+      lock.owns_lock() ? workspace_.get() : &local_workspace;
+  const internal::BandedQpSolution solution =
+      internal::SolveBandedQp(parsed.data, structure, options, workspace);
+
+  BandedQPSolverDetails& solver_details =
+      result->SetSolverDetailsType<BandedQPSolverDetails>();
+  solver_details.iterations = solution.iterations;
+  solver_details.primal_residual = solution.primal_residual;
+  solver_details.dual_residual = solution.dual_residual;
+  solver_details.complementarity_gap = solution.complementarity_gap;
+  solver_details.kkt_half_bandwidth = structure.half_bandwidth;
+
+  if (!solution.converged) {
+    result->set_solution_result(SolutionResult::kIterationLimit);
+    result->set_optimal_cost(NAN);
+    return;
+  }
+  const Eigen::VectorXd& x = solution.x;
+  result->set_x_val(x);
+  result->set_optimal_cost(0.5 * x.dot(parsed.data.P * x) +
+                           parsed.data.q.dot(x) + parsed.constant_cost);
+  SetDualSolutions(prog.linear_constraints(), parsed.linear_constraint_rows,
+                   solution, result);
+  SetDualSolutions(prog.linear_equality_constraints(),
+                   parsed.linear_equality_constraint_rows, solution, result);
+  SetDualSolutions(prog.bounding_box_constraints(),
+                   parsed.bounding_box_constraint_rows, solution, result);
+  result->set_solution_result(SolutionResult::kSolutionFound);
+}
+
+std::string BandedQPSolver::MaxIterationsOptionName() {
+  return "MaxIterations";
+}
+
+std::string BandedQPSolver::ToleranceOptionName() { return "Tolerance"; }
+
+SolverId BandedQPSolver::id() {
+  static const never_destroyed<SolverId> singleton{"Banded QP"};
+  return singleton.access();
+}
+
+bool BandedQPSolver::is_available() { return true; }
+
+bool BandedQPSolver::is_enabled() { return true; }
+
+bool BandedQPSolver::ProgramAttributesSatisfied(
+    const MathematicalProgram& prog) {
+  return CheckAttributes(prog, nullptr);
+}
+
+std::string BandedQPSolver::UnsatisfiedProgramAttributes(
+    const MathematicalProgram& prog) {
+  std::string explanation;
+  CheckAttributes(prog, &explanation);
+  return explanation;
+}
+
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/solvers/solver_base.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+struct BandedQpWorkspace;
+}  // namespace internal
+
+/// The information returned by BandedQPSolver.
+struct BandedQPSolverDetails {
+  /// Number of interior point iterations taken.
+  int iterations{};
+  /// Infinity norm of the residual of the linear constraints.
+  double primal_residual{};
+  /// Infinity norm of the residual of the stationarity condition.
+  double dual_residual{};
+  /// Average complementarity gap between the linear inequality constraints and
+  /// their multipliers.
+  double complementarity_gap{};
+  /// The half bandwidth of the reordered KKT matrix factorized in each
+  /// iteration.
+  int kkt_half_bandwidth{};
+};
+
+/**
+ * Solves a convex quadratic program with linear equality and inequality
+ * constraints whose KKT matrix is banded after reordering, such as the QPs
+ * from model predictive control or direct transcription, where the decision
+ * variables of a time step are only coupled to those of the neighboring time
+ * steps by the dynamics.
+ *
+ * The solver is a primal-dual interior point method with Mehrotra's
+ * predictor-corrector steps. The unknowns of the KKT system are ordered by the
+ * reverse Cuthill-McKee algorithm, which recovers the stage-wise order of such
+ * programs, and each iteration solves the KKT system with a banded LDLᵀ
+ * factorization without pivoting. On a stage-wise program this factorization
+ * is the Riccati recursion: its cost grows linearly with the number of time
+ * steps. All memory used by the iterations is allocated before the first
+ * iteration, and is kept by the solver for its next Solve(), so that solving
+ * a sequence of programs of the same size (as in model predictive control)
+ * doesn't allocate it again.
+ *
+ * ProgramAttributesSatisfied() only accepts programs with a convex quadratic
+ * cost and at least one linear equality constraint. The band structure is
+ * only checked by Solve(), which parses the program once: it throws if the
+ * factorization of the reordered KKT matrix would take more than a tenth of
+ * the work of a dense factorization, unless that work is small anyway.
+ *
+ * This solver doesn't depend on the initial guess, and doesn't support
+ * variable scaling. It doesn't detect infeasible or unbounded programs; it
+ * reports SolutionResult::kIterationLimit if it doesn't converge. For this
+ * reason ChooseBestSolver() never picks it; it must be used explicitly.
+ *
+ * The user can set the following options:
+ *
+ * - MaxIterationsOptionName(). The maximal number of interior point
+ *   iterations. The default is 50.
+ * - ToleranceOptionName(). The solver stops when the constraint residuals and
+ *   the stationarity residual, relative to the size of the program data, and
+ *   the average complementarity gap are all below this value. The default is
+ *   1E-8.
+ */
+class BandedQPSolver final : public SolverBase {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BandedQPSolver)
+
+  /// Type of details stored in MathematicalProgramResult.
+  using Details = BandedQPSolverDetails;
+
+  BandedQPSolver();
+  ~BandedQPSolver() final;
+
+  /// @returns string key for SolverOptions to set the maximal number of
+  /// iterations.
+  static std::string MaxIterationsOptionName();
+
+  /// @returns string key for SolverOptions to set the tolerance.
+  static std::string ToleranceOptionName();
+
+  /// @name Static versions of the instance methods with similar names.
+  //@{
+  static SolverId id();
+  static bool is_available();
+  static bool is_enabled();
+  static bool ProgramAttributesSatisfied(const MathematicalProgram&);
+  static std::string UnsatisfiedProgramAttributes(const MathematicalProgram&);
+  //@}
+
+  // A using-declaration adds these methods into our class's Doxygen.
+  using SolverBase::Solve;
+
+ private:
+  void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
+               const SolverOptions&, MathematicalProgramResult*) const final;
+
+  // The memory of the iterations, reused by the next call to DoSolve(). A
+  // call made while another thread holds the mutex uses its own memory.
+  mutable std::mutex workspace_mutex_;
+  std::unique_ptr<internal::BandedQpWorkspace> workspace_;
+};
+
+}  // namespace solvers
+}  // namespace drake
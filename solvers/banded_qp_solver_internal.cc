@@ -0,0 +1,513 @@
+#include "drake/solvers/banded_qp_solver_internal.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+namespace {
+/*
+ * Computes the breadth-first depth of every node in the component of `root`
+ * that is not yet in `placed`.
+ * @param[out] depth depth[i] is set for every node in `nodes`, the other
+ * entries are left untouched.
+ * @param[out] nodes The nodes of the component, in breadth-first order.
+ * @returns The largest depth.
+ */
+int CalcDepths(const std::vector<std::vector<int>>& adjacency,
+               const std::vector<bool>& placed, int root,
+               std::vector<int>* depth, std::vector<int>* nodes) {
+  nodes->clear();
+  nodes->push_back(root);
+  (*depth)[root] = 0;
+  int max_depth = 0;
+  for (int head = 0; head < static_cast<int>(nodes->size()); ++head) {
+    const int node = (*nodes)[head];
+    for (int neighbor : adjacency[node]) {
+      if (!placed[neighbor] && (*depth)[neighbor] < 0) {
+        (*depth)[neighbor] = (*depth)[node] + 1;
+        max_depth = std::max(max_depth, (*depth)[neighbor]);
+        nodes->push_back(neighbor);
+      }
+    }
+  }
+  return max_depth;
+}
+}  // namespace
+
+std::vector<int> ReverseCuthillMcKeeOrdering(
+    const std::vector<std::vector<int>>& adjacency) {
+  const int num_nodes = static_cast<int>(adjacency.size());
+  auto degree = [&adjacency](int node) {
+    return static_cast<int>(adjacency[node].size());
+  };
+  std::vector<int> ordering;
+  ordering.reserve(num_nodes);
+  std::vector<bool> placed(num_nodes, false);
+  std::vector<int> depth(num_nodes, -1);
+  std::vector<int> component;
+  std::vector<int> neighbors;
+  for (int start = 0; start < num_nodes; ++start) {
+    if (placed[start]) {
+      continue;
+    }
+    // Find a pseudo-peripheral node of this component, starting from its node
+    // of minimal degree, by the algorithm of Gibbs, Poole and Stockmeyer.
+    CalcDepths(adjacency, placed, start, &depth, &component);
+    int root = start;
+    for (int node : component) {
+      if (degree(node) < degree(root)) {
+        root = node;
+      }
+    }
+    for (int node : component) {
+      depth[node] = -1;
+    }
+    int eccentricity = CalcDepths(adjacency, placed, root, &depth, &component);
+    while (true) {
+      int candidate = -1;
+      for (int node : component) {
+        if (depth[node] == eccentricity &&
+            (candidate < 0 || degree(node) < degree(candidate))) {
+          candidate = node;
+        }
+      }
+      for (int node : component) {
+        depth[node] = -1;
+      }
+      const int candidate_eccentricity =
+          CalcDepths(adjacency, placed, candidate, &depth, &component);
+      if (candidate_eccentricity <= eccentricity) {
+        for (int node : component) {
+          depth[node] = -1;
+        }
+        break;
+      }
+      root = candidate;
+      eccentricity = candidate_eccentricity;
+    }
+    // Cuthill-McKee ordering of this component.
+    const int component_begin = static_cast<int>(ordering.size());
+    ordering.push_back(root);
+    placed[root] = true;
+    for (int head = component_begin; head < static_cast<int>(ordering.size());
+         ++head) {
+      neighbors.clear();
+      for (int neighbor : adjacency[ordering[head]]) {
+        if (!placed[neighbor]) {
+          placed[neighbor] = true;
+          neighbors.push_back(neighbor);
+        }
+      }
+      std::stable_sort(neighbors.begin(), neighbors.end(),
+                       [&degree](int a, int b) {
+                         return degree(a) < degree(b);
+                       });
+      ordering.insert(ordering.end(), neighbors.begin(), neighbors.end());
+    }
+  }
+  std::reverse(ordering.begin(), ordering.end());
+  return ordering;
+}
+
+EnvelopeLdlt::EnvelopeLdlt(const std::vector<int>& first_column) {
+  Reset(first_column);
+}
+
+void EnvelopeLdlt::Reset(const std::vector<int>& first_column) {
+  first_column_ = first_column;
+  row_start_.resize(first_column_.size());
+  half_bandwidth_ = 0;
+  int num_values = 0;
+  for (int i = 0; i < size(); ++i) {
+    DRAKE_DEMAND(first_column_[i] >= 0 && first_column_[i] <= i);
+    row_start_[i] = num_values;
+    num_values += i - first_column_[i] + 1;
+    half_bandwidth_ = std::max(half_bandwidth_, i - first_column_[i]);
+  }
+  values_.setZero(num_values);
+}
+
+bool EnvelopeLdlt::Factorize() {
+  double* const values = values_.data();
+  for (int i = 0; i < size(); ++i) {
+    const int fi = first_column_[i];
+    double* const row_i = values + row_start_[i] - fi;
+    // First overwrite the entries of row i by wⱼ = L(i, j) * D(j), which only
+    // needs the rows above i, then scale them to L(i, j).
+    for (int j = fi; j < i; ++j) {
+      const int fj = first_column_[j];
+      const double* const row_j = values + row_start_[j] - fj;
+      double sum = row_i[j];
+      for (int k = std::max(fi, fj); k < j; ++k) {
+        sum -= row_i[k] * row_j[k];
+      }
+      row_i[j] = sum;
+    }
+    double diagonal = row_i[i];
+    for (int j = fi; j < i; ++j) {
+      const double w = row_i[j];
+      row_i[j] = w / values[row_start_[j] + j - first_column_[j]];
+      diagonal -= w * row_i[j];
+    }
+    if (diagonal == 0 || !std::isfinite(diagonal)) {
+      return false;
+    }
+    row_i[i] = diagonal;
+  }
+  return true;
+}
+
+void EnvelopeLdlt::Solve(Eigen::VectorXd* b) const {
+  DRAKE_ASSERT(b != nullptr && b->rows() == size());
+  const double* const values = values_.data();
+  double* const x = b->data();
+  for (int i = 0; i < size(); ++i) {
+    const double* const row_i = values + row_start_[i] - first_column_[i];
+    double sum = x[i];
+    for (int j = first_column_[i]; j < i; ++j) {
+      sum -= row_i[j] * x[j];
+    }
+    x[i] = sum;
+  }
+  for (int i = 0; i < size(); ++i) {
+    x[i] /= values[row_start_[i] + i - first_column_[i]];
+  }
+  for (int i = size() - 1; i >= 0; --i) {
+    const double* const row_i = values + row_start_[i] - first_column_[i];
+    for (int j = first_column_[i]; j < i; ++j) {
+      x[j] -= row_i[j] * x[i];
+    }
+  }
+}
+
+namespace {
+// Returns the index of the KKT entry (a, b) in `ldlt`, where a and b are
+// unknowns in their original order.
+int KktIndex(const BandedKktStructure& structure, const EnvelopeLdlt& ldlt,
+             int a, int b) {
+  const int pa = structure.position[a];
+  const int pb = structure.position[b];
+  return ldlt.index(std::max(pa, pb), std::min(pa, pb));
+}
+
+using RowMajorMatrix = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+
+double InfNorm(const Eigen::VectorXd& v) {
+  return v.size() == 0 ? 0 : v.lpNorm<Eigen::Infinity>();
+}
+
+// Returns the largest α in (0, 1] such that v + α * dv ≥ 0, given v > 0.
+double StepToBoundary(const Eigen::VectorXd& v, const Eigen::VectorXd& dv) {
+  double alpha = 1;
+  for (int i = 0; i < v.rows(); ++i) {
+    if (dv(i) < 0) {
+      alpha = std::min(alpha, -v(i) / dv(i));
+    }
+  }
+  return alpha;
+}
+}  // namespace
+
+BandedKktStructure MakeBandedKktStructure(const BandedQpData& data) {
+  const int num_vars = data.P.cols();
+  const int num_unknowns = num_vars + data.E.rows();
+  std::vector<std::vector<int>> adjacency(num_unknowns);
+  auto connect = [&adjacency](int a, int b) {
+    if (a != b) {
+      adjacency[a].push_back(b);
+      adjacency[b].push_back(a);
+    }
+  };
+  for (int j = 0; j < data.P.outerSize(); ++j) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(data.P, j); it; ++it) {
+      if (it.row() > j) {
+        connect(it.row(), j);
+      }
+    }
+  }
+  for (int j = 0; j < data.E.outerSize(); ++j) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(data.E, j); it; ++it) {
+      connect(num_vars + it.row(), j);
+    }
+  }
+  const RowMajorMatrix G = data.G;
+  for (int l = 0; l < G.outerSize(); ++l) {
+    for (RowMajorMatrix::InnerIterator it(G, l); it; ++it) {
+      for (RowMajorMatrix::InnerIterator jt(G, l); jt && jt.col() < it.col();
+           ++jt) {
+        connect(it.col(), jt.col());
+      }
+    }
+  }
+  for (auto& neighbors : adjacency) {
+    std::sort(neighbors.begin(), neighbors.end());
+    neighbors.erase(std::unique(neighbors.begin(), neighbors.end()),
+                    neighbors.end());
+  }
+
+  BandedKktStructure structure;
+  structure.ordering = ReverseCuthillMcKeeOrdering(adjacency);
+  structure.position.resize(num_unknowns);
+  for (int k = 0; k < num_unknowns; ++k) {
+    structure.position[structure.ordering[k]] = k;
+  }
+  structure.first_column.resize(num_unknowns);
+  for (int k = 0; k < num_unknowns; ++k) {
+    int first = k;
+    for (int neighbor : adjacency[structure.ordering[k]]) {
+      first = std::min(first, structure.position[neighbor]);
+    }
+    structure.first_column[k] = first;
+    structure.half_bandwidth = std::max(structure.half_bandwidth, k - first);
+    const double width = k - first;
+    structure.factorization_cost += width * width;
+  }
+  return structure;
+}
+
+BandedQpSolution SolveBandedQp(const BandedQpData& data,
+                               const BandedKktStructure& structure,
+                               const BandedQpOptions& options,
+                               BandedQpWorkspace* workspace) {
+  DRAKE_DEMAND(workspace != nullptr);
+  const int n = data.P.cols();
+  const int m = data.E.rows();
+  const int p = data.G.rows();
+  const int num_unknowns = n + m;
+  DRAKE_DEMAND(static_cast<int>(structure.ordering.size()) == num_unknowns);
+  // The regularization that makes the KKT matrix quasi-definite.
+  const double kRegularization = 1E-9;
+  const int kMaxRefinementSteps = 3;
+
+  // Map every term of the KKT matrix to its slot in the envelope once, so that
+  // each iteration only scatters values.
+  EnvelopeLdlt& ldlt = workspace->ldlt;
+  ldlt.Reset(structure.first_column);
+  std::vector<int>& constant_index = workspace->constant_index;
+  std::vector<double>& constant_value = workspace->constant_value;
+  constant_index.clear();
+  constant_value.clear();
+  for (int j = 0; j < data.P.outerSize(); ++j) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(data.P, j); it; ++it) {
+      if (it.row() >= j) {
+        constant_index.push_back(KktIndex(structure, ldlt, it.row(), j));
+        constant_value.push_back(it.value());
+      }
+    }
+  }
+  for (int j = 0; j < data.E.outerSize(); ++j) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(data.E, j); it; ++it) {
+      constant_index.push_back(KktIndex(structure, ldlt, n + it.row(), j));
+      constant_value.push_back(it.value());
+    }
+  }
+  for (int k = 0; k < num_unknowns; ++k) {
+    constant_index.push_back(ldlt.index(k, k));
+    constant_value.push_back(structure.ordering[k] < n ? kRegularization
+                                                       : -kRegularization);
+  }
+  std::vector<int>& gdg_index = workspace->gdg_index;
+  std::vector<double>& gdg_coefficient = workspace->gdg_coefficient;
+  std::vector<int>& gdg_row = workspace->gdg_row;
+  gdg_index.clear();
+  gdg_coefficient.clear();
+  gdg_row.clear();
+  RowMajorMatrix& G_rows = workspace->G_rows;
+  G_rows = data.G;
+  for (int l = 0; l < G_rows.outerSize(); ++l) {
+    for (RowMajorMatrix::InnerIterator it(G_rows, l); it; ++it) {
+      for (RowMajorMatrix::InnerIterator jt(G_rows, l);
+           jt && jt.col() <= it.col(); ++jt) {
+        gdg_index.push_back(KktIndex(structure, ldlt, it.col(), jt.col()));
+        gdg_coefficient.push_back(it.value() * jt.value());
+        gdg_row.push_back(l);
+      }
+    }
+  }
+
+  BandedQpSolution solution;
+  Eigen::VectorXd& x = solution.x;
+  Eigen::VectorXd& y = solution.y;
+  Eigen::VectorXd& z = solution.z;
+  // Resizing keeps the memory of the workspace when the sizes do not change.
+  Eigen::VectorXd& s = workspace->s;
+  Eigen::VectorXd& D = workspace->D;
+  Eigen::VectorXd& r_d = workspace->r_d;
+  Eigen::VectorXd& r_e = workspace->r_e;
+  Eigen::VectorXd& r_i = workspace->r_i;
+  Eigen::VectorXd& r_sz = workspace->r_sz;
+  Eigen::VectorXd& dx = workspace->dx;
+  Eigen::VectorXd& dy = workspace->dy;
+  Eigen::VectorXd& ds = workspace->ds;
+  Eigen::VectorXd& dz = workspace->dz;
+  Eigen::VectorXd& ds_aff = workspace->ds_aff;
+  Eigen::VectorXd& dz_aff = workspace->dz_aff;
+  Eigen::VectorXd& Gx = workspace->Gx;
+  Eigen::VectorXd& Px = workspace->Px;
+  Eigen::VectorXd& Gv = workspace->Gv;
+  Eigen::VectorXd& tmp_p = workspace->tmp_p;
+  Eigen::VectorXd& tmp_n = workspace->tmp_n;
+  Eigen::VectorXd& rhs = workspace->rhs;
+  Eigen::VectorXd& kkt_solution = workspace->kkt_solution;
+  Eigen::VectorXd& residual = workspace->residual;
+  Eigen::VectorXd& permuted = workspace->permuted;
+  for (Eigen::VectorXd* v : {&s, &r_i, &r_sz, &ds, &dz, &ds_aff, &dz_aff, &Gx,
+                             &Gv, &tmp_p}) {
+    v->resize(p);
+  }
+  D.setOnes(p);
+  for (Eigen::VectorXd* v : {&r_d, &dx, &Px, &tmp_n}) {
+    v->resize(n);
+  }
+  r_e.resize(m);
+  dy.resize(m);
+  for (Eigen::VectorXd* v : {&rhs, &kkt_solution, &residual, &permuted}) {
+    v->resize(num_unknowns);
+  }
+
+  auto factorize = [&]() {
+    Eigen::VectorXd& values = ldlt.mutable_values();
+    values.setZero();
+    for (int k = 0; k < static_cast<int>(constant_index.size()); ++k) {
+      values(constant_index[k]) += constant_value[k];
+    }
+    for (int k = 0; k < static_cast<int>(gdg_index.size()); ++k) {
+      values(gdg_index[k]) += gdg_coefficient[k] * D(gdg_row[k]);
+    }
+    return ldlt.Factorize();
+  };
+  // Sets residual = rhs - K * kkt_solution with the unregularized K.
+  auto calc_residual = [&]() {
+    const auto v_x = kkt_solution.head(n);
+    const auto v_w = kkt_solution.tail(m);
+    Gv.noalias() = data.G * v_x;
+    Gv.array() *= D.array();
+    tmp_n.noalias() = data.P * v_x;
+    tmp_n.noalias() += data.G.transpose() * Gv;
+    tmp_n.noalias() += data.E.transpose() * v_w;
+    residual.head(n) = rhs.head(n) - tmp_n;
+    residual.tail(m).noalias() = rhs.tail(m) - data.E * v_x;
+  };
+  // Solves K * kkt_solution = rhs with the factorization of the regularized
+  // K, followed by iterative refinement.
+  auto solve_kkt = [&]() {
+    kkt_solution.setZero();
+    residual = rhs;
+    const double tolerance =
+        1E-14 * std::max(1.0, InfNorm(rhs));
+    for (int step = 0; step <= kMaxRefinementSteps; ++step) {
+      for (int k = 0; k < num_unknowns; ++k) {
+        permuted(k) = residual(structure.ordering[k]);
+      }
+      ldlt.Solve(&permuted);
+      for (int k = 0; k < num_unknowns; ++k) {
+        kkt_solution(structure.ordering[k]) += permuted(k);
+      }
+      calc_residual();
+      if (InfNorm(residual) <= tolerance) {
+        break;
+      }
+    }
+  };
+  // Given r_sz, solves the Newton system for (dx, dy, ds, dz).
+  auto solve_newton = [&]() {
+    // tmp_p = S⁻¹ * r_sz + D * r_i.
+    tmp_p.array() = r_sz.array() / s.array() + D.array() * r_i.array();
+    rhs.head(n) = -r_d;
+    rhs.head(n).noalias() -= data.G.transpose() * tmp_p;
+    rhs.tail(m) = -r_e;
+    solve_kkt();
+    dx = kkt_solution.head(n);
+    dy = -kkt_solution.tail(m);
+    ds.noalias() = data.G * dx;
+    ds += r_i;
+    dz.array() = -(r_sz.array() + z.array() * ds.array()) / s.array();
+  };
+
+  // The initial point minimizes ½xᵀPx + qᵀx + ½|Gx - h|² subject to
+  // Ex = f, and then s and z are shifted into the positive orthant.
+  x.resize(n);
+  y.resize(m);
+  z.resize(p);
+  if (!factorize()) {
+    return solution;
+  }
+  rhs.head(n) = -data.q;
+  rhs.head(n).noalias() += data.G.transpose() * data.h;
+  rhs.tail(m) = data.f;
+  solve_kkt();
+  x = kkt_solution.head(n);
+  y = -kkt_solution.tail(m);
+  Gx.noalias() = data.G * x;
+  s = Gx - data.h;
+  z = -s;
+  if (p > 0) {
+    if (s.minCoeff() < 1) {
+      s.array() += 1 - s.minCoeff();
+    }
+    if (z.minCoeff() < 1) {
+      z.array() += 1 - z.minCoeff();
+    }
+  }
+
+  const double primal_scale =
+      1 + std::max(InfNorm(data.f), InfNorm(data.h));
+  const double dual_scale = 1 + InfNorm(data.q);
+  for (solution.iterations = 0;; ++solution.iterations) {
+    Px.noalias() = data.P * x;
+    Gx.noalias() = data.G * x;
+    r_d = Px + data.q;
+    r_d.noalias() -= data.E.transpose() * y;
+    r_d.noalias() -= data.G.transpose() * z;
+    r_e.noalias() = data.E * x - data.f;
+    r_i = Gx - s - data.h;
+    const double mu = p > 0 ? s.dot(z) / p : 0.0;
+    solution.primal_residual = std::max(InfNorm(r_e), InfNorm(r_i));
+    solution.dual_residual = InfNorm(r_d);
+    solution.complementarity_gap = mu;
+    if (solution.primal_residual <= options.tolerance * primal_scale &&
+        solution.dual_residual <= options.tolerance * dual_scale &&
+        mu <= options.tolerance) {
+      solution.converged = true;
+      break;
+    }
+    if (solution.iterations >= options.max_iterations) {
+      break;
+    }
+
+    D.array() = z.array() / s.array();
+    if (!factorize()) {
+      break;
+    }
+    // Predictor (affine scaling) step.
+    r_sz.array() = s.array() * z.array();
+    solve_newton();
+    double alpha = std::min(StepToBoundary(s, ds), StepToBoundary(z, dz));
+    if (p > 0) {
+      ds_aff = ds;
+      dz_aff = dz;
+      const double mu_aff =
+          (s + alpha * ds_aff).dot(z + alpha * dz_aff) / p;
+      const double sigma = std::pow(mu_aff / mu, 3);
+      // Corrector step, with the same factorization.
+      r_sz.array() = s.array() * z.array() +
+                     ds_aff.array() * dz_aff.array() - sigma * mu;
+      solve_newton();
+      alpha = std::min(
+          1.0, 0.99 * std::min(StepToBoundary(s, ds), StepToBoundary(z, dz)));
+    }
+    x += alpha * dx;
+    y += alpha * dy;
+    s += alpha * ds;
+    z += alpha * dz;
+  }
+  return solution;
+}
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,199 @@
+#pragma once
+
+// For external users, please do not include this header file. It only exists so
+// that we can expose the internals to banded_qp_solver_internal_test.cc
+
+#include <vector>
+
+#include <Eigen/Core>
+#include <Eigen/Sparse>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+/*
+ * Computes the reverse Cuthill-McKee ordering of an undirected graph, which
+ * reduces the bandwidth of a sparse symmetric matrix whose off-diagonal
+ * pattern is the graph. Every connected component is ordered by a
+ * breadth-first search from a pseudo-peripheral node, visiting neighbors in
+ * increasing order of degree, and the resulting order is reversed.
+ * @param adjacency adjacency[i] lists the neighbors of node i.
+ * @returns The ordering, where the k'th entry is the node placed at position k.
+ */
+std::vector<int> ReverseCuthillMcKeeOrdering(
+    const std::vector<std::vector<int>>& adjacency);
+
+/*
+ * The LDLᵀ factorization of a symmetric matrix stored by its lower envelope,
+ * i.e., for each row i, the entries from the first non-zero column of that
+ * row up to the diagonal. The factor L has no fill-in outside of this
+ * envelope, so the factorization takes O(∑ᵢ wᵢ²) time, where wᵢ is the width
+ * of row i in the envelope. The factorization does not pivot, so it is meant
+ * for matrices that are positive definite or quasi-definite.
+ */
+class EnvelopeLdlt {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(EnvelopeLdlt)
+
+  // Constructs an empty matrix.
+  EnvelopeLdlt() = default;
+
+  /*
+   * @param first_column first_column[i] is the column of the first stored
+   * entry of row i.
+   * @pre 0 <= first_column[i] <= i.
+   */
+  explicit EnvelopeLdlt(const std::vector<int>& first_column);
+
+  /*
+   * Changes the envelope to the one of `first_column`, as in the constructor,
+   * and zeros every stored entry. The memory of the previous envelope is
+   * reused when it is large enough.
+   */
+  void Reset(const std::vector<int>& first_column);
+
+  int size() const { return static_cast<int>(first_column_.size()); }
+
+  // The largest distance between a stored entry and the diagonal.
+  int half_bandwidth() const { return half_bandwidth_; }
+
+  // The position of the entry (i, j) in values().
+  // @pre first_column[i] <= j <= i.
+  int index(int i, int j) const {
+    return row_start_[i] + j - first_column_[i];
+  }
+
+  // Before Factorize(), the stored entries of the matrix. After a successful
+  // Factorize(), the entries of L below the diagonal, and D on the diagonal.
+  const Eigen::VectorXd& values() const { return values_; }
+  Eigen::VectorXd& mutable_values() { return values_; }
+
+  /*
+   * Factorizes the matrix in values() in place.
+   * @returns false if a zero or non-finite pivot is met.
+   */
+  bool Factorize();
+
+  /*
+   * Overwrites `b` with the solution of (L * D * Lᵀ) * x = b.
+   * @pre Factorize() returned true.
+   */
+  void Solve(Eigen::VectorXd* b) const;
+
+ private:
+  std::vector<int> first_column_;
+  std::vector<int> row_start_;
+  int half_bandwidth_{0};
+  Eigen::VectorXd values_;
+};
+
+/*
+ * The convex quadratic program
+ *   min ½ xᵀPx + qᵀx
+ *   s.t. E * x = f
+ *        G * x ≥ h
+ * where P is symmetric positive semidefinite with both of its triangles
+ * stored.
+ */
+struct BandedQpData {
+  Eigen::SparseMatrix<double> P;
+  Eigen::VectorXd q;
+  Eigen::SparseMatrix<double> E;
+  Eigen::VectorXd f;
+  Eigen::SparseMatrix<double> G;
+  Eigen::VectorXd h;
+};
+
+struct BandedQpOptions {
+  int max_iterations{50};
+  // The tolerance on the scaled primal and dual residuals, and on the average
+  // complementarity gap.
+  double tolerance{1E-8};
+};
+
+struct BandedQpSolution {
+  bool converged{false};
+  int iterations{0};
+  Eigen::VectorXd x;
+  // The multipliers of E * x = f and G * x ≥ h respectively, such that
+  // P * x + q = Eᵀ * y + Gᵀ * z with z ≥ 0.
+  Eigen::VectorXd y;
+  Eigen::VectorXd z;
+  double primal_residual{};
+  double dual_residual{};
+  double complementarity_gap{};
+};
+
+/*
+ * The symmetric pattern and ordering of the KKT matrix
+ *   [P + Gᵀ * D * G   Eᵀ]
+ *   [E                0 ]
+ * factorized in every iteration of SolveBandedQp(), where D is a positive
+ * diagonal matrix. The unknowns are ordered by ReverseCuthillMcKeeOrdering().
+ */
+struct BandedKktStructure {
+  // ordering[k] is the unknown (x first, then the multipliers of E * x = f)
+  // placed at position k of the factorized matrix.
+  std::vector<int> ordering;
+  // The inverse of ordering.
+  std::vector<int> position;
+  // first_column[k] is the first non-zero column of row k of the reordered
+  // matrix.
+  std::vector<int> first_column;
+  int half_bandwidth{0};
+  // The cost of factorizing the reordered matrix, as ∑ₖ wₖ², where wₖ is the
+  // number of entries of row k between first_column[k] and the diagonal.
+  double factorization_cost{0};
+};
+
+// Computes the KKT structure of `data` from the sparsity patterns of P, E
+// and G.
+BandedKktStructure MakeBandedKktStructure(const BandedQpData& data);
+
+/*
+ * The memory used by the iterations of SolveBandedQp(). Passing the same
+ * workspace to consecutive solves of programs of the same size avoids
+ * allocating it again.
+ */
+struct BandedQpWorkspace {
+  EnvelopeLdlt ldlt;
+  // The terms of the reordered lower triangle of the KKT matrix that do not
+  // change between iterations, as indices into ldlt.values() and the values
+  // added to them.
+  std::vector<int> constant_index;
+  std::vector<double> constant_value;
+  // The slots of the reordered lower triangle of the KKT matrix that the
+  // products G(l, i) * D(l) * G(l, j) are added to, with G(l, i) * G(l, j)
+  // and l.
+  std::vector<int> gdg_index;
+  std::vector<double> gdg_coefficient;
+  std::vector<int> gdg_row;
+  // The row-major copy of G, so that the pairs of columns sharing a row are
+  // easy to enumerate.
+  Eigen::SparseMatrix<double, Eigen::RowMajor> G_rows;
+  // The vectors of the iterations. See SolveBandedQp() for their meaning.
+  Eigen::VectorXd s, D;
+  Eigen::VectorXd r_d, r_e, r_i, r_sz;
+  Eigen::VectorXd dx, dy, ds, dz, ds_aff, dz_aff;
+  Eigen::VectorXd Gx, Px, Gv, tmp_p, tmp_n;
+  Eigen::VectorXd rhs, kkt_solution, residual, permuted;
+};
+
+/*
+ * Solves `data` with a primal-dual interior point method with Mehrotra's
+ * predictor-corrector steps. Every iteration factorizes the KKT matrix of
+ * `structure` with an EnvelopeLdlt, after adding a small regularization that
+ * makes it quasi-definite; the regularization is removed by iterative
+ * refinement. All memory is allocated before the first iteration, in
+ * `workspace` when it is not already large enough.
+ * @pre structure = MakeBandedKktStructure(data).
+ */
+BandedQpSolution SolveBandedQp(const BandedQpData& data,
+                               const BandedKktStructure& structure,
+                               const BandedQpOptions& options,
+                               BandedQpWorkspace* workspace);
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
@@ -1,5 +1,13 @@
+#include <cmath>
+#include <limits>
+#include <vector>
+
 #include "drake/common/symbolic/monomial_util.h"
+#include "drake/math/autodiff_gradient.h"
+#include "drake/solvers/aggregate_costs_constraints.h"
+#include "drake/solvers/constraint.h"
 #include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/osqp_solver.h"
 #include "drake/tools/performance/fixture_common.h"
 
 namespace drake {
@@ -113,9 +121,226 @@ static void BenchmarkSosProgram3(benchmark::State& state) {  // NOLINT
   }
 }
 
+// Makes a banded constraint matrix with `num_vars` columns, similar in shape to
+// the dynamics constraints of a direct-collocation problem.
+Eigen::SparseMatrix<double> MakeBandedMatrix(int num_vars) {
+  std::vector<Eigen::Triplet<double>> triplets;
+  const int num_rows = num_vars - 2;
+  for (int i = 0; i < num_rows; ++i) {
+    triplets.emplace_back(i, i, 1.0);
+    triplets.emplace_back(i, i + 1, -2.0);
+    triplets.emplace_back(i, i + 2, 1.0);
+  }
+  Eigen::SparseMatrix<double> A(num_rows, num_vars);
+  A.setFromTriplets(triplets.begin(), triplets.end());
+  return A;
+}
+
+static void BenchmarkAddLinearConstraintSymbolic(
+    benchmark::State& state) {  // NOLINT
+  // Adds the rows of a banded constraint matrix one symbolic formula at a time,
+  // as a transcription written with symbolic::Expression does.
+  const int num_vars = state.range(0);
+  for (auto _ : state) {
+    MathematicalProgram prog;
+    const auto x = prog.NewContinuousVariables(num_vars, "x");
+    for (int i = 0; i + 2 < num_vars; ++i) {
+      prog.AddLinearConstraint(x(i) - 2 * x(i + 1) + x(i + 2) <= 1);
+    }
+  }
+}
+
+static void BenchmarkAddLinearConstraintSparse(
+    benchmark::State& state) {  // NOLINT
+  // Adds the same rows at once as a sparse matrix, bound to the variables by
+  // their indices.
+  const int num_vars = state.range(0);
+  const Eigen::SparseMatrix<double> A = MakeBandedMatrix(num_vars);
+  const Eigen::VectorXd lb = Eigen::VectorXd::Constant(
+      A.rows(), -std::numeric_limits<double>::infinity());
+  const Eigen::VectorXd ub = Eigen::VectorXd::Ones(A.rows());
+  std::vector<int> var_indices(num_vars);
+  for (int i = 0; i < num_vars; ++i) {
+    var_indices[i] = i;
+  }
+  for (auto _ : state) {
+    MathematicalProgram prog;
+    prog.NewContinuousVariables(num_vars, "x");
+    prog.AddLinearConstraint(A, lb, ub, var_indices);
+  }
+}
+
+static void BenchmarkConstraintGradientAutoDiff(
+    benchmark::State& state) {  // NOLINT
+  // Computes the constraint Jacobian the way the nonlinear solvers used to,
+  // by seeding a dense AutoDiffVecXd.
+  const int num_vars = state.range(0);
+  const Eigen::SparseMatrix<double> A = MakeBandedMatrix(num_vars);
+  const LinearConstraint constraint(
+      A, Eigen::VectorXd::Zero(A.rows()), Eigen::VectorXd::Zero(A.rows()));
+  const Eigen::VectorXd x = Eigen::VectorXd::LinSpaced(num_vars, -1, 1);
+  AutoDiffVecXd y;
+  for (auto _ : state) {
+    constraint.Eval(math::InitializeAutoDiff(x), &y);
+  }
+}
+
+static void BenchmarkConstraintGradientEvalWithJacobian(
+    benchmark::State& state) {  // NOLINT
+  // Computes the same Jacobian as sparse triplets with EvalWithJacobian.
+  const int num_vars = state.range(0);
+  const Eigen::SparseMatrix<double> A = MakeBandedMatrix(num_vars);
+  const LinearConstraint constraint(
+      A, Eigen::VectorXd::Zero(A.rows()), Eigen::VectorXd::Zero(A.rows()));
+  const Eigen::VectorXd x = Eigen::VectorXd::LinSpaced(num_vars, -1, 1);
+  Eigen::VectorXd y;
+  std::vector<Eigen::Triplet<double>> dy_dx;
+  for (auto _ : state) {
+    constraint.EvalWithJacobian(x, &y, &dy_dx);
+  }
+}
+
+// Makes a program with the linear constraints of a trajectory optimization
+// over `horizon` steps: the dynamics of a planar double integrator as linear
+// equality constraints and bounds on the inputs.
+void MakeTrajectoryConstraints(int horizon, MathematicalProgram* prog) {
+  const auto x = prog->NewContinuousVariables(4, horizon + 1, "x");
+  const auto u = prog->NewContinuousVariables(2, horizon, "u");
+  Eigen::Matrix<double, 4, 7> dynamics;
+  dynamics << Eigen::Matrix4d::Identity(), Eigen::Matrix<double, 4, 2>::Ones(),
+      -Eigen::Matrix4d::Identity();
+  prog->AddLinearEqualityConstraint(Eigen::Matrix4d::Identity(),
+                                    Eigen::Vector4d::Zero(), x.col(0));
+  for (int k = 0; k < horizon; ++k) {
+    prog->AddLinearEqualityConstraint(dynamics, Eigen::Vector4d::Zero(),
+                                      {x.col(k), u.col(k), x.col(k + 1)});
+    prog->AddBoundingBoxConstraint(-10, 10, u.col(k));
+  }
+}
+
+static void BenchmarkAggregateLinearConstraintsTriplets(
+    benchmark::State& state) {  // NOLINT
+  // Stacks the linear constraints by looking up the variable indices of each
+  // binding and collecting triplets, as the solvers did on every solve.
+  MathematicalProgram prog;
+  MakeTrajectoryConstraints(state.range(0), &prog);
+  for (auto _ : state) {
+    std::vector<Eigen::Triplet<double>> triplets;
+    std::vector<double> lb;
+    std::vector<double> ub;
+    int num_rows = 0;
+    auto append = [&](const auto& bindings) {
+      for (const auto& binding : bindings) {
+        const std::vector<int> var_indices =
+            prog.FindDecisionVariableIndices(binding.variables());
+        const Eigen::SparseMatrix<double>& A =
+            binding.evaluator()->get_sparse_A();
+        for (int j = 0; j < A.outerSize(); ++j) {
+          for (Eigen::SparseMatrix<double>::InnerIterator it(A, j); it;
+               ++it) {
+            triplets.emplace_back(num_rows + it.row(), var_indices[j],
+                                  it.value());
+          }
+        }
+        for (int i = 0; i < A.rows(); ++i) {
+          lb.push_back(binding.evaluator()->lower_bound()(i));
+          ub.push_back(binding.evaluator()->upper_bound()(i));
+        }
+        num_rows += A.rows();
+      }
+    };
+    append(prog.linear_constraints());
+    append(prog.linear_equality_constraints());
+    append(prog.bounding_box_constraints());
+    Eigen::SparseMatrix<double, Eigen::RowMajor> A(num_rows, prog.num_vars());
+    A.setFromTriplets(triplets.begin(), triplets.end());
+    benchmark::DoNotOptimize(A);
+  }
+}
+
+static void BenchmarkAggregateLinearConstraintsCached(
+    benchmark::State& state) {  // NOLINT
+  // Stacks the same constraints with internal::AggregateLinearConstraints,
+  // which reuses the sparsity structure cached in the program.
+  MathematicalProgram prog;
+  MakeTrajectoryConstraints(state.range(0), &prog);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(internal::AggregateLinearConstraints(prog));
+  }
+}
+
+static void BenchmarkOsqpMpcResolve(benchmark::State& state) {  // NOLINT
+  // Re-solves a model predictive control QP for a planar double integrator
+  // once per control tick, changing only the initial state and the tracked
+  // reference. A 1 kHz control loop needs each tick well below 1 ms. The
+  // argument sets the "reuse_workspace" option of OsqpSolver.
+  const int horizon = 30;
+  const double dt = 1E-3;
+  Eigen::Matrix4d A = Eigen::Matrix4d::Identity();
+  A.topRightCorner<2, 2>() = dt * Eigen::Matrix2d::Identity();
+  Eigen::Matrix<double, 4, 2> B;
+  B << 0.5 * dt * dt * Eigen::Matrix2d::Identity(),
+      dt * Eigen::Matrix2d::Identity();
+
+  MathematicalProgram prog;
+  const auto x = prog.NewContinuousVariables(4, horizon + 1, "x");
+  const auto u = prog.NewContinuousVariables(2, horizon, "u");
+  auto initial_state = prog.AddLinearEqualityConstraint(
+      Eigen::Matrix4d::Identity(), Eigen::Vector4d::Zero(), x.col(0));
+  std::vector<Binding<LinearCost>> tracking_costs;
+  Eigen::Matrix<double, 4, 7> dynamics;
+  dynamics << A, B, -Eigen::Matrix4d::Identity();
+  for (int k = 0; k < horizon; ++k) {
+    prog.AddLinearEqualityConstraint(dynamics, Eigen::Vector4d::Zero(),
+                                     {x.col(k), u.col(k), x.col(k + 1)});
+    prog.AddBoundingBoxConstraint(-10, 10, u.col(k));
+    prog.AddQuadraticCost(1E-3 * Eigen::Matrix2d::Identity(),
+                          Eigen::Vector2d::Zero(), u.col(k));
+  }
+  for (int k = 1; k <= horizon; ++k) {
+    // ‖x - x_ref‖² = xᵀx - 2 x_refᵀx + const.
+    prog.AddQuadraticCost(2 * Eigen::Matrix4d::Identity(),
+                          Eigen::Vector4d::Zero(), x.col(k));
+    tracking_costs.push_back(
+        prog.AddLinearCost(Eigen::Vector4d::Zero(), 0, x.col(k)));
+  }
+
+  OsqpSolver solver;
+  SolverOptions solver_options;
+  solver_options.SetOption(OsqpSolver::id(), "reuse_workspace",
+                           static_cast<int>(state.range(0)));
+  MathematicalProgramResult result;
+  int tick = 0;
+  for (auto _ : state) {
+    const double t = tick++ * dt;
+    initial_state.evaluator()->UpdateCoefficients(
+        Eigen::Matrix4d::Identity(),
+        Eigen::Vector4d(std::sin(t), std::cos(t), 0, 0));
+    const Eigen::Vector4d x_ref(std::cos(t), std::sin(t), 0, 0);
+    for (auto& cost : tracking_costs) {
+      cost.evaluator()->UpdateCoefficients(-2 * x_ref);
+    }
+    solver.Solve(prog, std::nullopt, solver_options, &result);
+  }
+}
+
 BENCHMARK(BenchmarkSosProgram1);
 BENCHMARK(BenchmarkSosProgram2);
 BENCHMARK(BenchmarkSosProgram3);
+BENCHMARK(BenchmarkAddLinearConstraintSymbolic)
+    ->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BenchmarkAddLinearConstraintSparse)
+    ->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BenchmarkConstraintGradientAutoDiff)
+    ->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BenchmarkConstraintGradientEvalWithJacobian)
+    ->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BenchmarkAggregateLinearConstraintsTriplets)
+    ->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BenchmarkAggregateLinearConstraintsCached)
+    ->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BenchmarkOsqpMpcResolve)
+    ->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
 }  // namespace
 }  // namespace solvers
 }  // namespace drake
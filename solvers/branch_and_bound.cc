@@ -7,6 +7,8 @@
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include "drake/common/drake_throw.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/unused.h"
 #include "drake/solvers/choose_best_solver.h"
 #include "drake/solvers/gurobi_solver.h"
@@ -202,11 +204,7 @@ MixedIntegerBranchAndBoundNode::ConstructRootNode(
   }
   MixedIntegerBranchAndBoundNode* node = new MixedIntegerBranchAndBoundNode(
       new_prog, binary_variables_list, solver_id);
-  node->solution_result_ = SolveProgramWithSolver(
-      *node->prog_, solver_id, node->prog_result_.get());
-  if (node->solution_result_ == SolutionResult::kSolutionFound) {
-    node->CheckOptimalSolutionIsIntegral();
-  }
+  node->SolveProgram();
   return std::make_pair(std::unique_ptr<MixedIntegerBranchAndBoundNode>(node),
                         map_old_vars_to_new_vars);
 }
@@ -290,7 +288,7 @@ void MixedIntegerBranchAndBoundNode::FixBinaryVariable(
   fixed_binary_value_ = binary_value;
 }
 
-void MixedIntegerBranchAndBoundNode::Branch(
+void MixedIntegerBranchAndBoundNode::CreateChildren(
     const symbolic::Variable& binary_variable) {
   left_child_.reset(new MixedIntegerBranchAndBoundNode(
       *prog_, remaining_binary_variables_, solver_id_));
@@ -300,20 +298,23 @@ void MixedIntegerBranchAndBoundNode::Branch(
   right_child_->FixBinaryVariable(binary_variable, 1);
   left_child_->parent_ = this;
   right_child_->parent_ = this;
-  left_child_->solution_result_ = SolveProgramWithSolver(
-      *left_child_->prog_, left_child_->solver_id_,
-      left_child_->prog_result_.get());
-  right_child_->solution_result_ = SolveProgramWithSolver(
-      *right_child_->prog_, right_child_->solver_id_,
-      right_child_->prog_result_.get());
-  if (left_child_->solution_result_ == SolutionResult::kSolutionFound) {
-    left_child_->CheckOptimalSolutionIsIntegral();
-  }
-  if (right_child_->solution_result_ == SolutionResult::kSolutionFound) {
-    right_child_->CheckOptimalSolutionIsIntegral();
+}
+
+void MixedIntegerBranchAndBoundNode::SolveProgram() {
+  solution_result_ =
+      SolveProgramWithSolver(*prog_, solver_id_, prog_result_.get());
+  if (solution_result_ == SolutionResult::kSolutionFound) {
+    CheckOptimalSolutionIsIntegral();
   }
 }
 
+void MixedIntegerBranchAndBoundNode::Branch(
+    const symbolic::Variable& binary_variable) {
+  CreateChildren(binary_variable);
+  left_child_->SolveProgram();
+  right_child_->SolveProgram();
+}
+
 MixedIntegerBranchAndBound::MixedIntegerBranchAndBound(
     const MathematicalProgram& prog, const SolverId& solver_id)
     : root_{nullptr},
@@ -360,20 +361,24 @@ SolutionResult MixedIntegerBranchAndBound::Solve() {
       !root_->optimal_solution_is_integral()) {
     SearchIntegralSolutionByRounding(*root_);
   }
-  MixedIntegerBranchAndBoundNode* branching_node = PickBranchingNode();
-  while (branching_node) {
-    // Found a branching node, branch on this node. If no branching node is
+  std::vector<MixedIntegerBranchAndBoundNode*> branching_nodes =
+      PickBranchingNodes();
+  while (!branching_nodes.empty()) {
+    // Found branching nodes, branch on these nodes. If no branching node is
     // found, then every leaf node is fathomed, the branch-and-bound process
     // should terminate.
     // TODO(hongkai.dai) We might need to have a function that picks the
     // branching node together with the branching variable simultaneously.
-    const symbolic::Variable* branching_variable =
-        PickBranchingVariable(*branching_node);
-    BranchAndUpdate(branching_node, *branching_variable);
+    std::vector<const symbolic::Variable*> branching_variables;
+    branching_variables.reserve(branching_nodes.size());
+    for (const auto* branching_node : branching_nodes) {
+      branching_variables.push_back(PickBranchingVariable(*branching_node));
+    }
+    BranchAndUpdate(branching_nodes, branching_variables);
     if (HasConverged()) {
       return SolutionResult::kSolutionFound;
     }
-    branching_node = PickBranchingNode();
+    branching_nodes = PickBranchingNodes();
   }
   // No node to branch.
   if (best_lower_bound_ == -std::numeric_limits<double>::infinity()) {
@@ -535,6 +540,25 @@ MixedIntegerBranchAndBoundNode* PickDepthFirstNodeInSubTree(
   }
 }
 
+// Appends the non-fathomed leaf nodes in the tree to `leaves`, from left to
+// right.
+void CollectUnfathomedLeafNodesInSubTree(
+    const MixedIntegerBranchAndBound& bnb,
+    const MixedIntegerBranchAndBoundNode& sub_tree_root,
+    std::vector<MixedIntegerBranchAndBoundNode*>* leaves) {
+  if (sub_tree_root.IsLeaf()) {
+    if (!bnb.IsLeafNodeFathomed(sub_tree_root)) {
+      leaves->push_back(
+          const_cast<MixedIntegerBranchAndBoundNode*>(&sub_tree_root));
+    }
+    return;
+  }
+  CollectUnfathomedLeafNodesInSubTree(bnb, *(sub_tree_root.left_child()),
+                                      leaves);
+  CollectUnfathomedLeafNodesInSubTree(bnb, *(sub_tree_root.right_child()),
+                                      leaves);
+}
+
 double BestLowerBoundInSubTree(
     const MixedIntegerBranchAndBound& bnb,
     const MixedIntegerBranchAndBoundNode& sub_tree_root) {
@@ -612,6 +636,50 @@ MixedIntegerBranchAndBoundNode* MixedIntegerBranchAndBound::PickDepthFirstNode()
   return PickDepthFirstNodeInSubTree(*this, *root_);
 }
 
+std::vector<MixedIntegerBranchAndBoundNode*>
+MixedIntegerBranchAndBound::PickBranchingNodes() const {
+  std::vector<MixedIntegerBranchAndBoundNode*> nodes;
+  MixedIntegerBranchAndBoundNode* first_node = PickBranchingNode();
+  if (first_node == nullptr) {
+    return nodes;
+  }
+  nodes.push_back(first_node);
+  const int batch_size = node_batch_size();
+  if (batch_size == 1 ||
+      node_selection_method_ == NodeSelectionMethod::kUserDefined) {
+    return nodes;
+  }
+  std::vector<MixedIntegerBranchAndBoundNode*> leaves;
+  CollectUnfathomedLeafNodesInSubTree(*this, *root_, &leaves);
+  // The sort is stable, so that ties are broken by the order of the leaves in
+  // the tree, and the batch is deterministic.
+  if (node_selection_method_ == NodeSelectionMethod::kMinLowerBound) {
+    std::stable_sort(leaves.begin(), leaves.end(),
+                     [](const MixedIntegerBranchAndBoundNode* a,
+                        const MixedIntegerBranchAndBoundNode* b) {
+                       return a->prog_result()->get_optimal_cost() <
+                              b->prog_result()->get_optimal_cost();
+                     });
+  } else {
+    DRAKE_DEMAND(node_selection_method_ == NodeSelectionMethod::kDepthFirst);
+    std::stable_sort(leaves.begin(), leaves.end(),
+                     [](const MixedIntegerBranchAndBoundNode* a,
+                        const MixedIntegerBranchAndBoundNode* b) {
+                       return a->remaining_binary_variables().size() <
+                              b->remaining_binary_variables().size();
+                     });
+  }
+  for (MixedIntegerBranchAndBoundNode* leaf : leaves) {
+    if (static_cast<int>(nodes.size()) >= batch_size) {
+      break;
+    }
+    if (leaf != first_node) {
+      nodes.push_back(leaf);
+    }
+  }
+  return nodes;
+}
+
 const symbolic::Variable* MixedIntegerBranchAndBound::PickBranchingVariable(
     const MixedIntegerBranchAndBoundNode& node) const {
   switch (variable_selection_method_) {
@@ -655,7 +723,24 @@ bool MixedIntegerBranchAndBound::IsLeafNodeFathomed(
 void MixedIntegerBranchAndBound::BranchAndUpdate(
     MixedIntegerBranchAndBoundNode* node,
     const symbolic::Variable& branching_variable) {
-  node->Branch(branching_variable);
+  BranchAndUpdate(std::vector<MixedIntegerBranchAndBoundNode*>{node},
+                  std::vector<const symbolic::Variable*>{&branching_variable});
+}
+
+void MixedIntegerBranchAndBound::BranchAndUpdate(
+    const std::vector<MixedIntegerBranchAndBoundNode*>& nodes,
+    const std::vector<const symbolic::Variable*>& branching_variables) {
+  DRAKE_DEMAND(nodes.size() == branching_variables.size());
+  // The children are created on this thread; only their programs are solved
+  // concurrently.
+  std::vector<MixedIntegerBranchAndBoundNode*> children;
+  children.reserve(2 * nodes.size());
+  for (int i = 0; i < static_cast<int>(nodes.size()); ++i) {
+    nodes[i]->CreateChildren(*branching_variables[i]);
+    children.push_back(nodes[i]->mutable_left_child());
+    children.push_back(nodes[i]->mutable_right_child());
+  }
+  SolveNodes(children);
   // Update the best lower and upper bounds.
   // The best lower bound is the minimal among all the optimal costs of the
   // non-fathomed leaf nodes.
@@ -663,7 +748,7 @@ void MixedIntegerBranchAndBound::BranchAndUpdate(
   // If either the left or the right children finds integral solution, then
   // we can potentially update the best upper bound, and insert the solutions
   // to the list solutions_;
-  for (auto& child : {node->left_child(), node->right_child()}) {
+  for (const MixedIntegerBranchAndBoundNode* child : children) {
     if (child->solution_result() == SolutionResult::kSolutionFound &&
         child->optimal_solution_is_integral()) {
       const double child_node_optimal_cost =
@@ -680,6 +765,12 @@ void MixedIntegerBranchAndBound::BranchAndUpdate(
   }
 }
 
+void MixedIntegerBranchAndBound::SolveNodes(
+    const std::vector<MixedIntegerBranchAndBoundNode*>& nodes) const {
+  drake::internal::ParallelFor(static_cast<int>(nodes.size()), num_threads_,
+                               [&nodes](int i) { nodes[i]->SolveProgram(); });
+}
+
 void MixedIntegerBranchAndBound::UpdateIntegralSolution(
     const Eigen::Ref<const Eigen::VectorXd>& solution, double cost) {
   // First make sure that this solution has not been found before. The solution
@@ -708,6 +799,16 @@ void MixedIntegerBranchAndBound::UpdateIntegralSolution(
   }
 }
 
+void MixedIntegerBranchAndBound::set_num_threads(int num_threads) {
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  num_threads_ = num_threads;
+}
+
+void MixedIntegerBranchAndBound::set_node_batch_size(int batch_size) {
+  DRAKE_THROW_UNLESS(batch_size >= 1);
+  node_batch_size_ = batch_size;
+}
+
 bool MixedIntegerBranchAndBound::HasConverged() const {
   if (best_upper_bound_ - best_lower_bound_ <= absolute_gap_tol_) {
     return true;
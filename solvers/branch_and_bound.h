@@ -3,8 +3,10 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/mathematical_program_result.h"
@@ -164,6 +166,10 @@ class MixedIntegerBranchAndBoundNode {
   const SolverId& solver_id() const { return solver_id_; }
 
  private:
+  // MixedIntegerBranchAndBound creates and solves the child nodes separately,
+  // so that the children of several nodes can be solved concurrently.
+  friend class MixedIntegerBranchAndBound;
+
   /**
    * If the solution to a binary variable is either less than integral_tol or
    * larger than 1 - integral_tol, then we regard the solution to be binary.
@@ -192,6 +198,15 @@ class MixedIntegerBranchAndBoundNode {
   void FixBinaryVariable(const symbolic::Variable& binary_variable,
                          bool binary_value);
 
+  // Creates the left and right child nodes, with binary_variable fixed to 0
+  // and 1 respectively, without solving their optimization programs.
+  void CreateChildren(const symbolic::Variable& binary_variable);
+
+  // Solves the optimization program in this node, and checks whether its
+  // optimal solution is integral. Only accesses the data of this node, so
+  // different nodes can be solved concurrently.
+  void SolveProgram();
+
   // Check if the optimal solution to the program in this node satisfies all
   // integral constraints.
   // Only call this function AFTER the program is solved.
@@ -563,6 +578,40 @@ class MixedIntegerBranchAndBound {
   /** Geeter for the relative gap tolerance. */
   [[nodiscard]] double relative_gap_tol() const { return relative_gap_tol_; }
 
+  /** Setter for the number of threads used to solve the optimization programs
+   * in the nodes. The two children of every branched node, and the children
+   * of the different nodes in a batch (see set_node_batch_size()), are solved
+   * concurrently, each on its own clone of the relaxed program. The solver
+   * must be safe to run on several programs at once. The default is 1.
+   * @pre num_threads >= 1.
+   * @throws std::exception if the precondition is not satisfied.
+   */
+  void set_num_threads(int num_threads);
+
+  /** Getter for the number of threads. */
+  [[nodiscard]] int num_threads() const { return num_threads_; }
+
+  /** Setter for the number of leaf nodes branched on in each iteration of
+   * Solve(). The first node of a batch is picked by the node selection
+   * method (see SetNodeSelectionMethod()), and the other nodes are the next
+   * un-fathomed leaf nodes in the order of that method; with
+   * NodeSelectionMethod::kUserDefined, every batch only contains the node
+   * picked by the user. The bounds, the solutions and the node callbacks are
+   * only updated once all the children in a batch are solved, in the order of
+   * the batch. Hence for a given batch size, the result of Solve() doesn't
+   * depend on num_threads(); set the batch size explicitly to get
+   * reproducible results (e.g., in tests) on machines with different numbers
+   * of threads. By default the batch size is num_threads().
+   * @pre batch_size >= 1.
+   * @throws std::exception if the precondition is not satisfied.
+   */
+  void set_node_batch_size(int batch_size);
+
+  /** Getter for the number of leaf nodes branched on in each iteration. */
+  [[nodiscard]] int node_batch_size() const {
+    return node_batch_size_.value_or(num_threads_);
+  }
+
  private:
   // Forward declaration the tester class.
   friend class MixedIntegerBranchAndBoundTester;
@@ -572,6 +621,14 @@ class MixedIntegerBranchAndBound {
    */
   [[nodiscard]] MixedIntegerBranchAndBoundNode* PickBranchingNode() const;
 
+  /**
+   * Pick at most node_batch_size() distinct nodes to branch, the first one
+   * being PickBranchingNode(). Returns an empty vector if every leaf node is
+   * fathomed.
+   */
+  [[nodiscard]] std::vector<MixedIntegerBranchAndBoundNode*>
+  PickBranchingNodes() const;
+
   /**
    * Pick the node with the minimal lower bound.
    */
@@ -597,6 +654,23 @@ class MixedIntegerBranchAndBound {
   void BranchAndUpdate(MixedIntegerBranchAndBoundNode* node,
                        const symbolic::Variable& branching_variable);
 
+  /**
+   * Branch on a batch of nodes, solves the optimization programs of all their
+   * children concurrently, then updates the best lower and upper bounds.
+   * @param nodes. The nodes to be branched.
+   * @param branching_variables. Branch on branching_variables[i] in nodes[i].
+   */
+  void BranchAndUpdate(
+      const std::vector<MixedIntegerBranchAndBoundNode*>& nodes,
+      const std::vector<const symbolic::Variable*>& branching_variables);
+
+  /**
+   * Solves the optimization programs in @p nodes, using up to num_threads()
+   * threads.
+   */
+  void SolveNodes(
+      const std::vector<MixedIntegerBranchAndBoundNode*>& nodes) const;
+
   /**
    * Update the solutions (solutions_) and the best upper bound, with an
    * integral solution and its cost.
@@ -681,6 +755,11 @@ class MixedIntegerBranchAndBound {
 
   bool search_integral_solution_by_rounding_ = false;
 
+  int num_threads_{1};
+
+  // If not set, the batch size is num_threads_.
+  std::optional<int> node_batch_size_;
+
   // The user defined function to pick a branching variable. Default is null.
   VariableSelectFun variable_selection_userfun_ = nullptr;
 
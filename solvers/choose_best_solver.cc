@@ -8,6 +8,7 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/never_destroyed.h"
+#include "drake/solvers/banded_qp_solver.h"
 #include "drake/solvers/clp_solver.h"
 #include "drake/solvers/csdp_solver.h"
 #include "drake/solvers/equality_constrained_qp_solver.h"
@@ -71,7 +72,8 @@ class StaticSolverInterface {
 };
 
 // The list of all solvers compiled in Drake.
-constexpr std::array<StaticSolverInterface, 12> kKnownSolvers{
+constexpr std::array<StaticSolverInterface, 13> kKnownSolvers{
+    StaticSolverInterface::Make<BandedQPSolver>(),
     StaticSolverInterface::Make<ClpSolver>(),
     StaticSolverInterface::Make<CsdpSolver>(),
     StaticSolverInterface::Make<EqualityConstrainedQPSolver>(),
@@ -117,6 +117,14 @@ void QuadraticConstraint::DoEval(
   DoEvalGeneric(x, y);
 }
 
+void QuadraticConstraint::DoEvalLagrangianHessian(
+    const Eigen::Ref<const Eigen::VectorXd>&,
+    const Eigen::Ref<const Eigen::VectorXd>& lambda,
+    std::vector<Eigen::Triplet<double>>* hessian) const {
+  // Q_ is stored symmetric, and is the Hessian of the constraint.
+  internal::AppendLowerTriangle(Q_, lambda(0), hessian);
+}
+
 std::ostream& QuadraticConstraint::DoDisplay(
     std::ostream& os, const VectorX<symbolic::Variable>& vars) const {
   return DisplayConstraint(*this, os, "QuadraticConstraint", vars, false);
@@ -143,6 +151,7 @@ LorentzConeConstraint::LorentzConeConstraint(
       eval_type_{eval_type} {
   DRAKE_DEMAND(A_.rows() >= 2);
   DRAKE_ASSERT(A_.rows() == b_.rows());
+  set_has_analytical_lagrangian_hessian(true);
 }
 
 void LorentzConeConstraint::UpdateCoefficients(
@@ -231,6 +240,41 @@ void LorentzConeConstraint::DoEval(
   DoEvalGeneric(x, y);
 }
 
+void LorentzConeConstraint::DoEvalLagrangianHessian(
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const Eigen::Ref<const Eigen::VectorXd>& lambda,
+    std::vector<Eigen::Triplet<double>>* hessian) const {
+  // The Hessian with respect to x is Aᵀ * H_z * A, where H_z is the Hessian of
+  // λᵀy with respect to z = A * x + b.
+  const int nz = A_dense_.rows();
+  Eigen::MatrixXd H_z = Eigen::MatrixXd::Zero(nz, nz);
+  switch (eval_type_) {
+    case EvalType::kConvex:
+    case EvalType::kConvexSmooth: {
+      // y = z₀ - |z_tail|, whose Hessian in z_tail is
+      // -(I - z_tail * z_tailᵀ / |z_tail|²) / |z_tail|. As with the gradient
+      // in kConvexSmooth, |z_tail| is approximated by sqrt(|z_tail|² + ε) so
+      // that the Hessian is bounded.
+      const Eigen::VectorXd z_tail = (A_dense_ * x + b_).tail(nz - 1);
+      const double eps = 1E-12;
+      const double s = std::sqrt(z_tail.squaredNorm() + eps);
+      H_z.bottomRightCorner(nz - 1, nz - 1) =
+          -lambda(0) / s *
+          (Eigen::MatrixXd::Identity(nz - 1, nz - 1) -
+           z_tail * z_tail.transpose() / (s * s));
+      break;
+    }
+    case EvalType::kNonconvex: {
+      // y(1) = z₀² - |z_tail|².
+      H_z.diagonal().setConstant(-2 * lambda(1));
+      H_z(0, 0) = 2 * lambda(1);
+      break;
+    }
+  }
+  internal::AppendLowerTriangle(A_dense_.transpose() * H_z * A_dense_, 1.0,
+                                hessian);
+}
+
 std::ostream& LorentzConeConstraint::DoDisplay(
     std::ostream& os, const VectorX<symbolic::Variable>& vars) const {
   return DisplayConstraint(*this, os, "LorentzConeConstraint", vars, false);
@@ -280,6 +324,21 @@ void RotatedLorentzConeConstraint::DoEval(
   DoEvalGeneric(x, y);
 }
 
+void RotatedLorentzConeConstraint::DoEvalLagrangianHessian(
+    const Eigen::Ref<const Eigen::VectorXd>&,
+    const Eigen::Ref<const Eigen::VectorXd>& lambda,
+    std::vector<Eigen::Triplet<double>>* hessian) const {
+  // y(2) = z₀ * z₁ - |z_tail|² is the only nonlinear output, its Hessian with
+  // respect to x is Aᵀ * H_z * A.
+  const int nz = A_dense_.rows();
+  Eigen::MatrixXd H_z = Eigen::MatrixXd::Zero(nz, nz);
+  H_z(0, 1) = lambda(2);
+  H_z(1, 0) = lambda(2);
+  H_z.diagonal().tail(nz - 2).setConstant(-2 * lambda(2));
+  internal::AppendLowerTriangle(A_dense_.transpose() * H_z * A_dense_, 1.0,
+                                hessian);
+}
+
 std::ostream& RotatedLorentzConeConstraint::DoDisplay(
     std::ostream& os, const VectorX<symbolic::Variable>& vars) const {
   return DisplayConstraint(*this, os, "RotatedLorentzConeConstraint", vars,
@@ -292,6 +351,7 @@ LinearConstraint::LinearConstraint(const Eigen::Ref<const Eigen::MatrixXd>& A,
     : Constraint(A.rows(), A.cols(), lb, ub), A_(A) {
   DRAKE_DEMAND(A.rows() == lb.rows());
   DRAKE_DEMAND(A.array().isFinite().all());
+  set_has_analytical_lagrangian_hessian(true);
 }
 
 LinearConstraint::LinearConstraint(const Eigen::SparseMatrix<double>& A,
@@ -300,6 +360,7 @@ LinearConstraint::LinearConstraint(const Eigen::SparseMatrix<double>& A,
     : Constraint(A.rows(), A.cols(), lb, ub), A_(A) {
   DRAKE_DEMAND(A.rows() == lb.rows());
   DRAKE_DEMAND(A_.IsFinite());
+  set_has_analytical_lagrangian_hessian(true);
 }
 
 const Eigen::MatrixXd& LinearConstraint::GetDenseA() const {
@@ -384,6 +445,28 @@ void LinearConstraint::DoEval(
   DoEvalGeneric(x, y);
 }
 
+void LinearConstraint::DoEvalWithJacobian(
+    const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+    std::vector<Eigen::Triplet<double>>* dy_dx) const {
+  // The Jacobian of A * x is A, whose non-zero entries are read off the sparse
+  // matrix rather than computed through AutoDiffXd.
+  const Eigen::SparseMatrix<double>& A = A_.get_as_sparse();
+  *y = A * x;
+  dy_dx->reserve(A.nonZeros());
+  for (int k = 0; k < A.outerSize(); ++k) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(A, k); it; ++it) {
+      dy_dx->emplace_back(it.row(), it.col(), it.value());
+    }
+  }
+}
+
+void LinearConstraint::DoEvalLagrangianHessian(
+    const Eigen::Ref<const Eigen::VectorXd>&,
+    const Eigen::Ref<const Eigen::VectorXd>&,
+    std::vector<Eigen::Triplet<double>>*) const {
+  // A linear constraint has zero Hessian.
+}
+
 std::ostream& LinearConstraint::DoDisplay(
     std::ostream& os, const VectorX<symbolic::Variable>& vars) const {
   return DisplayConstraint(*this, os, "LinearConstraint", vars, false);
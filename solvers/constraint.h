@@ -215,6 +215,7 @@ class QuadraticConstraint : public Constraint {
         b_(b) {
     DRAKE_ASSERT(Q_.rows() == Q_.cols());
     DRAKE_ASSERT(Q_.cols() == b_.rows());
+    set_has_analytical_lagrangian_hessian(true);
   }
 
   ~QuadraticConstraint() override {}
@@ -261,6 +262,11 @@ class QuadraticConstraint : public Constraint {
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
               VectorX<symbolic::Expression>* y) const override;
 
+  void DoEvalLagrangianHessian(
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& lambda,
+      std::vector<Eigen::Triplet<double>>* hessian) const override;
+
   std::ostream& DoDisplay(std::ostream&,
                           const VectorX<symbolic::Variable>&) const override;
 
@@ -360,6 +366,11 @@ class LorentzConeConstraint : public Constraint {
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
               VectorX<symbolic::Expression>* y) const override;
 
+  void DoEvalLagrangianHessian(
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& lambda,
+      std::vector<Eigen::Triplet<double>>* hessian) const override;
+
   std::ostream& DoDisplay(std::ostream&,
                           const VectorX<symbolic::Variable>&) const override;
 
@@ -405,6 +416,7 @@ class RotatedLorentzConeConstraint : public Constraint {
         b_(b) {
     DRAKE_DEMAND(A_.rows() >= 3);
     DRAKE_ASSERT(A_.rows() == b_.rows());
+    set_has_analytical_lagrangian_hessian(true);
   }
 
   /** Getter for A. */
@@ -442,6 +454,11 @@ class RotatedLorentzConeConstraint : public Constraint {
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
               VectorX<symbolic::Expression>* y) const override;
 
+  void DoEvalLagrangianHessian(
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& lambda,
+      std::vector<Eigen::Triplet<double>>* hessian) const override;
+
   std::ostream& DoDisplay(std::ostream&,
                           const VectorX<symbolic::Variable>&) const override;
 
@@ -634,6 +651,15 @@ class LinearConstraint : public Constraint {
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
               VectorX<symbolic::Expression>* y) const override;
 
+  void DoEvalWithJacobian(
+      const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+      std::vector<Eigen::Triplet<double>>* dy_dx) const override;
+
+  void DoEvalLagrangianHessian(
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& lambda,
+      std::vector<Eigen::Triplet<double>>* hessian) const override;
+
   std::ostream& DoDisplay(std::ostream&,
                           const VectorX<symbolic::Variable>&) const override;
 
@@ -54,6 +54,25 @@ void LinearCost::DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
   DoEvalGeneric(x, y);
 }
 
+void LinearCost::DoEvalWithJacobian(
+    const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+    std::vector<Eigen::Triplet<double>>* dy_dx) const {
+  DoEvalGeneric(x, y);
+  dy_dx->reserve(a_.rows());
+  for (int j = 0; j < a_.rows(); ++j) {
+    if (a_(j) != 0) {
+      dy_dx->emplace_back(0, j, a_(j));
+    }
+  }
+}
+
+void LinearCost::DoEvalLagrangianHessian(
+    const Eigen::Ref<const Eigen::VectorXd>&,
+    const Eigen::Ref<const Eigen::VectorXd>&,
+    std::vector<Eigen::Triplet<double>>*) const {
+  // A linear cost has zero Hessian.
+}
+
 std::ostream& LinearCost::DoDisplay(
     std::ostream& os, const VectorX<symbolic::Variable>& vars) const {
   return DisplayCost(*this, os, "LinearCost", vars);
@@ -91,6 +110,27 @@ void QuadraticCost::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
   }
 }
 
+void QuadraticCost::DoEvalWithJacobian(
+    const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+    std::vector<Eigen::Triplet<double>>* dy_dx) const {
+  const Eigen::RowVectorXd xT_times_Q = x.transpose() * Q_;
+  y->resize(1);
+  (*y)(0) = .5 * xT_times_Q.dot(x) + b_.dot(x) + c_;
+  const Eigen::RowVectorXd dy = xT_times_Q + b_.transpose();
+  dy_dx->reserve(dy.size());
+  for (int j = 0; j < dy.size(); ++j) {
+    dy_dx->emplace_back(0, j, dy(j));
+  }
+}
+
+void QuadraticCost::DoEvalLagrangianHessian(
+    const Eigen::Ref<const Eigen::VectorXd>&,
+    const Eigen::Ref<const Eigen::VectorXd>& lambda,
+    std::vector<Eigen::Triplet<double>>* hessian) const {
+  // Q_ is stored symmetric, and is the Hessian of the cost.
+  internal::AppendLowerTriangle(Q_, lambda(0), hessian);
+}
+
 void QuadraticCost::DoEval(
     const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
     VectorX<symbolic::Expression>* y) const {
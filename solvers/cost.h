@@ -50,7 +50,9 @@ class LinearCost : public Cost {
    */
   // NOLINTNEXTLINE(runtime/explicit) This conversion is desirable.
   LinearCost(const Eigen::Ref<const Eigen::VectorXd>& a, double b = 0.)
-      : Cost(a.rows()), a_(a), b_(b) {}
+      : Cost(a.rows()), a_(a), b_(b) {
+    set_has_analytical_lagrangian_hessian(true);
+  }
 
   ~LinearCost() override {}
 
@@ -90,6 +92,15 @@ class LinearCost : public Cost {
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
               VectorX<symbolic::Expression>* y) const override;
 
+  void DoEvalWithJacobian(
+      const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+      std::vector<Eigen::Triplet<double>>* dy_dx) const override;
+
+  void DoEvalLagrangianHessian(
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& lambda,
+      std::vector<Eigen::Triplet<double>>* hessian) const override;
+
   std::ostream& DoDisplay(std::ostream&,
                           const VectorX<symbolic::Variable>&) const override;
 
@@ -129,6 +140,7 @@ class QuadraticCost : public Cost {
       : Cost(Q.rows()), Q_((Q + Q.transpose()) / 2), b_(b), c_(c) {
     DRAKE_ASSERT(Q_.rows() == Q_.cols());
     DRAKE_ASSERT(Q_.cols() == b_.rows());
+    set_has_analytical_lagrangian_hessian(true);
     if (is_hessian_psd.has_value()) {
       is_convex_ = is_hessian_psd.value();
     } else {
@@ -201,6 +213,15 @@ class QuadraticCost : public Cost {
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
               VectorX<symbolic::Expression>* y) const override;
 
+  void DoEvalWithJacobian(
+      const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+      std::vector<Eigen::Triplet<double>>* dy_dx) const override;
+
+  void DoEvalLagrangianHessian(
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& lambda,
+      std::vector<Eigen::Triplet<double>>* hessian) const override;
+
   std::ostream& DoDisplay(std::ostream&,
                           const VectorX<symbolic::Variable>&) const override;
 
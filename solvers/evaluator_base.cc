@@ -1,9 +1,14 @@
 #include "drake/solvers/evaluator_base.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
 #include <set>
 
 #include "drake/common/drake_throw.h"
 #include "drake/common/nice_type_name.h"
+#include "drake/math/autodiff_gradient.h"
 
 using std::make_shared;
 using std::shared_ptr;
@@ -87,10 +92,136 @@ void EvaluatorBase::SetGradientSparsityPattern(
   gradient_sparsity_pattern_.emplace(gradient_sparsity_pattern);
 }
 
+void EvaluatorBase::DoEvalWithJacobian(
+    const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+    std::vector<Eigen::Triplet<double>>* dy_dx) const {
+  AutoDiffVecXd y_autodiff(num_outputs());
+  DoEval(math::InitializeAutoDiff(x), &y_autodiff);
+  *y = math::ExtractValue(y_autodiff);
+  const Eigen::MatrixXd dy = math::ExtractGradient(y_autodiff, x.rows());
+  if (gradient_sparsity_pattern_.has_value()) {
+    dy_dx->reserve(gradient_sparsity_pattern_->size());
+    for (const auto& [row, col] : *gradient_sparsity_pattern_) {
+      dy_dx->emplace_back(row, col, dy(row, col));
+    }
+  } else {
+    for (int j = 0; j < dy.cols(); ++j) {
+      for (int i = 0; i < dy.rows(); ++i) {
+        if (dy(i, j) != 0) {
+          dy_dx->emplace_back(i, j, dy(i, j));
+        }
+      }
+    }
+  }
+}
+
+void EvaluatorBase::DoEvalLagrangianHessian(
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const Eigen::Ref<const Eigen::VectorXd>& lambda,
+    std::vector<Eigen::Triplet<double>>* hessian) const {
+  const int n = x.rows();
+  // Computes the gradient of λᵀy, namely (∂y/∂x)ᵀλ.
+  Eigen::VectorXd y;
+  std::vector<Eigen::Triplet<double>> dy_dx;
+  const auto calc_gradient = [&](const Eigen::VectorXd& x_eval,
+                                 Eigen::VectorXd* gradient) {
+    EvalWithJacobian(x_eval, &y, &dy_dx);
+    gradient->setZero(n);
+    for (const auto& entry : dy_dx) {
+      (*gradient)(entry.col()) += lambda(entry.row()) * entry.value();
+    }
+  };
+  // The step ∛ε balances the truncation and round-off errors of central
+  // differences.
+  const double relative_step =
+      std::cbrt(std::numeric_limits<double>::epsilon());
+  Eigen::MatrixXd H(n, n);
+  Eigen::VectorXd x_perturbed = x;
+  Eigen::VectorXd gradient_plus, gradient_minus;
+  for (int j = 0; j < n; ++j) {
+    const double h = relative_step * std::max(1.0, std::abs(x(j)));
+    x_perturbed(j) = x(j) + h;
+    calc_gradient(x_perturbed, &gradient_plus);
+    x_perturbed(j) = x(j) - h;
+    calc_gradient(x_perturbed, &gradient_minus);
+    x_perturbed(j) = x(j);
+    H.col(j) = (gradient_plus - gradient_minus) / (2 * h);
+  }
+  internal::AppendLowerTriangle((H + H.transpose()) / 2, 1.0, hessian);
+}
+
 std::ostream& operator<<(std::ostream& os, const EvaluatorBase& e) {
   return e.Display(os);
 }
 
+namespace internal {
+int GetJacobianSize(const EvaluatorBase& evaluator, int num_vars) {
+  const auto& pattern = evaluator.gradient_sparsity_pattern();
+  return pattern.has_value() ? static_cast<int>(pattern->size())
+                             : evaluator.num_outputs() * num_vars;
+}
+
+int ScatterJacobian(const EvaluatorBase& evaluator, int num_vars,
+                    const std::vector<Eigen::Triplet<double>>& dy_dx,
+                    const Eigen::Ref<const Eigen::VectorXd>& column_scale,
+                    double* values) {
+  const auto scale = [&column_scale](const Eigen::Triplet<double>& entry) {
+    return column_scale.size() > 0
+               ? entry.value() * column_scale(entry.col())
+               : entry.value();
+  };
+  const int size = GetJacobianSize(evaluator, num_vars);
+  const auto& pattern = evaluator.gradient_sparsity_pattern();
+  if (!pattern.has_value()) {
+    std::fill(values, values + size, 0.0);
+    for (const auto& entry : dy_dx) {
+      values[entry.row() * num_vars + entry.col()] = scale(entry);
+    }
+    return size;
+  }
+  // The default DoEvalWithJacobian() reports the entries in the order of the
+  // pattern, which lets us skip the lookup of each entry.
+  bool in_pattern_order = static_cast<int>(dy_dx.size()) == size;
+  for (int k = 0; in_pattern_order && k < size; ++k) {
+    in_pattern_order = dy_dx[k].row() == (*pattern)[k].first &&
+                       dy_dx[k].col() == (*pattern)[k].second;
+  }
+  if (in_pattern_order) {
+    for (int k = 0; k < size; ++k) {
+      values[k] = scale(dy_dx[k]);
+    }
+    return size;
+  }
+  std::map<std::pair<int, int>, int> pattern_index;
+  for (int k = 0; k < size; ++k) {
+    pattern_index.emplace((*pattern)[k], k);
+  }
+  std::fill(values, values + size, 0.0);
+  for (const auto& entry : dy_dx) {
+    const auto it = pattern_index.find({entry.row(), entry.col()});
+    DRAKE_DEMAND(it != pattern_index.end());
+    values[it->second] = scale(entry);
+  }
+  return size;
+}
+
+void AppendLowerTriangle(const Eigen::Ref<const Eigen::MatrixXd>& H,
+                         double scale,
+                         std::vector<Eigen::Triplet<double>>* hessian) {
+  DRAKE_DEMAND(H.rows() == H.cols());
+  if (scale == 0) {
+    return;
+  }
+  for (int j = 0; j < H.cols(); ++j) {
+    for (int i = j; i < H.rows(); ++i) {
+      if (H(i, j) != 0) {
+        hessian->emplace_back(i, j, scale * H(i, j));
+      }
+    }
+  }
+}
+}  // namespace internal
+
 void PolynomialEvaluator::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
                                  Eigen::VectorXd* y) const {
   double_evaluation_point_temp_.clear();
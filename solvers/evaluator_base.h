@@ -8,6 +8,7 @@
 #include <vector>
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
@@ -74,6 +75,63 @@ class EvaluatorBase {
     DRAKE_ASSERT(y->rows() == num_outputs_);
   }
 
+  /**
+   * Evaluates the expression and its Jacobian ∂y/∂x in double precision.
+   *
+   * Nonlinear solvers call this method when they need the gradient, instead
+   * of evaluating the expression on AutoDiffXd themselves. Unless the derived
+   * class overrides DoEvalWithJacobian(), the Jacobian is obtained by
+   * evaluating the expression on AutoDiffXd.
+   * @param[in] x A `num_vars` x 1 input vector.
+   * @param[out] y A `num_outputs` x 1 output vector.
+   * @param[out] dy_dx The entries (row, col, value) of ∂y/∂x. Each entry
+   * appears at most once, and entries that do not appear are zero. When
+   * gradient_sparsity_pattern() is set, every entry is in the pattern.
+   */
+  void EvalWithJacobian(const Eigen::Ref<const Eigen::VectorXd>& x,
+                        Eigen::VectorXd* y,
+                        std::vector<Eigen::Triplet<double>>* dy_dx) const {
+    DRAKE_ASSERT(x.rows() == num_vars_ || num_vars_ == Eigen::Dynamic);
+    DRAKE_ASSERT(dy_dx != nullptr);
+    dy_dx->clear();
+    DoEvalWithJacobian(x, y, dy_dx);
+    DRAKE_ASSERT(y->rows() == num_outputs_);
+  }
+
+  /**
+   * Evaluates the Hessian of λᵀy with respect to x, namely ∑ᵢ λᵢ ∂²yᵢ/∂x²,
+   * which is this evaluator's contribution to the Hessian of the Lagrangian in
+   * a nonlinear program.
+   *
+   * Unless the derived class overrides DoEvalLagrangianHessian(), the Hessian
+   * is obtained by central differences of the gradients computed by
+   * EvalWithJacobian(), and so is only approximate; see
+   * has_analytical_lagrangian_hessian().
+   * @param[in] x A `num_vars` x 1 input vector.
+   * @param[in] lambda A `num_outputs` x 1 vector of multipliers.
+   * @param[out] hessian The entries (row, col, value) of the Hessian in its
+   * lower triangle (row >= col). Each entry appears at most once, and entries
+   * that do not appear are zero.
+   */
+  void EvalLagrangianHessian(
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& lambda,
+      std::vector<Eigen::Triplet<double>>* hessian) const {
+    DRAKE_ASSERT(x.rows() == num_vars_ || num_vars_ == Eigen::Dynamic);
+    DRAKE_ASSERT(lambda.rows() == num_outputs_);
+    DRAKE_ASSERT(hessian != nullptr);
+    hessian->clear();
+    DoEvalLagrangianHessian(x, lambda, hessian);
+  }
+
+  /**
+   * Returns true iff EvalLagrangianHessian() computes the Hessian exactly
+   * (e.g., in closed form), rather than by the finite-difference fallback.
+   */
+  bool has_analytical_lagrangian_hessian() const {
+    return has_analytical_lagrangian_hessian_;
+  }
+
   /**
    * Set a human-friendly description for the evaluator.
    */
@@ -181,6 +239,38 @@ class EvaluatorBase {
   virtual void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
                       VectorX<symbolic::Expression>* y) const = 0;
 
+  /**
+   * Implements EvalWithJacobian(). The default implementation evaluates the
+   * expression on AutoDiffXd, and reports the entries of the gradient within
+   * gradient_sparsity_pattern() (or the non-zero entries when no pattern is
+   * set). Derived classes that can compute the Jacobian directly should
+   * override this method.
+   * @param x Input vector.
+   * @param y Output vector.
+   * @param dy_dx The Jacobian entries, empty on entry.
+   * @pre x must be of size `num_vars` x 1.
+   * @post y will be of size `num_outputs` x 1.
+   */
+  virtual void DoEvalWithJacobian(
+      const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+      std::vector<Eigen::Triplet<double>>* dy_dx) const;
+
+  /**
+   * Implements EvalLagrangianHessian(). The default implementation takes
+   * central differences of the gradient of λᵀy computed by
+   * EvalWithJacobian(), and reports the lower triangle of the symmetrized
+   * result. Derived classes with an analytical Hessian should override this
+   * method, and call set_has_analytical_lagrangian_hessian(true).
+   * @param x Input vector.
+   * @param lambda The multipliers of the outputs.
+   * @param hessian The lower-triangular Hessian entries, empty on entry.
+   * @pre x must be of size `num_vars` x 1.
+   */
+  virtual void DoEvalLagrangianHessian(
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& lambda,
+      std::vector<Eigen::Triplet<double>>* hessian) const;
+
   /**
    * NVI implementation of Display. The default implementation will report
    * the NiceTypeName, get_description, and list the bound variables.
@@ -197,10 +287,17 @@ class EvaluatorBase {
   // matrix in the linear constraint is resized.
   void set_num_outputs(int num_outputs) { num_outputs_ = num_outputs; }
 
+  // Setter for has_analytical_lagrangian_hessian(), to be called by the
+  // sub-classes that override DoEvalLagrangianHessian().
+  void set_has_analytical_lagrangian_hessian(bool value) {
+    has_analytical_lagrangian_hessian_ = value;
+  }
+
  private:
   int num_vars_{};
   int num_outputs_{};
   std::string description_;
+  bool has_analytical_lagrangian_hessian_{false};
   // gradient_sparsity_pattern_ records the pair (row_index, col_index) that
   // contains the non-zero entries in the gradient of the Eval
   // function. Note that if the entry (row_index, col_index) *can* be non-zero
@@ -216,6 +313,40 @@ class EvaluatorBase {
  */
 std::ostream& operator<<(std::ostream& os, const EvaluatorBase& e);
 
+namespace internal {
+/*
+ * Returns the number of Jacobian entries that a solver reports for
+ * `evaluator` bound to `num_vars` variables: the size of its
+ * gradient_sparsity_pattern() if set, otherwise num_outputs * num_vars.
+ */
+int GetJacobianSize(const EvaluatorBase& evaluator, int num_vars);
+
+/*
+ * Writes the Jacobian entries `dy_dx` computed by
+ * EvaluatorBase::EvalWithJacobian() into `values`, laid out the way the
+ * nonlinear solvers declare the Jacobian structure of a binding: one value
+ * per entry of gradient_sparsity_pattern() in its order if set, otherwise the
+ * dense num_outputs x num_vars matrix in row-major order. Entries missing
+ * from `dy_dx` are written as zero.
+ * @param column_scale If non-empty, entry (i, j) is multiplied by
+ * column_scale(j).
+ * @returns GetJacobianSize(evaluator, num_vars), the number of values written.
+ */
+int ScatterJacobian(const EvaluatorBase& evaluator, int num_vars,
+                    const std::vector<Eigen::Triplet<double>>& dy_dx,
+                    const Eigen::Ref<const Eigen::VectorXd>& column_scale,
+                    double* values);
+
+/*
+ * Appends the lower triangle (row >= col) of the symmetric matrix `scale * H`
+ * to `hessian`, skipping the zero entries. Used by the analytical overrides of
+ * EvaluatorBase::DoEvalLagrangianHessian().
+ */
+void AppendLowerTriangle(const Eigen::Ref<const Eigen::MatrixXd>& H,
+                         double scale,
+                         std::vector<Eigen::Triplet<double>>* hessian);
+}  // namespace internal
+
 /**
  * Implements an evaluator of the form P(x, y...) where P is a multivariate
  * polynomial in x, y, ...
@@ -3,20 +3,23 @@
 #include <algorithm>
 #include <cstring>
 #include <limits>
+#include <map>
 #include <memory>
 #include <optional>
+#include <stdexcept>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include <IpIpoptApplication.hpp>
 #include <IpTNLP.hpp>
+#include <fmt/format.h>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/never_destroyed.h"
 #include "drake/common/text_logging.h"
 #include "drake/common/unused.h"
-#include "drake/math/autodiff.h"
 #include "drake/solvers/mathematical_program.h"
 
 using Ipopt::Index;
@@ -137,7 +140,7 @@ void SetAllConstraintDualSolution(
 /// @return number of constraints
 int GetNumGradients(const Constraint& c, int var_count, Index* num_grad) {
   const int num_constraints = c.num_constraints();
-  *num_grad = num_constraints * var_count;
+  *num_grad = internal::GetJacobianSize(c, var_count);
   return num_constraints;
 }
 
@@ -160,6 +163,19 @@ size_t GetGradientMatrix(
   const int m = c.num_constraints();
   size_t grad_index = 0;
 
+  const std::optional<std::vector<std::pair<int, int>>>&
+      gradient_sparsity_pattern = c.gradient_sparsity_pattern();
+  if (gradient_sparsity_pattern.has_value()) {
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(variables);
+    for (const auto& nonzero_entry : gradient_sparsity_pattern.value()) {
+      iRow[grad_index] = constraint_idx + nonzero_entry.first;
+      jCol[grad_index] = var_indices[nonzero_entry.second];
+      grad_index++;
+    }
+    return grad_index;
+  }
+
   for (int i = 0; i < static_cast<int>(m); ++i) {
     for (int j = 0; j < variables.rows(); ++j) {
       iRow[grad_index] = constraint_idx + i;
@@ -190,9 +206,9 @@ size_t EvaluateConstraint(const MathematicalProgram& prog,
                           const VectorXDecisionVariable& variables,
                           Number* result, Number* grad) {
   // For constraints which don't use all of the variables in the X
-  // input, extract a subset into the AutoDiffVecXd this_x to evaluate
-  // the constraint (we actually do this for all constraints.  One
-  // potential optimization might be to detect if the initial "tx" has
+  // input, extract a subset into this_x to evaluate the constraint
+  // (we actually do this for all constraints.  One
+  // potential optimization might be to detect if the initial "xvec" has
   // the correct geometry (e.g. the constraint uses all decision
   // variables in the same order they appear in xvec), but this is not
   // currently done).
@@ -218,33 +234,20 @@ size_t EvaluateConstraint(const MathematicalProgram& prog,
 
   // Run the version which calculates gradients.
 
-  AutoDiffVecXd ty(c.num_constraints());
-  c.Eval(math::InitializeAutoDiff(this_x), &ty);
+  Eigen::VectorXd ty(c.num_constraints());
+  std::vector<Eigen::Triplet<double>> dty;
+  c.EvalWithJacobian(this_x, &ty, &dty);
 
   // Store the results.  Since IPOPT directly knows the bounds of the
   // constraint, we don't need to apply any bounding information here.
   for (int i = 0; i < c.num_constraints(); i++) {
-    result[i] = ty(i).value();
+    result[i] = ty(i);
   }
 
-  // Extract the appropriate derivatives from our result into the
-  // gradient array.
-  size_t grad_idx = 0;
-
-  DRAKE_ASSERT(ty.rows() == c.num_constraints());
-  for (int i = 0; i < ty.rows(); i++) {
-    if (ty(i).derivatives().size() > 0) {
-      for (int j = 0; j < variables.rows(); j++) {
-        grad[grad_idx++] = ty(i).derivatives()(j);
-      }
-    } else {
-      for (int j = 0; j < variables.rows(); j++) {
-        grad[grad_idx++] = 0;
-      }
-    }
-  }
-
-  return grad_idx;
+  // Write the derivatives into the gradient array, in the layout declared by
+  // GetGradientMatrix.
+  return internal::ScatterJacobian(c, num_v_variables, dty,
+                                   Eigen::VectorXd(), grad);
 }
 
 // IPOPT uses separate callbacks to get the result and the gradients.  When
@@ -305,10 +308,20 @@ struct ResultCache {
 // the duration of the Solve() call.
 class IpoptSolver_NLP : public Ipopt::TNLP {
  public:
-  explicit IpoptSolver_NLP(const MathematicalProgram& problem,
-                           const Eigen::VectorXd& x_init,
-                           MathematicalProgramResult* result)
-      : problem_(&problem), x_init_{x_init}, result_(result) {}
+  // When `exact_hessian` is true, eval_h() reports the Hessian of the
+  // Lagrangian computed by EvaluatorBase::EvalLagrangianHessian(); otherwise
+  // IPOPT must be configured to approximate the Hessian itself. The
+  // finite-difference Hessians of the evaluators without an analytical one
+  // are only accepted when `allow_finite_difference_hessian` is true.
+  IpoptSolver_NLP(const MathematicalProgram& problem,
+                  const Eigen::VectorXd& x_init, bool exact_hessian,
+                  bool allow_finite_difference_hessian,
+                  MathematicalProgramResult* result)
+      : problem_(&problem),
+        x_init_{x_init},
+        exact_hessian_{exact_hessian},
+        allow_finite_difference_hessian_{allow_finite_difference_hessian},
+        result_(result) {}
 
   virtual ~IpoptSolver_NLP() {}
 
@@ -352,6 +365,10 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
     constraint_cache_.reset(new ResultCache(n, m, nnz_jac_g));
 
     nnz_h_lag = 0;
+    if (exact_hessian_) {
+      BuildHessianStructure();
+      nnz_h_lag = hessian_rows_.size();
+    }
     index_style = C_STYLE;
     return true;
   }
@@ -550,6 +567,62 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
     return true;
   }
 
+  virtual bool eval_h(Index n, const Number* x, bool new_x, Number obj_factor,
+                      Index m, const Number* lambda, bool new_lambda,
+                      Index nele_hess, Index* iRow, Index* jCol,
+                      Number* values) {
+    unused(new_x, m, new_lambda);
+    DRAKE_ASSERT(exact_hessian_);
+    DRAKE_ASSERT(nele_hess == static_cast<Index>(hessian_rows_.size()));
+
+    if (values == nullptr) {
+      // We're being asked for the structure.
+      DRAKE_ASSERT(iRow != nullptr);
+      DRAKE_ASSERT(jCol != nullptr);
+      std::copy(hessian_rows_.begin(), hessian_rows_.end(), iRow);
+      std::copy(hessian_cols_.begin(), hessian_cols_.end(), jCol);
+      return true;
+    }
+
+    DRAKE_ASSERT(iRow == nullptr);
+    DRAKE_ASSERT(jCol == nullptr);
+
+    // We're being asked for the actual values. The multipliers are laid out in
+    // the same order as the constraints in EvaluateConstraints(), and the
+    // nonlinear bindings are visited in the order of hessian_blocks_.
+    const Eigen::VectorXd xvec = MakeEigenVector(n, x);
+    std::fill(values, values + nele_hess, 0.0);
+    const Vector1d cost_multiplier(obj_factor);
+    auto block = hessian_blocks_.cbegin();
+    for (const auto& binding : problem_->GetAllCosts()) {
+      if (HasLagrangianHessian(binding)) {
+        AddLagrangianHessian(binding, *block++, xvec, cost_multiplier, values);
+      }
+    }
+    int constraint_idx = 0;
+    const auto add_constraint_hessians = [&](const auto& bindings) {
+      for (const auto& binding : bindings) {
+        const int num_constraints = binding.evaluator()->num_constraints();
+        if (HasLagrangianHessian(binding)) {
+          AddLagrangianHessian(
+              binding, *block++, xvec,
+              Eigen::Map<const Eigen::VectorXd>(lambda + constraint_idx,
+                                                num_constraints),
+              values);
+        }
+        constraint_idx += num_constraints;
+      }
+    };
+    add_constraint_hessians(problem_->generic_constraints());
+    add_constraint_hessians(problem_->lorentz_cone_constraints());
+    add_constraint_hessians(problem_->rotated_lorentz_cone_constraints());
+    add_constraint_hessians(problem_->linear_constraints());
+    add_constraint_hessians(problem_->linear_equality_constraints());
+    DRAKE_ASSERT(constraint_idx == m);
+    DRAKE_ASSERT(block == hessian_blocks_.cend());
+    return true;
+  }
+
   virtual void finalize_solution(SolverReturn status, Index n, const Number* x,
                                  const Number* z_L, const Number* z_U, Index m,
                                  const Number* g, const Number* lambda,
@@ -616,12 +689,132 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
   }
 
  private:
+  // Linear costs and constraints do not contribute to the Hessian of the
+  // Lagrangian, so they are left out of its sparsity structure.
+  template <typename C>
+  static bool HasLagrangianHessian(const Binding<C>& binding) {
+    const EvaluatorBase* evaluator = binding.evaluator().get();
+    return dynamic_cast<const LinearCost*>(evaluator) == nullptr &&
+           dynamic_cast<const LinearConstraint*>(evaluator) == nullptr;
+  }
+
+  // The part of the Hessian of the Lagrangian contributed by one nonlinear
+  // binding.
+  struct HessianBlock {
+    // The indices of the binding's variables in the program.
+    std::vector<int> indices;
+    // The position in the values of eval_h() of each entry (r, c) of the
+    // binding's own Hessian, at scatter[r * indices.size() + c] for r >= c.
+    std::vector<Index> scatter;
+  };
+
+  // The sparsity structure is the lower triangle (row >= col) of the union of
+  // the dense Hessian blocks over the variables of each nonlinear binding. It
+  // is recorded in hessian_rows_ and hessian_cols_, and hessian_blocks_ maps
+  // the entries of each binding's Hessian into it, so that eval_h() does not
+  // need to look up each entry.
+  void BuildHessianStructure() {
+    hessian_blocks_.clear();
+    // The bindings whose Hessian is approximated by finite differences.
+    std::vector<std::string> approximated;
+    const auto add_binding = [this, &approximated](const auto& binding) {
+      if (HasLagrangianHessian(binding)) {
+        // IPOPT takes a finite-difference approximation to be exact, so it is
+        // only used when the user asked for it.
+        if (!binding.evaluator()->has_analytical_lagrangian_hessian()) {
+          if (!allow_finite_difference_hessian_) {
+            throw std::invalid_argument(fmt::format(
+                "IpoptSolver: hessian_approximation=exact requires the exact "
+                "Hessian of every nonlinear cost and constraint, but {} only "
+                "approximates its Hessian by finite differences; use "
+                "hessian_approximation=limited-memory instead, or set the "
+                "option drake_allow_finite_difference_hessian=1.",
+                binding.to_string()));
+          }
+          approximated.push_back(binding.to_string());
+        }
+        hessian_blocks_.push_back(
+            {problem_->FindDecisionVariableIndices(binding.variables()), {}});
+      }
+    };
+    for (const auto& binding : problem_->GetAllCosts()) {
+      add_binding(binding);
+    }
+    for (const auto& binding : problem_->generic_constraints()) {
+      add_binding(binding);
+    }
+    for (const auto& binding : problem_->lorentz_cone_constraints()) {
+      add_binding(binding);
+    }
+    for (const auto& binding : problem_->rotated_lorentz_cone_constraints()) {
+      add_binding(binding);
+    }
+    if (!approximated.empty()) {
+      log()->warn(
+          "IpoptSolver: the Hessians of {} nonlinear costs and constraints "
+          "(e.g. {}) are approximated by finite differences, but IPOPT uses "
+          "them as the exact Hessian of the Lagrangian "
+          "(drake_allow_finite_difference_hessian=1).",
+          approximated.size(), approximated.front());
+    }
+
+    std::map<std::pair<int, int>, Index> value_index;
+    for (const HessianBlock& block : hessian_blocks_) {
+      for (int i : block.indices) {
+        for (int j : block.indices) {
+          if (i >= j) {
+            value_index.emplace(std::make_pair(i, j), 0);
+          }
+        }
+      }
+    }
+    hessian_rows_.clear();
+    hessian_cols_.clear();
+    for (auto& [row_col, index] : value_index) {
+      index = hessian_rows_.size();
+      hessian_rows_.push_back(row_col.first);
+      hessian_cols_.push_back(row_col.second);
+    }
+    for (HessianBlock& block : hessian_blocks_) {
+      const int size = block.indices.size();
+      block.scatter.resize(size * size);
+      for (int r = 0; r < size; ++r) {
+        for (int c = 0; c <= r; ++c) {
+          const int i = block.indices[r];
+          const int j = block.indices[c];
+          block.scatter[r * size + c] =
+              value_index.at(std::make_pair(std::max(i, j), std::min(i, j)));
+        }
+      }
+    }
+  }
+
+  // Adds the Hessian of lambdaᵀ * binding(x) to the values of eval_h().
+  template <typename C>
+  void AddLagrangianHessian(const Binding<C>& binding,
+                            const HessianBlock& block,
+                            const Eigen::VectorXd& xvec,
+                            const Eigen::Ref<const Eigen::VectorXd>& lambda,
+                            Number* values) {
+    const int size = block.indices.size();
+    Eigen::VectorXd this_x(size);
+    for (int i = 0; i < size; ++i) {
+      this_x(i) = xvec(block.indices[i]);
+    }
+    binding.evaluator()->EvalLagrangianHessian(this_x, lambda,
+                                               &hessian_entries_);
+    for (const auto& entry : hessian_entries_) {
+      values[block.scatter[entry.row() * size + entry.col()]] += entry.value();
+    }
+  }
+
   void EvaluateCosts(Index n, const Number* x) {
     const Eigen::VectorXd xvec = MakeEigenVector(n, x);
 
     problem_->EvalVisualizationCallbacks(xvec);
 
-    AutoDiffVecXd ty(1);
+    Eigen::VectorXd ty(1);
+    std::vector<Eigen::Triplet<double>> dty;
     Eigen::VectorXd this_x;
 
     cost_cache_->SetX(n, x);
@@ -636,21 +829,16 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
             xvec(problem_->FindDecisionVariableIndex(binding.variables()(i)));
       }
 
-      binding.evaluator()->Eval(math::InitializeAutoDiff(this_x), &ty);
+      binding.evaluator()->EvalWithJacobian(this_x, &ty, &dty);
 
-      cost_cache_->result[0] += ty(0).value();
+      cost_cache_->result[0] += ty(0);
 
-      if (ty(0).derivatives().size() > 0) {
-        for (int j = 0; j < num_v_variables; ++j) {
-          const size_t vj_index =
-              problem_->FindDecisionVariableIndex(binding.variables()(j));
-          cost_cache_->grad[vj_index] += ty(0).derivatives()(j);
-        }
+      for (const auto& entry : dty) {
+        const size_t vj_index = problem_->FindDecisionVariableIndex(
+            binding.variables()(entry.col()));
+        cost_cache_->grad[vj_index] += entry.value();
       }
       cost_cache_->grad_valid = true;
-
-      // We do not need to add code for ty(0).derivatives().size() == 0, since
-      // cost_cache_->grad would be unchanged if the derivative has zero size.
     }
   }
 
@@ -696,6 +884,15 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
   std::unique_ptr<ResultCache> cost_cache_;
   std::unique_ptr<ResultCache> constraint_cache_;
   Eigen::VectorXd x_init_;
+  const bool exact_hessian_;
+  const bool allow_finite_difference_hessian_;
+  // The sparsity structure of the Hessian of the Lagrangian, and its blocks
+  // for each nonlinear binding. Only populated when exact_hessian_ is true.
+  std::vector<Index> hessian_rows_;
+  std::vector<Index> hessian_cols_;
+  std::vector<HessianBlock> hessian_blocks_;
+  // Scratch space for the entries reported by EvalLagrangianHessian().
+  std::vector<Eigen::Triplet<double>> hessian_entries_;
   MathematicalProgramResult* const result_;
   // bb_con_dual_variable_indices_[constraint] maps the bounding box constraint
   // to the indices of its dual variables (one for lower bound and one for upper
@@ -776,6 +973,16 @@ void SetIpoptOptions(const MathematicalProgram& prog,
   }
 
   for (const auto& it : ipopt_options_int) {
+    // This option is handled by IpoptSolver_NLP, and unknown to IPOPT.
+    if (it.first == "drake_allow_finite_difference_hessian") {
+      if (!(it.second == 0 || it.second == 1)) {
+        throw std::invalid_argument(fmt::format(
+            "IpoptSolver: option drake_allow_finite_difference_hessian "
+            "should be either 0 or 1, but is incorrectly set to {}",
+            it.second));
+      }
+      continue;
+    }
     app->Options()->SetIntegerValue(it.first, it.second);
   }
 
@@ -875,8 +1082,20 @@ void IpoptSolver::DoSolve(
     return;
   }
 
+  // IPOPT only calls eval_h() when asked to use the exact Hessian.
+  std::string hessian_approximation;
+  app->Options()->GetStringValue("hessian_approximation",
+                                 hessian_approximation, "");
+  const bool exact_hessian = hessian_approximation == "exact";
+  const auto& options_int = merged_options.GetOptionsInt(id());
+  const auto allow_it =
+      options_int.find("drake_allow_finite_difference_hessian");
+  const bool allow_finite_difference_hessian =
+      allow_it != options_int.end() && allow_it->second == 1;
+
   Ipopt::SmartPtr<IpoptSolver_NLP> nlp =
-      new IpoptSolver_NLP(prog, initial_guess, result);
+      new IpoptSolver_NLP(prog, initial_guess, exact_hessian,
+                          allow_finite_difference_hessian, result);
   status = app->OptimizeTNLP(nlp);
 }
 
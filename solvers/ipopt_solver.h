@@ -40,6 +40,28 @@ struct IpoptSolverDetails {
   const char* ConvertStatusToString() const;
 };
 
+/**
+ * By default IpoptSolver sets the IPOPT option "hessian_approximation" to
+ * "limited-memory", so that IPOPT approximates the Hessian of the Lagrangian
+ * with L-BFGS. Setting it to "exact", e.g.
+ * `solver_options.SetOption(IpoptSolver::id(), "hessian_approximation",
+ * "exact")`, makes IPOPT use the Hessian computed by
+ * EvaluatorBase::EvalLagrangianHessian() for each cost and constraint. This
+ * requires every nonlinear cost and constraint to have an analytical Hessian
+ * (e.g. QuadraticCost, QuadraticConstraint, LorentzConeConstraint; see
+ * EvaluatorBase::has_analytical_lagrangian_hessian()); otherwise Solve()
+ * throws, rather than passing IPOPT a finite-difference approximation as the
+ * exact Hessian.
+ *
+ * On top of the IPOPT options, IpoptSolver accepts the integer option
+ * "drake_allow_finite_difference_hessian". Setting it to 1 lets the costs and
+ * constraints without an analytical Hessian (e.g. the generic constraints of
+ * trajectory optimization) take part in the exact Hessian, using the central
+ * differences of their gradients computed by
+ * EvaluatorBase::EvalLagrangianHessian(). IPOPT then treats these
+ * approximations as exact, which can slow down or derail its convergence, so
+ * Solve() logs a warning when it uses them. The default is 0.
+ */
 class IpoptSolver final : public SolverBase {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(IpoptSolver)
@@ -141,6 +141,23 @@ VectorX<T> Flatten(const Eigen::Ref<const MatrixX<T>>& mat) {
     return vec;
   }
 }
+
+// Returns the decision variables of `prog` with the given indices.
+VectorXDecisionVariable GetDecisionVariablesByIndex(
+    const MathematicalProgram& prog, const std::vector<int>& var_indices) {
+  VectorXDecisionVariable vars(var_indices.size());
+  for (int j = 0; j < static_cast<int>(var_indices.size()); ++j) {
+    const int index = var_indices[j];
+    if (index < 0 || index >= prog.num_vars()) {
+      throw std::out_of_range(fmt::format(
+          "var_indices[{}] = {} is not a decision variable index; the program "
+          "has {} decision variables.",
+          j, index, prog.num_vars()));
+    }
+    vars(j) = prog.decision_variable(index);
+  }
+  return vars;
+}
 }  // namespace
 
 void MathematicalProgram::AddDecisionVariables(
@@ -827,12 +844,13 @@ Binding<LinearConstraint> MathematicalProgram::AddConstraint(
   } else {
     // TODO(eric.cousineau): This is a good assertion... But seems out of place,
     // possibly redundant w.r.t. the binding infrastructure.
-    DRAKE_ASSERT(binding.evaluator()->GetDenseA().cols() ==
+    DRAKE_ASSERT(binding.evaluator()->num_vars() ==
                  static_cast<int>(binding.GetNumElements()));
     if (!CheckBinding(binding)) {
       return binding;
     }
     required_capabilities_.insert(ProgramAttribute::kLinearConstraint);
+    linear_constraints_structure_.reset();
     linear_constraints_.push_back(binding);
     return linear_constraints_.back();
   }
@@ -846,14 +864,32 @@ Binding<LinearConstraint> MathematicalProgram::AddLinearConstraint(
   return AddConstraint(make_shared<LinearConstraint>(A, lb, ub), vars);
 }
 
+Binding<LinearConstraint> MathematicalProgram::AddLinearConstraint(
+    const Eigen::SparseMatrix<double>& A,
+    const Eigen::Ref<const Eigen::VectorXd>& lb,
+    const Eigen::Ref<const Eigen::VectorXd>& ub,
+    const Eigen::Ref<const VectorXDecisionVariable>& vars) {
+  return AddConstraint(make_shared<LinearConstraint>(A, lb, ub), vars);
+}
+
+Binding<LinearConstraint> MathematicalProgram::AddLinearConstraint(
+    const Eigen::SparseMatrix<double>& A,
+    const Eigen::Ref<const Eigen::VectorXd>& lb,
+    const Eigen::Ref<const Eigen::VectorXd>& ub,
+    const std::vector<int>& var_indices) {
+  return AddLinearConstraint(A, lb, ub,
+                             GetDecisionVariablesByIndex(*this, var_indices));
+}
+
 Binding<LinearEqualityConstraint> MathematicalProgram::AddConstraint(
     const Binding<LinearEqualityConstraint>& binding) {
-  DRAKE_ASSERT(binding.evaluator()->GetDenseA().cols() ==
+  DRAKE_ASSERT(binding.evaluator()->num_vars() ==
                static_cast<int>(binding.GetNumElements()));
   if (!CheckBinding(binding)) {
     return binding;
   }
   required_capabilities_.insert(ProgramAttribute::kLinearEqualityConstraint);
+  linear_constraints_structure_.reset();
   linear_equality_constraints_.push_back(binding);
   return linear_equality_constraints_.back();
 }
@@ -877,6 +913,23 @@ MathematicalProgram::AddLinearEqualityConstraint(
   return AddConstraint(make_shared<LinearEqualityConstraint>(Aeq, beq), vars);
 }
 
+Binding<LinearEqualityConstraint>
+MathematicalProgram::AddLinearEqualityConstraint(
+    const Eigen::SparseMatrix<double>& Aeq,
+    const Eigen::Ref<const Eigen::VectorXd>& beq,
+    const Eigen::Ref<const VectorXDecisionVariable>& vars) {
+  return AddConstraint(make_shared<LinearEqualityConstraint>(Aeq, beq), vars);
+}
+
+Binding<LinearEqualityConstraint>
+MathematicalProgram::AddLinearEqualityConstraint(
+    const Eigen::SparseMatrix<double>& Aeq,
+    const Eigen::Ref<const Eigen::VectorXd>& beq,
+    const std::vector<int>& var_indices) {
+  return AddLinearEqualityConstraint(
+      Aeq, beq, GetDecisionVariablesByIndex(*this, var_indices));
+}
+
 Binding<BoundingBoxConstraint> MathematicalProgram::AddConstraint(
     const Binding<BoundingBoxConstraint>& binding) {
   if (!CheckBinding(binding)) {
@@ -885,6 +938,7 @@ Binding<BoundingBoxConstraint> MathematicalProgram::AddConstraint(
   DRAKE_ASSERT(binding.evaluator()->num_outputs() ==
                static_cast<int>(binding.GetNumElements()));
   required_capabilities_.insert(ProgramAttribute::kLinearConstraint);
+  linear_constraints_structure_.reset();
   bbox_constraints_.push_back(binding);
   return bbox_constraints_.back();
 }
@@ -1744,6 +1798,7 @@ int MathematicalProgram::RemoveConstraint(
   } else if (dynamic_cast<LinearEqualityConstraint*>(constraint_evaluator)) {
     // LinearEqualityConstraint is derived from LinearConstraint. Put this
     // branch before the LinearConstraint branch.
+    linear_constraints_structure_.reset();
     return RemoveCostOrConstraintImpl(
         internal::BindingDynamicCast<LinearEqualityConstraint>(constraint),
         ProgramAttribute::kLinearEqualityConstraint,
@@ -1751,10 +1806,12 @@ int MathematicalProgram::RemoveConstraint(
   } else if (dynamic_cast<BoundingBoxConstraint*>(constraint_evaluator)) {
     // BoundingBoxConstraint is derived from LinearConstraint. Put this branch
     // before the LinearConstraint branch.
+    linear_constraints_structure_.reset();
     return RemoveCostOrConstraintImpl(
         internal::BindingDynamicCast<BoundingBoxConstraint>(constraint),
         ProgramAttribute::kLinearConstraint, &bbox_constraints_);
   } else if (dynamic_cast<LinearConstraint*>(constraint_evaluator)) {
+    linear_constraints_structure_.reset();
     return RemoveCostOrConstraintImpl(
         internal::BindingDynamicCast<LinearConstraint>(constraint),
         ProgramAttribute::kLinearConstraint, &linear_constraints_);
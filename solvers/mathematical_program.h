@@ -6,6 +6,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <ostream>
 #include <set>
@@ -133,6 +134,16 @@ struct assert_if_is_constraint {
 };
 }  // namespace internal
 
+class MathematicalProgram;
+
+namespace internal {
+// See aggregate_costs_constraints.h.
+struct AggregatedLinearConstraints;
+struct LinearConstraintsStructure;
+AggregatedLinearConstraints AggregateLinearConstraints(
+    const MathematicalProgram& prog);
+}  // namespace internal
+
 /**
  * MathematicalProgram stores the decision variables, the constraints and costs
  * of an optimization problem. The user can solve the problem by calling
@@ -1422,6 +1433,34 @@ class MathematicalProgram {
       const Eigen::Ref<const Eigen::VectorXd>& ub,
       const Eigen::Ref<const VectorXDecisionVariable>& vars);
 
+  /**
+   * Adds linear constraints lb <= A * vars <= ub with a sparse matrix A.
+   * This is the preferred way to add many rows at once, for example the
+   * dynamics of a long trajectory: the rows become one binding, and A is stored
+   * without ever being converted to a dense matrix or to symbolic expressions,
+   * so the cost of adding the constraint is linear in the number of nonzeros.
+   * @pydrake_mkdoc_identifier{sparse_A}
+   */
+  Binding<LinearConstraint> AddLinearConstraint(
+      const Eigen::SparseMatrix<double>& A,
+      const Eigen::Ref<const Eigen::VectorXd>& lb,
+      const Eigen::Ref<const Eigen::VectorXd>& ub,
+      const Eigen::Ref<const VectorXDecisionVariable>& vars);
+
+  /**
+   * Adds linear constraints lb <= A * x <= ub with a sparse matrix A, where
+   * x(j) is the decision variable with index `var_indices[j]` in this program
+   * (see FindDecisionVariableIndex()). This saves gathering the variables when
+   * the rows are assembled from variable indices, e.g. by a problem generator.
+   * @throws std::exception if an index is not a decision variable index.
+   * @pydrake_mkdoc_identifier{sparse_A_var_indices}
+   */
+  Binding<LinearConstraint> AddLinearConstraint(
+      const Eigen::SparseMatrix<double>& A,
+      const Eigen::Ref<const Eigen::VectorXd>& lb,
+      const Eigen::Ref<const Eigen::VectorXd>& ub,
+      const std::vector<int>& var_indices);
+
   /**
    * Adds one row of linear constraint referencing potentially a
    * subset of the decision variables (defined in the vars parameter).
@@ -1685,6 +1724,29 @@ class MathematicalProgram {
       const Eigen::Ref<const Eigen::VectorXd>& beq,
       const Eigen::Ref<const VectorXDecisionVariable>& vars);
 
+  /**
+   * Adds linear equality constraints Aeq * vars = beq with a sparse matrix Aeq.
+   * Like the sparse overload of AddLinearConstraint(), Aeq is never converted
+   * to a dense matrix or to symbolic expressions.
+   * @pydrake_mkdoc_identifier{sparse_Aeq}
+   */
+  Binding<LinearEqualityConstraint> AddLinearEqualityConstraint(
+      const Eigen::SparseMatrix<double>& Aeq,
+      const Eigen::Ref<const Eigen::VectorXd>& beq,
+      const Eigen::Ref<const VectorXDecisionVariable>& vars);
+
+  /**
+   * Adds linear equality constraints Aeq * x = beq with a sparse matrix Aeq,
+   * where x(j) is the decision variable with index `var_indices[j]` in this
+   * program.
+   * @throws std::exception if an index is not a decision variable index.
+   * @pydrake_mkdoc_identifier{sparse_Aeq_var_indices}
+   */
+  Binding<LinearEqualityConstraint> AddLinearEqualityConstraint(
+      const Eigen::SparseMatrix<double>& Aeq,
+      const Eigen::Ref<const Eigen::VectorXd>& beq,
+      const std::vector<int>& var_indices);
+
   /**
    * Adds one row of linear equality constraint referencing potentially a subset
    * of decision variables.
@@ -3304,6 +3366,15 @@ class MathematicalProgram {
 
   ProgramAttributes required_capabilities_;
 
+  // The sparsity structure of the stacked linear, linear equality and bounding
+  // box constraints, cached by internal::AggregateLinearConstraints(). It is
+  // reset whenever one of those constraints is added or removed.
+  friend internal::AggregatedLinearConstraints
+  internal::AggregateLinearConstraints(const MathematicalProgram&);
+  mutable std::mutex linear_constraints_structure_mutex_;
+  mutable std::shared_ptr<const internal::LinearConstraintsStructure>
+      linear_constraints_structure_;
+
   template <typename T>
   void NewVariables_impl(
       VarType type, const T& names, bool is_symmetric,
@@ -7,6 +7,15 @@
 namespace drake {
 namespace solvers {
 
+// The workspace is only kept when OSQP is available.
+struct OsqpSolver::Workspace {};
+
+OsqpSolver::OsqpSolver()
+    : SolverBase(&id, &is_available, &is_enabled, &ProgramAttributesSatisfied,
+                 &UnsatisfiedProgramAttributes) {}
+
+OsqpSolver::~OsqpSolver() = default;
+
 bool OsqpSolver::is_available() { return false; }
 
 void OsqpSolver::DoSolve(
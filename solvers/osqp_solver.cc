@@ -1,13 +1,16 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <algorithm>
+#include <memory>
 #include <optional>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <osqp.h>
 
 #include "drake/common/text_logging.h"
-#include "drake/math/eigen_sparse_triplet.h"
+#include "drake/solvers/aggregate_costs_constraints.h"
 #include "drake/solvers/mathematical_program.h"
 
 namespace drake {
@@ -115,83 +118,33 @@ c_float ConvertInfinity(double val) {
   return static_cast<c_float>(val);
 }
 
-// Will call this function to parse both LinearConstraint and
-// LinearEqualityConstraint.
-template <typename C>
-void ParseLinearConstraints(
-    const MathematicalProgram& prog,
-    const std::vector<Binding<C>>& linear_constraints,
-    std::vector<Eigen::Triplet<c_float>>* A_triplets, std::vector<c_float>* l,
-    std::vector<c_float>* u, int* num_A_rows,
-    std::unordered_map<Binding<Constraint>, int>* constraint_start_row) {
-  // Loop over the linear constraints, stack them to get l, u and A.
-  for (const auto& constraint : linear_constraints) {
-    const std::vector<int> x_indices =
-        prog.FindDecisionVariableIndices(constraint.variables());
-    const std::vector<Eigen::Triplet<double>> Ai_triplets =
-        math::SparseMatrixToTriplets(constraint.evaluator()->get_sparse_A());
-    const Binding<Constraint> constraint_cast =
-        internal::BindingDynamicCast<Constraint>(constraint);
-    constraint_start_row->emplace(constraint_cast, *num_A_rows);
-    // Append constraint.A to osqp A.
-    for (const auto& Ai_triplet : Ai_triplets) {
-      A_triplets->emplace_back(*num_A_rows + Ai_triplet.row(),
-                               x_indices[Ai_triplet.col()],
-                               static_cast<c_float>(Ai_triplet.value()));
-    }
-    const int num_Ai_rows = constraint.evaluator()->num_constraints();
-    l->reserve(l->size() + num_Ai_rows);
-    u->reserve(u->size() + num_Ai_rows);
-    for (int i = 0; i < num_Ai_rows; ++i) {
-      l->push_back(ConvertInfinity(constraint.evaluator()->lower_bound()(i)));
-      u->push_back(ConvertInfinity(constraint.evaluator()->upper_bound()(i)));
-    }
-    *num_A_rows += num_Ai_rows;
-  }
-}
-
-void ParseBoundingBoxConstraints(
-    const MathematicalProgram& prog,
-    std::vector<Eigen::Triplet<c_float>>* A_triplets, std::vector<c_float>* l,
-    std::vector<c_float>* u, int* num_A_rows,
-    std::unordered_map<Binding<Constraint>, int>* constraint_start_row) {
-  // Loop over the linear constraints, stack them to get l, u and A.
-  for (const auto& constraint : prog.bounding_box_constraints()) {
-    const Binding<Constraint> constraint_cast =
-        internal::BindingDynamicCast<Constraint>(constraint);
-    constraint_start_row->emplace(constraint_cast, *num_A_rows);
-    // Append constraint.A to osqp A.
-    for (int i = 0; i < static_cast<int>(constraint.GetNumElements()); ++i) {
-      A_triplets->emplace_back(
-          *num_A_rows + i,
-          prog.FindDecisionVariableIndex(constraint.variables()(i)),
-          static_cast<c_float>(1));
-    }
-    const int num_Ai_rows = constraint.evaluator()->num_constraints();
-    l->reserve(l->size() + num_Ai_rows);
-    u->reserve(u->size() + num_Ai_rows);
-    for (int i = 0; i < num_Ai_rows; ++i) {
-      l->push_back(ConvertInfinity(constraint.evaluator()->lower_bound()(i)));
-      u->push_back(ConvertInfinity(constraint.evaluator()->upper_bound()(i)));
-    }
-    *num_A_rows += num_Ai_rows;
-  }
-}
-
+// Stacks all the linear constraints as l <= A x <= u. The sparsity structure
+// of A is cached in prog, so that re-solving a program whose constraints were
+// only updated skips the conversion of the bindings.
 void ParseAllLinearConstraints(
     const MathematicalProgram& prog, Eigen::SparseMatrix<c_float>* A,
     std::vector<c_float>* l, std::vector<c_float>* u,
     std::unordered_map<Binding<Constraint>, int>* constraint_start_row) {
-  std::vector<Eigen::Triplet<c_float>> A_triplets;
-  l->clear();
-  u->clear();
-  int num_A_rows = 0;
-  ParseLinearConstraints(prog, prog.linear_constraints(), &A_triplets, l, u,
-                         &num_A_rows, constraint_start_row);
-  ParseLinearConstraints(prog, prog.linear_equality_constraints(), &A_triplets,
-                         l, u, &num_A_rows, constraint_start_row);
-  ParseBoundingBoxConstraints(prog, &A_triplets, l, u, &num_A_rows,
-                              constraint_start_row);
+  internal::AggregatedLinearConstraints aggregated =
+      internal::AggregateLinearConstraints(prog);
+  int k = 0;
+  auto set_start_rows = [&](const auto& constraints) {
+    for (const auto& constraint : constraints) {
+      constraint_start_row->emplace(
+          internal::BindingDynamicCast<Constraint>(constraint),
+          aggregated.start_row[k++]);
+    }
+  };
+  set_start_rows(prog.linear_constraints());
+  set_start_rows(prog.linear_equality_constraints());
+  set_start_rows(prog.bounding_box_constraints());
+  const int num_A_rows = aggregated.A.rows();
+  l->resize(num_A_rows);
+  u->resize(num_A_rows);
+  for (int i = 0; i < num_A_rows; ++i) {
+    (*l)[i] = ConvertInfinity(aggregated.lower_bound(i));
+    (*u)[i] = ConvertInfinity(aggregated.upper_bound(i));
+  }
 
   // Scale the matrix A.
   // Note that we only scale the columns of A, because the constraint has the
@@ -199,17 +152,18 @@ void ParseAllLinearConstraints(
   // rows of A.
   const auto& scale_map = prog.GetVariableScaling();
   if (!scale_map.empty()) {
-    for (auto& triplet : A_triplets) {
-      auto column = scale_map.find(triplet.col());
+    const int* columns = aggregated.A.innerIndexPtr();
+    double* values = aggregated.A.valuePtr();
+    for (int i = 0; i < aggregated.A.nonZeros(); ++i) {
+      auto column = scale_map.find(columns[i]);
       if (column != scale_map.end()) {
-        triplet = Eigen::Triplet<double>(triplet.row(), triplet.col(),
-                                         triplet.value() * (column->second));
+        values[i] *= column->second;
       }
     }
   }
 
-  A->resize(num_A_rows, prog.num_vars());
-  A->setFromTriplets(A_triplets.begin(), A_triplets.end());
+  // OSQP takes A in compressed column storage.
+  *A = aggregated.A.cast<c_float>();
 }
 
 // Convert an Eigen::SparseMatrix to csc_matrix, to be used by osqp.
@@ -319,8 +273,56 @@ void SetDualSolution(
                                    constraint.evaluator()->num_constraints()));
   }
 }
+
+// Returns true if `a` and `b` are compressed sparse matrices with the same size
+// and the same pattern of stored entries.
+bool HaveSameSparsityPattern(const Eigen::SparseMatrix<c_float>& a,
+                             const Eigen::SparseMatrix<c_float>& b) {
+  DRAKE_ASSERT(a.isCompressed() && b.isCompressed());
+  return a.rows() == b.rows() && a.cols() == b.cols() &&
+         a.nonZeros() == b.nonZeros() &&
+         std::equal(a.outerIndexPtr(), a.outerIndexPtr() + a.cols() + 1,
+                    b.outerIndexPtr()) &&
+         std::equal(a.innerIndexPtr(), a.innerIndexPtr() + a.nonZeros(),
+                    b.innerIndexPtr());
+}
+
+// Returns true if the stored entries of `a` and `b` have the same values.
+// @pre a and b have the same sparsity pattern.
+bool HaveSameValues(const Eigen::SparseMatrix<c_float>& a,
+                    const Eigen::SparseMatrix<c_float>& b) {
+  return std::equal(a.valuePtr(), a.valuePtr() + a.nonZeros(), b.valuePtr());
+}
 }  // namespace
 
+struct OsqpSolver::Workspace {
+  Workspace() = default;
+  ~Workspace() { Reset(); }
+
+  void Reset() {
+    osqp_cleanup(work);
+    work = nullptr;
+  }
+
+  // The OSQP workspace, owned by this object; nullptr before the first
+  // successful setup.
+  OSQPWorkspace* work{nullptr};
+  // The data last passed to `work`, used to detect which part of the problem
+  // changed between solves.
+  SolverOptions options;
+  Eigen::SparseMatrix<c_float> P;
+  Eigen::SparseMatrix<c_float> A;
+  std::vector<c_float> q;
+  std::vector<c_float> l;
+  std::vector<c_float> u;
+};
+
+OsqpSolver::OsqpSolver()
+    : SolverBase(&id, &is_available, &is_enabled, &ProgramAttributesSatisfied,
+                 &UnsatisfiedProgramAttributes) {}
+
+OsqpSolver::~OsqpSolver() = default;
+
 bool OsqpSolver::is_available() { return true; }
 
 void OsqpSolver::DoSolve(
@@ -356,39 +358,104 @@ void OsqpSolver::DoSolve(
   std::vector<c_float> l, u;
   ParseAllLinearConstraints(prog, &A_sparse, &l, &u, &constraint_start_row);
 
-  // Now pass the constraint and cost to osqp data.
-  OSQPData* data = nullptr;
-
-  // Populate data.
-  data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
-
-  data->n = prog.num_vars();
-  data->m = A_sparse.rows();
-  data->P = EigenSparseToCSC(P_sparse);
-  data->q = q.data();
-  data->A = EigenSparseToCSC(A_sparse);
-  data->l = l.data();
-  data->u = u.data();
-
-  // Define Solver settings as default.
-  // Problem settings
-  OSQPSettings* settings =
-      static_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
-  osqp_set_default_settings(settings);
+  // Use the workspace kept from the previous solve if requested, unless another
+  // thread is using it.
+  const auto& options_int = merged_options.GetOptionsInt(id());
+  const auto reuse_option = options_int.find("reuse_workspace");
+  const bool reuse_requested =
+      reuse_option != options_int.end() && reuse_option->second != 0;
+  std::unique_lock<std::mutex> lock(workspace_mutex_, std::defer_lock);
+  if (reuse_requested) {
+    lock.try_lock();
+  }
+  std::unique_ptr<Workspace> temporary_workspace;
+  Workspace* workspace{nullptr};
+  if (lock.owns_lock()) {
+    if (workspace_ == nullptr) {
+      workspace_ = std::make_unique<Workspace>();
+    }
+    workspace = workspace_.get();
+  } else {
+    temporary_workspace = std::make_unique<Workspace>();
+    workspace = temporary_workspace.get();
+  }
 
-  SetOsqpSolverSettings(merged_options, settings);
+  // If only the numerical data changed since the previous solve, pass the new
+  // data to the workspace instead of setting it up again.
+  bool reused_workspace =
+      workspace->work != nullptr && workspace->options == merged_options &&
+      HaveSameSparsityPattern(P_sparse, workspace->P) &&
+      HaveSameSparsityPattern(A_sparse, workspace->A);
+  if (reused_workspace && q != workspace->q) {
+    reused_workspace = osqp_update_lin_cost(workspace->work, q.data()) == 0;
+  }
+  if (reused_workspace && (l != workspace->l || u != workspace->u)) {
+    reused_workspace =
+        osqp_update_bounds(workspace->work, l.data(), u.data()) == 0;
+  }
+  if (reused_workspace && !(HaveSameValues(P_sparse, workspace->P) &&
+                            HaveSameValues(A_sparse, workspace->A))) {
+    // Passing nullptr as the indices updates every stored entry.
+    reused_workspace =
+        osqp_update_P_A(workspace->work, P_sparse.valuePtr(), nullptr,
+                        P_sparse.nonZeros(), A_sparse.valuePtr(), nullptr,
+                        A_sparse.nonZeros()) == 0;
+  }
+  solver_details.reused_workspace = reused_workspace;
 
   // If any step fails, it will set the solution_result and skip other steps.
   std::optional<SolutionResult> solution_result;
 
   // Setup workspace.
-  OSQPWorkspace* work = nullptr;
-  if (!solution_result) {
-    const c_int osqp_setup_err = osqp_setup(&work, data, settings);
+  if (!reused_workspace) {
+    workspace->Reset();
+
+    // Now pass the constraint and cost to osqp data. OSQP copies the data
+    // into its workspace, so it is freed right after the setup.
+    OSQPData* data = nullptr;
+
+    // Populate data.
+    data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
+
+    data->n = prog.num_vars();
+    data->m = A_sparse.rows();
+    data->P = EigenSparseToCSC(P_sparse);
+    data->q = q.data();
+    data->A = EigenSparseToCSC(A_sparse);
+    data->l = l.data();
+    data->u = u.data();
+
+    // Define Solver settings as default.
+    // Problem settings
+    OSQPSettings* settings =
+        static_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
+    osqp_set_default_settings(settings);
+
+    SetOsqpSolverSettings(merged_options, settings);
+
+    const c_int osqp_setup_err = osqp_setup(&(workspace->work), data, settings);
     if (osqp_setup_err != 0) {
       solution_result = SolutionResult::kInvalidInput;
+      workspace->Reset();
     }
+    c_free(data->P->x);
+    c_free(data->P->i);
+    c_free(data->P->p);
+    c_free(data->P);
+    c_free(data->A->x);
+    c_free(data->A->i);
+    c_free(data->A->p);
+    c_free(data->A);
+    c_free(data);
+    c_free(settings);
+    workspace->options = merged_options;
   }
+  OSQPWorkspace* const work = workspace->work;
+  workspace->P = std::move(P_sparse);
+  workspace->A = std::move(A_sparse);
+  workspace->q = std::move(q);
+  workspace->l = std::move(l);
+  workspace->u = std::move(u);
 
   // Solve problem.
   if (!solution_result) {
@@ -407,7 +474,9 @@ void OsqpSolver::DoSolve(
     solver_details.status_val = work->info->status_val;
     solver_details.primal_res = work->info->pri_res;
     solver_details.dual_res = work->info->dua_res;
-    solver_details.setup_time = work->info->setup_time;
+    // OSQP keeps the setup time of the first solve in a reused workspace.
+    solver_details.setup_time =
+        reused_workspace ? 0.0 : work->info->setup_time;
     solver_details.solve_time = work->info->solve_time;
     solver_details.polish_time = work->info->polish_time;
     solver_details.run_time = work->info->run_time;
@@ -465,19 +534,6 @@ void OsqpSolver::DoSolve(
     }
   }
   result->set_solution_result(solution_result.value());
-
-  // Clean workspace.
-  osqp_cleanup(work);
-  c_free(data->P->x);
-  c_free(data->P->i);
-  c_free(data->P->p);
-  c_free(data->P);
-  c_free(data->A->x);
-  c_free(data->A->i);
-  c_free(data->A->p);
-  c_free(data->A);
-  c_free(data);
-  c_free(settings);
 }
 
 }  // namespace solvers
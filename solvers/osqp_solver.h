@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <string>
 
 #include "drake/common/drake_copyable.h"
@@ -30,6 +32,10 @@ struct OsqpSolverDetails {
   double polish_time{};
   /// Total OSQP time (seconds).
   double run_time{};
+  /// True if the OSQP workspace of a previous Solve() was updated in place
+  /// instead of being set up again, see the "reuse_workspace" option of
+  /// OsqpSolver.
+  bool reused_workspace{false};
   /// y contains the solution for the Lagrangian multiplier associated with
   /// l <= Ax <= u. The Lagrangian multiplier is set only when OSQP solves
   /// the problem. Notice that the order of the linear constraints are linear
@@ -37,6 +43,26 @@ struct OsqpSolverDetails {
   Eigen::VectorXd y{};
 };
 
+/**
+ * Besides the OSQP settings, OsqpSolver accepts the integer option
+ * "reuse_workspace". When it is set to 1, the OsqpSolver keeps the OSQP
+ * workspace of its most recent Solve() call. If the next program has the same
+ * number of variables, the same sparsity pattern of the quadratic cost Hessian
+ * and of the linear constraint matrix, and the same solver options, then only
+ * its numerical data (e.g., changed through LinearCost::UpdateCoefficients(),
+ * LinearEqualityConstraint::UpdateCoefficients() or
+ * BoundingBoxConstraint::UpdateLowerBound()) is passed to the workspace
+ * through OSQP's update functions. This skips the setup (allocation, scaling
+ * and KKT factorization) of OSQP, and, unless the "warm_start" option is set
+ * to 0, OSQP warm starts from the previous solution. This makes re-solving a
+ * program in a loop (as in model predictive control) much faster than setting
+ * up OSQP each time; such loops should create one OsqpSolver and call Solve()
+ * on it repeatedly. Since the workspace also keeps OSQP's adapted step size,
+ * the result of a solve then depends on the previous solves.
+ *
+ * Only one Solve() call at a time uses the kept workspace; concurrent calls on
+ * the same OsqpSolver set up a temporary workspace instead.
+ */
 class OsqpSolver final : public SolverBase {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(OsqpSolver)
@@ -62,6 +88,13 @@ class OsqpSolver final : public SolverBase {
  private:
   void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
                const SolverOptions&, MathematicalProgramResult*) const final;
+
+  // The OSQP workspace kept between Solve() calls, defined in the source file.
+  struct Workspace;
+  // Guards workspace_, which is created by the first Solve() call with the
+  // "reuse_workspace" option.
+  mutable std::mutex workspace_mutex_;
+  mutable std::unique_ptr<Workspace> workspace_;
 };
 }  // namespace solvers
 }  // namespace drake
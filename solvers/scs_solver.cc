@@ -17,6 +17,7 @@
 #include "drake/common/text_logging.h"
 #include "drake/math/eigen_sparse_triplet.h"
 #include "drake/math/quadratic_form.h"
+#include "drake/solvers/aggregate_costs_constraints.h"
 #include "drake/solvers/mathematical_program.h"
 
 namespace drake {
@@ -154,153 +155,71 @@ void ParseQuadraticCost(const MathematicalProgram& prog, std::vector<double>* c,
   }
 }
 
-void ParseLinearConstraint(const MathematicalProgram& prog,
-                           std::vector<Eigen::Triplet<double>>* A_triplets,
-                           std::vector<double>* b, int* A_row_count,
-                           ScsCone* cone) {
-  // The linear constraint lb ≤ aᵀx ≤ ub is converted to
-  // -aᵀx + s1 = lb,
-  //  aᵀx + s2 = ub
-  // s1, s2 in the positive cone.
-  // The special cases are when ub = ∞ or lb = -∞.
-  // When ub = ∞, then we only add the constraint
-  // -aᵀx + s = lb, s in the positive cone.
-  // When lb = -∞, then we only add the constraint
-  // aᵀx + s = ub, s in the positive cone.
-  int num_linear_constraint_rows = 0;
-  for (const auto& linear_constraint : prog.linear_constraints()) {
-    const Eigen::VectorXd& ub = linear_constraint.evaluator()->upper_bound();
-    const Eigen::VectorXd& lb = linear_constraint.evaluator()->lower_bound();
-    const VectorXDecisionVariable& x = linear_constraint.variables();
-    const Eigen::SparseMatrix<double>& Ai =
-        linear_constraint.evaluator()->get_sparse_A();
-    // We store the starting row index in A_triplets for each row of
-    // linear_constraint. Namely the constraint lb(i) <= A.row(i)*x <= ub(i) is
-    // stored in A_triplets with starting_row_indices[i] (or
-    // starting_row_indices[i]+1 if both lb(i) and ub(i) are finite).
-    std::vector<int> starting_row_indices(
-        linear_constraint.evaluator()->num_constraints());
-    for (int i = 0; i < linear_constraint.evaluator()->num_constraints(); ++i) {
-      const bool needs_ub{!std::isinf(ub(i))};
-      const bool needs_lb{!std::isinf(lb(i))};
-      if (!needs_ub && !needs_lb) {
-        // We use -1 to indicate that we won't add linear constraint when both
-        // bounds are infinity.
-        starting_row_indices[i] = -1;
-      } else {
-        starting_row_indices[i] = *A_row_count + num_linear_constraint_rows;
-        // We first add the constraint for lower bound, and then add the
-        // constraint for upper bound. This is consistent with the loop below
-        // when we modify A_triplets.
-        if (needs_lb) {
-          b->push_back(-lb(i));
-          num_linear_constraint_rows++;
-        }
-        if (needs_ub) {
-          b->push_back(ub(i));
-          num_linear_constraint_rows++;
-        }
-      }
-    }
-    for (int j = 0; j < Ai.cols(); ++j) {
-      const int xj_index = prog.FindDecisionVariableIndex(x(j));
-      for (Eigen::SparseMatrix<double>::InnerIterator it(Ai, j); it; ++it) {
-        const int Ai_row_count = it.row();
-        const bool needs_ub{!std::isinf(ub(Ai_row_count))};
-        const bool needs_lb{!std::isinf(lb(Ai_row_count))};
-        if (!needs_lb && !needs_ub) {
-          continue;
-        }
-        int row_index = starting_row_indices[Ai_row_count];
-        if (needs_lb) {
-          // If lb != -∞, then the constraint -aᵀx + s = lb will be added to
-          // the matrix A, in the row row_index.
-          A_triplets->emplace_back(row_index, xj_index, -it.value());
-          ++row_index;
-        }
-        if (needs_ub) {
-          // If ub != ∞, then the constraint aᵀx + s = ub will be added to the
-          // matrix A, in the row row_index.
-          A_triplets->emplace_back(row_index, xj_index, it.value());
-        }
-      }
+void ParseLinearConstraints(const MathematicalProgram& prog,
+                            std::vector<Eigen::Triplet<double>>* A_triplets,
+                            std::vector<double>* b, int* A_row_count,
+                            ScsCone* cone) {
+  // The linear constraints, linear equality constraints and bounding box
+  // constraints are stacked (with a cached sparsity structure) as
+  //   lb ≤ A x ≤ ub.
+  // The linear equality constraint rows aᵀx = lb are converted to
+  //   aᵀx + s = lb, s in the zero cone.
+  // The other rows lb ≤ aᵀx ≤ ub are converted to
+  //   -aᵀx + s1 = -lb,
+  //    aᵀx + s2 = ub,
+  //   s1, s2 in the positive cone.
+  // When ub = ∞ (or lb = -∞), we only add the constraint for the finite bound.
+  // SCS requires the zero cone rows to come before the positive cone rows.
+  const internal::AggregatedLinearConstraints aggregated =
+      internal::AggregateLinearConstraints(prog);
+  const Eigen::SparseMatrix<double, Eigen::RowMajor>& A = aggregated.A;
+  const Eigen::VectorXd& lb = aggregated.lower_bound;
+  const Eigen::VectorXd& ub = aggregated.upper_bound;
+  const int num_rows = A.rows();
+  // The first row of the k-th binding, or num_rows if there is none.
+  const auto binding_start_row = [&aggregated, num_rows](int k) {
+    return k < static_cast<int>(aggregated.start_row.size())
+               ? aggregated.start_row[k]
+               : num_rows;
+  };
+  const int num_linear_constraints = prog.linear_constraints().size();
+  const int num_linear_equality_constraints =
+      prog.linear_equality_constraints().size();
+  const int equality_begin = binding_start_row(num_linear_constraints);
+  const int equality_end = binding_start_row(num_linear_constraints +
+                                             num_linear_equality_constraints);
+  A_triplets->reserve(A_triplets->size() + 2 * A.nonZeros());
+  b->reserve(b->size() + 2 * num_rows);
+  // Adds the SCS row sign * aᵢᵀx + s = sign * bound.
+  const auto add_row = [&](int i, double sign, double bound) {
+    for (Eigen::SparseMatrix<double, Eigen::RowMajor>::InnerIterator it(A, i);
+         it; ++it) {
+      A_triplets->emplace_back(*A_row_count, it.col(), sign * it.value());
     }
+    b->push_back(sign * bound);
+    ++(*A_row_count);
+  };
+
+  for (int i = equality_begin; i < equality_end; ++i) {
+    add_row(i, 1, lb(i));
   }
-  *A_row_count += num_linear_constraint_rows;
-  cone->l += num_linear_constraint_rows;
-}
+  cone->z += equality_end - equality_begin;
 
-void ParseLinearEqualityConstraint(
-    const MathematicalProgram& prog,
-    std::vector<Eigen::Triplet<double>>* A_triplets, std::vector<double>* b,
-    int* A_row_count, ScsCone* cone) {
-  int num_linear_equality_constraints_rows = 0;
-  // The linear equality constraint A x = b is converted to
-  // A x + s = b. s in zero cone.
-  for (const auto& linear_equality_constraint :
-       prog.linear_equality_constraints()) {
-    const Eigen::SparseMatrix<double>& Ai =
-        linear_equality_constraint.evaluator()->get_sparse_A();
-    const std::vector<Eigen::Triplet<double>> Ai_triplets =
-        math::SparseMatrixToTriplets(Ai);
-    A_triplets->reserve(A_triplets->size() + Ai_triplets.size());
-    const solvers::VectorXDecisionVariable& x =
-        linear_equality_constraint.variables();
-    // x_indices[i] is the index of x(i)
-    const std::vector<int> x_indices = prog.FindDecisionVariableIndices(x);
-    for (const auto& Ai_triplet : Ai_triplets) {
-      A_triplets->emplace_back(Ai_triplet.row() + *A_row_count,
-                               x_indices[Ai_triplet.col()], Ai_triplet.value());
+  int num_positive_cone_rows = 0;
+  for (int i = 0; i < num_rows; ++i) {
+    if (i >= equality_begin && i < equality_end) {
+      continue;
     }
-    const int num_Ai_rows =
-        linear_equality_constraint.evaluator()->num_constraints();
-    b->reserve(b->size() + num_Ai_rows);
-    for (int i = 0; i < num_Ai_rows; ++i) {
-      b->push_back(linear_equality_constraint.evaluator()->lower_bound()(i));
+    if (!std::isinf(lb(i))) {
+      add_row(i, -1, lb(i));
+      ++num_positive_cone_rows;
     }
-    *A_row_count += num_Ai_rows;
-    num_linear_equality_constraints_rows += num_Ai_rows;
-  }
-  cone->z += num_linear_equality_constraints_rows;
-}
-
-void ParseBoundingBoxConstraint(const MathematicalProgram& prog,
-                                std::vector<Eigen::Triplet<double>>* A_triplets,
-                                std::vector<double>* b, int* A_row_count,
-                                ScsCone* cone) {
-  // A bounding box constraint lb ≤ x ≤ ub is converted to the SCS form as
-  // x + s1 = ub, -x + s2 = -lb, s1, s2 in the positive cone.
-  // TODO(hongkai.dai) : handle the special case l = u, such that we can convert
-  // it to x + s = l, s in zero cone.
-  int num_bounding_box_constraint_rows = 0;
-  for (const auto& bounding_box_constraint : prog.bounding_box_constraints()) {
-    int num_scs_new_constraint = 0;
-    const VectorXDecisionVariable& xi = bounding_box_constraint.variables();
-    const int num_xi_rows = xi.rows();
-    A_triplets->reserve(A_triplets->size() + 2 * num_xi_rows);
-    b->reserve(b->size() + 2 * num_xi_rows);
-    for (int i = 0; i < num_xi_rows; ++i) {
-      if (!std::isinf(bounding_box_constraint.evaluator()->upper_bound()(i))) {
-        // if ub != ∞, then add the constraint x + s1 = ub, s1 in the positive
-        // cone.
-        A_triplets->emplace_back(num_scs_new_constraint + *A_row_count,
-                                 prog.FindDecisionVariableIndex(xi(i)), 1);
-        b->push_back(bounding_box_constraint.evaluator()->upper_bound()(i));
-        ++num_scs_new_constraint;
-      }
-      if (!std::isinf(bounding_box_constraint.evaluator()->lower_bound()(i))) {
-        // if lb != -∞, then add the constraint -x + s2 = -lb, s2 in the
-        // positive cone.
-        A_triplets->emplace_back(num_scs_new_constraint + *A_row_count,
-                                 prog.FindDecisionVariableIndex(xi(i)), -1);
-        b->push_back(-bounding_box_constraint.evaluator()->lower_bound()(i));
-        ++num_scs_new_constraint;
-      }
+    if (!std::isinf(ub(i))) {
+      add_row(i, 1, ub(i));
+      ++num_positive_cone_rows;
     }
-    *A_row_count += num_scs_new_constraint;
-    num_bounding_box_constraint_rows += num_scs_new_constraint;
   }
-  cone->l += num_bounding_box_constraint_rows;
+  cone->l += num_positive_cone_rows;
 }
 
 void ParseSecondOrderConeConstraints(
@@ -767,14 +686,8 @@ void ScsSolver::DoSolve(
   // Parse linear cost
   ParseLinearCost(prog, &c, &cost_constant);
 
-  // Parse linear equality constraint
-  ParseLinearEqualityConstraint(prog, &A_triplets, &b, &A_row_count, cone);
-
-  // Parse bounding box constraint
-  ParseBoundingBoxConstraint(prog, &A_triplets, &b, &A_row_count, cone);
-
-  // Parse linear constraint
-  ParseLinearConstraint(prog, &A_triplets, &b, &A_row_count, cone);
+  // Parse linear equality, bounding box and linear constraints.
+  ParseLinearConstraints(prog, &A_triplets, &b, &A_row_count, cone);
 
   // Parse Lorentz cone and rotated Lorentz cone constraint
   std::vector<int> lorentz_cone_length;
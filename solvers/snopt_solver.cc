@@ -20,7 +20,6 @@
 
 #include "drake/common/scope_exit.h"
 #include "drake/common/text_logging.h"
-#include "drake/math/autodiff.h"
 #include "drake/solvers/mathematical_program.h"
 
 // TODO(jwnimmer-tri) Eventually resolve these warnings.
@@ -346,26 +345,47 @@ int SingleNonlinearConstraintSize<LinearComplementarityConstraint>(
   return 1;
 }
 
-// Evaluate a single nonlinear constraints. For generic Constraint,
-// LorentzConeConstraint, RotatedLorentzConeConstraint, we call Eval function
-// of the constraint directly. For some other constraint, such as
-// LinearComplementaryConstraint, we will evaluate its nonlinear constraint
-// differently, than its Eval function.
+// Evaluate a single nonlinear constraints and its gradient. For generic
+// Constraint, LorentzConeConstraint, RotatedLorentzConeConstraint, we call
+// EvalWithJacobian function of the constraint directly. For some other
+// constraint, such as LinearComplementaryConstraint, we will evaluate its
+// nonlinear constraint differently, than its Eval function.
+// @param x_scaled The value of the bound variables, after scaling.
+// @param scale The scaling factor of each bound variable, or empty if none of
+// them is scaled. The gradient is taken w.r.t the unscaled variables.
+// @param F The value of the constraint.
+// @param G The value of the non-zero entries in the gradient.
+// @return The number of entries written to G.
 template <typename C>
-void EvaluateSingleNonlinearConstraint(
-    const C& constraint, const Eigen::Ref<const AutoDiffVecXd>& tx,
-    AutoDiffVecXd* ty) {
-  ty->resize(SingleNonlinearConstraintSize(constraint));
-  constraint.Eval(tx, ty);
+int EvaluateSingleNonlinearConstraint(
+    const C& constraint, const Eigen::Ref<const Eigen::VectorXd>& x_scaled,
+    const Eigen::Ref<const Eigen::VectorXd>& scale, double F[], double G[]) {
+  Eigen::VectorXd ty(SingleNonlinearConstraintSize(constraint));
+  std::vector<Eigen::Triplet<double>> dty;
+  constraint.EvalWithJacobian(x_scaled, &ty, &dty);
+  for (int i = 0; i < ty.rows(); ++i) {
+    F[i] = ty(i);
+  }
+  return internal::ScatterJacobian(constraint, x_scaled.rows(), dty, scale, G);
 }
 
 template <>
-void EvaluateSingleNonlinearConstraint<LinearComplementarityConstraint>(
+int EvaluateSingleNonlinearConstraint<LinearComplementarityConstraint>(
     const LinearComplementarityConstraint& constraint,
-    const Eigen::Ref<const AutoDiffVecXd>& tx, AutoDiffVecXd* ty) {
-  ty->resize(1);
-  (*ty)(0) = tx.dot(constraint.M().cast<AutoDiffXd>() * tx +
-                    constraint.q().cast<AutoDiffXd>());
+    const Eigen::Ref<const Eigen::VectorXd>& x_scaled,
+    const Eigen::Ref<const Eigen::VectorXd>& scale, double F[], double G[]) {
+  // The nonlinear constraint is xᵀ(Mx + q), with gradient (M + Mᵀ)x + q.
+  const Eigen::VectorXd Mx = constraint.M() * x_scaled;
+  F[0] = x_scaled.dot(Mx + constraint.q());
+  Eigen::VectorXd gradient =
+      Mx + constraint.M().transpose() * x_scaled + constraint.q();
+  if (scale.size() > 0) {
+    gradient = gradient.cwiseProduct(scale);
+  }
+  for (int j = 0; j < gradient.rows(); ++j) {
+    G[j] = gradient(j);
+  }
+  return gradient.rows();
 }
 
 /*
@@ -388,61 +408,31 @@ void EvaluateNonlinearConstraints(
     size_t* constraint_index, size_t* grad_index, const Eigen::VectorXd& xvec) {
   const auto & scale_map = prog.GetVariableScaling();
   Eigen::VectorXd this_x;
+  Eigen::VectorXd scale;
   for (const auto& binding : constraint_list) {
     const auto& c = binding.evaluator();
-    int num_constraints = SingleNonlinearConstraintSize(*c);
 
     const int num_variables = binding.GetNumElements();
     this_x.resize(num_variables);
-    // binding_var_indices[i] is the index of binding.variables()(i) in prog's
-    // decision variables.
-    std::vector<int> binding_var_indices(num_variables);
+    scale.resize(0);
     for (int i = 0; i < num_variables; ++i) {
-      binding_var_indices[i] =
+      const int var_index =
           prog.FindDecisionVariableIndex(binding.variables()(i));
-      this_x(i) = xvec(binding_var_indices[i]);
-    }
-
-    // Scale this_x
-    auto this_x_scaled = math::InitializeAutoDiff(this_x);
-    for (int i = 0; i < num_variables; i++) {
-      auto it = scale_map.find(binding_var_indices[i]);
+      this_x(i) = xvec(var_index);
+      // Scale this_x
+      auto it = scale_map.find(var_index);
       if (it != scale_map.end()) {
-        this_x_scaled(i) *= it->second;
-      }
-    }
-
-    AutoDiffVecXd ty;
-    ty.resize(num_constraints);
-    EvaluateSingleNonlinearConstraint(*c, this_x_scaled, &ty);
-
-    for (int i = 0; i < num_constraints; i++) {
-      F[(*constraint_index)++] = ty(i).value();
-    }
-
-    const std::optional<std::vector<std::pair<int, int>>>&
-        gradient_sparsity_pattern =
-            binding.evaluator()->gradient_sparsity_pattern();
-    if (gradient_sparsity_pattern.has_value()) {
-      for (const auto& nonzero_entry : gradient_sparsity_pattern.value()) {
-        G[(*grad_index)++] =
-            ty(nonzero_entry.first).derivatives().size() > 0
-                ? ty(nonzero_entry.first).derivatives()(nonzero_entry.second)
-                : 0.0;
-      }
-    } else {
-      for (int i = 0; i < num_constraints; i++) {
-        if (ty(i).derivatives().size() > 0) {
-          for (int j = 0; j < num_variables; ++j) {
-            G[(*grad_index)++] = ty(i).derivatives()(j);
-          }
-        } else {
-          for (int j = 0; j < num_variables; ++j) {
-            G[(*grad_index)++] = 0.0;
-          }
+        if (scale.size() == 0) {
+          scale = Eigen::VectorXd::Ones(num_variables);
         }
+        scale(i) = it->second;
+        this_x(i) *= it->second;
       }
     }
+
+    *grad_index += EvaluateSingleNonlinearConstraint(
+        *c, this_x, scale, F + *constraint_index, G + *grad_index);
+    *constraint_index += SingleNonlinearConstraintSize(*c);
   }
 }
 
@@ -500,23 +490,22 @@ void EvaluateAndAddNonlinearCosts(
           prog.FindDecisionVariableIndex(binding.variables()(i));
       this_x(i) = x(binding_var_indices[i]);
     }
-    AutoDiffVecXd ty(1);
     // Scale this_x
-    auto this_x_scaled = math::InitializeAutoDiff(this_x);
+    Eigen::VectorXd scale = Eigen::VectorXd::Ones(num_variables);
     for (int i = 0; i < num_variables; i++) {
       auto it = scale_map.find(binding_var_indices[i]);
       if (it != scale_map.end()) {
-        this_x_scaled(i) *= it->second;
+        scale(i) = it->second;
       }
     }
-    obj->Eval(this_x_scaled, &ty);
-
-    *total_cost += ty(0).value();
-    if (ty(0).derivatives().size() > 0) {
-      for (int i = 0; i < num_variables; ++i) {
-        (*nonlinear_cost_gradients)[binding_var_indices[i]] +=
-            ty(0).derivatives()(i);
-      }
+    Eigen::VectorXd ty(1);
+    std::vector<Eigen::Triplet<double>> dty;
+    obj->EvalWithJacobian(this_x.cwiseProduct(scale), &ty, &dty);
+
+    *total_cost += ty(0);
+    for (const auto& entry : dty) {
+      (*nonlinear_cost_gradients)[binding_var_indices[entry.col()]] +=
+          entry.value() * scale(entry.col());
     }
   }
 }
@@ -311,6 +311,76 @@ TEST_F(TestAggregateCostsAndConstraints, AggregateBoundingBoxConstraints2) {
   EXPECT_TRUE(CompareMatrices(upper, Eigen::Vector4d(2, kInf, 3, 2)));
 }
 
+namespace internal {
+GTEST_TEST(AggregateLinearConstraintsTest, Test) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<3>();
+  AggregatedLinearConstraints result = AggregateLinearConstraints(prog);
+  EXPECT_EQ(result.A.rows(), 0);
+  EXPECT_EQ(result.A.cols(), 3);
+  EXPECT_TRUE(result.start_row.empty());
+
+  // -1 <= x0 + 2x1 + 3x0 <= 1, where the repeated x0 is summed.
+  auto linear = prog.AddLinearConstraint(Eigen::RowVector3d(1, 2, 3),
+                                         Vector1d(-1), Vector1d(1),
+                                         Vector3<symbolic::Variable>(
+                                             x(0), x(1), x(0)));
+  auto bounds = prog.AddBoundingBoxConstraint(Eigen::Vector2d(0, -kInf),
+                                              Eigen::Vector2d(1, 2),
+                                              x.tail<2>());
+  prog.AddLinearEqualityConstraint(x(2) - x(1) == 3);
+  result = AggregateLinearConstraints(prog);
+  Eigen::Matrix3d A_expected;
+  // clang-format off
+  A_expected << 4,  2, 0,
+                0, -1, 1,
+                0,  1, 0;
+  // clang-format on
+  Eigen::MatrixXd A_with_bounds(4, 3);
+  A_with_bounds << A_expected, 0, 0, 1;
+  EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(result.A), A_with_bounds));
+  EXPECT_TRUE(CompareMatrices(result.lower_bound,
+                              Eigen::Vector4d(-1, 3, 0, -kInf)));
+  EXPECT_TRUE(CompareMatrices(result.upper_bound,
+                              Eigen::Vector4d(1, 3, 1, 2)));
+  EXPECT_EQ(result.start_row, std::vector<int>({0, 1, 2}));
+
+  // Updating the coefficients is picked up whether or not it changes the
+  // sparsity or the number of rows of the evaluator.
+  linear.evaluator()->UpdateCoefficients(Eigen::RowVector3d(1, 5, 3),
+                                         Vector1d(-2), Vector1d(2));
+  bounds.evaluator()->set_bounds(Eigen::Vector2d(-1, -1),
+                                 Eigen::Vector2d(1, 1));
+  result = AggregateLinearConstraints(prog);
+  A_with_bounds(0, 1) = 5;
+  EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(result.A), A_with_bounds));
+  EXPECT_TRUE(CompareMatrices(result.lower_bound,
+                              Eigen::Vector4d(-2, 3, -1, -1)));
+  EXPECT_TRUE(CompareMatrices(result.upper_bound,
+                              Eigen::Vector4d(2, 3, 1, 1)));
+
+  linear.evaluator()->UpdateCoefficients(
+      Eigen::Matrix<double, 2, 3>::Identity(), Eigen::Vector2d(-1, -2),
+      Eigen::Vector2d(1, 2));
+  result = AggregateLinearConstraints(prog);
+  Eigen::MatrixXd A_two_rows(5, 3);
+  A_two_rows << 1, 0, 0, 0, 1, 0, A_with_bounds.bottomRows<3>();
+  EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(result.A), A_two_rows));
+  EXPECT_EQ(result.start_row, std::vector<int>({0, 2, 3}));
+
+  // Adding variables or removing constraints is picked up.
+  prog.NewContinuousVariables<1>();
+  prog.RemoveConstraint(bounds);
+  result = AggregateLinearConstraints(prog);
+  Eigen::MatrixXd A_removed = Eigen::MatrixXd::Zero(3, 4);
+  A_removed.leftCols<3>() = A_two_rows.topRows<3>();
+  EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(result.A), A_removed));
+  EXPECT_TRUE(CompareMatrices(result.lower_bound,
+                              Eigen::Vector3d(-1, -2, 3)));
+  EXPECT_EQ(result.start_row, std::vector<int>({0, 2}));
+}
+}  // namespace internal
+
 GTEST_TEST(TestFindNonconvexQuadraticCost, Test) {
   MathematicalProgram prog;
   auto x = prog.NewContinuousVariables<2>();
@@ -0,0 +1,132 @@
+#include "drake/solvers/banded_qp_solver_internal.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+namespace {
+// Returns the half bandwidth of the graph `adjacency` under `ordering`.
+int CalcHalfBandwidth(const std::vector<std::vector<int>>& adjacency,
+                      const std::vector<int>& ordering) {
+  std::vector<int> position(ordering.size());
+  for (int k = 0; k < static_cast<int>(ordering.size()); ++k) {
+    position[ordering[k]] = k;
+  }
+  int half_bandwidth = 0;
+  for (int i = 0; i < static_cast<int>(adjacency.size()); ++i) {
+    for (int j : adjacency[i]) {
+      half_bandwidth =
+          std::max(half_bandwidth, std::abs(position[i] - position[j]));
+    }
+  }
+  return half_bandwidth;
+}
+
+GTEST_TEST(ReverseCuthillMcKeeOrderingTest, ShuffledPath) {
+  // A path through the nodes in a shuffled order, and an isolated node.
+  const std::vector<int> path{3, 7, 1, 9, 0, 5, 2, 8, 4, 6};
+  std::vector<std::vector<int>> adjacency(11);
+  for (int i = 0; i + 1 < static_cast<int>(path.size()); ++i) {
+    adjacency[path[i]].push_back(path[i + 1]);
+    adjacency[path[i + 1]].push_back(path[i]);
+  }
+  const std::vector<int> ordering = ReverseCuthillMcKeeOrdering(adjacency);
+  ASSERT_EQ(ordering.size(), adjacency.size());
+  std::vector<int> sorted = ordering;
+  std::sort(sorted.begin(), sorted.end());
+  for (int i = 0; i < static_cast<int>(sorted.size()); ++i) {
+    EXPECT_EQ(sorted[i], i);
+  }
+  EXPECT_EQ(CalcHalfBandwidth(adjacency, ordering), 1);
+}
+
+GTEST_TEST(EnvelopeLdltTest, Solve) {
+  const int n = 12;
+  std::vector<int> first_column(n);
+  for (int i = 0; i < n; ++i) {
+    first_column[i] = std::max(0, i - 1 - i % 3);
+  }
+  EnvelopeLdlt ldlt(first_column);
+  EXPECT_EQ(ldlt.size(), n);
+  EXPECT_EQ(ldlt.half_bandwidth(), 3);
+  // A quasi-definite matrix, with positive and negative diagonal blocks.
+  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = first_column[i]; j <= i; ++j) {
+      const double value = i == j ? (i < n / 2 ? 10.0 : -10.0)
+                                  : std::sin(i + 2.0 * j);
+      A(i, j) = value;
+      A(j, i) = value;
+      ldlt.mutable_values()(ldlt.index(i, j)) = value;
+    }
+  }
+  ASSERT_TRUE(ldlt.Factorize());
+  const Eigen::VectorXd b = Eigen::VectorXd::LinSpaced(n, -1, 2);
+  Eigen::VectorXd x = b;
+  ldlt.Solve(&x);
+  EXPECT_TRUE(CompareMatrices(A * x, b, 1E-12));
+
+  EnvelopeLdlt singular(first_column);
+  EXPECT_FALSE(singular.Factorize());
+
+  // Reset() changes the envelope and zeros the entries.
+  ldlt.Reset({0, 0});
+  EXPECT_EQ(ldlt.size(), 2);
+  EXPECT_EQ(ldlt.half_bandwidth(), 1);
+  EXPECT_TRUE(CompareMatrices(ldlt.values(), Eigen::Vector3d::Zero()));
+}
+
+GTEST_TEST(SolveBandedQpTest, ActiveBound) {
+  // min x₀² + x₁²
+  // s.t. x₀ + x₁ = 2
+  //      x₀ ≥ 1.5
+  //      -x₁ ≥ -10
+  BandedQpData data;
+  data.P.resize(2, 2);
+  data.P.insert(0, 0) = 2;
+  data.P.insert(1, 1) = 2;
+  data.q = Eigen::Vector2d::Zero();
+  data.E.resize(1, 2);
+  data.E.insert(0, 0) = 1;
+  data.E.insert(0, 1) = 1;
+  data.f = Eigen::VectorXd::Constant(1, 2);
+  data.G.resize(2, 2);
+  data.G.insert(0, 0) = 1;
+  data.G.insert(1, 1) = -1;
+  data.h = Eigen::Vector2d(1.5, -10);
+
+  const BandedKktStructure structure = MakeBandedKktStructure(data);
+  EXPECT_EQ(structure.ordering.size(), 3);
+  EXPECT_EQ(structure.half_bandwidth, 1);
+  EXPECT_EQ(structure.factorization_cost, 2);
+  BandedQpWorkspace workspace;
+  const BandedQpSolution solution =
+      SolveBandedQp(data, structure, BandedQpOptions{}, &workspace);
+  ASSERT_TRUE(solution.converged);
+  const double tol = 1E-7;
+  EXPECT_TRUE(CompareMatrices(solution.x, Eigen::Vector2d(1.5, 0.5), tol));
+  EXPECT_TRUE(CompareMatrices(solution.y, Eigen::VectorXd::Constant(1, 1),
+                              tol));
+  EXPECT_TRUE(CompareMatrices(solution.z, Eigen::Vector2d(2, 0), tol));
+
+  // Solving again in the same workspace reuses its memory and finds the same
+  // solution.
+  const double* const ldlt_values = workspace.ldlt.values().data();
+  const double* const rhs = workspace.rhs.data();
+  const BandedQpSolution again =
+      SolveBandedQp(data, structure, BandedQpOptions{}, &workspace);
+  EXPECT_EQ(workspace.ldlt.values().data(), ldlt_values);
+  EXPECT_EQ(workspace.rhs.data(), rhs);
+  EXPECT_EQ(again.iterations, solution.iterations);
+  EXPECT_TRUE(CompareMatrices(again.x, solution.x));
+}
+}  // namespace
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
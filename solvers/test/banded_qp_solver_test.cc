@@ -0,0 +1,179 @@
+#include "drake/solvers/banded_qp_solver.h"
+
+#include <limits>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/osqp_solver.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+const double kInf = std::numeric_limits<double>::infinity();
+
+// min ∑ x(k)² + ∑ u(k)²
+// s.t. x(0) = 1
+//      x(k+1) = x(k) + u(k)
+//      -0.1 ≤ u(k) ≤ 0.1
+class ChainTest : public ::testing::Test {
+ public:
+  ChainTest() {
+    const int num_steps = 20;
+    x_ = prog_.NewContinuousVariables(num_steps + 1, "x");
+    u_ = prog_.NewContinuousVariables(num_steps, "u");
+    prog_.AddQuadraticCost(x_.cast<symbolic::Expression>().squaredNorm());
+    prog_.AddQuadraticCost(u_.cast<symbolic::Expression>().squaredNorm());
+    prog_.AddLinearEqualityConstraint(x_(0) == 1);
+    for (int k = 0; k < num_steps; ++k) {
+      prog_.AddLinearEqualityConstraint(x_(k + 1) == x_(k) + u_(k));
+    }
+    prog_.AddBoundingBoxConstraint(-0.1, 0.1, u_);
+  }
+
+ protected:
+  MathematicalProgram prog_;
+  VectorX<symbolic::Variable> x_;
+  VectorX<symbolic::Variable> u_;
+};
+
+TEST_F(ChainTest, Solve) {
+  BandedQPSolver solver;
+  ASSERT_TRUE(solver.AreProgramAttributesSatisfied(prog_));
+  const MathematicalProgramResult result = solver.Solve(prog_);
+  ASSERT_TRUE(result.is_success());
+  const auto& details = result.get_solver_details<BandedQPSolver>();
+  EXPECT_GT(details.iterations, 0);
+  // One stage is (x(k), u(k), the dynamics constraint of step k).
+  EXPECT_LE(details.kkt_half_bandwidth, 3);
+
+  const Eigen::VectorXd x = result.GetSolution(x_);
+  const Eigen::VectorXd u = result.GetSolution(u_);
+  const double tol = 1E-7;
+  EXPECT_NEAR(x(0), 1, tol);
+  EXPECT_TRUE(
+      CompareMatrices(x.tail(u.rows()), x.head(u.rows()) + u, tol));
+  EXPECT_TRUE((u.array().abs() <= 0.1 + tol).all());
+  // The bound is active in the first steps.
+  EXPECT_NEAR(u(0), -0.1, tol);
+
+  OsqpSolver osqp_solver;
+  if (osqp_solver.available()) {
+    SolverOptions options;
+    options.SetOption(OsqpSolver::id(), "eps_abs", 1E-8);
+    options.SetOption(OsqpSolver::id(), "eps_rel", 1E-8);
+    options.SetOption(OsqpSolver::id(), "polish", 1);
+    const MathematicalProgramResult osqp_result =
+        osqp_solver.Solve(prog_, std::nullopt, options);
+    ASSERT_TRUE(osqp_result.is_success());
+    EXPECT_TRUE(CompareMatrices(x, osqp_result.GetSolution(x_), 1E-5));
+    EXPECT_TRUE(CompareMatrices(u, osqp_result.GetSolution(u_), 1E-5));
+    EXPECT_NEAR(result.get_optimal_cost(), osqp_result.get_optimal_cost(),
+                1E-5);
+  }
+}
+
+TEST_F(ChainTest, IterationLimit) {
+  BandedQPSolver solver;
+  SolverOptions options;
+  options.SetOption(BandedQPSolver::id(),
+                    BandedQPSolver::MaxIterationsOptionName(), 1);
+  const MathematicalProgramResult result =
+      solver.Solve(prog_, std::nullopt, options);
+  EXPECT_EQ(result.get_solution_result(), SolutionResult::kIterationLimit);
+  EXPECT_EQ(result.get_solver_details<BandedQPSolver>().iterations, 1);
+
+  options.SetOption(BandedQPSolver::id(),
+                    BandedQPSolver::ToleranceOptionName(), -1.0);
+  DRAKE_EXPECT_THROWS_MESSAGE(solver.Solve(prog_, std::nullopt, options),
+                              ".*Tolerance should be a positive number.");
+}
+
+GTEST_TEST(BandedQPSolverTest, DualSolution) {
+  // min x₀² + x₁²
+  // s.t. x₀ + x₁ = 2
+  //      x₀ ≥ 1.5
+  //      x₁ ≤ 10
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>();
+  prog.AddQuadraticCost(x(0) * x(0) + x(1) * x(1));
+  auto equality = prog.AddLinearEqualityConstraint(x(0) + x(1) == 2);
+  auto bound = prog.AddBoundingBoxConstraint(1.5, kInf, x(0));
+  auto inequality = prog.AddLinearConstraint(x(1) <= 10);
+
+  BandedQPSolver solver;
+  const MathematicalProgramResult result = solver.Solve(prog);
+  ASSERT_TRUE(result.is_success());
+  const double tol = 1E-7;
+  EXPECT_TRUE(
+      CompareMatrices(result.GetSolution(x), Eigen::Vector2d(1.5, 0.5), tol));
+  EXPECT_NEAR(result.get_optimal_cost(), 2.5, tol);
+  // The duals are the shadow prices d(cost)/d(bound).
+  EXPECT_TRUE(CompareMatrices(result.GetDualSolution(equality),
+                              Vector1d(1), tol));
+  EXPECT_TRUE(CompareMatrices(result.GetDualSolution(bound), Vector1d(2),
+                              tol));
+  EXPECT_TRUE(CompareMatrices(result.GetDualSolution(inequality),
+                              Vector1d(0), tol));
+}
+
+GTEST_TEST(BandedQPSolverTest, UnsatisfiedProgramAttributes) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<4>();
+  prog.AddQuadraticCost(x(0) * x(0));
+  prog.AddLinearConstraint(x(0) + x(1) >= 1);
+  EXPECT_FALSE(BandedQPSolver::ProgramAttributesSatisfied(prog));
+  EXPECT_THAT(BandedQPSolver::UnsatisfiedProgramAttributes(prog),
+              testing::HasSubstr("no linear equality constraint"));
+
+  // An equality written as a linear constraint counts.
+  prog.AddLinearConstraint(x(3) + x(2) == 1);
+  EXPECT_TRUE(BandedQPSolver::ProgramAttributesSatisfied(prog));
+
+  prog.AddQuadraticCost(-x(1) * x(1));
+  EXPECT_THAT(BandedQPSolver::UnsatisfiedProgramAttributes(prog),
+              testing::HasSubstr("non-convex"));
+}
+
+GTEST_TEST(BandedQPSolverTest, NotBanded) {
+  // Every variable is coupled to every other one by the cost, so the KKT
+  // matrix is dense.
+  const int n = 200;
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables(n);
+  prog.AddQuadraticCost(
+      Eigen::MatrixXd::Ones(n, n) + Eigen::MatrixXd::Identity(n, n),
+      Eigen::VectorXd::Zero(n), x);
+  prog.AddLinearEqualityConstraint(x(0) == 1);
+  BandedQPSolver solver;
+  ASSERT_TRUE(solver.AreProgramAttributesSatisfied(prog));
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      solver.Solve(prog),
+      ".*KKT matrix of size 201 is not banded: its half bandwidth is 199.*");
+
+  // A small dense program is still solved, since its factorization is cheap.
+  MathematicalProgram small_prog;
+  auto y = small_prog.NewContinuousVariables<4>();
+  small_prog.AddQuadraticCost(pow(y(0) + y(1) + y(2) + y(3), 2) +
+                              y.cast<symbolic::Expression>().squaredNorm());
+  small_prog.AddLinearEqualityConstraint(y(3) == 1);
+  EXPECT_TRUE(solver.Solve(small_prog).is_success());
+}
+
+// Solving a program of the same size again reuses the memory of the first
+// solve, and gives the same result.
+TEST_F(ChainTest, SolveAgain) {
+  BandedQPSolver solver;
+  const MathematicalProgramResult first = solver.Solve(prog_);
+  const MathematicalProgramResult second = solver.Solve(prog_);
+  ASSERT_TRUE(second.is_success());
+  EXPECT_EQ(second.get_solver_details<BandedQPSolver>().iterations,
+            first.get_solver_details<BandedQPSolver>().iterations);
+  EXPECT_TRUE(CompareMatrices(second.get_x_val(), first.get_x_val()));
+}
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
@@ -1,6 +1,8 @@
 #include "drake/solvers/branch_and_bound.h"
 
 #include <algorithm>
+#include <map>
+#include <optional>
 
 #include <gtest/gtest.h>
 
@@ -986,6 +988,58 @@ GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSteelBlendingProblem) {
   }
 }
 
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolveParallel) {
+  auto prog = ConstructMathematicalProgram2();
+  const VectorDecisionVariable<5> x = prog->decision_variables();
+  Eigen::Matrix<double, 5, 1> x_expected0;
+  x_expected0 << 1, 1.0 / 3.0, 1, 1, 0;
+  const double tol{1E-3};
+
+  for (auto pick_node : NonUserDefinedPickNodeMethods()) {
+    for (int batch_size : {1, 2, 4}) {
+      std::optional<std::multimap<double, Eigen::VectorXd>> serial_solutions;
+      for (int num_threads : {1, 4}) {
+        MixedIntegerBranchAndBound bnb(*prog, GurobiSolver::id());
+        bnb.SetNodeSelectionMethod(pick_node);
+        bnb.set_num_threads(num_threads);
+        bnb.set_node_batch_size(batch_size);
+        EXPECT_EQ(bnb.node_batch_size(), batch_size);
+        EXPECT_EQ(bnb.Solve(), SolutionResult::kSolutionFound);
+        EXPECT_NEAR(bnb.GetOptimalCost(), -13.0 / 3, tol);
+        EXPECT_TRUE(CompareMatrices(bnb.GetSolution(x, 0), x_expected0, tol,
+                                    MatrixCompareType::absolute));
+        // For a given batch size, the result doesn't depend on the number of
+        // threads.
+        if (!serial_solutions.has_value()) {
+          serial_solutions = bnb.solutions();
+        } else {
+          ASSERT_EQ(bnb.solutions().size(), serial_solutions->size());
+          auto it = serial_solutions->begin();
+          for (const auto& [cost, solution] : bnb.solutions()) {
+            EXPECT_EQ(cost, it->first);
+            EXPECT_TRUE(CompareMatrices(solution, it->second));
+            ++it;
+          }
+        }
+      }
+    }
+  }
+}
+
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestParallelOptions) {
+  auto prog = ConstructMathematicalProgram2();
+  MixedIntegerBranchAndBound bnb(*prog, GurobiSolver::id());
+  EXPECT_EQ(bnb.num_threads(), 1);
+  EXPECT_EQ(bnb.node_batch_size(), 1);
+  // The batch size follows the number of threads, unless it is set.
+  bnb.set_num_threads(3);
+  EXPECT_EQ(bnb.node_batch_size(), 3);
+  bnb.set_node_batch_size(2);
+  EXPECT_EQ(bnb.node_batch_size(), 2);
+  EXPECT_THROW(bnb.set_num_threads(0), std::exception);
+  EXPECT_THROW(bnb.set_node_batch_size(0), std::exception);
+}
+
 void CheckAllIntegralSolution(
     const MixedIntegerBranchAndBound& bnb,
     const Eigen::Ref<const VectorXDecisionVariable>& x,
@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/solvers/banded_qp_solver.h"
 #include "drake/solvers/clp_solver.h"
 #include "drake/solvers/csdp_solver.h"
 #include "drake/solvers/equality_constrained_qp_solver.h"
@@ -108,6 +109,19 @@ TEST_F(ChooseBestSolverTest, EqualityConstrainedQPSolver) {
   CheckBestSolver(EqualityConstrainedQPSolver::id());
 }
 
+TEST_F(ChooseBestSolverTest, BandedQPSolver) {
+  // The chain x(k+1) = x(k) + u(k) with bounded u(k) has a banded KKT matrix,
+  // but BandedQPSolver doesn't detect infeasibility, so it is never chosen.
+  auto u = prog_.NewContinuousVariables<2>();
+  prog_.AddQuadraticCost(x_.cast<symbolic::Expression>().squaredNorm() +
+                         u.cast<symbolic::Expression>().squaredNorm());
+  prog_.AddLinearEqualityConstraint(x_(1) == x_(0) + u(0));
+  prog_.AddLinearEqualityConstraint(x_(2) == x_(1) + u(1));
+  prog_.AddBoundingBoxConstraint(-1, 1, u);
+  ASSERT_TRUE(BandedQPSolver::ProgramAttributesSatisfied(prog_));
+  EXPECT_NE(ChooseBestSolver(prog_), BandedQPSolver::id());
+}
+
 void CheckGetAvailableSolvers(const MathematicalProgram& prog) {
   const ProgramType prog_type = GetProgramType(prog);
   const std::vector<SolverId> available_ids = GetAvailableSolvers(prog_type);
@@ -255,6 +269,7 @@ TEST_F(ChooseBestSolverTest, NoAvailableSolver) {
 TEST_F(ChooseBestSolverTest, MakeSolver) {
   CheckMakeSolver(*linear_system_solver_);
   CheckMakeSolver(*equality_constrained_qp_solver_);
+  CheckMakeSolver(BandedQPSolver());
   CheckMakeSolver(*mosek_solver_);
   CheckMakeSolver(*gurobi_solver_);
   CheckMakeSolver(*osqp_solver_);
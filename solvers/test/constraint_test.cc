@@ -84,6 +84,18 @@ GTEST_TEST(TestConstraint, LinearConstraintSparse) {
   EXPECT_TRUE(CompareMatrices(dut.GetDenseA(), A_sparse_new.toDense()));
   EXPECT_TRUE(CompareMatrices(dut.lower_bound(), lb));
   EXPECT_TRUE(CompareMatrices(dut.upper_bound(), ub));
+
+  // The Jacobian reported by EvalWithJacobian holds the non-zero entries of A.
+  const Eigen::Vector3d x(1, -2, 3);
+  Eigen::VectorXd y;
+  std::vector<Eigen::Triplet<double>> dy_dx;
+  dut.EvalWithJacobian(x, &y, &dy_dx);
+  EXPECT_TRUE(CompareMatrices(y, A_sparse_new * x));
+  EXPECT_EQ(dy_dx.size(), A_sparse_new.nonZeros());
+  Eigen::SparseMatrix<double> dy_dx_sparse(2, 3);
+  dy_dx_sparse.setFromTriplets(dy_dx.begin(), dy_dx.end());
+  EXPECT_TRUE(
+      CompareMatrices(dy_dx_sparse.toDense(), A_sparse_new.toDense()));
 }
 
 GTEST_TEST(TestConstraint, LinearEqualityConstraintSparse) {
@@ -484,6 +496,79 @@ GTEST_TEST(testConstraint, testRotatedLorentzConeConstraint) {
   TestRotatedLorentzConeEval(A4, b4, x4, false);
 }
 
+// Compares EvalLagrangianHessian() against central differences of the
+// AutoDiffXd gradient of λᵀy.
+void CheckLagrangianHessian(const Constraint& constraint, const VectorXd& x,
+                            const VectorXd& lambda, double tol) {
+  const int n = x.rows();
+  EXPECT_TRUE(constraint.has_analytical_lagrangian_hessian());
+  std::vector<Eigen::Triplet<double>> hessian;
+  constraint.EvalLagrangianHessian(x, lambda, &hessian);
+  MatrixXd H = MatrixXd::Zero(n, n);
+  for (const auto& entry : hessian) {
+    EXPECT_GE(entry.row(), entry.col());
+    H(entry.row(), entry.col()) += entry.value();
+    if (entry.row() != entry.col()) {
+      H(entry.col(), entry.row()) += entry.value();
+    }
+  }
+  const auto gradient = [&](const VectorXd& x_eval) {
+    AutoDiffVecXd y;
+    constraint.Eval(math::InitializeAutoDiff(x_eval), &y);
+    return VectorXd(math::ExtractGradient(y, n).transpose() * lambda);
+  };
+  const double h = 1E-6;
+  MatrixXd H_numerical(n, n);
+  for (int j = 0; j < n; ++j) {
+    VectorXd x_plus = x;
+    VectorXd x_minus = x;
+    x_plus(j) += h;
+    x_minus(j) -= h;
+    H_numerical.col(j) = (gradient(x_plus) - gradient(x_minus)) / (2 * h);
+  }
+  EXPECT_TRUE(CompareMatrices(H, H_numerical, tol));
+}
+
+GTEST_TEST(testConstraint, LagrangianHessian) {
+  Eigen::Matrix<double, 4, 3> A;
+  // clang-format off
+  A << 1, 2, 0,
+       -1, 0.5, 3,
+       2, 1, -1,
+       0, 3, 1;
+  // clang-format on
+  const Eigen::Vector4d b(3, 1, -2, 0.5);
+  const Vector3d x(0.2, -0.4, 1.1);
+
+  for (const auto eval_type : {LorentzConeConstraint::EvalType::kConvex,
+                               LorentzConeConstraint::EvalType::kConvexSmooth,
+                               LorentzConeConstraint::EvalType::kNonconvex}) {
+    const LorentzConeConstraint lorentz_cone(A, b, eval_type);
+    const VectorXd lambda =
+        VectorXd::LinSpaced(lorentz_cone.num_constraints(), 1.5, -2);
+    CheckLagrangianHessian(lorentz_cone, x, lambda, 1E-6);
+  }
+  CheckLagrangianHessian(RotatedLorentzConeConstraint(A, b), x,
+                         Vector3d(0.5, 2, -1.5), 1E-6);
+
+  Eigen::Matrix3d Q;
+  // clang-format off
+  Q << 1, 2, 0,
+       0, 3, 1,
+       2, 0, 4;
+  // clang-format on
+  CheckLagrangianHessian(QuadraticConstraint(Q, Vector3d(1, 2, 3), 0, 1), x,
+                         Vector1d(-2), 1E-6);
+
+  // Linear constraints report no Hessian entry.
+  const LinearConstraint linear(A, Eigen::Vector4d::Zero(),
+                                Eigen::Vector4d::Ones());
+  EXPECT_TRUE(linear.has_analytical_lagrangian_hessian());
+  std::vector<Eigen::Triplet<double>> hessian;
+  linear.EvalLagrangianHessian(x, Eigen::Vector4d::Ones(), &hessian);
+  EXPECT_TRUE(hessian.empty());
+}
+
 GTEST_TEST(testConstraint, RotatedLorentzConeConstraintUpdateCoefficients) {
   Eigen::Matrix<double, 3, 2> A;
   A << 1, 2, -2, -1, 2, 3;
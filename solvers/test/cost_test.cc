@@ -292,6 +292,50 @@ GTEST_TEST(TestQuadraticCost, ConvexCost) {
   EXPECT_TRUE(cost->is_convex());
 }
 
+GTEST_TEST(TestQuadraticCost, EvalWithJacobian) {
+  Eigen::Matrix2d Q;
+  Q << 1, 2, 3, 10;
+  const Eigen::Vector2d b(5, 6);
+  const QuadraticCost cost(Q, b, 0.5);
+  const Eigen::Vector2d x(-1, 2);
+
+  // EvalWithJacobian must agree with the AutoDiffXd evaluation.
+  AutoDiffVecXd y_autodiff;
+  cost.Eval(math::InitializeAutoDiff(x), &y_autodiff);
+  VectorXd y;
+  std::vector<Eigen::Triplet<double>> dy_dx;
+  cost.EvalWithJacobian(x, &y, &dy_dx);
+  EXPECT_NEAR(y(0), y_autodiff(0).value(), 1E-14);
+  ASSERT_EQ(dy_dx.size(), 2);
+  for (const auto& entry : dy_dx) {
+    EXPECT_EQ(entry.row(), 0);
+    EXPECT_NEAR(entry.value(), y_autodiff(0).derivatives()(entry.col()),
+                1E-14);
+  }
+}
+
+GTEST_TEST(TestQuadraticCost, EvalLagrangianHessian) {
+  Eigen::Matrix2d Q;
+  Q << 1, 2, 3, 10;
+  const QuadraticCost cost(Q, Eigen::Vector2d(5, 6), 0.5);
+  EXPECT_TRUE(cost.has_analytical_lagrangian_hessian());
+  std::vector<Eigen::Triplet<double>> hessian;
+  cost.EvalLagrangianHessian(Eigen::Vector2d(-1, 2), Vector1d(2), &hessian);
+  // The lower triangle of 2 * (Q + Qᵀ) / 2.
+  Eigen::SparseMatrix<double> H(2, 2);
+  H.setFromTriplets(hessian.begin(), hessian.end());
+  Eigen::Matrix2d H_expected;
+  H_expected << 2, 0, 5, 20;
+  EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(H), H_expected, 1E-14));
+
+  // A linear cost has zero Hessian.
+  const LinearCost linear_cost(Eigen::Vector2d(1, 2), 3);
+  EXPECT_TRUE(linear_cost.has_analytical_lagrangian_hessian());
+  linear_cost.EvalLagrangianHessian(Eigen::Vector2d(-1, 2), Vector1d(2),
+                                    &hessian);
+  EXPECT_TRUE(hessian.empty());
+}
+
 // TODO(eric.cousineau): Move QuadraticErrorCost and L2NormCost tests here from
 // MathematicalProgram.
 
@@ -236,6 +236,120 @@ GTEST_TEST(EvaluatorBaseTest, SetGradientSparsityPattern) {
   }
 }
 
+// Returns the dense matrix with the entries `dy_dx`.
+MatrixXd ToDense(const vector<Eigen::Triplet<double>>& dy_dx, int rows,
+                 int cols) {
+  Eigen::SparseMatrix<double> sparse(rows, cols);
+  sparse.setFromTriplets(dy_dx.begin(), dy_dx.end());
+  return MatrixXd(sparse);
+}
+
+GTEST_TEST(EvaluatorBaseTest, EvalWithJacobian) {
+  SimpleEvaluator evaluator;
+  const Eigen::Vector3d x(1, -2, 0.5);
+  MatrixXd dy_dx_expected(2, 3);
+  dy_dx_expected << 1, 2, 3, 4, 5, 6;
+
+  // Without a sparsity pattern, every non-zero entry is reported.
+  VectorXd y;
+  vector<Eigen::Triplet<double>> dy_dx;
+  evaluator.EvalWithJacobian(x, &y, &dy_dx);
+  EXPECT_TRUE(CompareMatrices(y, dy_dx_expected * x, 1E-14));
+  EXPECT_EQ(dy_dx.size(), 6);
+  EXPECT_TRUE(CompareMatrices(ToDense(dy_dx, 2, 3), dy_dx_expected, 1E-14));
+  vector<double> values(6);
+  EXPECT_EQ(
+      internal::ScatterJacobian(evaluator, 3, dy_dx, VectorXd(), values.data()),
+      6);
+  EXPECT_EQ(values, vector<double>({1, 2, 3, 4, 5, 6}));
+  // The column scaling multiplies each column of the Jacobian.
+  EXPECT_EQ(internal::ScatterJacobian(evaluator, 3, dy_dx,
+                                      Eigen::Vector3d(1, 2, 3), values.data()),
+            6);
+  EXPECT_EQ(values, vector<double>({1, 4, 9, 4, 10, 18}));
+
+  // With a sparsity pattern, the reported entries and the layout of the
+  // scattered values follow the pattern.
+  evaluator.SetGradientSparsityPattern({{1, 2}, {0, 0}, {1, 0}});
+  evaluator.EvalWithJacobian(x, &y, &dy_dx);
+  ASSERT_EQ(dy_dx.size(), 3);
+  EXPECT_EQ(dy_dx[0].row(), 1);
+  EXPECT_EQ(dy_dx[0].col(), 2);
+  EXPECT_EQ(dy_dx[0].value(), 6);
+  EXPECT_EQ(internal::GetJacobianSize(evaluator, 3), 3);
+  values.assign(3, -1);
+  EXPECT_EQ(
+      internal::ScatterJacobian(evaluator, 3, dy_dx, VectorXd(), values.data()),
+      3);
+  EXPECT_EQ(values, vector<double>({6, 1, 4}));
+  // Entries reported out of the pattern's order are placed by lookup, and the
+  // missing ones are zero.
+  values.assign(3, -1);
+  internal::ScatterJacobian(evaluator, 3, {{1, 0, 4}, {1, 2, 6}}, VectorXd(),
+                            values.data());
+  EXPECT_EQ(values, vector<double>({6, 0, 4}));
+}
+
+// y = [x₀² x₁, sin(x₁) x₂], whose Hessians are known in closed form.
+class NonlinearEvaluator : public EvaluatorBase {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(NonlinearEvaluator)
+  NonlinearEvaluator() : EvaluatorBase(2, 3) {}
+
+ protected:
+  void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
+              Eigen::VectorXd* y) const override {
+    DoEvalGeneric(x, y);
+  }
+
+  void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
+              AutoDiffVecXd* y) const override {
+    DoEvalGeneric(x, y);
+  }
+
+  void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
+              VectorX<symbolic::Expression>* y) const override {
+    DoEvalGeneric(x.cast<symbolic::Expression>(), y);
+  }
+
+ private:
+  template <typename DerivedX, typename ScalarY>
+  void DoEvalGeneric(const Eigen::MatrixBase<DerivedX>& x,
+                     VectorX<ScalarY>* y) const {
+    using std::sin;
+    y->resize(2);
+    (*y)(0) = x(0) * x(0) * x(1);
+    (*y)(1) = sin(x(1)) * x(2);
+  }
+};
+
+GTEST_TEST(EvaluatorBaseTest, EvalLagrangianHessian) {
+  NonlinearEvaluator evaluator;
+  const Eigen::Vector3d x(0.5, -1.2, 2);
+  const Vector2d lambda(3, -0.5);
+  MatrixXd H_expected = MatrixXd::Zero(3, 3);
+  H_expected(0, 0) = lambda(0) * 2 * x(1);
+  H_expected(1, 0) = lambda(0) * 2 * x(0);
+  H_expected(1, 1) = -lambda(1) * std::sin(x(1)) * x(2);
+  H_expected(2, 1) = lambda(1) * std::cos(x(1));
+
+  // The default implementation takes finite differences of the gradient, and
+  // only reports the lower triangle. It is flagged as inexact.
+  EXPECT_FALSE(evaluator.has_analytical_lagrangian_hessian());
+  vector<Eigen::Triplet<double>> hessian{{0, 0, 100}};
+  evaluator.EvalLagrangianHessian(x, lambda, &hessian);
+  for (const auto& entry : hessian) {
+    EXPECT_GE(entry.row(), entry.col());
+  }
+  EXPECT_TRUE(CompareMatrices(ToDense(hessian, 3, 3), H_expected, 1E-8));
+
+  // The linear evaluator has zero Hessian.
+  SimpleEvaluator linear_evaluator;
+  linear_evaluator.EvalLagrangianHessian(x, lambda, &hessian);
+  EXPECT_TRUE(
+      CompareMatrices(ToDense(hessian, 3, 3), MatrixXd::Zero(3, 3), 1E-8));
+}
+
 /**
  * An evaluator with dynamic sized input.
  */
@@ -1,9 +1,15 @@
 #include "drake/solvers/ipopt_solver.h"
 
+#include <cmath>
+#include <limits>
+#include <memory>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/filesystem.h"
 #include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/test/linear_program_examples.h"
 #include "drake/solvers/test/mathematical_program_test_util.h"
@@ -213,6 +219,82 @@ GTEST_TEST(IpoptSolverTest, TestNonconvexQP) {
   }
 }
 
+GTEST_TEST(IpoptSolverTest, ExactHessian) {
+  IpoptSolver solver;
+  if (!solver.available()) {
+    return;
+  }
+  // Minimizes the ill-conditioned (x - c)ᵀD(x - c) within the unit ball. Since
+  // c lies along the first axis, the solution is x = (1, 0, 0, 0).
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables(4);
+  prog.AddQuadraticErrorCost(
+      Eigen::Vector4d(1, 10, 100, 1000).asDiagonal().toDenseMatrix(),
+      Eigen::Vector4d(2, 0, 0, 0), x);
+  const double kInf = std::numeric_limits<double>::infinity();
+  prog.AddConstraint(
+      std::make_shared<QuadraticConstraint>(2 * Eigen::Matrix4d::Identity(),
+                                            Eigen::Vector4d::Zero(), -kInf, 1),
+      x);
+  SolverOptions options;
+  options.SetOption(IpoptSolver::id(), "hessian_approximation", "exact");
+  // With the exact Hessian of the Lagrangian, IPOPT takes Newton steps, and
+  // so needs only a few iterations.
+  options.SetOption(IpoptSolver::id(), "max_iter", 20);
+  const Eigen::Vector4d x_init(0.1, 0.3, 0.3, 0.3);
+  const auto result = solver.Solve(prog, x_init, options);
+  EXPECT_TRUE(result.is_success());
+  EXPECT_TRUE(CompareMatrices(result.GetSolution(x),
+                              Eigen::Vector4d(1, 0, 0, 0), 1E-6));
+
+  // A cost whose Hessian would only be approximated by finite differences is
+  // rejected, rather than passed to IPOPT as exact.
+  prog.AddL2NormCost(Eigen::Matrix4d::Identity(), Eigen::Vector4d::Ones(), x);
+  DRAKE_EXPECT_THROWS_MESSAGE(solver.Solve(prog, x_init, options),
+                              ".*hessian_approximation=exact.*L2NormCost.*");
+}
+
+GTEST_TEST(IpoptSolverTest, ExactHessianFiniteDifference) {
+  IpoptSolver solver;
+  if (!solver.available()) {
+    return;
+  }
+  // A generic nonlinear constraint, such as those of trajectory optimization,
+  // has no analytical Hessian.
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables(4);
+  prog.AddQuadraticErrorCost(Eigen::Matrix4d::Identity(),
+                             Eigen::Vector4d(1, 2, 0, 0), x);
+  const auto constraint =
+      prog.AddConstraint(x(0) * x(0) + sin(x(1)) + x(2) * x(3) <= 1);
+  ASSERT_FALSE(constraint.evaluator()->has_analytical_lagrangian_hessian());
+  SolverOptions options;
+  options.SetOption(IpoptSolver::id(), "hessian_approximation", "exact");
+  const Eigen::Vector4d x_init(0.1, 0.2, 0.3, 0.4);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      solver.Solve(prog, x_init, options),
+      ".*hessian_approximation=exact.*drake_allow_finite_difference_hessian.*");
+
+  // When allowed, its finite-difference Hessian is used as the exact one.
+  options.SetOption(IpoptSolver::id(), "drake_allow_finite_difference_hessian",
+                    1);
+  const auto result = solver.Solve(prog, x_init, options);
+  EXPECT_TRUE(result.is_success());
+  const Eigen::Vector4d x_sol = result.GetSolution(x);
+  EXPECT_NEAR(x_sol(0) * x_sol(0) + std::sin(x_sol(1)) + x_sol(2) * x_sol(3),
+              1, 1E-6);
+  // The solution matches the one found with the limited-memory Hessian.
+  SolverOptions lbfgs_options;
+  const auto lbfgs_result = solver.Solve(prog, x_init, lbfgs_options);
+  ASSERT_TRUE(lbfgs_result.is_success());
+  EXPECT_TRUE(CompareMatrices(x_sol, lbfgs_result.GetSolution(x), 1E-5));
+
+  options.SetOption(IpoptSolver::id(), "drake_allow_finite_difference_hessian",
+                    2);
+  DRAKE_EXPECT_THROWS_MESSAGE(solver.Solve(prog, x_init, options),
+                              ".*drake_allow_finite_difference_hessian.*");
+}
+
 /* Tests the solver's processing of the verbosity options. With multiple ways
  to request verbosity (common options and solver-specific options), we simply
  apply a smoke test that none of the means causes runtime errors. Note, we
@@ -1050,6 +1050,65 @@ GTEST_TEST(TestMathematicalProgram, AddLinearCostSymbolic) {
   CheckAddedSymbolicLinearCost(&prog, x(1) * x(1) + x(0) - x(1) * x(1));
 }
 
+GTEST_TEST(TestMathematicalProgram, AddLinearConstraintSparse) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables(4, "x");
+  // x0 - 2 * x1 + x2 ≤ 1
+  // 3 * x3 - x1 ≥ -2
+  std::vector<Eigen::Triplet<double>> triplets{
+      {0, 0, 1}, {0, 1, -2}, {0, 2, 1}, {1, 3, 3}, {1, 1, -1}};
+  Eigen::SparseMatrix<double> A(2, 4);
+  A.setFromTriplets(triplets.begin(), triplets.end());
+  const Eigen::Vector2d lb(-kInf, -2);
+  const Eigen::Vector2d ub(1, kInf);
+  const auto binding = prog.AddLinearConstraint(A, lb, ub, x);
+  EXPECT_EQ(prog.linear_constraints().size(), 1);
+  EXPECT_EQ(binding.evaluator()->get_sparse_A().nonZeros(), 5);
+  EXPECT_TRUE(CompareMatrices(binding.evaluator()->GetDenseA(), A.toDense()));
+  EXPECT_TRUE(CompareMatrices(binding.evaluator()->lower_bound(), lb));
+  EXPECT_TRUE(CompareMatrices(binding.evaluator()->upper_bound(), ub));
+  ASSERT_EQ(binding.variables().rows(), 4);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(binding.variables()(i), x(i));
+  }
+
+  // The same constraint, on x in the reverse order, through the variable
+  // indices.
+  Eigen::SparseMatrix<double> A_reversed(2, 4);
+  for (const auto& triplet : triplets) {
+    A_reversed.insert(triplet.row(), 3 - triplet.col()) = triplet.value();
+  }
+  const auto binding_indices = prog.AddLinearConstraint(
+      A_reversed, lb, ub, std::vector<int>{3, 2, 1, 0});
+  ASSERT_EQ(binding_indices.variables().rows(), 4);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(binding_indices.variables()(i), x(3 - i));
+  }
+  const Eigen::Vector4d x_val(1, 2, 3, 4);
+  EXPECT_TRUE(CompareMatrices(prog.EvalBinding(binding_indices, x_val),
+                              prog.EvalBinding(binding, x_val)));
+
+  // A sparse equality constraint: x0 + x3 = 2.
+  Eigen::SparseMatrix<double> Aeq(1, 2);
+  Aeq.insert(0, 0) = 1;
+  Aeq.insert(0, 1) = 1;
+  const auto equality = prog.AddLinearEqualityConstraint(
+      Aeq, Vector1d(2), std::vector<int>{0, 3});
+  EXPECT_EQ(prog.linear_equality_constraints().size(), 1);
+  ASSERT_EQ(equality.variables().rows(), 2);
+  EXPECT_EQ(equality.variables()(0), x(0));
+  EXPECT_EQ(equality.variables()(1), x(3));
+  EXPECT_TRUE(CompareMatrices(equality.evaluator()->lower_bound(),
+                              Vector1d(2)));
+  prog.AddLinearEqualityConstraint(Aeq, Vector1d(2), x.tail<2>());
+  EXPECT_EQ(prog.linear_equality_constraints().size(), 2);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      prog.AddLinearEqualityConstraint(Aeq, Vector1d(2),
+                                       std::vector<int>{0, 4}),
+      "var_indices\\[1\\] = 4 is not a decision variable index.*");
+}
+
 GTEST_TEST(TestMathematicalProgram, AddLinearConstraintSymbolic1) {
   // Add linear constraint: -10 <= 3 - 5*x0 + 10*x2 - 7*y1 <= 10
   MathematicalProgram prog;
@@ -269,6 +269,61 @@ GTEST_TEST(OsqpSolverTest, TimeLimitTest) {
   }
 }
 
+GTEST_TEST(OsqpSolverTest, ReuseWorkspace) {
+  // A small MPC-shaped problem, whose linear cost, bounds and equality
+  // constraint are updated between solves.
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<3>();
+  prog.AddQuadraticCost(Eigen::Matrix3d::Identity(), Eigen::Vector3d::Zero(),
+                        x);
+  auto linear_cost = prog.AddLinearCost(Eigen::Vector3d(1, -2, 0.5), 0, x);
+  auto bounds = prog.AddBoundingBoxConstraint(-1, 1, x);
+  auto equality = prog.AddLinearEqualityConstraint(
+      Eigen::RowVector3d(1, 1, 1), Vector1d(0.5), x);
+
+  OsqpSolver osqp_solver;
+  if (osqp_solver.available()) {
+    SolverOptions solver_options;
+    solver_options.SetOption(osqp_solver.solver_id(), "reuse_workspace", 1);
+    solver_options.SetOption(osqp_solver.solver_id(), "eps_abs", 1E-8);
+    solver_options.SetOption(osqp_solver.solver_id(), "eps_rel", 1E-8);
+    MathematicalProgramResult result;
+    osqp_solver.Solve(prog, {}, solver_options, &result);
+    EXPECT_TRUE(result.is_success());
+    EXPECT_FALSE(result.get_solver_details<OsqpSolver>().reused_workspace);
+
+    // Only the numerical data changes, so the workspace is updated in place,
+    // and the result matches the one from a new solver.
+    linear_cost.evaluator()->UpdateCoefficients(Eigen::Vector3d(-1, 0.3, 2));
+    bounds.evaluator()->UpdateLowerBound(Eigen::Vector3d(-0.5, -2, -1));
+    equality.evaluator()->UpdateCoefficients(Eigen::RowVector3d(1, 2, 1),
+                                             Vector1d(0.2));
+    osqp_solver.Solve(prog, {}, solver_options, &result);
+    EXPECT_TRUE(result.is_success());
+    EXPECT_TRUE(result.get_solver_details<OsqpSolver>().reused_workspace);
+    MathematicalProgramResult new_result;
+    OsqpSolver().Solve(prog, {}, solver_options, &new_result);
+    EXPECT_FALSE(new_result.get_solver_details<OsqpSolver>().reused_workspace);
+    EXPECT_TRUE(CompareMatrices(result.GetSolution(x),
+                                new_result.GetSolution(x), 1E-6));
+    EXPECT_NEAR(result.get_optimal_cost(), new_result.get_optimal_cost(),
+                1E-6);
+    EXPECT_TRUE(CompareMatrices(result.GetDualSolution(equality),
+                                new_result.GetDualSolution(equality), 1E-6));
+
+    // A new constraint changes the structure of the problem.
+    prog.AddLinearConstraint(x(0) - x(2) <= 0.1);
+    osqp_solver.Solve(prog, {}, solver_options, &result);
+    EXPECT_TRUE(result.is_success());
+    EXPECT_FALSE(result.get_solver_details<OsqpSolver>().reused_workspace);
+
+    // Without the option, the workspace is always set up.
+    osqp_solver.Solve(prog, {}, {}, &result);
+    EXPECT_TRUE(result.is_success());
+    EXPECT_FALSE(result.get_solver_details<OsqpSolver>().reused_workspace);
+  }
+}
+
 GTEST_TEST(OsqpSolverTest, ProgramAttributesGood) {
   MathematicalProgram prog;
   auto x = prog.NewContinuousVariables<1>("x");
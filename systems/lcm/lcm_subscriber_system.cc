@@ -1,5 +1,6 @@
 #include "drake/systems/lcm/lcm_subscriber_system.h"
 
+#include <algorithm>
 #include <functional>
 #include <utility>
 
@@ -30,6 +31,10 @@ LcmSubscriberSystem::LcmSubscriberSystem(
   DRAKE_DEMAND(serializer_ != nullptr);
   DRAKE_DEMAND(lcm != nullptr);
 
+  // The message buffers must exist before we subscribe.
+  decode_buffer_ = serializer_->CreateDefaultValue();
+  received_message_ = serializer_->CreateDefaultValue();
+
   subscription_ = lcm->Subscribe(
       channel_, [this](const void* buffer, int size) {
         this->HandleMessage(buffer, size);
@@ -72,14 +77,37 @@ systems::EventStatus LcmSubscriberSystem::ProcessMessageAndStoreToAbstractState(
     const Context<double>&, State<double>* state) const {
   AbstractValues& abstract_state = state->get_mutable_abstract_state();
   std::lock_guard<std::mutex> lock(received_message_mutex_);
-  if (!received_message_.empty()) {
-    serializer_->Deserialize(
-        received_message_.data(), received_message_.size(),
-        &abstract_state.get_mutable_value(kStateIndexMessage));
+  if (received_message_count_ > 0) {
+    if (received_message_error_) {
+      std::rethrow_exception(received_message_error_);
+    }
+    abstract_state.get_mutable_value(kStateIndexMessage)
+        .SetFrom(*received_message_);
   }
   abstract_state.get_mutable_value(kStateIndexMessageCount)
       .get_mutable_value<int>() = received_message_count_;
 
+  // Update the statistics, the first time that a message is processed.
+  if (received_message_count_ > processed_message_count_) {
+    const int num_pending = received_message_count_ - processed_message_count_;
+    const double latency = std::chrono::duration<double>(
+        Clock::now() - received_message_time_).count();
+    LcmSubscriberStatistics& stats = statistics_;
+    ++stats.num_processed;
+    stats.num_dropped += num_pending - 1;
+    stats.max_pending = std::max(stats.max_pending, num_pending);
+    stats.last_latency = latency;
+    stats.mean_latency =
+        (stats.num_processed == 1)
+            ? latency
+            : stats.mean_latency +
+                  (latency - stats.mean_latency) / stats.num_processed;
+    stats.max_latency =
+        (stats.num_processed == 1) ? latency
+                                   : std::max(stats.max_latency, latency);
+    processed_message_count_ = received_message_count_;
+  }
+
   return systems::EventStatus::Succeeded();
 }
 
@@ -138,11 +166,21 @@ void LcmSubscriberSystem::HandleMessage(const void* buffer, int size) {
   DRAKE_LOGGER_TRACE("Receiving LCM {} message", channel_);
   DRAKE_DEMAND(magic_number_ == kMagic);
 
-  const uint8_t* const rbuf_begin = static_cast<const uint8_t*>(buffer);
-  const uint8_t* const rbuf_end = rbuf_begin + size;
+  const Clock::time_point now = Clock::now();
+  std::lock_guard<std::mutex> decode_lock(decode_mutex_);
+  // Decoding errors are kept for later, in order to be thrown from the
+  // thread that uses the message rather than from the LCM callback.
+  std::exception_ptr error;
+  try {
+    serializer_->Deserialize(buffer, size, decode_buffer_.get());
+  } catch (...) {
+    error = std::current_exception();
+  }
+
   std::lock_guard<std::mutex> lock(received_message_mutex_);
-  received_message_.clear();
-  received_message_.insert(received_message_.begin(), rbuf_begin, rbuf_end);
+  received_message_.swap(decode_buffer_);
+  received_message_error_ = std::move(error);
+  received_message_time_ = now;
   received_message_count_++;
   received_message_condition_variable_.notify_all();
 }
@@ -190,8 +228,10 @@ int LcmSubscriberSystem::WaitForMessage(
   }
 
   if (message) {
-      serializer_->Deserialize(
-          received_message_.data(), received_message_.size(), message);
+    if (received_message_error_) {
+      std::rethrow_exception(received_message_error_);
+    }
+    message->SetFrom(*received_message_);
   }
 
   return received_message_count_;
@@ -202,6 +242,14 @@ int LcmSubscriberSystem::GetInternalMessageCount() const {
   return received_message_count_;
 }
 
+LcmSubscriberStatistics LcmSubscriberSystem::GetReceiveStatistics() const {
+  std::unique_lock<std::mutex> lock(received_message_mutex_);
+  LcmSubscriberStatistics result = statistics_;
+  result.num_received = received_message_count_;
+  result.num_pending = received_message_count_ - processed_message_count_;
+  return result;
+}
+
 }  // namespace lcm
 }  // namespace systems
 }  // namespace drake
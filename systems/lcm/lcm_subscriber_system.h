@@ -1,10 +1,12 @@
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
+#include <exception>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <string>
-#include <vector>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_deprecated.h"
@@ -18,6 +20,47 @@ namespace drake {
 namespace systems {
 namespace lcm {
 
+/**
+ * Statistics of the messages received by a LcmSubscriberSystem; see
+ * LcmSubscriberSystem::GetReceiveStatistics(). A message is processed when it
+ * is first stored into the State of a Context. Since the system only keeps the
+ * most recently received message, the messages that are received while
+ * another one is pending replace it, i.e., the replaced one is dropped. Hence,
+ * `num_received == num_processed + num_dropped + num_pending`.
+ *
+ * The latencies are measured with the host's steady clock, in seconds, from
+ * the receipt of a message (when the DrakeLcmInterface calls the subscription's
+ * handler) until the message is processed. They are NaN until the first
+ * message is processed.
+ *
+ * The statistics are global to the LcmSubscriberSystem instance, like the
+ * received message itself: they are not part of any Context. A message is
+ * counted as processed by whichever Context stores it first; storing the same
+ * message into another Context (or again into the same one) changes nothing.
+ * When several Contexts of the same system are advanced (e.g., by several
+ * Simulators), the statistics thus describe their processing as a whole, not
+ * that of any one of them.
+ */
+struct LcmSubscriberStatistics {
+  /** The number of messages received. */
+  int num_received{0};
+  /** The number of messages processed. */
+  int num_processed{0};
+  /** The number of messages dropped. */
+  int num_dropped{0};
+  /** The number of messages received since the last message was processed,
+  all but the latest of which will be dropped. */
+  int num_pending{0};
+  /** The largest `num_pending` seen when a message was processed. */
+  int max_pending{0};
+  /** The latency of the most recently processed message. */
+  double last_latency{std::numeric_limits<double>::quiet_NaN()};
+  /** The mean latency of the processed messages. */
+  double mean_latency{std::numeric_limits<double>::quiet_NaN()};
+  /** The largest latency of the processed messages. */
+  double max_latency{std::numeric_limits<double>::quiet_NaN()};
+};
+
 /**
  * Receives LCM messages from a given channel and outputs them to a
  * System<double>'s port. This class stores the most recently processed LCM
@@ -33,6 +76,13 @@ namespace lcm {
  * all these operations are taken care of by the Simulator. On the other hand,
  * the user needs to manually replicate this process without the Simulator.
  *
+ * Each message is decoded when it is received, straight into a preallocated
+ * message object, which is then swapped with the one holding the previous
+ * message (i.e., the messages are double-buffered). Decoding into the same
+ * objects over and over lets the message types that hold arrays reuse their
+ * memory, and the bytes of the messages are never copied. Processing a
+ * message copies the message object into the State.
+ *
  * If LCM service in use is a drake::lcm::DrakeLcmLog (not live operation),
  * then see drake::systems::lcm::LcmLogPlaybackSystem for a helper to advance
  * the log cursor in concert with the simulation.
@@ -118,7 +168,15 @@ class LcmSubscriberSystem : public LeafSystem<double> {
    */
   int GetMessageCount(const Context<double>& context) const;
 
+  /**
+   * Returns the statistics of the messages received so far. They are shared by
+   * all of the Contexts of this system; see LcmSubscriberStatistics.
+   */
+  LcmSubscriberStatistics GetReceiveStatistics() const;
+
  private:
+  using Clock = std::chrono::steady_clock;
+
   // Callback entry point from LCM into this class.
   void HandleMessage(const void*, int);
 
@@ -136,18 +194,42 @@ class LcmSubscriberSystem : public LeafSystem<double> {
   // Will be non-null iff our output port is abstract-valued.
   const std::unique_ptr<SerializerInterface> serializer_;
 
-  // The mutex that guards received_message_ and received_message_count_.
+  // The mutex that guards decode_buffer_, which the handler decodes the
+  // messages into before swapping it with received_message_. Only the handler
+  // uses it, so that it can decode without holding received_message_mutex_.
+  std::mutex decode_mutex_;
+
+  // The message object that the next message is decoded into. Not null.
+  std::unique_ptr<AbstractValue> decode_buffer_;
+
+  // The mutex that guards the members below.
   mutable std::mutex received_message_mutex_;
 
   // A condition variable that's signaled every time the handler is called.
   mutable std::condition_variable received_message_condition_variable_;
 
-  // The bytes of the most recently received LCM message.
-  std::vector<uint8_t> received_message_;
+  // The most recently received LCM message. Not null.
+  std::unique_ptr<AbstractValue> received_message_;
+
+  // The error that decoding the most recently received LCM message threw, if
+  // any, which is rethrown when the message is used.
+  std::exception_ptr received_message_error_;
+
+  // When the most recently received LCM message was received.
+  Clock::time_point received_message_time_;
 
   // A message counter that's incremented every time the handler is called.
   int received_message_count_{0};
 
+  // The value of received_message_count_ when a message was last processed,
+  // into any Context. Like statistics_, this is not per-Context state: it
+  // only serves the statistics, never the output of the system.
+  mutable int processed_message_count_{0};
+
+  // The statistics of the processed messages, global to this instance; the
+  // message counts are filled in by GetReceiveStatistics().
+  mutable LcmSubscriberStatistics statistics_;
+
   // When we are destroyed, our subscription will be automatically removed
   // (if the DrakeLcmInterface supports removal).
   std::shared_ptr<drake::lcm::DrakeSubscriptionInterface> subscription_;
@@ -1,6 +1,7 @@
 #include "drake/systems/lcm/lcm_subscriber_system.h"
 
 #include <array>
+#include <cmath>
 #include <future>
 
 #include <gtest/gtest.h>
@@ -102,6 +103,90 @@ GTEST_TEST(LcmSubscriberSystemTest, ReceiveTest) {
   EXPECT_TRUE(CompareLcmtDrakeSignalMessages(value, sample_data.value));
 }
 
+// Tests the statistics of the received messages, and that only the latest
+// message is processed.
+GTEST_TEST(LcmSubscriberSystemTest, StatisticsTest) {
+  drake::lcm::DrakeLcm lcm;
+  const std::string channel_name = "channel_name";
+  auto dut = LcmSubscriberSystem::Make<lcmt_drake_signal>(channel_name, &lcm);
+  std::unique_ptr<Context<double>> context = dut->CreateDefaultContext();
+  std::unique_ptr<SystemOutput<double>> output = dut->AllocateOutput();
+
+  LcmSubscriberStatistics stats = dut->GetReceiveStatistics();
+  EXPECT_EQ(stats.num_received, 0);
+  EXPECT_EQ(stats.num_pending, 0);
+  EXPECT_TRUE(std::isnan(stats.mean_latency));
+
+  // Three messages arrive before the first one is processed.
+  SampleData sample_data;
+  for (int i = 0; i < 3; ++i) {
+    sample_data.value.timestamp = i;
+    sample_data.PublishAndHandle(&lcm, channel_name);
+  }
+  stats = dut->GetReceiveStatistics();
+  EXPECT_EQ(stats.num_received, 3);
+  EXPECT_EQ(stats.num_processed, 0);
+  EXPECT_EQ(stats.num_pending, 3);
+  EXPECT_TRUE(std::isnan(stats.last_latency));
+
+  // Only the latest one is processed; the others are dropped.
+  EvalOutputHelper(*dut, context.get(), output.get());
+  EXPECT_TRUE(CompareLcmtDrakeSignalMessages(
+      output->get_data(0)->get_value<lcmt_drake_signal>(), sample_data.value));
+  stats = dut->GetReceiveStatistics();
+  EXPECT_EQ(stats.num_received, 3);
+  EXPECT_EQ(stats.num_processed, 1);
+  EXPECT_EQ(stats.num_dropped, 2);
+  EXPECT_EQ(stats.num_pending, 0);
+  EXPECT_EQ(stats.max_pending, 3);
+  EXPECT_GE(stats.last_latency, 0.0);
+  EXPECT_EQ(stats.mean_latency, stats.last_latency);
+  EXPECT_EQ(stats.max_latency, stats.last_latency);
+
+  // Processing the same message again (e.g., into another Context) does not
+  // change the statistics.
+  EvalOutputHelper(*dut, dut->CreateDefaultContext().get(), output.get());
+  EXPECT_EQ(dut->GetReceiveStatistics().num_processed, 1);
+
+  sample_data.value.timestamp = 3;
+  sample_data.PublishAndHandle(&lcm, channel_name);
+  EvalOutputHelper(*dut, context.get(), output.get());
+  EXPECT_TRUE(CompareLcmtDrakeSignalMessages(
+      output->get_data(0)->get_value<lcmt_drake_signal>(), sample_data.value));
+  stats = dut->GetReceiveStatistics();
+  EXPECT_EQ(stats.num_received, 4);
+  EXPECT_EQ(stats.num_processed, 2);
+  EXPECT_EQ(stats.num_dropped, 2);
+  EXPECT_EQ(stats.max_pending, 3);
+  EXPECT_GE(stats.max_latency, stats.mean_latency);
+}
+
+// Tests that a message that cannot be decoded is an error when it is used,
+// rather than when it is received.
+GTEST_TEST(LcmSubscriberSystemTest, DecodeErrorTest) {
+  drake::lcm::DrakeLcm lcm;
+  const std::string channel_name = "channel_name";
+  auto dut = LcmSubscriberSystem::Make<lcmt_drake_signal>(channel_name, &lcm);
+  std::unique_ptr<Context<double>> context = dut->CreateDefaultContext();
+  std::unique_ptr<SystemOutput<double>> output = dut->AllocateOutput();
+
+  const std::array<uint8_t, 3> garbage{1, 2, 3};
+  lcm.Publish(channel_name, garbage.data(), garbage.size(), {});
+  EXPECT_NO_THROW(lcm.HandleSubscriptions(0));
+  EXPECT_EQ(dut->GetInternalMessageCount(), 1);
+  EXPECT_THROW(EvalOutputHelper(*dut, context.get(), output.get()),
+               std::exception);
+  Value<lcmt_drake_signal> message;
+  EXPECT_THROW(dut->WaitForMessage(0, &message), std::exception);
+
+  // The next valid message replaces the bad one.
+  SampleData sample_data;
+  sample_data.PublishAndHandle(&lcm, channel_name);
+  EvalOutputHelper(*dut, context.get(), output.get());
+  EXPECT_TRUE(CompareLcmtDrakeSignalMessages(
+      output->get_data(0)->get_value<lcmt_drake_signal>(), sample_data.value));
+}
+
 GTEST_TEST(LcmSubscriberSystemTest, WaitTest) {
   // Ensure that `WaitForMessage` works as expected.
   drake::lcm::DrakeLcm lcm;
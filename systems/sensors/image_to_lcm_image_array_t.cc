@@ -1,9 +1,13 @@
 #include "drake/systems/sensors/image_to_lcm_image_array_t.h"
 
 #include <stdexcept>
+#include <type_traits>
+#include <vector>
 
+#include <png.h>
 #include <zlib.h>
 
+#include "drake/common/parallel_for.h"
 #include "drake/lcmt_image.hpp"
 #include "drake/lcmt_image_array.hpp"
 #include "drake/systems/sensors/lcm_image_traits.h"
@@ -19,27 +23,94 @@ const int64_t kSecToMillisec = 1000000;
 
 // Overwrites the msg's compression_method, size, and data.
 template <PixelType kPixelType>
-void Compress(const Image<kPixelType>& image, lcmt_image* msg) {
+void CompressZlib(const Image<kPixelType>& image,
+                  const ImageCompressionParams& compression, lcmt_image* msg) {
   msg->compression_method = lcmt_image::COMPRESSION_METHOD_ZLIB;
 
   const int source_size = image.width() * image.height() * image.kPixelSize;
-  // The destination buf_size must be slightly larger than the source size.
-  // http://refspecs.linuxbase.org/LSB_3.0.0/LSB-PDA/LSB-PDA/zlib-compress2-1.html
-  std::vector<uint8_t>& dest = msg->data;
-  size_t dest_size = source_size * 1.001 + 12;
-  dest.resize(dest_size);
+  z_stream stream{};
+  auto status = deflateInit2(
+      &stream, compression.level, Z_DEFLATED, MAX_WBITS, MAX_MEM_LEVEL,
+      compression.run_length_only ? Z_RLE : Z_DEFAULT_STRATEGY);
+  DRAKE_DEMAND(status == Z_OK);
 
-  auto compress_status = compress2(
-      dest.data(), &dest_size,
-      reinterpret_cast<const Bytef*>(image.at(0, 0)),
-      source_size, Z_BEST_SPEED);
-  DRAKE_DEMAND(compress_status == Z_OK);
+  // The destination is sized to the worst case, so that a single call
+  // compresses the whole image.
+  std::vector<uint8_t>& dest = msg->data;
+  dest.resize(deflateBound(&stream, source_size));
+  stream.next_in = const_cast<Bytef*>(
+      reinterpret_cast<const Bytef*>(image.at(0, 0)));
+  stream.avail_in = source_size;
+  stream.next_out = dest.data();
+  stream.avail_out = dest.size();
+  status = deflate(&stream, Z_FINISH);
+  DRAKE_DEMAND(status == Z_STREAM_END);
+  const int dest_size = stream.total_out;
+  deflateEnd(&stream);
 
-  DRAKE_DEMAND(dest_size <= dest.size());
   dest.resize(dest_size);
   msg->size = dest_size;
 }
 
+// Appends the bytes written by libpng to the std::vector<uint8_t> its io
+// pointer points to.
+void AppendPngBytes(png_structp png_ptr, png_bytep data, size_t length) {
+  auto* dest = static_cast<std::vector<uint8_t>*>(png_get_io_ptr(png_ptr));
+  dest->insert(dest->end(), data, data + length);
+}
+
+// Overwrites the msg's compression_method, size, and data.
+template <PixelType kPixelType>
+void CompressPng(const Image<kPixelType>& image,
+                 const ImageCompressionParams& compression, lcmt_image* msg) {
+  using ChannelType = typename ImageTraits<kPixelType>::ChannelType;
+  constexpr int kNumChannels = ImageTraits<kPixelType>::kNumChannels;
+  static_assert(sizeof(ChannelType) <= 2 && kNumChannels <= 4);
+  constexpr int kColorTypes[] = {PNG_COLOR_TYPE_GRAY, PNG_COLOR_TYPE_GRAY_ALPHA,
+                                 PNG_COLOR_TYPE_RGB, PNG_COLOR_TYPE_RGB_ALPHA};
+  msg->compression_method = lcmt_image::COMPRESSION_METHOD_PNG;
+
+  png_structp png_ptr =
+      png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+  DRAKE_DEMAND(png_ptr != nullptr);
+  png_infop info_ptr = png_create_info_struct(png_ptr);
+  DRAKE_DEMAND(info_ptr != nullptr);
+
+  // The data keeps its capacity from one message to the next.
+  std::vector<uint8_t>& dest = msg->data;
+  dest.clear();
+  if (setjmp(png_jmpbuf(png_ptr)) != 0) {
+    png_destroy_write_struct(&png_ptr, &info_ptr);
+    throw std::runtime_error("ImageToLcmImageArrayT: PNG encoding failed");
+  }
+  png_set_write_fn(png_ptr, &dest, AppendPngBytes, nullptr);
+  png_set_IHDR(png_ptr, info_ptr, image.width(), image.height(),
+               sizeof(ChannelType) * 8, kColorTypes[kNumChannels - 1],
+               PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
+               PNG_FILTER_TYPE_DEFAULT);
+  // The "sub" filter predicts each byte from the same byte of the pixel on
+  // its left, which is as cheap as a filter can be.
+  png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, PNG_FILTER_SUB);
+  png_set_compression_level(png_ptr, compression.level);
+  if (compression.run_length_only) {
+    png_set_compression_strategy(png_ptr, Z_RLE);
+  }
+  png_write_info(png_ptr, info_ptr);
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  // PNG stores 16-bit channels as big endian.
+  if constexpr (sizeof(ChannelType) == 2) {
+    png_set_swap(png_ptr);
+  }
+#endif
+  for (int v = 0; v < image.height(); ++v) {
+    png_write_row(png_ptr, reinterpret_cast<png_const_bytep>(image.at(0, v)));
+  }
+  png_write_end(png_ptr, nullptr);
+  png_destroy_write_struct(&png_ptr, &info_ptr);
+
+  msg->size = dest.size();
+}
+
 // Overwrites the msg's compression_method, size, and data.
 template <PixelType kPixelType>
 void Pack(const Image<kPixelType>& image, lcmt_image* msg) {
@@ -54,7 +125,7 @@ void Pack(const Image<kPixelType>& image, lcmt_image* msg) {
 // Overwrites everything in msg except its header.
 template <PixelType kPixelType>
 void PackImageToLcmImageT(const Image<kPixelType>& image, lcmt_image* msg,
-                          bool do_compress) {
+                          const ImageCompressionParams& compression) {
   msg->width = image.width();
   msg->height = image.height();
   msg->row_stride = image.kPixelSize * msg->width;
@@ -63,64 +134,77 @@ void PackImageToLcmImageT(const Image<kPixelType>& image, lcmt_image* msg,
       LcmPixelTraits<ImageTraits<kPixelType>::kPixelFormat>::kPixelFormat;
   msg->channel_type = LcmImageTraits<kPixelType>::kChannelType;
 
-  if (do_compress) {
-    Compress(image, msg);
-  } else {
-    Pack(image, msg);
+  using ChannelType = typename ImageTraits<kPixelType>::ChannelType;
+  switch (compression.method) {
+    case ImageCompressionParams::Method::kNone:
+      Pack(image, msg);
+      return;
+    case ImageCompressionParams::Method::kZlib:
+      CompressZlib(image, compression, msg);
+      return;
+    case ImageCompressionParams::Method::kPng:
+      if constexpr (std::is_integral_v<ChannelType> &&
+                    sizeof(ChannelType) <= 2) {
+        CompressPng(image, compression, msg);
+      } else {
+        CompressZlib(image, compression, msg);
+      }
+      return;
   }
+  DRAKE_UNREACHABLE();
 }
 
 // Overwrites everything in msg except its header.
 void PackImageToLcmImageT(const AbstractValue& untyped_image,
                           PixelType pixel_type, lcmt_image* msg,
-                          bool do_compress) {
+                          const ImageCompressionParams& compression) {
   switch (pixel_type) {
     case PixelType::kRgb8U: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kRgb8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, compression);
       break;
     }
     case PixelType::kBgr8U: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kBgr8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, compression);
       break;
     }
     case PixelType::kRgba8U: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kRgba8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, compression);
       break;
     }
     case PixelType::kBgra8U: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kBgra8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, compression);
       break;
     }
     case PixelType::kGrey8U: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kGrey8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, compression);
       break;
     }
     case PixelType::kDepth16U: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kDepth16U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, compression);
       break;
     }
     case PixelType::kDepth32F: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kDepth32F>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, compression);
       break;
     }
     case PixelType::kLabel16I: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kLabel16I>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, compression);
       break;
     }
     case PixelType::kExpr:
@@ -128,10 +212,30 @@ void PackImageToLcmImageT(const AbstractValue& untyped_image,
   }
 }
 
+// Returns the compression of the `do_compress` constructor argument.
+ImageCompressionParams MakeCompressionParams(bool do_compress) {
+  ImageCompressionParams compression;
+  compression.method = do_compress ? ImageCompressionParams::Method::kZlib
+                                   : ImageCompressionParams::Method::kNone;
+  return compression;
+}
+
+// Throws if `compression` is not valid.
+const ImageCompressionParams& ValidateCompressionParams(
+    const ImageCompressionParams& compression) {
+  DRAKE_THROW_UNLESS(compression.level >= 1 && compression.level <= 9);
+  DRAKE_THROW_UNLESS(compression.num_threads >= 1);
+  return compression;
+}
+
 }  // anonymous namespace
 
 ImageToLcmImageArrayT::ImageToLcmImageArrayT(bool do_compress)
-    : do_compress_(do_compress) {
+    : ImageToLcmImageArrayT(MakeCompressionParams(do_compress)) {}
+
+ImageToLcmImageArrayT::ImageToLcmImageArrayT(
+    const ImageCompressionParams& compression)
+    : compression_(ValidateCompressionParams(compression)) {
   image_array_t_msg_output_port_index_ = DeclareAbstractOutputPort(
       kUseDefaultName, &ImageToLcmImageArrayT::CalcImageArray)
           .get_index();
@@ -141,7 +245,14 @@ ImageToLcmImageArrayT::ImageToLcmImageArrayT(const string& color_frame_name,
                                              const string& depth_frame_name,
                                              const string& label_frame_name,
                                              bool do_compress)
-    : do_compress_(do_compress) {
+    : ImageToLcmImageArrayT(color_frame_name, depth_frame_name,
+                            label_frame_name,
+                            MakeCompressionParams(do_compress)) {}
+
+ImageToLcmImageArrayT::ImageToLcmImageArrayT(
+    const string& color_frame_name, const string& depth_frame_name,
+    const string& label_frame_name, const ImageCompressionParams& compression)
+    : compression_(ValidateCompressionParams(compression)) {
   color_image_input_port_index_ =
       DeclareImageInputPort<PixelType::kRgba8U>(color_frame_name).get_index();
   depth_image_input_port_index_ =
@@ -193,17 +304,26 @@ void ImageToLcmImageArrayT::CalcImageArray(
   const int num_inputs = num_input_ports();
   msg->num_images = num_inputs;
   msg->images.resize(num_inputs);
+  // The inputs are evaluated up front, since the cache is not thread-safe.
+  std::vector<const AbstractValue*> values(num_inputs);
   for (int i = 0; i < num_inputs; i++) {
     const std::string& name = this->get_input_port(i).get_name();
-    const PixelType& type = input_port_pixel_type_[i];
-    const auto& value = this->get_input_port(i).
+    values[i] = &this->get_input_port(i).
         template Eval<AbstractValue>(context);
     lcmt_image& packed = msg->images.at(i);
     packed.header = {};
     packed.header.utime = utime;
     packed.header.frame_name = name;
-    PackImageToLcmImageT(value, type, &packed, do_compress_);
   }
+
+  // Each image is packed into its own lcmt_image, so the images can be
+  // compressed in parallel.
+  drake::internal::ParallelFor(num_inputs, compression_.num_threads,
+                               [&](int i) {
+                                 PackImageToLcmImageT(
+                                     *values[i], input_port_pixel_type_[i],
+                                     &msg->images[i], compression_);
+                               });
 }
 
 }  // namespace sensors
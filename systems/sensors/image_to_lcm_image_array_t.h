@@ -13,6 +13,38 @@ namespace drake {
 namespace systems {
 namespace sensors {
 
+/// How ImageToLcmImageArrayT compresses its images.
+struct ImageCompressionParams {
+  /// The codecs.
+  enum class Method {
+    /// The images are sent uncompressed.
+    kNone,
+    /// The raw image data is compressed with zlib.
+    kZlib,
+    /// The images are encoded as PNG: each row is filtered by predicting every
+    /// pixel from its left neighbor before the zlib compression, which shrinks
+    /// smooth (e.g., depth) images much more than plain zlib does. Only the
+    /// images with 8 or 16-bit integer channels can be encoded as PNG; the
+    /// others (e.g., ImageDepth32F) are compressed with kZlib instead.
+    kPng,
+  };
+
+  /// The codec.
+  Method method{Method::kZlib};
+
+  /// The zlib compression level of kZlib and kPng, from 1 (fastest) to 9
+  /// (smallest).
+  int level{1};
+
+  /// If true, zlib only looks for runs of the previous byte (its Z_RLE
+  /// strategy) rather than for any earlier match. This compresses much faster,
+  /// and nearly as well on images (especially after the PNG row filter).
+  bool run_length_only{false};
+
+  /// The number of threads that compress the images of the array in parallel.
+  int num_threads{1};
+};
+
 // TODO(jwnimmer-tri) Throughout this filename, classname, and method names, the
 // the "_t" or "T" suffix is superfluous and should be removed.
 
@@ -44,6 +76,13 @@ class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
   /// After construction, use DeclareImageInputPort() to add inputs.
   explicit ImageToLcmImageArrayT(bool do_compress = false);
 
+  /// Constructs an empty system with no input ports, which compresses its
+  /// images as specified by `compression`.
+  /// After construction, use DeclareImageInputPort() to add inputs.
+  /// @throws std::exception if `compression.level` is not in [1, 9] or
+  /// `compression.num_threads` is not positive.
+  explicit ImageToLcmImageArrayT(const ImageCompressionParams& compression);
+
   /// An %ImageToLcmImageArrayT constructor.  Declares three input ports --
   /// one color image, one depth image, and one label image.
   ///
@@ -57,6 +96,16 @@ class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
                         const std::string& label_frame_name,
                         bool do_compress = false);
 
+  /// An %ImageToLcmImageArrayT constructor, which declares the same three
+  /// input ports as the constructor above, and compresses the images as
+  /// specified by `compression`.
+  /// @throws std::exception if `compression.level` is not in [1, 9] or
+  /// `compression.num_threads` is not positive.
+  ImageToLcmImageArrayT(const std::string& color_frame_name,
+                        const std::string& depth_frame_name,
+                        const std::string& label_frame_name,
+                        const ImageCompressionParams& compression);
+
   /// Returns the input port containing a color image.
   /// Note: Only valid if the color/depth/label constructor is used.
   const InputPort<double>& color_image_input_port() const;
@@ -90,7 +139,7 @@ class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
   int image_array_t_msg_output_port_index_{-1};
 
   std::vector<PixelType> input_port_pixel_type_{};
-  const bool do_compress_;
+  const ImageCompressionParams compression_;
 };
 
 }  // namespace sensors
@@ -2,8 +2,14 @@
 
 #include <unistd.h>
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
 #include <regex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -95,6 +101,140 @@ void SaveToPng(const ImageGrey8U& image, const std::string& file_path) {
   SaveToFileHelper(image, file_path);
 }
 
+// A bounded queue of write jobs, which are run by a pool of worker threads.
+// A job is queued in two steps: a slot is reserved first (which may block or
+// fail when the queue is full), and only then is the job built and pushed, so
+// that no image is copied only to be dropped.
+class ImageWriter::WriteQueue {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(WriteQueue)
+
+  explicit WriteQueue(const ImageWriterAsyncParams& params)
+      : max_pending_(params.max_pending_images),
+        drop_when_full_(params.drop_when_full) {
+    DRAKE_THROW_UNLESS(params.num_threads > 0);
+    DRAKE_THROW_UNLESS(params.max_pending_images > 0);
+    for (int i = 0; i < params.num_threads; ++i) {
+      workers_.emplace_back([this]() { Work(); });
+    }
+  }
+
+  // Finishes the pending jobs, then stops the workers.
+  ~WriteQueue() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    job_available_.notify_all();
+    for (std::thread& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  // Reserves a slot for a job, which must then be given to Push() (or else
+  // returned with Release()). Returns false if the queue is full and full
+  // queues drop new jobs.
+  bool Reserve() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    RethrowError();
+    if (num_pending_ == max_pending_ && drop_when_full_) {
+      ++num_dropped_;
+      return false;
+    }
+    job_done_.wait(lock, [this]() { return num_pending_ < max_pending_; });
+    ++num_pending_;
+    return true;
+  }
+
+  // Queues the job of a reserved slot. If this throws, the slot is released.
+  void Push(std::function<void()> job) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      try {
+        jobs_.push_back(std::move(job));
+      } catch (...) {
+        --num_pending_;
+        job_done_.notify_all();
+        throw;
+      }
+    }
+    job_available_.notify_one();
+  }
+
+  // Releases a reserved slot whose job will not be pushed.
+  void Release() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --num_pending_;
+    }
+    job_done_.notify_all();
+  }
+
+  void Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    job_done_.wait(lock, [this]() { return num_pending_ == 0; });
+    RethrowError();
+  }
+
+  int num_dropped() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_dropped_;
+  }
+
+ private:
+  void Work() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      job_available_.wait(lock,
+                          [this]() { return stopping_ || !jobs_.empty(); });
+      if (jobs_.empty()) {
+        // Only stop once every job has been run.
+        return;
+      }
+      std::function<void()> job = std::move(jobs_.front());
+      jobs_.pop_front();
+      lock.unlock();
+      std::exception_ptr error;
+      try {
+        job();
+      } catch (...) {
+        error = std::current_exception();
+      }
+      lock.lock();
+      if (error != nullptr && error_ == nullptr) {
+        error_ = error;
+      }
+      --num_pending_;
+      job_done_.notify_all();
+    }
+  }
+
+  // Rethrows (once) the first error of the jobs. The mutex must be held.
+  void RethrowError() {
+    if (error_ != nullptr) {
+      std::exception_ptr error = nullptr;
+      std::swap(error, error_);
+      std::rethrow_exception(error);
+    }
+  }
+
+  const int max_pending_;
+  const bool drop_when_full_;
+  mutable std::mutex mutex_;
+  // Signals the workers that jobs_ is not empty, or that they must stop.
+  std::condition_variable job_available_;
+  // Signals the producers that num_pending_ decreased.
+  std::condition_variable job_done_;
+  std::deque<std::function<void()>> jobs_;
+  // The number of reserved slots: the jobs that are about to be pushed, are
+  // queued, or are running.
+  int num_pending_{0};
+  int num_dropped_{0};
+  bool stopping_{false};
+  std::exception_ptr error_;
+  std::vector<std::thread> workers_;
+};
+
 ImageWriter::ImageWriter() {
   // NOTE: This excludes *many* of the defined `PixelType` values.
   labels_[PixelType::kRgba8U] = "color";
@@ -109,6 +249,23 @@ ImageWriter::ImageWriter() {
   extensions_[PixelType::kGrey8U] = ".png";
 }
 
+ImageWriter::ImageWriter(const ImageWriterAsyncParams& params)
+    : ImageWriter() {
+  write_queue_ = std::make_unique<WriteQueue>(params);
+}
+
+ImageWriter::~ImageWriter() = default;
+
+void ImageWriter::Flush() const {
+  if (write_queue_ != nullptr) {
+    write_queue_->Flush();
+  }
+}
+
+int ImageWriter::num_dropped_images() const {
+  return write_queue_ != nullptr ? write_queue_->num_dropped() : 0;
+}
+
 template <PixelType kPixelType>
 const InputPort<double>& ImageWriter::DeclareImageInputPort(
     std::string port_name, std::string file_name_format, double publish_period,
@@ -182,9 +339,45 @@ void ImageWriter::WriteImage(const Context<double>& context, int index) const {
   const auto& port = get_input_port(index);
   const ImagePortInfo& data = port_info_[index];
   const Image<kPixelType>& image = port.Eval<Image<kPixelType>>(context);
-  SaveToFileHelper(
-      image, MakeFileName(data.format, data.pixel_type, context.get_time(),
-                          port.get_name(), data.count++));
+  if (write_queue_ == nullptr) {
+    SaveToFileHelper(
+        image, MakeFileName(data.format, data.pixel_type, context.get_time(),
+                            port.get_name(), data.count++));
+    return;
+  }
+  std::string file_name = MakeFileName(data.format, data.pixel_type,
+                                       context.get_time(), port.get_name(),
+                                       data.count);
+  const bool queued =
+      QueueWriteJob([&image, &file_name]() -> std::function<void()> {
+        // The image is copied, since the context may change before it is
+        // written.
+        return [image, file_name = std::move(file_name)]() {
+          SaveToFileHelper(image, file_name);
+        };
+      });
+  if (queued) {
+    ++data.count;
+  }
+}
+
+bool ImageWriter::QueueWriteJob(
+    const std::function<std::function<void()>()>& make_job) const {
+  DRAKE_DEMAND(write_queue_ != nullptr);
+  if (!write_queue_->Reserve()) {
+    return false;
+  }
+  std::function<void()> job;
+  try {
+    job = make_job();
+  } catch (...) {
+    // Otherwise, the slot would stay reserved forever, and once every slot
+    // leaked, the publish events would block (or drop every image).
+    write_queue_->Release();
+    throw;
+  }
+  write_queue_->Push(std::move(job));
+  return true;
 }
 
 std::string ImageWriter::MakeFileName(const std::string& format,
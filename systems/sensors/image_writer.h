@@ -6,6 +6,8 @@
  invoked in any context and a System that can be connected into a diagram to
  automatically capture images during simulation at a fixed frequency.  */
 
+#include <functional>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -52,6 +54,24 @@ void SaveToPng(const ImageGrey8U& image, const std::string& file_path);
 
 //@}
 
+/** The configuration of an ImageWriter that writes its images asynchronously;
+ see ImageWriter(const ImageWriterAsyncParams&).  */
+struct ImageWriterAsyncParams {
+  /** The number of threads that encode and write the images. Must be
+   positive.  */
+  int num_threads{1};
+
+  /** The maximum number of images that can be waiting to be written or being
+   written at any time (across all ports). Must be positive.  */
+  int max_pending_images{8};
+
+  /** What to do with a new image when `max_pending_images` images are already
+   pending. If false, the publish event blocks until an image has been
+   written, so that no image is lost. If true, the new image is dropped
+   instead, so that the simulation never waits on the disk.  */
+  bool drop_when_full{false};
+};
+
 /** A system for periodically writing images to the file system. The system does
  not have a fixed set of input ports; the system can have an arbitrary number of
  image input ports. Each input port is independently configured with respect to:
@@ -86,14 +106,36 @@ void SaveToPng(const ImageGrey8U& image, const std::string& file_path);
  that function's documentation for elaboration on how to configure image output.
  It is important to note, that every declared image input port _must_ be
  connected; otherwise, attempting to write an image from that port, will cause
- an error in the system.  */
+ an error in the system.
+
+ <h3>Writing images asynchronously</h3>
+
+ By default, images are encoded and written to disk within the publish event,
+ which stalls the simulation for the duration of the disk I/O. When
+ constructed with ImageWriterAsyncParams, the publish event only copies the
+ image and queues it; a pool of background threads then encodes and writes
+ the queued images. The number of pending images is bounded, and the
+ `drop_when_full` policy decides whether a full queue blocks the publish event
+ or drops the new image. A dropped image is not counted, i.e., the `count`
+ format argument only increments for images that are written. Flush() waits
+ for the pending images to be written; the destructor flushes as well.  */
 class ImageWriter : public LeafSystem<double> {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ImageWriter)
 
-  /** Constructs default instance with no image ports.  */
+  /** Constructs default instance with no image ports, which writes the images
+   synchronously.  */
   ImageWriter();
 
+  /** Constructs an instance with no image ports, which writes the images
+   asynchronously as configured by `params`.
+   @throws std::exception if `params.num_threads` or
+   `params.max_pending_images` is not positive.  */
+  explicit ImageWriter(const ImageWriterAsyncParams& params);
+
+  /** Waits for the pending images to be written.  */
+  ~ImageWriter() override;
+
   /** Declares and configures a new image input port. A port is configured by
    providing:
 
@@ -200,6 +242,17 @@ class ImageWriter : public LeafSystem<double> {
                                                  double publish_period,
                                                  double start_time);
 
+  /** Blocks until all of the images queued so far have been written to disk.
+   This is a no-op when the images are written synchronously.
+   @throws std::exception if writing any of those images threw an exception.
+   */
+  void Flush() const;
+
+  /** Returns the number of images that have been dropped, rather than written,
+   because the queue was full. This is always zero when the images are written
+   synchronously or `drop_when_full` is false.  */
+  int num_dropped_images() const;
+
  private:
 #ifndef DRAKE_DOXYGEN_CXX
   // Friend for facilitating unit testing.
@@ -210,6 +263,13 @@ class ImageWriter : public LeafSystem<double> {
   template <PixelType kPixelType>
   void WriteImage(const Context<double>& context, int index) const;
 
+  // Reserves a slot in the write queue (which must exist), then queues the job
+  // returned by `make_job`. Returns false (without calling `make_job`) if the
+  // queue is full and drops new images. If `make_job` throws, the slot is
+  // released before the exception propagates.
+  bool QueueWriteJob(
+      const std::function<std::function<void()>()>& make_job) const;
+
   // Creates a file name from the given format string and time.
   std::string MakeFileName(const std::string& format, PixelType pixel_type,
                            double time, const std::string& port_name,
@@ -260,6 +320,11 @@ class ImageWriter : public LeafSystem<double> {
 
   std::unordered_map<PixelType, std::string> labels_;
   std::unordered_map<PixelType, std::string> extensions_;
+
+  // The queue and threads that write the images asynchronously, or null if
+  // they are written synchronously.
+  class WriteQueue;
+  std::unique_ptr<WriteQueue> write_queue_;
 };
 
 }  // namespace sensors
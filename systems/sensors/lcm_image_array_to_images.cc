@@ -181,7 +181,16 @@ bool UnpackLcmImage(const lcmt_image* lcm_image, Image<kPixelType>* image) {
 
   switch (lcm_image->compression_method) {
     case lcmt_image::COMPRESSION_METHOD_NOT_COMPRESSED: {
-      memcpy(image->at(0, 0), lcm_image->data.data(), image->size());
+      // N.B. Image::size() counts channels, not bytes.
+      const int num_bytes =
+          image->width() * image->height() * image->kPixelSize;
+      if (lcm_image->size != num_bytes) {
+        drake::log()->error("Incoming LCM image has {} bytes, expected {}",
+                            lcm_image->size, num_bytes);
+        *image = Image<kPixelType>();
+        return false;
+      }
+      memcpy(image->at(0, 0), lcm_image->data.data(), num_bytes);
       return true;
     }
     case lcmt_image::COMPRESSION_METHOD_ZLIB: {
@@ -111,6 +111,38 @@ GTEST_TEST(ImageToLcmImageArrayT, ValidTest) {
          lcmt_image::COMPRESSION_METHOD_NOT_COMPRESSED);
 }
 
+GTEST_TEST(ImageToLcmImageArrayT, CompressionParamsTest) {
+  ImageRgba8U color_image(kImageWidth, kImageHeight);
+  ImageDepth32F depth_image(kImageWidth, kImageHeight);
+  ImageLabel16I label_image(kImageWidth, kImageHeight);
+
+  ImageCompressionParams compression;
+  compression.method = ImageCompressionParams::Method::kPng;
+  compression.level = 6;
+  compression.run_length_only = true;
+  compression.num_threads = 3;
+  ImageToLcmImageArrayT dut(
+      kColorFrameName, kDepthFrameName, kLabelFrameName, compression);
+  const lcmt_image_array image_array =
+      SetUpInputAndOutput(&dut, color_image, depth_image, label_image);
+  ASSERT_EQ(image_array.images.size(), 3);
+  for (const lcmt_image& image : image_array.images) {
+    EXPECT_EQ(image.data.size(), image.size);
+    // PNG does not support 32-bit floats, so the depth image falls back to
+    // zlib.
+    EXPECT_EQ(image.compression_method,
+              image.pixel_format == lcmt_image::PIXEL_FORMAT_DEPTH
+                  ? lcmt_image::COMPRESSION_METHOD_ZLIB
+                  : lcmt_image::COMPRESSION_METHOD_PNG);
+  }
+
+  compression.level = 0;
+  EXPECT_THROW(ImageToLcmImageArrayT{compression}, std::exception);
+  compression.level = 1;
+  compression.num_threads = 0;
+  EXPECT_THROW(ImageToLcmImageArrayT{compression}, std::exception);
+}
+
 }  // namespace
 }  // namespace sensors
 }  // namespace systems
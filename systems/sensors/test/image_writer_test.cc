@@ -3,8 +3,12 @@
 #include <unistd.h>
 
 #include <fstream>
+#include <functional>
+#include <future>
 #include <set>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <vtkImageData.h>
@@ -79,6 +83,11 @@ class ImageWriterTester {
     return writer_.extensions_.at(pixel_type);
   }
 
+  bool QueueWriteJob(
+      const std::function<std::function<void()>()>& make_job) const {
+    return writer_.QueueWriteJob(make_job);
+  }
+
  private:
   const ImageWriter& writer_;
 };
@@ -665,6 +674,132 @@ TEST_F(ImageWriterTest, SingleConfiguredPort) {
   }
 }
 
+// Confirms that an asynchronous writer writes every image once flushed.
+TEST_F(ImageWriterTest, WritesImagesAsynchronously) {
+  ImageWriterAsyncParams params;
+  params.num_threads = 2;
+  params.max_pending_images = 2;
+  ImageWriter writer(params);
+  ImageWriterTester tester(writer);
+
+  const double period = 1 / 10.0;  // 10 Hz.
+  const std::string port_name{"async_port"};
+  filesystem::path path(temp_dir());
+  path.append("async_{count}");
+  const auto& port = writer.DeclareImageInputPort<PixelType::kRgba8U>(
+      port_name, path.string(), period, 0.0);
+  auto events = writer.AllocateCompositeEventCollection();
+  auto context = writer.AllocateContext();
+  const auto image = test_image<PixelType::kRgba8U>();
+  port.FixValue(context.get(), image);
+
+  std::vector<std::string> expected_names;
+  for (int i = 0; i < 5; ++i) {
+    context->SetTime(i * period);
+    events->Clear();
+    writer.CalcNextUpdateTime(*context, events.get());
+    expected_names.push_back(tester.MakeFileName(
+        tester.port_format(port.get_index()), PixelType::kRgba8U,
+        context->get_time(), port_name, tester.port_count(port.get_index())));
+    add_file_for_cleanup(expected_names.back());
+    // More images than max_pending_images are published; the publish events
+    // block rather than drop them.
+    writer.Publish(*context, events->get_publish_events());
+  }
+  writer.Flush();
+  EXPECT_EQ(5, tester.port_count(port.get_index()));
+  EXPECT_EQ(0, writer.num_dropped_images());
+  for (const std::string& name : expected_names) {
+    EXPECT_TRUE(MatchesFileOnDisk(name, image));
+  }
+
+  params.num_threads = 0;
+  EXPECT_THROW(ImageWriter{params}, std::exception);
+  params.num_threads = 1;
+  params.max_pending_images = 0;
+  EXPECT_THROW(ImageWriter{params}, std::exception);
+}
+
+// Confirms that a full queue drops the new images when drop_when_full is set.
+TEST_F(ImageWriterTest, DropsImagesWhenFull) {
+  ImageWriterAsyncParams params;
+  params.num_threads = 1;
+  params.max_pending_images = 1;
+  params.drop_when_full = true;
+  ImageWriter writer(params);
+  ImageWriterTester tester(writer);
+
+  const std::string port_name{"drop_port"};
+  filesystem::path path(temp_dir());
+  path.append("drop_{count}");
+  const auto& port = writer.DeclareImageInputPort<PixelType::kRgba8U>(
+      port_name, path.string(), 1.0, 0.0);
+  auto events = writer.AllocateCompositeEventCollection();
+  auto context = writer.AllocateContext();
+  const auto image = test_image<PixelType::kRgba8U>();
+  port.FixValue(context.get(), image);
+  writer.CalcNextUpdateTime(*context, events.get());
+
+  // Occupy the only slot of the queue until `unblock` is set.
+  std::promise<void> unblock;
+  std::shared_future<void> unblocked = unblock.get_future().share();
+  ASSERT_TRUE(tester.QueueWriteJob([unblocked]() -> std::function<void()> {
+    return [unblocked]() { unblocked.wait(); };
+  }));
+
+  // The images published meanwhile are dropped, and not counted.
+  writer.Publish(*context, events->get_publish_events());
+  writer.Publish(*context, events->get_publish_events());
+  EXPECT_EQ(2, writer.num_dropped_images());
+  EXPECT_EQ(0, tester.port_count(port.get_index()));
+
+  // Once the queue has drained, the images are written again.
+  unblock.set_value();
+  writer.Flush();
+  const std::string name =
+      tester.MakeFileName(tester.port_format(port.get_index()),
+                          PixelType::kRgba8U, context->get_time(), port_name,
+                          tester.port_count(port.get_index()));
+  add_file_for_cleanup(name);
+  writer.Publish(*context, events->get_publish_events());
+  writer.Flush();
+  EXPECT_EQ(2, writer.num_dropped_images());
+  EXPECT_EQ(1, tester.port_count(port.get_index()));
+  EXPECT_TRUE(MatchesFileOnDisk(name, image));
+}
+
+// Confirms that Flush() rethrows (once) the error of a background write.
+TEST_F(ImageWriterTest, FlushRethrowsWriteError) {
+  ImageWriter writer(ImageWriterAsyncParams{});
+  ImageWriterTester tester(writer);
+  ASSERT_TRUE(tester.QueueWriteJob([]() -> std::function<void()> {
+    return []() { throw std::runtime_error("Failed to write the image"); };
+  }));
+  DRAKE_EXPECT_THROWS_MESSAGE(writer.Flush(), "Failed to write the image");
+  EXPECT_NO_THROW(writer.Flush());
+}
+
+// Confirms that the slot reserved for a job is released if the job cannot be
+// built, rather than leaked.
+TEST_F(ImageWriterTest, ReleasesSlotOfFailedJob) {
+  ImageWriterAsyncParams params;
+  params.max_pending_images = 1;
+  params.drop_when_full = true;
+  ImageWriter writer(params);
+  ImageWriterTester tester(writer);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      tester.QueueWriteJob([]() -> std::function<void()> {
+        throw std::runtime_error("Failed to copy the image");
+      }),
+      "Failed to copy the image");
+  // Had the only slot leaked, this job would be dropped.
+  EXPECT_TRUE(tester.QueueWriteJob([]() -> std::function<void()> {
+    return []() {};
+  }));
+  writer.Flush();
+  EXPECT_EQ(0, writer.num_dropped_images());
+}
+
 // This simply confirms that the color image gets written to the right format.
 TEST_F(ImageWriterTest, WritesColorImage) {
   TestWritingImageOnPort<PixelType::kRgba8U>();
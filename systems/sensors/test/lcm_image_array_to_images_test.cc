@@ -8,6 +8,7 @@
 #include "drake/common/find_resource.h"
 #include "drake/lcmt_image_array.hpp"
 #include "drake/systems/sensors/image.h"
+#include "drake/systems/sensors/image_to_lcm_image_array_t.h"
 
 namespace drake {
 namespace systems {
@@ -119,6 +120,69 @@ GTEST_TEST(LcmImageArrayToImagesTest, PngTest) {
   EXPECT_EQ(depth_image.size(), 32 * 32);
 }
 
+// Encodes images with ImageToLcmImageArrayT, for each of its codecs, and
+// checks that they decode to the same images.
+GTEST_TEST(LcmImageArrayToImagesTest, RoundTripTest) {
+  const int width = 13;
+  const int height = 7;
+  ImageRgba8U color_image(width, height);
+  ImageDepth16U depth16_image(width, height);
+  ImageDepth32F depth32_image(width, height);
+  for (int v = 0; v < height; ++v) {
+    for (int u = 0; u < width; ++u) {
+      for (int c = 0; c < 4; ++c) {
+        color_image.at(u, v)[c] = static_cast<uint8_t>(u * 17 + v * 5 + c);
+      }
+      depth16_image.at(u, v)[0] = static_cast<uint16_t>(1000 + 300 * v + u);
+      depth32_image.at(u, v)[0] = depth16_image.at(u, v)[0] / 1e3;
+    }
+  }
+
+  using Method = ImageCompressionParams::Method;
+  for (const Method method : {Method::kNone, Method::kZlib, Method::kPng}) {
+    for (const bool is_32f : {false, true}) {
+      ImageCompressionParams compression;
+      compression.method = method;
+      compression.run_length_only = is_32f;
+      compression.num_threads = 2;
+      ImageToLcmImageArrayT encoder(compression);
+      const auto& color_port =
+          encoder.DeclareImageInputPort<PixelType::kRgba8U>("color");
+      const InputPort<double>& depth_port =
+          is_32f ? encoder.DeclareImageInputPort<PixelType::kDepth32F>("depth")
+                 : encoder.DeclareImageInputPort<PixelType::kDepth16U>("depth");
+      auto encoder_context = encoder.CreateDefaultContext();
+      color_port.FixValue(encoder_context.get(), color_image);
+      if (is_32f) {
+        depth_port.FixValue(encoder_context.get(), depth32_image);
+      } else {
+        depth_port.FixValue(encoder_context.get(), depth16_image);
+      }
+      const auto& lcm_images =
+          encoder.image_array_t_msg_output_port().Eval<lcmt_image_array>(
+              *encoder_context);
+
+      LcmImageArrayToImages dut;
+      ImageRgba8U decoded_color_image;
+      ImageDepth32F decoded_depth_image;
+      DecodeImageArray(&dut, lcm_images, &decoded_color_image,
+                       &decoded_depth_image);
+      EXPECT_EQ(decoded_color_image, color_image);
+      // The 16-bit depths, in millimeters, are decoded to meters.
+      ASSERT_EQ(decoded_depth_image.width(), width);
+      ASSERT_EQ(decoded_depth_image.height(), height);
+      for (int v = 0; v < height; ++v) {
+        for (int u = 0; u < width; ++u) {
+          const float expected_depth =
+              is_32f ? depth32_image.at(u, v)[0]
+                     : static_cast<float>(depth16_image.at(u, v)[0]) / 1e3;
+          EXPECT_EQ(decoded_depth_image.at(u, v)[0], expected_depth);
+        }
+      }
+    }
+  }
+}
+
 }  // namespace
 }  // namespace sensors
 }  // namespace systems